@@ -43,6 +43,10 @@
 #include "../mist.h"
 #endif
 
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+
 #ifndef __INCLUDE_FFT_UTIL_H__
 #include "fft_util.h"
 #endif
@@ -61,6 +65,7 @@
 #include "fftsg.h"
 #include "fftsg2d.h"
 #include "fftsg3d.h"
+#include "mixed_radix.h"
 
 // mistOԂ̎n܂
 _MIST_BEGIN
@@ -81,7 +86,7 @@ _MIST_BEGIN
 /// @brief 1RTCϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̔z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
@@ -92,7 +97,7 @@ _MIST_BEGIN
 template < class T1, class T2, class Allocator1, class Allocator2 >
 bool dct( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -122,7 +127,14 @@ bool dct( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::ddct( static_cast<int>( in.size() ), -1, data, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	{
+		ooura_fft::ddct( static_cast<int>( in.size() ), -1, data, ip, w );
+	}
+	else
+	{
+		__mixed_radix__::ddct( in.size( ), -1, data );
+	}
 
 
 	out.resize( in.size( ) );
@@ -142,7 +154,7 @@ bool dct( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 /// @brief 1RTCtϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
@@ -152,7 +164,7 @@ bool dct( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 template < class T1, class T2, class Allocator1, class Allocator2 >
 bool idct( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -183,7 +195,14 @@ bool idct( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 	ip[ 0 ] = 0;
 	data[ 0 ] *= 0.5;
 
-	ooura_fft::ddct(  static_cast<int>( in.size() ), 1, data, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	{
+		ooura_fft::ddct( static_cast<int>( in.size() ), 1, data, ip, w );
+	}
+	else
+	{
+		__mixed_radix__::ddct( in.size( ), 1, data );
+	}
 
 
 	out.resize( in.size( ) );
@@ -203,18 +222,19 @@ bool idct( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 /// @brief 2RTCϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool dct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+bool dct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) || !__fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -223,10 +243,15 @@ bool dct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 	size_type i, j, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
 	__fft_util__::FFT_MEMORY2 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
-									4 * in.width( ) * FFT2D_MAX_THREADS,
+									4 * in.width( ) * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -250,7 +275,14 @@ bool dct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::ddct2d(  static_cast<int>( in.width( ) ), static_cast<int>( in.height( ) ), -1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) && __fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	{
+		ooura_fft::ddct2d( static_cast<int>( in.width( ) ), static_cast<int>( in.height( ) ), -1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddct2d( in.width( ), in.height( ), -1, data, thread_num );
+	}
 
 
 	out.resize( in.width( ), in.height( ) );
@@ -274,17 +306,18 @@ bool dct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 /// @brief 2RTCtϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool idct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+bool idct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) || !__fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -293,10 +326,15 @@ bool idct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 	size_type i, j, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
 	__fft_util__::FFT_MEMORY2 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
-									4 * in.width( ) * FFT2D_MAX_THREADS,
+									4 * in.width( ) * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -332,7 +370,14 @@ bool idct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 	}
 
 
-	ooura_fft::ddct2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), 1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) && __fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	{
+		ooura_fft::ddct2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), 1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddct2d( in.width( ), in.height( ), 1, data, thread_num );
+	}
 
 
 	out.resize( in.width( ), in.height( ) );
@@ -356,33 +401,38 @@ bool idct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 /// @brief 3RTCϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool dct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+bool dct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.height( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
 
 	typedef typename Allocator1::size_type size_type;
 	size_type i, j, k, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
+	size = size > in.depth( ) ? size : in.depth( );
 	__fft_util__::FFT_MEMORY3 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
 									in.depth( ),
-									4 * size * FFT3D_MAX_THREADS,
+									4 * size * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -409,7 +459,16 @@ bool dct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::ddct3d( static_cast<int>( in.width( ) ), static_cast<int>( in.height( ) ), static_cast<int>( in.depth( ) ), -1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.height( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	{
+		ooura_fft::ddct3d( static_cast<int>( in.width( ) ), static_cast<int>( in.height( ) ), static_cast<int>( in.depth( ) ), -1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddct3d( in.width( ), in.height( ), in.depth( ), -1, data, thread_num );
+	}
 
 
 	out.resize( in.width( ), in.height( ), in.depth( ) );
@@ -435,32 +494,37 @@ bool dct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 /// @brief 3RTCtϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool idct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+bool idct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.height( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
 
 	typedef typename Allocator1::size_type size_type;
 	size_type i, j, k, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
+	size = size > in.depth( ) ? size : in.depth( );
 	__fft_util__::FFT_MEMORY3 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
 									in.depth( ),
-									4 * size * FFT3D_MAX_THREADS,
+									4 * size * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -509,7 +573,16 @@ bool idct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::ddct3d( static_cast<int>( in.width( ) ), static_cast<int>( in.height( ) ), static_cast<int>( in.depth( ) ), 1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.height( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	{
+		ooura_fft::ddct3d( static_cast<int>( in.width( ) ), static_cast<int>( in.height( ) ), static_cast<int>( in.depth( ) ), 1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddct3d( in.width( ), in.height( ), in.depth( ), 1, data, thread_num );
+	}
 
 	out.resize( in.width( ), in.height( ), in.depth( ) );
 
@@ -529,6 +602,291 @@ bool idct( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 	return( true );
 }
 
+
+namespace __dct__
+{
+	// 傫 N ̐KDCT-IIs C[ u * N + x ] = a( u ) cos( ( 2x + 1 ) u / 2N ) 쐬
+	inline void make_dct_matrix( std::vector< double > &c, size_t N )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		c.resize( N * N );
+		for( size_t u = 0 ; u < N ; u++ )
+		{
+			double a = std::sqrt( ( u == 0 ? 1.0 : 2.0 ) / static_cast< double >( N ) );
+			for( size_t x = 0 ; x < N ; x++ )
+			{
+				c[ u * N + x ] = a * std::cos( pi * static_cast< double >( ( 2 * x + 1 ) * u ) / static_cast< double >( 2 * N ) );
+			}
+		}
+	}
+
+	// N ~ N ̃ubN bix Aj̊esƊeɍs m |
+	// s r[ y ][ : ] = k b[ y ][ k ] m[ k ][ : ]C b[ v ][ : ] = k m[ k ][ v ] r[ k ][ : ] ƂD
+	// œ[v͒ N ̘AϘaɂȂ邽߁CRpCɂxNg
+	template < size_t N >
+	inline void transform_block( const double *m, double *b )
+	{
+		double r[ N * N ];
+
+		for( size_t y = 0 ; y < N ; y++ )
+		{
+			double *ry = r + y * N;
+			const double *by = b + y * N;
+			for( size_t i = 0 ; i < N ; i++ )
+			{
+				ry[ i ] = 0.0;
+			}
+			for( size_t k = 0 ; k < N ; k++ )
+			{
+				const double v = by[ k ];
+				const double *mk = m + k * N;
+				for( size_t i = 0 ; i < N ; i++ )
+				{
+					ry[ i ] += v * mk[ i ];
+				}
+			}
+		}
+
+		for( size_t v = 0 ; v < N ; v++ )
+		{
+			double *bv = b + v * N;
+			for( size_t i = 0 ; i < N ; i++ )
+			{
+				bv[ i ] = 0.0;
+			}
+			for( size_t k = 0 ; k < N ; k++ )
+			{
+				const double c = m[ k * N + v ];
+				const double *rk = r + k * N;
+				for( size_t i = 0 ; i < N ; i++ )
+				{
+					bv[ i ] += c * rk[ i ];
+				}
+			}
+		}
+	}
+
+	// width ~ height ̉摜 data ̃ubNs first`last-1 ϊ
+	template < size_t N >
+	inline void transform_blocks( double *data, size_t width, const double *m, size_t first, size_t last )
+	{
+		double b[ N * N ];
+
+		for( size_t by = first ; by < last ; by++ )
+		{
+			for( size_t bx = 0 ; bx < width / N ; bx++ )
+			{
+				double *p = data + by * N * width + bx * N;
+
+				for( size_t y = 0 ; y < N ; y++ )
+				{
+					for( size_t x = 0 ; x < N ; x++ )
+					{
+						b[ y * N + x ] = p[ y * width + x ];
+					}
+				}
+
+				transform_block< N >( m, b );
+
+				for( size_t y = 0 ; y < N ; y++ )
+				{
+					for( size_t x = 0 ; x < N ; x++ )
+					{
+						p[ y * width + x ] = b[ y * N + x ];
+					}
+				}
+			}
+		}
+	}
+
+	// ubNsƂɕăubNDCTvZXbh
+	class block_dct_thread : public mist::thread< block_dct_thread >
+	{
+	public:
+		typedef mist::thread< block_dct_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+
+	private:
+		double *data_;
+		size_type width_;
+		size_type height_;
+		size_type block_size_;
+		const double *matrix_;
+		size_type thread_id_;
+		size_type thread_num_;
+
+	public:
+		void setup_parameters( double *data, size_type width, size_type height, size_type block_size, const double *matrix, size_type thread_id, size_type thread_num )
+		{
+			data_       = data;
+			width_      = width;
+			height_     = height;
+			block_size_ = block_size;
+			matrix_     = matrix;
+			thread_id_  = thread_id;
+			thread_num_ = thread_num;
+		}
+
+		const block_dct_thread& operator =( const block_dct_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				data_ = p.data_;
+				width_ = p.width_;
+				height_ = p.height_;
+				block_size_ = p.block_size_;
+				matrix_ = p.matrix_;
+				thread_id_ = p.thread_id_;
+				thread_num_ = p.thread_num_;
+			}
+			return( *this );
+		}
+
+		block_dct_thread( ) : data_( NULL ), width_( 0 ), height_( 0 ), block_size_( 8 ), matrix_( NULL ), thread_id_( 0 ), thread_num_( 1 )
+		{
+		}
+
+		block_dct_thread( const block_dct_thread &p ) : base( p ), data_( p.data_ ), width_( p.width_ ), height_( p.height_ ), block_size_( p.block_size_ ),
+														matrix_( p.matrix_ ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			size_type rows = height_ / block_size_;
+			size_type first = rows * thread_id_ / thread_num_;
+			size_type last = rows * ( thread_id_ + 1 ) / thread_num_;
+
+			switch( block_size_ )
+			{
+			case 4:
+				transform_blocks< 4 >( data_, width_, matrix_, first, last );
+				break;
+
+			case 8:
+				transform_blocks< 8 >( data_, width_, matrix_, first, last );
+				break;
+
+			case 16:
+				transform_blocks< 16 >( data_, width_, matrix_, first, last );
+				break;
+
+			default:
+				break;
+			}
+
+			return( 0 );
+		}
+	};
+
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	bool block_transform( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, size_t block_size, bool inverse, size_t thread_num )
+	{
+		if( in.empty( ) || ( block_size != 4 && block_size != 8 && block_size != 16 ) )
+		{
+			return( false );
+		}
+		else if( in.width( ) % block_size != 0 || in.height( ) % block_size != 0 )
+		{
+			return( false );
+		}
+
+		size_t width = in.width( ), height = in.height( );
+		std::vector< double > data( in.size( ) ), c, m( block_size * block_size );
+
+		for( size_t i = 0 ; i < in.size( ) ; i++ )
+		{
+			data[ i ] = __fft_util__::convert_complex< T1 >::convert_to( in[ i ] ).real( );
+		}
+
+		// ϊ m[ x ][ u ] = C[ u ][ x ]iC ̓]ujCtϊ m = C Ƃ
+		make_dct_matrix( c, block_size );
+		for( size_t u = 0 ; u < block_size ; u++ )
+		{
+			for( size_t x = 0 ; x < block_size ; x++ )
+			{
+				m[ x * block_size + u ] = inverse ? c[ x * block_size + u ] : c[ u * block_size + x ];
+			}
+		}
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_t >( get_cpu_num( ) );
+		}
+		if( thread_num > height / block_size )
+		{
+			thread_num = height / block_size;
+		}
+
+		block_dct_thread *thread = new block_dct_thread[ thread_num ];
+		for( size_t i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_parameters( &data[ 0 ], width, height, block_size, &m[ 0 ], i, thread_num );
+		}
+		do_threads( thread, thread_num );
+		delete [] thread;
+
+		out.resize( width, height );
+		for( size_t i = 0 ; i < out.size( ) ; i++ )
+		{
+			out[ i ] = __fft_util__::convert_complex< T2 >::convert_from_real( data[ i ] );
+		}
+
+		return( true );
+	}
+}
+
+
+/// @brief 摜ubNɕ2URTCϊ
+//! 
+//! 摜 block_size ~ block_size ̃ubNɕCeubN𐳋KDCT-IIŕϊiJPEGƓ`jD
+//! 
+//! \f[
+//!     F( u, v ) = a( u ) a( v ) \sum^{N-1}_{y=0}\sum^{N-1}_{x=0} f( x, y ) \cos\frac{( 2x + 1 )u\pi}{2N} \cos\frac{( 2y + 1 )v\pi}{2N}
+//! \f]
+//! C\f$ a( 0 ) = \sqrt{1/N} \f$C\f$ a( k ) = \sqrt{2/N} \f$ ƂCeubŇW͉摜̓ʒuɊi[D
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention 摜̑傫̓ubN̑傫̔{łȂ΂ȂȂ
+//! @attention o݂͂̂̉摜z̏ꍇ́CťWԂ
+//! 
+//! @param[in]  in         c ͉摜
+//! @param[out] out        c o͉摜iubNƂDCTWj
+//! @param[in]  block_size c ubN̑傫i4C8C16̂ꂩj
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool block_dct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type block_size = 8, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
+{
+	return( __dct__::block_transform( in, out, block_size, false, thread_num ) );
+}
+
+
+/// @brief ubNƂ2URTCtϊiblock_dct ̋tϊj
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention 摜̑傫̓ubN̑傫̔{łȂ΂ȂȂ
+//! 
+//! @param[in]  in         c ͉摜iubNƂDCTWj
+//! @param[out] out        c o͉摜
+//! @param[in]  block_size c ubN̑傫i4C8C16̂ꂩj
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool block_idct( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type block_size = 8, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
+{
+	return( __dct__::block_transform( in, out, block_size, true, thread_num ) );
+}
+
+
 /// @}
 //  DCT O[v̏I
 
@@ -43,6 +43,10 @@
 #include "../mist.h"
 #endif
 
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+
 #ifndef __INCLUDE_FFT_UTIL_H__
 #include "fft_util.h"
 #endif
@@ -60,6 +64,7 @@
 #include "fftsg.h"
 #include "fftsg2d.h"
 #include "fftsg3d.h"
+#include "mixed_radix.h"
 
 // mistOԂ̎n܂
 _MIST_BEGIN
@@ -81,7 +86,7 @@ _MIST_BEGIN
 /// @brief 1TCϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̔z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
@@ -92,7 +97,7 @@ _MIST_BEGIN
 template < class T1, class T2, class Allocator1, class Allocator2 >
 bool dst( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -122,7 +127,14 @@ bool dst( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::ddst( static_cast< int >( in.size( ) ), -1, data, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	{
+		ooura_fft::ddst( static_cast< int >( in.size( ) ), -1, data, ip, w );
+	}
+	else
+	{
+		__mixed_radix__::ddst( in.size( ), -1, data );
+	}
 
 
 	out.resize( in.size( ) );
@@ -144,7 +156,7 @@ bool dst( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 /// @brief 1TCtϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
@@ -154,7 +166,7 @@ bool dst( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 template < class T1, class T2, class Allocator1, class Allocator2 >
 bool idst( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -187,7 +199,14 @@ bool idst( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 	ip[ 0 ] = 0;
 	data[ 0 ] *= 0.5;
 
-	ooura_fft::ddst( static_cast< int >( in.size( ) ), 1, data, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	{
+		ooura_fft::ddst( static_cast< int >( in.size( ) ), 1, data, ip, w );
+	}
+	else
+	{
+		__mixed_radix__::ddst( in.size( ), 1, data );
+	}
 
 
 	out.resize( in.size( ) );
@@ -207,18 +226,19 @@ bool idst( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 /// @brief 2TCϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool dst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+bool dst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) || !__fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -227,10 +247,15 @@ bool dst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 	size_type i, j, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
 	__fft_util__::FFT_MEMORY2 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
-									4 * in.width( ) * FFT2D_MAX_THREADS,
+									4 * in.width( ) * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -254,7 +279,14 @@ bool dst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::ddst2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), -1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) && __fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	{
+		ooura_fft::ddst2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), -1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddst2d( in.width( ), in.height( ), -1, data, thread_num );
+	}
 
 
 	out.resize( in.width( ), in.height( ) );
@@ -277,17 +309,18 @@ bool dst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 /// @brief 2TCtϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool idst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+bool idst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) || !__fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -296,10 +329,15 @@ bool idst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 	size_type i, j, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
 	__fft_util__::FFT_MEMORY2 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
-									4 * in.width( ) * FFT2D_MAX_THREADS,
+									4 * in.width( ) * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -333,7 +371,14 @@ bool idst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 		data[ 0 ][ j ] *= 0.5;
 	}
 
-	ooura_fft::ddst2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), 1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) && __fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	{
+		ooura_fft::ddst2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), 1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddst2d( in.width( ), in.height( ), 1, data, thread_num );
+	}
 
 
 	out.resize( in.width( ), in.height( ) );
@@ -356,33 +401,38 @@ bool idst( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 /// @brief 3TCϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool dst( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+bool dst( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.height( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
 
 	typedef typename Allocator1::size_type size_type;
 	size_type i, j, k, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
+	size = size > in.depth( ) ? size : in.depth( );
 	__fft_util__::FFT_MEMORY3 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
 									in.depth( ),
-									4 * size * FFT3D_MAX_THREADS,
+									4 * size * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -409,7 +459,16 @@ bool dst( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::ddst3d(  static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) ), -1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.height( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	{
+		ooura_fft::ddst3d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) ), -1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddst3d( in.width( ), in.height( ), in.depth( ), -1, data, thread_num );
+	}
 
 
 	out.resize( in.width( ), in.height( ), in.depth( ) );
@@ -435,32 +494,37 @@ bool dst( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 /// @brief 3TCtϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool idst( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+bool idst( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.height( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
 
 	typedef typename Allocator1::size_type size_type;
 	size_type i, j, k, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
+	size = size > in.depth( ) ? size : in.depth( );
 	__fft_util__::FFT_MEMORY3 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
 									in.depth( ),
-									4 * size * FFT3D_MAX_THREADS,
+									4 * size * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size / 2 ) ) + 3 ),
 									size * 3 / 2 ) )
 	{
@@ -509,7 +573,16 @@ bool idst( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 		}
 	}
 
-	ooura_fft::ddst3d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) ), 1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.height( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	{
+		ooura_fft::ddst3d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) ), 1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::ddst3d( in.width( ), in.height( ), in.depth( ), 1, data, thread_num );
+	}
 
 	out.resize( in.width( ), in.height( ), in.depth( ) );
 
@@ -65,6 +65,7 @@
 #include "fftsg.h"
 #include "fftsg2d.h"
 #include "fftsg3d.h"
+#include "mixed_radix.h"
 
 // mistOԂ̎n܂
 _MIST_BEGIN
@@ -83,112 +84,765 @@ _MIST_BEGIN
 
 
 
-template < class T1, class T2, class Allocator1, class Allocator2 >
-bool _fft( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
+namespace __fft_util__
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+	// fft_plan ̋ʕ
+	// f[^ MIST ̔zƓ x A std::complex< double > ̕тƂĈ
+	class fft_plan_base
 	{
-		return( false );
+	protected:
+		typedef std::complex< double > complex_type;
+
+		size_t dimension_;
+		size_t width_;
+		size_t height_;
+		size_t depth_;
+		size_t thread_num_;
+		bool power_of_two_;
+
+		std::vector< int > ip_;							// YFFT̃rbg]pƗ̈iip[ 0 ] ͏̂ 0 ɂj
+		std::vector< double > w_;						// YFFT̎Op֐\icos/sinj
+		std::vector< double > t_;						// Y2E3FFT̍Ɨ̈
+		__mixed_radix__::line_transform transform_[ 3 ];	// 2̎włȂꍇ z, y, x ̕ϊ
+		std::vector< complex_type > work_;				// 2̎włȂ1ϊ̍Ɨ̈
+		std::vector< double * > rows_;
+		std::vector< double ** > planes_;
+		std::vector< complex_type > buffer_;			// std::complex< double > ȊO̔zϊۂ̍Ɨ̈
+
+		void initialize( size_t dimension, size_t width, size_t height, size_t depth, size_t thread_num )
+		{
+			dimension_  = dimension;
+			width_      = width;
+			height_     = dimension > 1 ? height : 1;
+			depth_      = dimension > 2 ? depth : 1;
+			thread_num_ = thread_num == 0 ? static_cast< size_t >( get_cpu_num( ) ) : thread_num;
+
+			ip_.clear( );
+			w_.clear( );
+			t_.clear( );
+			work_.clear( );
+			for( size_t i = 0 ; i < 3 ; i++ )
+			{
+				transform_[ i ] = __mixed_radix__::line_transform( );
+			}
+
+			power_of_two_ = size_check( static_cast< unsigned int >( width_ ) ) &&
+							( dimension < 2 || size_check( static_cast< unsigned int >( height_ ) ) ) &&
+							( dimension < 3 || size_check( static_cast< unsigned int >( depth_ ) ) );
+
+			size_t size = width_ > height_ ? width_ : height_;
+			size = size > depth_ ? size : depth_;
+
+			rows_.resize( height_ * depth_ );
+			planes_.resize( depth_ );
+
+			if( width_ * height_ * depth_ == 0 )
+			{
+				return;
+			}
+			else if( power_of_two_ )
+			{
+				// Op֐\͍ŏ̕ϊɍ쐬Cȍ~͎g񂳂
+				ip_.resize( static_cast< size_t >( std::sqrt( static_cast< double >( size ) ) + 3 ) );
+				w_.resize( size / 2 + 1 );
+				ip_[ 0 ] = 0;
+
+				if( dimension_ == 2 )
+				{
+					t_.resize( 8 * height_ * thread_num_ );
+				}
+				else if( dimension_ == 3 )
+				{
+					t_.resize( 8 * ( height_ > depth_ ? height_ : depth_ ) * thread_num_ );
+				}
+			}
+			else if( dimension_ == 1 )
+			{
+				transform_[ 2 ].initialize( __mixed_radix__::CDFT, width_ );
+				work_.resize( transform_[ 2 ].work_size( ) );
+			}
+			else
+			{
+				transform_[ 2 ].initialize( __mixed_radix__::CDFT, width_ );
+				transform_[ 1 ] = height_ == width_ ? transform_[ 2 ] : __mixed_radix__::line_transform( __mixed_radix__::CDFT, height_ );
+				if( dimension_ > 2 )
+				{
+					transform_[ 0 ] = depth_ == width_ ? transform_[ 2 ] : ( depth_ == height_ ? transform_[ 1 ] : __mixed_radix__::line_transform( __mixed_radix__::CDFT, depth_ ) );
+				}
+			}
+		}
+
+		// data ̏ŕϊiKȂj
+		void transform( complex_type *data, int isgn )
+		{
+			double *a = reinterpret_cast< double * >( data );
+
+			if( dimension_ == 1 )
+			{
+				if( power_of_two_ )
+				{
+					ooura_fft::cdft( static_cast< int >( width_ * 2 ), isgn, a, &ip_[ 0 ], &w_[ 0 ] );
+				}
+				else
+				{
+					transform_[ 2 ]( a, isgn, &work_[ 0 ] );
+				}
+				return;
+			}
+
+			for( size_t k = 0 ; k < depth_ ; k++ )
+			{
+				for( size_t j = 0 ; j < height_ ; j++ )
+				{
+					rows_[ j + k * height_ ] = a + ( j + k * height_ ) * width_ * 2;
+				}
+				planes_[ k ] = &rows_[ k * height_ ];
+			}
+
+			if( !power_of_two_ )
+			{
+				__mixed_radix__::transform3d( transform_[ 0 ], transform_[ 1 ], transform_[ 2 ], depth_, height_, width_, isgn, &planes_[ 0 ], thread_num_ );
+			}
+			else if( dimension_ == 2 )
+			{
+				ooura_fft::cdft2d( static_cast< int >( height_ ), static_cast< int >( width_ * 2 ), isgn, &rows_[ 0 ], &t_[ 0 ], &ip_[ 0 ], &w_[ 0 ], static_cast< int >( thread_num_ ) );
+			}
+			else
+			{
+				ooura_fft::cdft3d( static_cast< int >( depth_ ), static_cast< int >( height_ ), static_cast< int >( width_ * 2 ), isgn, &planes_[ 0 ], &t_[ 0 ], &ip_[ 0 ], &w_[ 0 ], static_cast< int >( thread_num_ ) );
+			}
+		}
+
+		template < class T, class Allocator >
+		void load( const array< T, Allocator > &in )
+		{
+			buffer_.resize( in.size( ) );
+			for( size_t i = 0 ; i < in.size( ) ; i++ )
+			{
+				buffer_[ i ] = convert_complex< T >::convert_to( in[ i ] );
+			}
+		}
+
+		template < class T, class Allocator >
+		void store( array< T, Allocator > &out, double scale ) const
+		{
+			for( size_t i = 0 ; i < out.size( ) ; i++ )
+			{
+				out[ i ] = convert_complex< T >::convert_from( buffer_[ i ].real( ) * scale, buffer_[ i ].imag( ) * scale );
+			}
+		}
+
+		template < class Allocator >
+		void normalize( array< complex_type, Allocator > &data ) const
+		{
+			double scale = 1.0 / static_cast< double >( data.size( ) );
+			for( size_t i = 0 ; i < data.size( ) ; i++ )
+			{
+				data[ i ] *= scale;
+			}
+		}
+
+		fft_plan_base( ) : dimension_( 1 ), width_( 0 ), height_( 1 ), depth_( 1 ), thread_num_( 1 ), power_of_two_( false )
+		{
+		}
+	};
+}
+
+
+/// @brief 傫̍t[GϊJԂvZ邽߂̃NX
+//!
+//! Op֐\ƍƗ̈ŏɈx쐬Cȍ~̕ϊŎg񂷁D
+//! std::complex< double > ̔z̓Rs[ɂ̏ŕϊD
+//! 傫2̎włȂꍇ́CFFT܂Bluestein@pD
+//!
+//! @code gp
+//! mist::fft_plan< 2 > plan( 512, 400 );
+//! mist::array2< std::complex< double > > img( 512, 400 );
+//!
+//! plan.fft( img );        // img ̏Ńt[Gϊ
+//! plan.ifft( img );       // img ̏ŋtt[Gϊ
+//! plan.fft( in, out );    // Cӂ̌^̔zϊ
+//! @endcode
+//!
+//! @attention 1̃IuWFNg𕡐̃Xbh瓯Ɏgp邱Ƃ͂łȂ
+//!
+//! @param DIMENSION c ϊ̎i1`3j
+//!
+template < size_t DIMENSION >
+class fft_plan;
+
+
+/// @brief 1t[GϊJԂvZ邽߂̃NX
+template < >
+class fft_plan< 1 > : protected __fft_util__::fft_plan_base
+{
+public:
+	typedef size_t size_type;	///< @brief Ȃ̐\^
+
+public:
+	/// @brief ϊf[^̑傫ύXCOp֐\蒼
+	void resize( size_type size )
+	{
+		initialize( 1, size, 1, 1, 1 );
 	}
 
-	// 1t[Gϊ
-	typedef typename Allocator1::size_type size_type;
-	size_type i;
-	__fft_util__::FFT_MEMORY1 mem;
+	/// @brief ϊf[^̑傫
+	size_type size( ) const { return( width_ ); }
+
+	/// @brief data ̏Ńt[Gϊ
+	//!
+	//! @param[in,out] data c o̓f[^
+	//!
+	//! @return ϊɐǂi傫قȂꍇ͎sj
+	//!
+	template < class Allocator >
+	bool fft( array< std::complex< double >, Allocator > &data )
+	{
+		if( data.empty( ) || data.size( ) != size( ) )
+		{
+			return( false );
+		}
 
-	if( !__fft_util__::allocate_memory( mem,
-									in.size( ) * 2,
-									static_cast< size_t >( std::sqrt( static_cast< double >( in.size( ) ) ) + 3 ),
-									in.size( ) / 2 ) )
+		transform( &data[ 0 ], -1 );
+		return( true );
+	}
+
+	/// @brief data ̏ŋtt[Gϊ
+	//!
+	//! @param[in,out] data c o̓f[^
+	//!
+	//! @return ϊɐǂi傫قȂꍇ͎sj
+	//!
+	template < class Allocator >
+	bool ifft( array< std::complex< double >, Allocator > &data )
 	{
-		__fft_util__::deallocate_memory( mem );
-		return( false );
+		if( data.empty( ) || data.size( ) != size( ) )
+		{
+			return( false );
+		}
+
+		transform( &data[ 0 ], 1 );
+		normalize( data );
+		return( true );
 	}
 
-	double *data	= mem.data;
-	double *w		= mem.w;
-	int    *ip		= mem.ip;
+	/// @brief 1t[Gϊ
+	//!
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//! @attention o݂͂̂̔z̏ꍇ́Cp[Ԃ
+	//!
+	//! @param[in]  in  c ̓f[^
+	//! @param[out] out c o̓f[^
+	//!
+	//! @return ϊɐǂi傫قȂꍇ͎sj
+	//!
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	bool fft( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
+	{
+		if( in.empty( ) || in.size( ) != size( ) )
+		{
+			return( false );
+		}
+
+		load( in );
+		transform( &buffer_[ 0 ], -1 );
+		out.resize( size( ) );
+		store( out, 1.0 );
+		return( true );
+	}
 
-	for( i = 0 ; i < in.size( ) ; i++ )
+	/// @brief 1tt[Gϊ
+	//!
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//!
+	//! @param[in]  in  c ̓f[^
+	//! @param[out] out c o̓f[^
+	//!
+	//! @return ϊɐǂi傫قȂꍇ͎sj
+	//!
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	bool ifft( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
 	{
-		std::complex< double > c( __fft_util__::convert_complex< T1 >::convert_to( in[ i ] ) );
-		data[ i * 2 ]     = c.real( );
-		data[ i * 2 + 1 ] = c.imag( );
+		if( in.empty( ) || in.size( ) != size( ) )
+		{
+			return( false );
+		}
+
+		load( in );
+		transform( &buffer_[ 0 ], 1 );
+		out.resize( size( ) );
+		store( out, 1.0 / size( ) );
+		return( true );
 	}
 
-	ip[ 0 ] = 0;
+	/// @brief 傫 size ̕ϊ
+	fft_plan( size_type size = 0 )
+	{
+		resize( size );
+	}
+};
 
-	ooura_fft::cdft( static_cast< int >( in.size( ) * 2 ), -1, data, ip, w );
 
-	out.resize( in.size( ) );
+/// @brief 2t[GϊJԂvZ邽߂̃NX
+template < >
+class fft_plan< 2 > : protected __fft_util__::fft_plan_base
+{
+public:
+	typedef size_t size_type;	///< @brief Ȃ̐\^
+
+public:
+	/// @brief ϊf[^̑傫ύXCOp֐\蒼
+	//!
+	//! @param[in] width      c X̑傫
+	//! @param[in] height     c Y̑傫
+	//! @param[in] thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+	//!
+	void resize( size_type width, size_type height, size_type thread_num = 0 )
+	{
+		initialize( 2, width, height, 1, thread_num );
+	}
+
+	size_type width( ) const { return( width_ ); }		///< @brief X̑傫
+	size_type height( ) const { return( height_ ); }	///< @brief Y̑傫
+	size_type size( ) const { return( width_ * height_ ); }	///< @brief vf
 
-	for( i = 0 ; i < out.size( ) ; i++ )
+	/// @brief data ̏Ńt[Gϊ
+	template < class Allocator >
+	bool fft( array2< std::complex< double >, Allocator > &data )
 	{
-		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from( data[ 2 * i ], data[ 2 * i + 1 ] );
+		if( data.empty( ) || data.width( ) != width( ) || data.height( ) != height( ) || data.size( ) != size( ) )
+		{
+			return( false );
+		}
+
+		transform( &data[ 0 ], -1 );
+		return( true );
 	}
 
-	__fft_util__::deallocate_memory( mem );
+	/// @brief data ̏ŋtt[Gϊ
+	template < class Allocator >
+	bool ifft( array2< std::complex< double >, Allocator > &data )
+	{
+		if( data.empty( ) || data.width( ) != width( ) || data.height( ) != height( ) || data.size( ) != size( ) )
+		{
+			return( false );
+		}
 
-	return( true );
-}
+		transform( &data[ 0 ], 1 );
+		normalize( data );
+		return( true );
+	}
 
+	/// @brief 2t[Gϊi͂Əo͓͂MISTReiIuWFNgł悢j
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	bool fft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+	{
+		if( in.empty( ) || in.width( ) != width( ) || in.height( ) != height( ) || in.size( ) != size( ) )
+		{
+			return( false );
+		}
 
+		load( in );
+		transform( &buffer_[ 0 ], -1 );
+		out.resize( width( ), height( ) );
+		store( out, 1.0 );
+		return( true );
+	}
 
-template < class T1, class T2, class Allocator1, class Allocator2 >
-bool _ifft( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
+	/// @brief 2tt[Gϊi͂Əo͓͂MISTReiIuWFNgł悢j
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	bool ifft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+	{
+		if( in.empty( ) || in.width( ) != width( ) || in.height( ) != height( ) || in.size( ) != size( ) )
+		{
+			return( false );
+		}
+
+		load( in );
+		transform( &buffer_[ 0 ], 1 );
+		out.resize( width( ), height( ) );
+		store( out, 1.0 / size( ) );
+		return( true );
+	}
+
+	/// @brief 傫 width ~ height ̕ϊ
+	fft_plan( size_type width = 0, size_type height = 0, size_type thread_num = 0 )
+	{
+		resize( width, height, thread_num );
+	}
+};
+
+
+/// @brief 3t[GϊJԂvZ邽߂̃NX
+template < >
+class fft_plan< 3 > : protected __fft_util__::fft_plan_base
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.size( ) ) )
+public:
+	typedef size_t size_type;	///< @brief Ȃ̐\^
+
+public:
+	/// @brief ϊf[^̑傫ύXCOp֐\蒼
+	//!
+	//! @param[in] width      c X̑傫
+	//! @param[in] height     c Y̑傫
+	//! @param[in] depth      c Z̑傫
+	//! @param[in] thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+	//!
+	void resize( size_type width, size_type height, size_type depth, size_type thread_num = 0 )
 	{
-		return( false );
+		initialize( 3, width, height, depth, thread_num );
 	}
 
-	// 1t[Gϊ
-	typedef typename Allocator1::size_type size_type;
-	size_type i;
-	__fft_util__::FFT_MEMORY1 mem;
+	size_type width( ) const { return( width_ ); }		///< @brief X̑傫
+	size_type height( ) const { return( height_ ); }	///< @brief Y̑傫
+	size_type depth( ) const { return( depth_ ); }		///< @brief Z̑傫
+	size_type size( ) const { return( width_ * height_ * depth_ ); }	///< @brief vf
 
-	if( !__fft_util__::allocate_memory( mem,
-									in.size( ) * 2,
-									static_cast< size_t >( std::sqrt( static_cast< double >( in.size( ) ) ) + 3 ),
-									in.size( ) / 2 ) )
+	/// @brief data ̏Ńt[Gϊ
+	template < class Allocator >
+	bool fft( array3< std::complex< double >, Allocator > &data )
 	{
-		__fft_util__::deallocate_memory( mem );
-		return( false );
+		if( data.empty( ) || data.width( ) != width( ) || data.height( ) != height( ) || data.depth( ) != depth( ) )
+		{
+			return( false );
+		}
+
+		transform( &data[ 0 ], -1 );
+		return( true );
 	}
 
-	double *data	= mem.data;
-	double *w		= mem.w;
-	int    *ip		= mem.ip;
+	/// @brief data ̏ŋtt[Gϊ
+	template < class Allocator >
+	bool ifft( array3< std::complex< double >, Allocator > &data )
+	{
+		if( data.empty( ) || data.width( ) != width( ) || data.height( ) != height( ) || data.depth( ) != depth( ) )
+		{
+			return( false );
+		}
+
+		transform( &data[ 0 ], 1 );
+		normalize( data );
+		return( true );
+	}
 
-	for( i = 0 ; i < in.size( ) ; i++ )
+	/// @brief 3t[Gϊi͂Əo͓͂MISTReiIuWFNgł悢j
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	bool fft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 	{
-		std::complex< double > c( __fft_util__::convert_complex< T1 >::convert_to( in[ i ] ) );
-		data[ i * 2 ]     = c.real( );
-		data[ i * 2 + 1 ] = c.imag( );
+		if( in.empty( ) || in.width( ) != width( ) || in.height( ) != height( ) || in.depth( ) != depth( ) )
+		{
+			return( false );
+		}
+
+		load( in );
+		transform( &buffer_[ 0 ], -1 );
+		out.resize( width( ), height( ), depth( ) );
+		store( out, 1.0 );
+		return( true );
 	}
 
-	ip[ 0 ] = 0;
+	/// @brief 3tt[Gϊi͂Əo͓͂MISTReiIuWFNgł悢j
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	bool ifft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+	{
+		if( in.empty( ) || in.width( ) != width( ) || in.height( ) != height( ) || in.depth( ) != depth( ) )
+		{
+			return( false );
+		}
+
+		load( in );
+		transform( &buffer_[ 0 ], 1 );
+		out.resize( width( ), height( ), depth( ) );
+		store( out, 1.0 / size( ) );
+		return( true );
+	}
+
+	/// @brief 傫 width ~ height ~ depth ̕ϊ
+	fft_plan( size_type width = 0, size_type height = 0, size_type depth = 0, size_type thread_num = 0 )
+	{
+		resize( width, height, depth, thread_num );
+	}
+};
 
-	ooura_fft::cdft( static_cast< int >(in.size( ) * 2), 1, data, ip, w );
 
-	out.resize( in.size( ) );
 
-	double __value__ = 1.0 / in.size( );
-	for( i = 0 ; i < out.size( ) ; i++ )
+/// @brief ̑1M܂Ƃ߂čt[GϊNX
+//!
+//!  L ̐M count {COp֐\ƍƗ̈LĈxɕϊD
+//! M b  i Ԗڂ̗vf data[ b * distance + i * stride ] ƂC
+//! 摜̊esistride = 1, distance = Lj⑽`l̉f[^istride = `l, distance = 1jD
+//! M̓Xbhv[̃XbhɕĊ蓖ĂD
+//!
+//! T  float w肷ƁCo͂Pxŕێă]ʂ𔼕ɂiϊ͔̂{xŌvZjD
+//!
+//! @code gp
+//! mist::fft_batch< float > batch( 256 );
+//! mist::array2< std::complex< float > > rows( 256, 1000 );
+//!
+//! batch.fft( rows );                          // 1000 {̍s̏Ńt[Gϊ
+//! batch.ifft( &wav[ 0 ], 2, 2, 1 );           // 2`l݂ɕԃf[^tt[Gϊ
+//! @endcode
+//!
+//! @attention 1̃IuWFNg𕡐̃Xbh瓯Ɏgp邱Ƃ͂łȂ
+//!
+//! @param T c o̓f[^̐xidouble ܂ floatj
+//!
+template < class T = double >
+class fft_batch
+{
+public:
+	typedef size_t size_type;					///< @brief Ȃ̐\^
+	typedef std::complex< T > value_type;		///< @brief o̓f[^̌^
+
+private:
+	typedef std::complex< double > complex_type;
+
+	struct parameter
+	{
+		const fft_batch *plan;
+		value_type *data;
+		size_type first;
+		size_type last;
+		size_type stride;
+		size_type distance;
+		int isgn;
+		double scale;
+	};
+
+	size_type length_;
+	size_type thread_num_;
+	bool power_of_two_;
+	std::vector< int > ip_;						// YFFT̃rbg]pƗ̈
+	std::vector< double > w_;					// YFFT̎Op֐\icos/sinj
+	__mixed_radix__::line_transform transform_;	// 2̎włȂꍇ̕ϊ
+#if defined( __THREAD_POOL_SUPPORT__ ) && __THREAD_POOL_SUPPORT__ != 0
+	thread_pool pool_;
+#endif
+
+public:
+	/// @brief M̒ύXCOp֐\蒼
+	//!
+	//! @param[in] length     c 1{̐M̒
+	//! @param[in] thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+	//!
+	void resize( size_type length, size_type thread_num = 0 )
+	{
+		length_ = length;
+		thread_num_ = thread_num == 0 ? static_cast< size_type >( get_cpu_num( ) ) : thread_num;
+		power_of_two_ = length > 1 && __fft_util__::size_check( static_cast< unsigned int >( length ) );
+
+		ip_.clear( );
+		w_.clear( );
+		transform_ = __mixed_radix__::line_transform( );
+
+		if( power_of_two_ )
+		{
+			// ̃XbhQƂ邽߁COp֐\ō쐬Ă
+			std::vector< complex_type > dmy( length );
+			ip_.resize( static_cast< size_type >( std::sqrt( static_cast< double >( length ) ) + 3 ) );
+			w_.resize( length / 2 + 1 );
+			ip_[ 0 ] = 0;
+			ooura_fft::cdft( static_cast< int >( length * 2 ), -1, reinterpret_cast< double * >( &dmy[ 0 ] ), &ip_[ 0 ], &w_[ 0 ] );
+		}
+		else if( length > 0 )
+		{
+			transform_.initialize( __mixed_radix__::CDFT, length );
+		}
+
+#if defined( __THREAD_POOL_SUPPORT__ ) && __THREAD_POOL_SUPPORT__ != 0
+		if( thread_num_ > 1 )
+		{
+			pool_.initialize( thread_num_ );
+		}
+		else
+		{
+			pool_.uninitialize( );
+		}
+#endif
+	}
+
+	/// @brief 1{̐M̒
+	size_type size( ) const { return( length_ ); }
+
+	/// @brief gpXbh
+	size_type thread_num( ) const { return( thread_num_ ); }
+
+	/// @brief count {̐M̏Ńt[Gϊ
+	//!
+	//! @param[in,out] data     c 擪̐M̐擪vfւ̃|C^
+	//! @param[in]     count    c M̖{
+	//! @param[in]     stride   c Mŗׂ荇vf̊Ԋu
+	//! @param[in]     distance c ׂ荇M̐擪vf̊Ԋui0̏ꍇ  ~ stridej
+	//!
+	//! @return ϊɐǂ
+	//!
+	bool fft( value_type *data, size_type count, size_type stride = 1, size_type distance = 0 )
 	{
-		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from( data[ 2 * i ] * __value__, data[ 2 * i + 1 ] * __value__ );
+		return( execute( data, count, stride, distance, -1, 1.0 ) );
 	}
 
-	__fft_util__::deallocate_memory( mem );
+	/// @brief count {̐M̏ŋtt[Gϊ
+	//!
+	//! @param[in,out] data     c 擪̐M̐擪vfւ̃|C^
+	//! @param[in]     count    c M̖{
+	//! @param[in]     stride   c Mŗׂ荇vf̊Ԋu
+	//! @param[in]     distance c ׂ荇M̐擪vf̊Ԋui0̏ꍇ  ~ stridej
+	//!
+	//! @return ϊɐǂ
+	//!
+	bool ifft( value_type *data, size_type count, size_type stride = 1, size_type distance = 0 )
+	{
+		return( execute( data, count, stride, distance, 1, 1.0 / static_cast< double >( length_ ) ) );
+	}
 
-	return( true );
+	/// @brief 摜̊es̏Ńt[Gϊ
+	//!
+	//! @param[in,out] data c X̑傫M̒ɓ摜
+	//!
+	//! @return ϊɐǂi傫قȂꍇ͎sj
+	//!
+	template < class Allocator >
+	bool fft( array2< value_type, Allocator > &data )
+	{
+		if( data.empty( ) || data.width( ) != length_ )
+		{
+			return( false );
+		}
+		return( fft( &data[ 0 ], data.height( ) ) );
+	}
+
+	/// @brief 摜̊es̏ŋtt[Gϊ
+	//!
+	//! @param[in,out] data c X̑傫M̒ɓ摜
+	//!
+	//! @return ϊɐǂi傫قȂꍇ͎sj
+	//!
+	template < class Allocator >
+	bool ifft( array2< value_type, Allocator > &data )
+	{
+		if( data.empty( ) || data.width( ) != length_ )
+		{
+			return( false );
+		}
+		return( ifft( &data[ 0 ], data.height( ) ) );
+	}
+
+	/// @brief  length ̐Mϊ鏀
+	fft_batch( size_type length = 0, size_type thread_num = 0 ) : length_( 0 ), thread_num_( 1 ), power_of_two_( false )
+	{
+		resize( length, thread_num );
+	}
+
+private:
+	// Xbhv[ێ邽߃Rs[͋֎~
+	fft_batch( const fft_batch & );
+	const fft_batch &operator =( const fft_batch & );
+
+	bool execute( value_type *data, size_type count, size_type stride, size_type distance, int isgn, double scale )
+	{
+		if( data == NULL || length_ == 0 || count == 0 || stride == 0 )
+		{
+			return( false );
+		}
+
+		if( distance == 0 )
+		{
+			distance = length_ * stride;
+		}
+
+		size_type thread_num = count < thread_num_ ? count : thread_num_;
+		std::vector< parameter > param( thread_num );
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			param[ i ].plan     = this;
+			param[ i ].data     = data;
+			param[ i ].first    = count * i / thread_num;
+			param[ i ].last     = count * ( i + 1 ) / thread_num;
+			param[ i ].stride   = stride;
+			param[ i ].distance = distance;
+			param[ i ].isgn     = isgn;
+			param[ i ].scale    = scale;
+		}
+
+		if( thread_num == 1 )
+		{
+			transform( param[ 0 ] );
+		}
+		else
+		{
+#if defined( __THREAD_POOL_SUPPORT__ ) && __THREAD_POOL_SUPPORT__ != 0
+			pool_.executes( transform, &param[ 0 ], thread_num );
+			pool_.wait( );
+#else
+			do_threads( &param[ 0 ], thread_num, transform );
+#endif
+		}
+
+		return( true );
+	}
+
+	// M first`last-1 1{Ɨ̈ɏW߂ĕϊC̈ʒuɏ߂
+	static void transform( const parameter &p )
+	{
+		const fft_batch &plan = *p.plan;
+		const size_type length = plan.length_;
+		std::vector< complex_type > buff( length ), work( plan.power_of_two_ ? 0 : plan.transform_.work_size( ) );
+		std::vector< int > ip( plan.ip_ );
+		double *a = reinterpret_cast< double * >( &buff[ 0 ] );
+
+		for( size_type b = p.first ; b < p.last ; b++ )
+		{
+			value_type *x = p.data + b * p.distance;
+
+			for( size_type i = 0 ; i < length ; i++ )
+			{
+				const value_type &v = x[ i * p.stride ];
+				buff[ i ] = complex_type( v.real( ), v.imag( ) );
+			}
+
+			if( plan.power_of_two_ )
+			{
+				// Op֐\͍쐬ς݂Ȃ̂ŁCYFFT͕\Ȃ
+				ooura_fft::cdft( static_cast< int >( length * 2 ), p.isgn, a, &ip[ 0 ], const_cast< double * >( &plan.w_[ 0 ] ) );
+			}
+			else if( length > 1 )
+			{
+				plan.transform_( a, p.isgn, &work[ 0 ] );
+			}
+
+			for( size_type i = 0 ; i < length ; i++ )
+			{
+				x[ i * p.stride ] = value_type( static_cast< T >( buff[ i ].real( ) * p.scale ), static_cast< T >( buff[ i ].imag( ) * p.scale ) );
+			}
+		}
+	}
+};
+
+
+
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool _fft( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
+{
+	// 1t[Gϊ
+	fft_plan< 1 > plan( in.size( ) );
+	return( plan.fft( in, out ) );
+}
+
+
+
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool _ifft( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
+{
+	// 1tt[Gϊ
+	fft_plan< 1 > plan( in.size( ) );
+	return( plan.ifft( in, out ) );
 }
 
 
 /// @brief 1t[Gϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̔z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
@@ -207,7 +861,7 @@ bool fft( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 /// @brief 1tt[Gϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
@@ -225,18 +879,19 @@ bool ifft( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
 /// @brief 2t[Gϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool fft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+bool fft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) || !__fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -245,10 +900,15 @@ bool fft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 	size_type i, j, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
 	__fft_util__::FFT_MEMORY2 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ) * 2,
-									8 * in.width( ) * FFT2D_MAX_THREADS,
+									8 * in.width( ) * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size ) ) + 3 ),
 									size / 2 ) )
 	{
@@ -273,7 +933,14 @@ bool fft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::cdft2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) * 2 ), -1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) && __fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	{
+		ooura_fft::cdft2d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) * 2 ), -1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::cdft2d( in.width( ), in.height( ) * 2, -1, data, thread_num );
+	}
 
 
 	out.resize( in.width( ), in.height( ) );
@@ -296,17 +963,18 @@ bool fft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 /// @brief 2tt[Gϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool ifft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+bool ifft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) || !__fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
@@ -315,10 +983,15 @@ bool ifft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 	size_type i, j, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
 	__fft_util__::FFT_MEMORY2 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ) * 2,
-									8 * in.width( ) * FFT2D_MAX_THREADS,
+									8 * in.width( ) * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size ) ) + 3 ),
 									size / 2 ) )
 	{
@@ -343,7 +1016,14 @@ bool ifft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::cdft2d( static_cast< int >(in.width( )), static_cast< int >(in.height( ) * 2), 1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) && __fft_util__::size_check( ( unsigned int ) in.height( ) ) )
+	{
+		ooura_fft::cdft2d( static_cast< int >(in.width( )), static_cast< int >(in.height( ) * 2), 1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::cdft2d( in.width( ), in.height( ) * 2, 1, data, thread_num );
+	}
 
 	out.resize( in.width( ), in.height( ) );
 
@@ -366,33 +1046,38 @@ bool ifft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
 /// @brief 3t[Gϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool fft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+bool fft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.height( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
 
 	typedef typename Allocator1::size_type size_type;
 	size_type i, j, k, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
+	size = size > in.depth( ) ? size : in.depth( );
 	__fft_util__::FFT_MEMORY3 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
 									in.depth( ) * 2,
-									8 * size * FFT3D_MAX_THREADS,
+									8 * size * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size ) ) + 3 ),
 									size / 2 ) )
 	{
@@ -420,7 +1105,16 @@ bool fft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::cdft3d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) * 2 ), -1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.height( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	{
+		ooura_fft::cdft3d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) * 2 ), -1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::cdft3d( in.width( ), in.height( ), in.depth( ) * 2, -1, data, thread_num );
+	}
 
 	out.resize( in.width( ), in.height( ), in.depth( ) );
 
@@ -446,32 +1140,37 @@ bool fft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
 /// @brief 3tt[Gϊ
 //! 
 //! @attention ͂Əo͂́CMISTReiIuWFNgł삷
-//! @attention ͉摜̈ӂ2̎w̕Kv
+//! @attention ͉摜̈ӂ2̎włȂꍇ́CFFT܂Bluestein@pČvZ
 //! 
 //! @param[in]  in  c ͉摜
 //! @param[out] out c o͉摜
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
 //! 
 //! @return ϊɐǂ
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-bool ifft( const array3< T1, Allocator1 > &in, array3< T2 , Allocator2 > &out )
+bool ifft( const array3< T1, Allocator1 > &in, array3< T2 , Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
 {
-	if( !__fft_util__::size_check( ( unsigned int ) in.width( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.height( ) ) ||
-		!__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	if( in.empty( ) )
 	{
 		return( false );
 	}
 
 	typedef typename Allocator1::size_type size_type;
 	size_type i, j, k, size = in.width( ) > in.height( ) ? in.width( ) : in.height( );
+	size = size > in.depth( ) ? size : in.depth( );
 	__fft_util__::FFT_MEMORY3 mem;
 
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
 	if( !__fft_util__::allocate_memory( mem,
 									in.width( ),
 									in.height( ),
 									in.depth( ) * 2,
-									8 * size * FFT3D_MAX_THREADS,
+									8 * size * thread_num,
 									static_cast< size_t >( std::sqrt( static_cast< double >( size ) ) + 3 ),
 									size / 2 ) )
 	{
@@ -499,7 +1198,16 @@ bool ifft( const array3< T1, Allocator1 > &in, array3< T2 , Allocator2 > &out )
 
 	ip[ 0 ] = 0;
 
-	ooura_fft::cdft3d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) * 2 ), 1, data, t, ip, w );
+	if( __fft_util__::size_check( ( unsigned int ) in.width( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.height( ) ) &&
+		__fft_util__::size_check( ( unsigned int ) in.depth( ) ) )
+	{
+		ooura_fft::cdft3d( static_cast< int >( in.width( ) ), static_cast< int >( in.height( ) ), static_cast< int >( in.depth( ) * 2 ), 1, data, t, ip, w, static_cast< int >( thread_num ) );
+	}
+	else
+	{
+		__mixed_radix__::cdft3d( in.width( ), in.height( ), in.depth( ) * 2, 1, data, thread_num );
+	}
 
 	out.resize( in.width( ), in.height( ), in.depth( ) );
 
@@ -521,6 +1229,348 @@ bool ifft( const array3< T1, Allocator1 > &in, array3< T2 , Allocator2 > &out )
 }
 
 
+namespace __fft_util__
+{
+	// f[^ inix A depth ~ height ~ widthjC񕉂̎g 0`width/2 ̕ff[^ out ɕϊ
+	inline void rfft( const double *in, std::complex< double > *out, size_t width, size_t height, size_t depth, size_t thread_num )
+	{
+		if( height == 1 && depth == 1 && size_check( static_cast< unsigned int >( width ) ) )
+		{
+			// Y rdft piR[ k ] = a[ 2k ]CI[ k ] = a[ 2k + 1 ]CR[ n/2 ] = a[ 1 ]j
+			std::vector< double > a( in, in + width ), w( width / 2 + 1 );
+			std::vector< int > ip( static_cast< size_t >( std::sqrt( static_cast< double >( width / 2 ) ) + 3 ) );
+			ip[ 0 ] = 0;
+
+			ooura_fft::rdft( static_cast< int >( width ), 1, &a[ 0 ], &ip[ 0 ], &w[ 0 ] );
+
+			out[ 0 ] = std::complex< double >( a[ 0 ], 0.0 );
+			out[ width / 2 ] = std::complex< double >( a[ 1 ], 0.0 );
+			for( size_t k = 1 ; k < width / 2 ; k++ )
+			{
+				out[ k ] = std::complex< double >( a[ 2 * k ], -a[ 2 * k + 1 ] );
+			}
+			return;
+		}
+
+		__mixed_radix__::real_fft tx( width );
+		__mixed_radix__::line_transform ty( __mixed_radix__::CDFT, height ), tz( __mixed_radix__::CDFT, depth );
+		__mixed_radix__::real_transform3d( tx, ty, tz, height, depth, in, out, thread_num );
+	}
+
+	// rfft ̋tϊiKȂjDin ͍Ɨ̈Ƃď
+	inline void irfft( std::complex< double > *in, double *out, size_t width, size_t height, size_t depth, size_t thread_num )
+	{
+		if( height == 1 && depth == 1 && size_check( static_cast< unsigned int >( width ) ) )
+		{
+			std::vector< double > w( width / 2 + 1 );
+			std::vector< int > ip( static_cast< size_t >( std::sqrt( static_cast< double >( width / 2 ) ) + 3 ) );
+			ip[ 0 ] = 0;
+
+			out[ 0 ] = in[ 0 ].real( );
+			out[ 1 ] = in[ width / 2 ].real( );
+			for( size_t k = 1 ; k < width / 2 ; k++ )
+			{
+				out[ 2 * k ]     = in[ k ].real( );
+				out[ 2 * k + 1 ] = -in[ k ].imag( );
+			}
+
+			ooura_fft::rdft( static_cast< int >( width ), -1, out, &ip[ 0 ], &w[ 0 ] );
+
+			for( size_t i = 0 ; i < width ; i++ )
+			{
+				out[ i ] *= 2.0;
+			}
+			return;
+		}
+
+		__mixed_radix__::real_fft tx( width );
+		__mixed_radix__::line_transform ty( __mixed_radix__::CDFT, height ), tz( __mixed_radix__::CDFT, depth );
+		__mixed_radix__::real_inverse_transform3d( tx, ty, tz, height, depth, in, out, thread_num );
+	}
+
+	template < class T, class Allocator >
+	inline void load_real( const array< T, Allocator > &in, std::vector< double > &data )
+	{
+		data.resize( in.size( ) );
+		for( size_t i = 0 ; i < in.size( ) ; i++ )
+		{
+			data[ i ] = convert_complex< T >::convert_to( in[ i ] ).real( );
+		}
+	}
+
+	template < class T, class Allocator >
+	inline void load_complex( const array< T, Allocator > &in, std::vector< std::complex< double > > &data )
+	{
+		data.resize( in.size( ) );
+		for( size_t i = 0 ; i < in.size( ) ; i++ )
+		{
+			data[ i ] = convert_complex< T >::convert_to( in[ i ] );
+		}
+	}
+}
+
+
+/// @brief f[^1t[Gϊ
+//! 
+//! vf N ̎f[^C񕉂̎g k = 0, 1, ..., N/2  N/2+1 ̕fɕϊD
+//! ̎g X[ N - k ] = conj( X[ k ] ) œ邽ߏo͂ȂD
+//! f fft ɔׂāCvZʂƋLʂ񔼕ɂȂD
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention ͂f̏ꍇ͎݂̂p
+//! @attention o݂͂̂̔z̏ꍇ́Cp[Ԃ
+//! 
+//! @param[in]  in  c ̓f[^ivf Nj
+//! @param[out] out c o̓f[^ivf N/2+1j
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool rfft( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out )
+{
+	if( in.empty( ) )
+	{
+		return( false );
+	}
+
+	typedef typename Allocator1::size_type size_type;
+	size_type width = in.size( );
+	std::vector< double > data;
+	std::vector< std::complex< double > > freq( width / 2 + 1 );
+
+	__fft_util__::load_real( in, data );
+	__fft_util__::rfft( &data[ 0 ], &freq[ 0 ], width, 1, 1, 1 );
+
+	out.resize( freq.size( ) );
+	for( size_type i = 0 ; i < out.size( ) ; i++ )
+	{
+		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from( freq[ i ].real( ), freq[ i ].imag( ) );
+	}
+
+	return( true );
+}
+
+
+/// @brief f[^1tt[Gϊirfft ̋tϊj
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention ^̏o͂ɂ́CUł͂Ȃt̒lԂ
+//! 
+//! @param[in]  in    c 񕉂̎g̓̓f[^ivf width/2+1j
+//! @param[out] out   c o̓f[^ivf widthj
+//! @param[in]  width c ̃f[^̗vf
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool irfft( const array1< T1, Allocator1 > &in, array1< T2, Allocator2 > &out, typename array1< T1, Allocator1 >::size_type width )
+{
+	if( width == 0 || in.size( ) != width / 2 + 1 )
+	{
+		return( false );
+	}
+
+	typedef typename Allocator1::size_type size_type;
+	std::vector< std::complex< double > > freq;
+	std::vector< double > data( width );
+
+	__fft_util__::load_complex( in, freq );
+	__fft_util__::irfft( &freq[ 0 ], &data[ 0 ], width, 1, 1, 1 );
+
+	out.resize( width );
+
+	double __value__ = 1.0 / width;
+	for( size_type i = 0 ; i < out.size( ) ; i++ )
+	{
+		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from_real( data[ i ] * __value__ );
+	}
+
+	return( true );
+}
+
+
+/// @brief f[^2t[Gϊ
+//! 
+//! 傫 W ~ H ̎摜CX̔񕉂̎g 0`W/2  ( W/2+1 ) ~ H ̕fɕϊD
+//! c̎g X( W - u, ( H - v ) % H ) = conj( X( u, v ) ) œD
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention ͂f̏ꍇ͎݂̂p
+//! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
+//! 
+//! @param[in]  in  c ͉摜iW ~ Hj
+//! @param[out] out c o͉摜i( W/2+1 ) ~ Hj
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool rfft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
+{
+	if( in.empty( ) )
+	{
+		return( false );
+	}
+
+	typedef typename Allocator1::size_type size_type;
+	size_type width = in.width( ), height = in.height( );
+	std::vector< double > data;
+	std::vector< std::complex< double > > freq( ( width / 2 + 1 ) * height );
+
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
+	__fft_util__::load_real( in, data );
+	__fft_util__::rfft( &data[ 0 ], &freq[ 0 ], width, height, 1, thread_num );
+
+	out.resize( width / 2 + 1, height );
+	for( size_type i = 0 ; i < out.size( ) ; i++ )
+	{
+		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from( freq[ i ].real( ), freq[ i ].imag( ) );
+	}
+
+	return( true );
+}
+
+
+/// @brief f[^2tt[Gϊirfft ̋tϊj
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention ^̏o͂ɂ́CUł͂Ȃt̒lԂ
+//! 
+//! @param[in]  in    c ͉摜i( width/2+1 ) ~ Hj
+//! @param[out] out   c o͉摜iwidth ~ Hj
+//! @param[in]  width c ̉摜X̑傫
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool irfft( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T1, Allocator1 >::size_type width, typename array2< T1, Allocator1 >::size_type thread_num = 0 )
+{
+	if( width == 0 || in.width( ) != width / 2 + 1 || in.height( ) == 0 )
+	{
+		return( false );
+	}
+
+	typedef typename Allocator1::size_type size_type;
+	size_type height = in.height( );
+	std::vector< std::complex< double > > freq;
+	std::vector< double > data( width * height );
+
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
+	__fft_util__::load_complex( in, freq );
+	__fft_util__::irfft( &freq[ 0 ], &data[ 0 ], width, height, 1, thread_num );
+
+	out.resize( width, height );
+
+	double __value__ = 1.0 / out.size( );
+	for( size_type i = 0 ; i < out.size( ) ; i++ )
+	{
+		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from_real( data[ i ] * __value__ );
+	}
+
+	return( true );
+}
+
+
+/// @brief f[^3t[Gϊ
+//! 
+//! 傫 W ~ H ~ D ̎摜CX̔񕉂̎g 0`W/2  ( W/2+1 ) ~ H ~ D ̕fɕϊD
+//! c̎g X( W - u, ( H - v ) % H, ( D - w ) % D ) = conj( X( u, v, w ) ) œD
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention ͂f̏ꍇ͎݂̂p
+//! @attention o݂͂̂̉摜z̏ꍇ́Cp[Ԃ
+//! 
+//! @param[in]  in  c ͉摜iW ~ H ~ Dj
+//! @param[out] out c o͉摜i( W/2+1 ) ~ H ~ Dj
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool rfft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
+{
+	if( in.empty( ) )
+	{
+		return( false );
+	}
+
+	typedef typename Allocator1::size_type size_type;
+	size_type width = in.width( ), height = in.height( ), depth = in.depth( );
+	std::vector< double > data;
+	std::vector< std::complex< double > > freq( ( width / 2 + 1 ) * height * depth );
+
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
+	__fft_util__::load_real( in, data );
+	__fft_util__::rfft( &data[ 0 ], &freq[ 0 ], width, height, depth, thread_num );
+
+	out.resize( width / 2 + 1, height, depth );
+	for( size_type i = 0 ; i < out.size( ) ; i++ )
+	{
+		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from( freq[ i ].real( ), freq[ i ].imag( ) );
+	}
+
+	return( true );
+}
+
+
+/// @brief f[^3tt[Gϊirfft ̋tϊj
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//! @attention ^̏o͂ɂ́CUł͂Ȃt̒lԂ
+//! 
+//! @param[in]  in    c ͉摜i( width/2+1 ) ~ H ~ Dj
+//! @param[out] out   c o͉摜iwidth ~ H ~ Dj
+//! @param[in]  width c ̉摜X̑傫
+//! @param[in]  thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+//! 
+//! @return ϊɐǂ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+bool irfft( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type width, typename array3< T1, Allocator1 >::size_type thread_num = 0 )
+{
+	if( width == 0 || in.width( ) != width / 2 + 1 || in.height( ) == 0 || in.depth( ) == 0 )
+	{
+		return( false );
+	}
+
+	typedef typename Allocator1::size_type size_type;
+	size_type height = in.height( ), depth = in.depth( );
+	std::vector< std::complex< double > > freq;
+	std::vector< double > data( width * height * depth );
+
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
+	__fft_util__::load_complex( in, freq );
+	__fft_util__::irfft( &freq[ 0 ], &data[ 0 ], width, height, depth, thread_num );
+
+	out.resize( width, height, depth );
+
+	double __value__ = 1.0 / out.size( );
+	for( size_type i = 0 ; i < out.size( ) ; i++ )
+	{
+		out[ i ] = __fft_util__::convert_complex< T2 >::convert_from_real( data[ i ] * __value__ );
+	}
+
+	return( true );
+}
+
+
 /// @}
 //  FFT O[v̏I
 
@@ -147,6 +147,12 @@ namespace __fft_util__
 		{
 			out = static_cast< T >( std::sqrt( r * r + i * i ) );
 		}
+
+		template < class T >
+		static void convert_from_real( const double r, T &out )
+		{
+			out = static_cast< T >( r );
+		}
 	};
 
 	template < >
@@ -165,6 +171,13 @@ namespace __fft_util__
 			typedef typename T::value_type value_type;
 			out = T( static_cast< value_type >( r ), static_cast< value_type >( i ) );
 		}
+
+		template < class T >
+		static void convert_from_real( const double r, T &out )
+		{
+			typedef typename T::value_type value_type;
+			out = T( static_cast< value_type >( r ), value_type( ) );
+		}
 	};
 
 	// ʓIȃf[^^畡f^ɕϊ֐
@@ -190,6 +203,14 @@ namespace __fft_util__
 			convert_from_complex< is_complex< T >::value >::convert_from( r, i, dmy );
 			return( dmy );
 		}
+
+		// l̂܂ܕϊi^̏ꍇۂj
+		static const T convert_from_real( double r )
+		{
+			T dmy;
+			convert_from_complex< is_complex< T >::value >::convert_from_real( r, dmy );
+			return( dmy );
+		}
 	};
 
 
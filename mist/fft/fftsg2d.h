@@ -22,20 +22,23 @@ functions
     ddct2d: Discrete Cosine Transform
     ddst2d: Discrete Sine Transform
 function prototypes
-    void cdft2d(int, int, int, double **, double *, int *, double *);
-    void rdft2d(int, int, int, double **, double *, int *, double *);
+    void cdft2d(int, int, int, double **, double *, int *, double *, int);
+    void rdft2d(int, int, int, double **, double *, int *, double *, int);
     void rdft2dsort(int, int, int, double **);
-    void ddct2d(int, int, int, double **, double *, int *, double *);
-    void ddst2d(int, int, int, double **, double *, int *, double *);
+    void ddct2d(int, int, int, double **, double *, int *, double *, int);
+    void ddst2d(int, int, int, double **, double *, int *, double *, int);
 necessary package
     fftsg.c  : 1D-FFT package
 macro definitions
     USE_FFT2D_PTHREADS : default=not defined
-        FFT2D_MAX_THREADS     : must be 2^N, default=4
+        FFT2D_MAX_THREADS     : default number of threads (nthread), default=4
         FFT2D_THREADS_BEGIN_N : default=65536
     USE_FFT2D_WINTHREADS : default=not defined
-        FFT2D_MAX_THREADS     : must be 2^N, default=4
+        FFT2D_MAX_THREADS     : default number of threads (nthread), default=4
         FFT2D_THREADS_BEGIN_N : default=131072
+    nthread (last argument of cdft2d, rdft2d, ddct2d, ddst2d)
+        number of threads, rounded down to 2^N, default=FFT2D_MAX_THREADS
+        (threads are created through the MIST thread library)
 
 
 -------- Complex DFT (Discrete Fourier Transform) --------
@@ -74,7 +77,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= 8*n1,                   if single thread, 
-                length of t >= 8*n1*FFT2D_MAX_THREADS, if multi threads, 
+                length of t >= 8*n1*nthread, if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
                :work area for bit reversal (int *)
@@ -183,7 +186,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= 8*n1,                   if single thread, 
-                length of t >= 8*n1*FFT2D_MAX_THREADS, if multi threads, 
+                length of t >= 8*n1*nthread, if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
                :work area for bit reversal (int *)
@@ -238,7 +241,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= 4*n1,                   if single thread, 
-                length of t >= 4*n1*FFT2D_MAX_THREADS, if multi threads, 
+                length of t >= 4*n1*nthread, if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
                :work area for bit reversal (int *)
@@ -313,7 +316,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= 4*n1,                   if single thread, 
-                length of t >= 4*n1*FFT2D_MAX_THREADS, if multi threads, 
+                length of t >= 4*n1*nthread, if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
                :work area for bit reversal (int *)
@@ -343,6 +346,12 @@ macro definitions
         .
 */
 
+#if defined( USE_FFT2D_PTHREADS ) || defined( USE_FFT2D_WINTHREADS )
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+#endif
+
 namespace ooura_fft{
 
 #include <stdio.h>
@@ -355,54 +364,50 @@ namespace ooura_fft{
 }
 
 
-#ifdef USE_FFT2D_PTHREADS
+#if defined( USE_FFT2D_PTHREADS ) || defined( USE_FFT2D_WINTHREADS )
 #define USE_FFT2D_THREADS
 #ifndef FFT2D_MAX_THREADS
 #define FFT2D_MAX_THREADS 4
 #endif
 #ifndef FFT2D_THREADS_BEGIN_N
+#ifdef USE_FFT2D_WINTHREADS
+#define FFT2D_THREADS_BEGIN_N 131072
+#else
 #define FFT2D_THREADS_BEGIN_N 65536
 #endif
-#include <pthread.h>
-#define fft2d_thread_t pthread_t
+#endif
+#define fft2d_thread_t mist::thread_handle
 #define fft2d_thread_create(thp,func,argp) { \
-    if (pthread_create(thp, NULL, func, (void *) (argp)) != 0) { \
-        fprintf(stderr, "fft2d thread error\n"); \
-        exit(1); \
-    } \
+    *(thp) = mist::create_thread(*(argp), fft2d_thread_function(func)); \
 }
 #define fft2d_thread_wait(th) { \
-    if (pthread_join(th, NULL) != 0) { \
-        fprintf(stderr, "fft2d thread error\n"); \
-        exit(1); \
-    } \
+    mist::wait_thread(th); \
+    mist::close_thread(th); \
 }
-#endif /* USE_FFT2D_PTHREADS */
+#endif /* USE_FFT2D_PTHREADS || USE_FFT2D_WINTHREADS */
 
 
-#ifdef USE_FFT2D_WINTHREADS
-#define USE_FFT2D_THREADS
-#ifndef FFT2D_MAX_THREADS
-#define FFT2D_MAX_THREADS 4
-#endif
-#ifndef FFT2D_THREADS_BEGIN_N
-#define FFT2D_THREADS_BEGIN_N 131072
-#endif
-#include <windows.h>
-#define fft2d_thread_t HANDLE
-#define fft2d_thread_create(thp,func,argp) { \
-    DWORD thid; \
-    *(thp) = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE) (func), (LPVOID) (argp), 0, &thid); \
-    if (*(thp) == 0) { \
-        fprintf(stderr, "fft2d thread error\n"); \
-        exit(1); \
-    } \
-}
-#define fft2d_thread_wait(th) { \
-    WaitForSingleObject(th, INFINITE); \
-    CloseHandle(th); \
+#ifdef USE_FFT2D_THREADS
+#define FFT2D_MAX_THREADS_DEFAULT FFT2D_MAX_THREADS
+#else
+#define FFT2D_MAX_THREADS_DEFAULT 1
+#endif /* USE_FFT2D_THREADS */
+
+
+/* number of threads actually used (power of 2, at most nthread) */
+inline int fft2d_thread_num(int nthread)
+{
+    int n = 1;
+#ifdef USE_FFT2D_THREADS
+    while (n * 2 <= nthread) {
+        n *= 2;
+    }
+#else
+    (void) nthread;
+#endif /* USE_FFT2D_THREADS */
+    return n;
 }
-#endif /* USE_FFT2D_WINTHREADS */
+
 
 
 
@@ -423,6 +428,14 @@ struct fft2d_arg_st {
 typedef struct fft2d_arg_st fft2d_arg_t;
 
 
+/* calls an Ooura thread routine from a mist thread */
+struct fft2d_thread_function {
+    void *(*func)(void *);
+    fft2d_thread_function(void *(*f)(void *)) : func(f) {}
+    void operator ()(fft2d_arg_t &arg) const { func(&arg); }
+};
+
+
     void ddst(int n, int isgn, double *a, int *ip, double *w);
 
 inline void *xdft2d0_th(void *p)
@@ -624,16 +637,17 @@ inline void *ddxt2d_th(void *p)
 }
 
 inline void xdft2d0_subth(int n1, int n2, int icr, int isgn, double **a, 
-    int *ip, double *w)
+    int *ip, double *w, int nthread)
 {
-    fft2d_thread_t th[FFT2D_MAX_THREADS];
-    fft2d_arg_t ag[FFT2D_MAX_THREADS];
-    int nthread, i;
+    fft2d_thread_t *th;
+    fft2d_arg_t *ag;
+    int i;
     
-    nthread = FFT2D_MAX_THREADS;
     if (nthread > n1) {
         nthread = n1;
     }
+    th = new fft2d_thread_t[nthread];
+    ag = new fft2d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -649,24 +663,27 @@ inline void xdft2d0_subth(int n1, int n2, int icr, int isgn, double **a,
     for (i = 0; i < nthread; i++) {
         fft2d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 
 inline void cdft2d_subth(int n1, int n2, int isgn, double **a, double *t, 
-    int *ip, double *w)
+    int *ip, double *w, int nthread)
 {
-    fft2d_thread_t th[FFT2D_MAX_THREADS];
-    fft2d_arg_t ag[FFT2D_MAX_THREADS];
-    int nthread, nt, i;
+    fft2d_thread_t *th;
+    fft2d_arg_t *ag;
+    int nt, i;
     
-    nthread = FFT2D_MAX_THREADS;
     nt = 8 * n1;
-    if (n2 == 4 * FFT2D_MAX_THREADS) {
+    if (n2 == 4 * nthread) {
         nt >>= 1;
-    } else if (n2 < 4 * FFT2D_MAX_THREADS) {
+    } else if (n2 < 4 * nthread) {
         nthread = n2 >> 1;
         nt >>= 2;
     }
+    th = new fft2d_thread_t[nthread];
+    ag = new fft2d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -682,20 +699,23 @@ inline void cdft2d_subth(int n1, int n2, int isgn, double **a, double *t,
     for (i = 0; i < nthread; i++) {
         fft2d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 
 inline void ddxt2d0_subth(int n1, int n2, int ics, int isgn, double **a, 
-    int *ip, double *w)
+    int *ip, double *w, int nthread)
 {
-    fft2d_thread_t th[FFT2D_MAX_THREADS];
-    fft2d_arg_t ag[FFT2D_MAX_THREADS];
-    int nthread, i;
+    fft2d_thread_t *th;
+    fft2d_arg_t *ag;
+    int i;
     
-    nthread = FFT2D_MAX_THREADS;
     if (nthread > n1) {
         nthread = n1;
     }
+    th = new fft2d_thread_t[nthread];
+    ag = new fft2d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -711,24 +731,27 @@ inline void ddxt2d0_subth(int n1, int n2, int ics, int isgn, double **a,
     for (i = 0; i < nthread; i++) {
         fft2d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 
 inline void ddxt2d_subth(int n1, int n2, int ics, int isgn, double **a, 
-    double *t, int *ip, double *w)
+    double *t, int *ip, double *w, int nthread)
 {
-    fft2d_thread_t th[FFT2D_MAX_THREADS];
-    fft2d_arg_t ag[FFT2D_MAX_THREADS];
-    int nthread, nt, i;
+    fft2d_thread_t *th;
+    fft2d_arg_t *ag;
+    int nt, i;
     
-    nthread = FFT2D_MAX_THREADS;
     nt = 4 * n1;
-    if (n2 == 2 * FFT2D_MAX_THREADS) {
+    if (n2 == 2 * nthread) {
         nt >>= 1;
-    } else if (n2 < 2 * FFT2D_MAX_THREADS) {
+    } else if (n2 < 2 * nthread) {
         nthread = n2;
         nt >>= 2;
     }
+    th = new fft2d_thread_t[nthread];
+    ag = new fft2d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -745,6 +768,8 @@ inline void ddxt2d_subth(int n1, int n2, int ics, int isgn, double **a,
     for (i = 0; i < nthread; i++) {
         fft2d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 #endif /* USE_FFT2D_THREADS */
@@ -896,9 +921,11 @@ inline void ddxt2d_sub(int n1, int n2, int ics, int isgn, double **a,
 
 
 inline void cdft2d(int n1, int n2, int isgn, double **a, double *t, 
-    int *ip, double *w)
+    int *ip, double *w, int nthread = FFT2D_MAX_THREADS_DEFAULT)
 {
-    int n, itnull, nthread, nt, i;
+    int n, itnull, nt, i;
+    
+    nthread = fft2d_thread_num(nthread);
     
     n = n1 << 1;
     if (n < n2) {
@@ -910,10 +937,6 @@ inline void cdft2d(int n1, int n2, int isgn, double **a, double *t,
     itnull = 0;
     if (t == NULL) {
         itnull = 1;
-        nthread = 1;
-#ifdef USE_FFT2D_THREADS
-        nthread = FFT2D_MAX_THREADS;
-#endif /* USE_FFT2D_THREADS */
         nt = 8 * nthread * n1;
         if (n2 == 4 * nthread) {
             nt >>= 1;
@@ -924,9 +947,9 @@ inline void cdft2d(int n1, int n2, int isgn, double **a, double *t,
         fft2d_alloc_error_check(t);
     }
 #ifdef USE_FFT2D_THREADS
-    if ((double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
-        xdft2d0_subth(n1, n2, 0, isgn, a, ip, w);
-        cdft2d_subth(n1, n2, isgn, a, t, ip, w);
+    if (nthread > 1 && (double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
+        xdft2d0_subth(n1, n2, 0, isgn, a, ip, w, nthread);
+        cdft2d_subth(n1, n2, isgn, a, t, ip, w, nthread);
     } else 
 #endif /* USE_FFT2D_THREADS */
     {
@@ -942,9 +965,11 @@ inline void cdft2d(int n1, int n2, int isgn, double **a, double *t,
 
 
 inline void rdft2d(int n1, int n2, int isgn, double **a, double *t, 
-    int *ip, double *w)
+    int *ip, double *w, int nthread = FFT2D_MAX_THREADS_DEFAULT)
 {
-    int n, nw, nc, itnull, nthread, nt, i;
+    int n, nw, nc, itnull, nt, i;
+    
+    nthread = fft2d_thread_num(nthread);
     
     n = n1 << 1;
     if (n < n2) {
@@ -963,10 +988,6 @@ inline void rdft2d(int n1, int n2, int isgn, double **a, double *t,
     itnull = 0;
     if (t == NULL) {
         itnull = 1;
-        nthread = 1;
-#ifdef USE_FFT2D_THREADS
-        nthread = FFT2D_MAX_THREADS;
-#endif /* USE_FFT2D_THREADS */
         nt = 8 * nthread * n1;
         if (n2 == 4 * nthread) {
             nt >>= 1;
@@ -977,14 +998,14 @@ inline void rdft2d(int n1, int n2, int isgn, double **a, double *t,
         fft2d_alloc_error_check(t);
     }
 #ifdef USE_FFT2D_THREADS
-    if ((double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
+    if (nthread > 1 && (double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
         if (isgn < 0) {
             rdft2d_sub(n1, n2, isgn, a);
-            cdft2d_subth(n1, n2, isgn, a, t, ip, w);
+            cdft2d_subth(n1, n2, isgn, a, t, ip, w, nthread);
         }
-        xdft2d0_subth(n1, n2, 1, isgn, a, ip, w);
+        xdft2d0_subth(n1, n2, 1, isgn, a, ip, w, nthread);
         if (isgn >= 0) {
-            cdft2d_subth(n1, n2, isgn, a, t, ip, w);
+            cdft2d_subth(n1, n2, isgn, a, t, ip, w, nthread);
             rdft2d_sub(n1, n2, isgn, a);
         }
     } else 
@@ -1043,9 +1064,11 @@ inline void rdft2dsort(int n1, int n2, int isgn, double **a)
 
 
 inline void ddct2d(int n1, int n2, int isgn, double **a, double *t, 
-    int *ip, double *w)
+    int *ip, double *w, int nthread = FFT2D_MAX_THREADS_DEFAULT)
 {
-    int n, nw, nc, itnull, nthread, nt, i;
+    int n, nw, nc, itnull, nt, i;
+    
+    nthread = fft2d_thread_num(nthread);
     
     n = n1;
     if (n < n2) {
@@ -1064,10 +1087,6 @@ inline void ddct2d(int n1, int n2, int isgn, double **a, double *t,
     itnull = 0;
     if (t == NULL) {
         itnull = 1;
-        nthread = 1;
-#ifdef USE_FFT2D_THREADS
-        nthread = FFT2D_MAX_THREADS;
-#endif /* USE_FFT2D_THREADS */
         nt = 4 * nthread * n1;
         if (n2 == 2 * nthread) {
             nt >>= 1;
@@ -1078,9 +1097,9 @@ inline void ddct2d(int n1, int n2, int isgn, double **a, double *t,
         fft2d_alloc_error_check(t);
     }
 #ifdef USE_FFT2D_THREADS
-    if ((double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
-        ddxt2d0_subth(n1, n2, 0, isgn, a, ip, w);
-        ddxt2d_subth(n1, n2, 0, isgn, a, t, ip, w);
+    if (nthread > 1 && (double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
+        ddxt2d0_subth(n1, n2, 0, isgn, a, ip, w, nthread);
+        ddxt2d_subth(n1, n2, 0, isgn, a, t, ip, w, nthread);
     } else 
 #endif /* USE_FFT2D_THREADS */
     {
@@ -1096,9 +1115,11 @@ inline void ddct2d(int n1, int n2, int isgn, double **a, double *t,
 
 
 inline void ddst2d(int n1, int n2, int isgn, double **a, double *t, 
-    int *ip, double *w)
+    int *ip, double *w, int nthread = FFT2D_MAX_THREADS_DEFAULT)
 {
-    int n, nw, nc, itnull, nthread, nt, i;
+    int n, nw, nc, itnull, nt, i;
+    
+    nthread = fft2d_thread_num(nthread);
     
     n = n1;
     if (n < n2) {
@@ -1117,10 +1138,6 @@ inline void ddst2d(int n1, int n2, int isgn, double **a, double *t,
     itnull = 0;
     if (t == NULL) {
         itnull = 1;
-        nthread = 1;
-#ifdef USE_FFT2D_THREADS
-        nthread = FFT2D_MAX_THREADS;
-#endif /* USE_FFT2D_THREADS */
         nt = 4 * nthread * n1;
         if (n2 == 2 * nthread) {
             nt >>= 1;
@@ -1131,9 +1148,9 @@ inline void ddst2d(int n1, int n2, int isgn, double **a, double *t,
         fft2d_alloc_error_check(t);
     }
 #ifdef USE_FFT2D_THREADS
-    if ((double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
-        ddxt2d0_subth(n1, n2, 1, isgn, a, ip, w);
-        ddxt2d_subth(n1, n2, 1, isgn, a, t, ip, w);
+    if (nthread > 1 && (double) n1 * n2 >= (double) FFT2D_THREADS_BEGIN_N) {
+        ddxt2d0_subth(n1, n2, 1, isgn, a, ip, w, nthread);
+        ddxt2d_subth(n1, n2, 1, isgn, a, t, ip, w, nthread);
     } else 
 #endif /* USE_FFT2D_THREADS */
     {
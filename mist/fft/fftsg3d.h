@@ -23,20 +23,23 @@ functions
     ddct3d: Discrete Cosine Transform
     ddst3d: Discrete Sine Transform
 function prototypes
-    void cdft3d(int, int, int, int, double ***, double *, int *, double *);
-    void rdft3d(int, int, int, int, double ***, double *, int *, double *);
+    void cdft3d(int, int, int, int, double ***, double *, int *, double *, int);
+    void rdft3d(int, int, int, int, double ***, double *, int *, double *, int);
     void rdft3dsort(int, int, int, int, double ***);
-    void ddct3d(int, int, int, int, double ***, double *, int *, double *);
-    void ddst3d(int, int, int, int, double ***, double *, int *, double *);
+    void ddct3d(int, int, int, int, double ***, double *, int *, double *, int);
+    void ddst3d(int, int, int, int, double ***, double *, int *, double *, int);
 necessary package
     fftsg.c  : 1D-FFT package
 macro definitions
     USE_FFT3D_PTHREADS : default=not defined
-        FFT3D_MAX_THREADS     : must be 2^N, default=4
+        FFT3D_MAX_THREADS     : default number of threads (nthread), default=4
         FFT3D_THREADS_BEGIN_N : default=65536
     USE_FFT3D_WINTHREADS : default=not defined
-        FFT3D_MAX_THREADS     : must be 2^N, default=4
+        FFT3D_MAX_THREADS     : default number of threads (nthread), default=4
         FFT3D_THREADS_BEGIN_N : default=131072
+    nthread (last argument of cdft3d, rdft3d, ddct3d, ddst3d)
+        number of threads, rounded down to 2^N, default=FFT3D_MAX_THREADS
+        (threads are created through the MIST thread library)
 
 
 -------- Complex DFT (Discrete Fourier Transform) --------
@@ -83,7 +86,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= max(8*n1, 8*n2),        if single thread, 
-                length of t >= max(8*n1, 8*n2)*FFT3D_MAX_THREADS, 
+                length of t >= max(8*n1, 8*n2)*nthread, 
                                                        if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
@@ -248,7 +251,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= max(8*n1, 8*n2),        if single thread, 
-                length of t >= max(8*n1, 8*n2)*FFT3D_MAX_THREADS, 
+                length of t >= max(8*n1, 8*n2)*nthread, 
                                                        if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
@@ -313,7 +316,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= max(4*n1, 4*n2),        if single thread, 
-                length of t >= max(4*n1, 4*n2)*FFT3D_MAX_THREADS, 
+                length of t >= max(4*n1, 4*n2)*nthread, 
                                                        if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
@@ -400,7 +403,7 @@ macro definitions
         t[0...*]
                :work area (double *)
                 length of t >= max(4*n1, 4*n2),        if single thread, 
-                length of t >= max(4*n1, 4*n2)*FFT3D_MAX_THREADS, 
+                length of t >= max(4*n1, 4*n2)*nthread, 
                                                        if multi threads, 
                 t is dynamically allocated, if t == NULL.
         ip[0...*]
@@ -440,6 +443,12 @@ macro definitions
         .
 */
 
+#if defined( USE_FFT3D_PTHREADS ) || defined( USE_FFT3D_WINTHREADS )
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+#endif
+
 namespace ooura_fft{
 
 #include <stdio.h>
@@ -452,54 +461,50 @@ namespace ooura_fft{
 }
 
 
-#ifdef USE_FFT3D_PTHREADS
+#if defined( USE_FFT3D_PTHREADS ) || defined( USE_FFT3D_WINTHREADS )
 #define USE_FFT3D_THREADS
 #ifndef FFT3D_MAX_THREADS
 #define FFT3D_MAX_THREADS 4
 #endif
 #ifndef FFT3D_THREADS_BEGIN_N
+#ifdef USE_FFT3D_WINTHREADS
+#define FFT3D_THREADS_BEGIN_N 131072
+#else
 #define FFT3D_THREADS_BEGIN_N 65536
 #endif
-#include <pthread.h>
-#define fft3d_thread_t pthread_t
+#endif
+#define fft3d_thread_t mist::thread_handle
 #define fft3d_thread_create(thp,func,argp) { \
-    if (pthread_create(thp, NULL, func, (void *) (argp)) != 0) { \
-        fprintf(stderr, "fft3d thread error\n"); \
-        exit(1); \
-    } \
+    *(thp) = mist::create_thread(*(argp), fft3d_thread_function(func)); \
 }
 #define fft3d_thread_wait(th) { \
-    if (pthread_join(th, NULL) != 0) { \
-        fprintf(stderr, "fft3d thread error\n"); \
-        exit(1); \
-    } \
+    mist::wait_thread(th); \
+    mist::close_thread(th); \
 }
-#endif /* USE_FFT3D_PTHREADS */
+#endif /* USE_FFT3D_PTHREADS || USE_FFT3D_WINTHREADS */
 
 
-#ifdef USE_FFT3D_WINTHREADS
-#define USE_FFT3D_THREADS
-#ifndef FFT3D_MAX_THREADS
-#define FFT3D_MAX_THREADS 4
-#endif
-#ifndef FFT3D_THREADS_BEGIN_N
-#define FFT3D_THREADS_BEGIN_N 131072
-#endif
-#include <windows.h>
-#define fft3d_thread_t HANDLE
-#define fft3d_thread_create(thp,func,argp) { \
-    DWORD thid; \
-    *(thp) = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE) (func), (LPVOID) (argp), 0, &thid); \
-    if (*(thp) == 0) { \
-        fprintf(stderr, "fft3d thread error\n"); \
-        exit(1); \
-    } \
-}
-#define fft3d_thread_wait(th) { \
-    WaitForSingleObject(th, INFINITE); \
-    CloseHandle(th); \
+#ifdef USE_FFT3D_THREADS
+#define FFT3D_MAX_THREADS_DEFAULT FFT3D_MAX_THREADS
+#else
+#define FFT3D_MAX_THREADS_DEFAULT 1
+#endif /* USE_FFT3D_THREADS */
+
+
+/* number of threads actually used (power of 2, at most nthread) */
+inline int fft3d_thread_num(int nthread)
+{
+    int n = 1;
+#ifdef USE_FFT3D_THREADS
+    while (n * 2 <= nthread) {
+        n *= 2;
+    }
+#else
+    (void) nthread;
+#endif /* USE_FFT3D_THREADS */
+    return n;
 }
-#endif /* USE_FFT3D_WINTHREADS */
+
 
     void ddst(int n, int isgn, double *a, int *ip, double *w);
 
@@ -520,6 +525,14 @@ struct fft3d_arg_st {
 typedef struct fft3d_arg_st fft3d_arg_t;
 
 
+/* calls an Ooura thread routine from a mist thread */
+struct fft3d_thread_function {
+    void *(*func)(void *);
+    fft3d_thread_function(void *(*f)(void *)) : func(f) {}
+    void operator ()(fft3d_arg_t &arg) const { func(&arg); }
+};
+
+
 inline void *xdft3da_th(void *p)
 {
     int nthread, n0, n1, n2, n3, icr, isgn, *ip, i, j, k;
@@ -828,13 +841,12 @@ inline void *ddxt3db_th(void *p)
 }
 
 inline void xdft3da_subth(int n1, int n2, int n3, int icr, int isgn, 
-    double ***a, double *t, int *ip, double *w)
+    double ***a, double *t, int *ip, double *w, int nthread)
 {
-    fft3d_thread_t th[FFT3D_MAX_THREADS];
-    fft3d_arg_t ag[FFT3D_MAX_THREADS];
-    int nthread, nt, i;
+    fft3d_thread_t *th;
+    fft3d_arg_t *ag;
+    int nt, i;
     
-    nthread = FFT3D_MAX_THREADS;
     if (nthread > n1) {
         nthread = n1;
     }
@@ -844,6 +856,8 @@ inline void xdft3da_subth(int n1, int n2, int n3, int icr, int isgn,
     } else if (n3 < 4) {
         nt >>= 2;
     }
+    th = new fft3d_thread_t[nthread];
+    ag = new fft3d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -861,17 +875,18 @@ inline void xdft3da_subth(int n1, int n2, int n3, int icr, int isgn,
     for (i = 0; i < nthread; i++) {
         fft3d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 
 inline void cdft3db_subth(int n1, int n2, int n3, int isgn, double ***a, 
-    double *t, int *ip, double *w)
+    double *t, int *ip, double *w, int nthread)
 {
-    fft3d_thread_t th[FFT3D_MAX_THREADS];
-    fft3d_arg_t ag[FFT3D_MAX_THREADS];
-    int nthread, nt, i;
+    fft3d_thread_t *th;
+    fft3d_arg_t *ag;
+    int nt, i;
     
-    nthread = FFT3D_MAX_THREADS;
     if (nthread > n2) {
         nthread = n2;
     }
@@ -881,6 +896,8 @@ inline void cdft3db_subth(int n1, int n2, int n3, int isgn, double ***a,
     } else if (n3 < 4) {
         nt >>= 2;
     }
+    th = new fft3d_thread_t[nthread];
+    ag = new fft3d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -897,17 +914,18 @@ inline void cdft3db_subth(int n1, int n2, int n3, int isgn, double ***a,
     for (i = 0; i < nthread; i++) {
         fft3d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 
 inline void ddxt3da_subth(int n1, int n2, int n3, int ics, int isgn, 
-    double ***a, double *t, int *ip, double *w)
+    double ***a, double *t, int *ip, double *w, int nthread)
 {
-    fft3d_thread_t th[FFT3D_MAX_THREADS];
-    fft3d_arg_t ag[FFT3D_MAX_THREADS];
-    int nthread, nt, i;
+    fft3d_thread_t *th;
+    fft3d_arg_t *ag;
+    int nt, i;
     
-    nthread = FFT3D_MAX_THREADS;
     if (nthread > n1) {
         nthread = n1;
     }
@@ -915,6 +933,8 @@ inline void ddxt3da_subth(int n1, int n2, int n3, int ics, int isgn,
     if (n3 == 2) {
         nt >>= 1;
     }
+    th = new fft3d_thread_t[nthread];
+    ag = new fft3d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -932,17 +952,18 @@ inline void ddxt3da_subth(int n1, int n2, int n3, int ics, int isgn,
     for (i = 0; i < nthread; i++) {
         fft3d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 
 inline void ddxt3db_subth(int n1, int n2, int n3, int ics, int isgn, 
-    double ***a, double *t, int *ip, double *w)
+    double ***a, double *t, int *ip, double *w, int nthread)
 {
-    fft3d_thread_t th[FFT3D_MAX_THREADS];
-    fft3d_arg_t ag[FFT3D_MAX_THREADS];
-    int nthread, nt, i;
+    fft3d_thread_t *th;
+    fft3d_arg_t *ag;
+    int nt, i;
     
-    nthread = FFT3D_MAX_THREADS;
     if (nthread > n2) {
         nthread = n2;
     }
@@ -950,6 +971,8 @@ inline void ddxt3db_subth(int n1, int n2, int n3, int ics, int isgn,
     if (n3 == 2) {
         nt >>= 1;
     }
+    th = new fft3d_thread_t[nthread];
+    ag = new fft3d_arg_t[nthread];
     for (i = 0; i < nthread; i++) {
         ag[i].nthread = nthread;
         ag[i].n0 = i;
@@ -967,6 +990,8 @@ inline void ddxt3db_subth(int n1, int n2, int n3, int ics, int isgn,
     for (i = 0; i < nthread; i++) {
         fft3d_thread_wait(th[i]);
     }
+    delete [] th;
+    delete [] ag;
 }
 
 #endif /* USE_FFT3D_THREADS */
@@ -1330,10 +1355,12 @@ inline void ddxt3db_sub(int n1, int n2, int n3, int ics, int isgn,
 
 
 inline void cdft3d(int n1, int n2, int n3, int isgn, double ***a, 
-    double *t, int *ip, double *w)
+    double *t, int *ip, double *w, int nthread = FFT3D_MAX_THREADS_DEFAULT)
 {
     int n, itnull, nt;
     
+    nthread = fft3d_thread_num(nthread);
+    
     n = n1;
     if (n < n2) {
         n = n2;
@@ -1353,9 +1380,7 @@ inline void cdft3d(int n1, int n2, int n3, int isgn, double ***a,
             nt = n2;
         }
         nt *= 8;
-#ifdef USE_FFT3D_THREADS
-        nt *= FFT3D_MAX_THREADS;
-#endif /* USE_FFT3D_THREADS */
+        nt *= nthread;
         if (n3 == 4) {
             nt >>= 1;
         } else if (n3 < 4) {
@@ -1365,9 +1390,9 @@ inline void cdft3d(int n1, int n2, int n3, int isgn, double ***a,
         fft3d_alloc_error_check(t);
     }
 #ifdef USE_FFT3D_THREADS
-    if ((double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
-        xdft3da_subth(n1, n2, n3, 0, isgn, a, t, ip, w);
-        cdft3db_subth(n1, n2, n3, isgn, a, t, ip, w);
+    if (nthread > 1 && (double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
+        xdft3da_subth(n1, n2, n3, 0, isgn, a, t, ip, w, nthread);
+        cdft3db_subth(n1, n2, n3, isgn, a, t, ip, w, nthread);
     } else 
 #endif /* USE_FFT3D_THREADS */
     {
@@ -1381,10 +1406,12 @@ inline void cdft3d(int n1, int n2, int n3, int isgn, double ***a,
 
 
 inline void rdft3d(int n1, int n2, int n3, int isgn, double ***a, 
-    double *t, int *ip, double *w)
+    double *t, int *ip, double *w, int nthread = FFT3D_MAX_THREADS_DEFAULT)
 {
     int n, nw, nc, itnull, nt;
     
+    nthread = fft3d_thread_num(nthread);
+    
     n = n1;
     if (n < n2) {
         n = n2;
@@ -1411,9 +1438,7 @@ inline void rdft3d(int n1, int n2, int n3, int isgn, double ***a,
             nt = n2;
         }
         nt *= 8;
-#ifdef USE_FFT3D_THREADS
-        nt *= FFT3D_MAX_THREADS;
-#endif /* USE_FFT3D_THREADS */
+        nt *= nthread;
         if (n3 == 4) {
             nt >>= 1;
         } else if (n3 < 4) {
@@ -1423,14 +1448,14 @@ inline void rdft3d(int n1, int n2, int n3, int isgn, double ***a,
         fft3d_alloc_error_check(t);
     }
 #ifdef USE_FFT3D_THREADS
-    if ((double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
+    if (nthread > 1 && (double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
         if (isgn < 0) {
             rdft3d_sub(n1, n2, n3, isgn, a);
-            cdft3db_subth(n1, n2, n3, isgn, a, t, ip, w);
+            cdft3db_subth(n1, n2, n3, isgn, a, t, ip, w, nthread);
         }
-        xdft3da_subth(n1, n2, n3, 1, isgn, a, t, ip, w);
+        xdft3da_subth(n1, n2, n3, 1, isgn, a, t, ip, w, nthread);
         if (isgn >= 0) {
-            cdft3db_subth(n1, n2, n3, isgn, a, t, ip, w);
+            cdft3db_subth(n1, n2, n3, isgn, a, t, ip, w, nthread);
             rdft3d_sub(n1, n2, n3, isgn, a);
         }
     } else 
@@ -1534,10 +1559,12 @@ inline void rdft3dsort(int n1, int n2, int n3, int isgn, double ***a)
 
 
 inline void ddct3d(int n1, int n2, int n3, int isgn, double ***a, 
-    double *t, int *ip, double *w)
+    double *t, int *ip, double *w, int nthread = FFT3D_MAX_THREADS_DEFAULT)
 {
     int n, nw, nc, itnull, nt;
     
+    nthread = fft3d_thread_num(nthread);
+    
     n = n1;
     if (n < n2) {
         n = n2;
@@ -1563,9 +1590,7 @@ inline void ddct3d(int n1, int n2, int n3, int isgn, double ***a,
             nt = n2;
         }
         nt *= 4;
-#ifdef USE_FFT3D_THREADS
-        nt *= FFT3D_MAX_THREADS;
-#endif /* USE_FFT3D_THREADS */
+        nt *= nthread;
         if (n3 == 2) {
             nt >>= 1;
         }
@@ -1573,9 +1598,9 @@ inline void ddct3d(int n1, int n2, int n3, int isgn, double ***a,
         fft3d_alloc_error_check(t);
     }
 #ifdef USE_FFT3D_THREADS
-    if ((double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
-        ddxt3da_subth(n1, n2, n3, 0, isgn, a, t, ip, w);
-        ddxt3db_subth(n1, n2, n3, 0, isgn, a, t, ip, w);
+    if (nthread > 1 && (double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
+        ddxt3da_subth(n1, n2, n3, 0, isgn, a, t, ip, w, nthread);
+        ddxt3db_subth(n1, n2, n3, 0, isgn, a, t, ip, w, nthread);
     } else 
 #endif /* USE_FFT3D_THREADS */
     {
@@ -1589,10 +1614,12 @@ inline void ddct3d(int n1, int n2, int n3, int isgn, double ***a,
 
 
 inline void ddst3d(int n1, int n2, int n3, int isgn, double ***a, 
-    double *t, int *ip, double *w)
+    double *t, int *ip, double *w, int nthread = FFT3D_MAX_THREADS_DEFAULT)
 {
     int n, nw, nc, itnull, nt;
     
+    nthread = fft3d_thread_num(nthread);
+    
     n = n1;
     if (n < n2) {
         n = n2;
@@ -1618,9 +1645,7 @@ inline void ddst3d(int n1, int n2, int n3, int isgn, double ***a,
             nt = n2;
         }
         nt *= 4;
-#ifdef USE_FFT3D_THREADS
-        nt *= FFT3D_MAX_THREADS;
-#endif /* USE_FFT3D_THREADS */
+        nt *= nthread;
         if (n3 == 2) {
             nt >>= 1;
         }
@@ -1628,9 +1653,9 @@ inline void ddst3d(int n1, int n2, int n3, int isgn, double ***a,
         fft3d_alloc_error_check(t);
     }
 #ifdef USE_FFT3D_THREADS
-    if ((double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
-        ddxt3da_subth(n1, n2, n3, 1, isgn, a, t, ip, w);
-        ddxt3db_subth(n1, n2, n3, 1, isgn, a, t, ip, w);
+    if (nthread > 1 && (double) n1 * n2 * n3 >= (double) FFT3D_THREADS_BEGIN_N) {
+        ddxt3da_subth(n1, n2, n3, 1, isgn, a, t, ip, w, nthread);
+        ddxt3db_subth(n1, n2, n3, 1, isgn, a, t, ip, w, nthread);
     } else 
 #endif /* USE_FFT3D_THREADS */
     {
@@ -0,0 +1,1153 @@
+//
+// Copyright (c) 2003-2011, MIST Project, Nagoya University
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/// @file mist/fft/mixed_radix.h
+//!
+//! @brief CӒ̃f[^ɑ΂鍂t[Gϊ̃ASY
+//!
+//! f[^ 4, 2, 3, 5, 7 ̐ςɕłꍇ Stockham ^̍FFTŌvZC
+//! ȊȎf܂ޏꍇ Bluestein @ichirp-z ϊjɂ2̎w撷FFTɋAD
+//! YFFTpbP[Wifftsg.hCfftsg2d.hCfftsg3d.hj cdftCddctCddst Ɠ`Ef[^zuŌvZD
+//!
+
+#ifndef __INCLUDE_FFT_MIXED_RADIX_H__
+#define __INCLUDE_FFT_MIXED_RADIX_H__
+
+
+#ifndef __INCLUDE_MIST_CONF_H__
+#include "../config/mist_conf.h"
+#endif
+
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <algorithm>
+
+// mistOԂ̎n܂
+_MIST_BEGIN
+
+
+namespace __mixed_radix__
+{
+	typedef std::complex< double > complex_type;
+
+	// f̐ρistd::complex ̏Z NaN ̌𔺂xߓWJČvZj
+	inline complex_type multiply( const complex_type &a, const complex_type &b )
+	{
+		return( complex_type( a.real( ) * b.real( ) - a.imag( ) * b.imag( ), a.real( ) * b.imag( ) + a.imag( ) * b.real( ) ) );
+	}
+
+	// isgn < 0 ̏ꍇ w CȊO w ̋|
+	inline complex_type rotate( const complex_type &a, const complex_type &w, int isgn )
+	{
+		if( isgn < 0 )
+		{
+			return( complex_type( a.real( ) * w.real( ) - a.imag( ) * w.imag( ), a.real( ) * w.imag( ) + a.imag( ) * w.real( ) ) );
+		}
+		else
+		{
+			return( complex_type( a.real( ) * w.real( ) + a.imag( ) * w.imag( ), a.imag( ) * w.real( ) - a.real( ) * w.imag( ) ) );
+		}
+	}
+
+	// P i |
+	inline complex_type multiply_i( const complex_type &a )
+	{
+		return( complex_type( -a.imag( ), a.real( ) ) );
+	}
+
+
+	// Stockham ^FFT̊2̒i
+	//  ns ̕ϊ radix ܂Ƃ߂āC ns * radix ̕ϊ x  y ɍ쐬
+	inline void butterfly2( const complex_type *x, complex_type *y, size_t n, size_t ns, const complex_type *table, int isgn )
+	{
+		const size_t m = n / 2;
+		const size_t step = n / ( ns * 2 );
+
+		for( size_t j = 0, b = 0 ; j < m ; b += ns * 2 )
+		{
+			for( size_t k = 0 ; k < ns ; k++, j++ )
+			{
+				complex_type a0 = x[ j ];
+				complex_type a1 = rotate( x[ j + m ], table[ k * step ], isgn );
+
+				y[ b + k ]      = a0 + a1;
+				y[ b + k + ns ] = a0 - a1;
+			}
+		}
+	}
+
+	// Stockham ^FFT̊4̒i
+	inline void butterfly4( const complex_type *x, complex_type *y, size_t n, size_t ns, const complex_type *table, int isgn )
+	{
+		const size_t m = n / 4;
+		const size_t step = n / ( ns * 4 );
+		const double sgn = isgn < 0 ? -1.0 : 1.0;
+
+		for( size_t j = 0, b = 0 ; j < m ; b += ns * 4 )
+		{
+			for( size_t k = 0 ; k < ns ; k++, j++ )
+			{
+				complex_type a0 = x[ j ];
+				complex_type a1 = rotate( x[ j + m ], table[ k * step ], isgn );
+				complex_type a2 = rotate( x[ j + m * 2 ], table[ k * step * 2 ], isgn );
+				complex_type a3 = rotate( x[ j + m * 3 ], table[ k * step * 3 ], isgn );
+
+				complex_type t0 = a0 + a2;
+				complex_type t1 = a0 - a2;
+				complex_type t2 = a1 + a3;
+				complex_type t3 = multiply_i( a1 - a3 ) * sgn;
+
+				y[ b + k ]          = t0 + t2;
+				y[ b + k + ns ]     = t1 + t3;
+				y[ b + k + ns * 2 ] = t0 - t2;
+				y[ b + k + ns * 3 ] = t1 - t3;
+			}
+		}
+	}
+
+	// Stockham ^FFT̊i3, 5, 7j̒i
+	// Ώ̂ȍ܂Ƃ߂ y[ k ]  y[ P - k ] 𓯎ɌvZ
+	template < size_t P >
+	inline void butterfly_odd( const complex_type *x, complex_type *y, size_t n, size_t ns, const complex_type *table, int isgn )
+	{
+		const size_t H = ( P - 1 ) / 2;
+		const size_t m = n / P;
+		const size_t step = n / ( ns * P );
+		const double pi = 3.1415926535897932384626433832795;
+		const double sgn = isgn < 0 ? -1.0 : 1.0;
+
+		double c[ P ], s[ P ];
+		for( size_t l = 0 ; l < P ; l++ )
+		{
+			c[ l ] = std::cos( 2.0 * pi * static_cast< double >( l ) / static_cast< double >( P ) );
+			s[ l ] = std::sin( 2.0 * pi * static_cast< double >( l ) / static_cast< double >( P ) ) * sgn;
+		}
+
+		complex_type a[ P ], sum[ H + 1 ], dif[ H + 1 ];
+
+		for( size_t j = 0, b = 0 ; j < m ; b += ns * P )
+		{
+			for( size_t k = 0 ; k < ns ; k++, j++ )
+			{
+				a[ 0 ] = x[ j ];
+				for( size_t q = 1 ; q < P ; q++ )
+				{
+					a[ q ] = rotate( x[ j + m * q ], table[ k * step * q ], isgn );
+				}
+
+				complex_type y0 = a[ 0 ];
+				for( size_t l = 1 ; l <= H ; l++ )
+				{
+					sum[ l ] = a[ l ] + a[ P - l ];
+					dif[ l ] = a[ l ] - a[ P - l ];
+					y0 += sum[ l ];
+				}
+				y[ b + k ] = y0;
+
+				for( size_t q = 1 ; q <= H ; q++ )
+				{
+					complex_type re = a[ 0 ], im( 0.0, 0.0 );
+					for( size_t l = 1 ; l <= H ; l++ )
+					{
+						size_t lq = ( l * q ) % P;
+						re += sum[ l ] * c[ lq ];
+						im += dif[ l ] * s[ lq ];
+					}
+					im = multiply_i( im );
+
+					y[ b + k + ns * q ]       = re + im;
+					y[ b + k + ns * ( P - q ) ] = re - im;
+				}
+			}
+		}
+	}
+
+
+	//  4, 2, 3, 5, 7 ̐ςɕłf[^ɑ΂ Stockham ^̎ȐFFT
+	class stockham
+	{
+	private:
+		size_t size_;
+		std::vector< size_t > radix_;
+		std::vector< complex_type > table_;		// exp( -2i k / n )
+
+	public:
+		// n  4, 2, 3, 5, 7 ̐ςɕiłȂꍇ falsej
+		static bool factorize( size_t n, std::vector< size_t > &radix )
+		{
+			static const size_t primes[] = { 3, 5, 7 };
+
+			radix.clear( );
+
+			if( n == 0 )
+			{
+				return( false );
+			}
+
+			while( n % 4 == 0 )
+			{
+				radix.push_back( 4 );
+				n /= 4;
+			}
+			if( n % 2 == 0 )
+			{
+				radix.push_back( 2 );
+				n /= 2;
+			}
+			for( size_t i = 0 ; i < sizeof( primes ) / sizeof( primes[ 0 ] ) ; i++ )
+			{
+				while( n % primes[ i ] == 0 )
+				{
+					radix.push_back( primes[ i ] );
+					n /= primes[ i ];
+				}
+			}
+
+			return( n == 1 );
+		}
+
+		bool initialize( size_t n )
+		{
+			if( !factorize( n, radix_ ) )
+			{
+				size_ = 0;
+				return( false );
+			}
+
+			const double pi = 3.1415926535897932384626433832795;
+			size_ = n;
+			table_.resize( n );
+			for( size_t k = 0 ; k < n ; k++ )
+			{
+				double t = 2.0 * pi * static_cast< double >( k ) / static_cast< double >( n );
+				table_[ k ] = complex_type( std::cos( t ), -std::sin( t ) );
+			}
+
+			return( true );
+		}
+
+		size_t size( ) const { return( size_ ); }
+
+		/// @brief KȂFFTvZiisgn < 0  exp( -2i jk / n )CȊO exp( 2i jk / n )j
+		//!
+		//! work ɂ size( ) ̕f̈悪Kv
+		//!
+		void transform( complex_type *data, complex_type *work, int isgn ) const
+		{
+			complex_type *x = data;
+			complex_type *y = work;
+			size_t ns = 1;
+
+			for( size_t i = 0 ; i < radix_.size( ) ; i++ )
+			{
+				switch( radix_[ i ] )
+				{
+				case 2:
+					butterfly2( x, y, size_, ns, &table_[ 0 ], isgn );
+					break;
+
+				case 3:
+					butterfly_odd< 3 >( x, y, size_, ns, &table_[ 0 ], isgn );
+					break;
+
+				case 4:
+					butterfly4( x, y, size_, ns, &table_[ 0 ], isgn );
+					break;
+
+				case 5:
+					butterfly_odd< 5 >( x, y, size_, ns, &table_[ 0 ], isgn );
+					break;
+
+				case 7:
+				default:
+					butterfly_odd< 7 >( x, y, size_, ns, &table_[ 0 ], isgn );
+					break;
+				}
+
+				std::swap( x, y );
+				ns *= radix_[ i ];
+			}
+
+			if( x != data )
+			{
+				for( size_t i = 0 ; i < size_ ; i++ )
+				{
+					data[ i ] = x[ i ];
+				}
+			}
+		}
+
+		stockham( ) : size_( 0 )
+		{
+		}
+	};
+
+
+	/// @brief CӒ̕fFFT
+	//!
+	//! 4, 2, 3, 5, 7 ̐ςɕłȂ Bluestein @pāC2̎w撷̏ݍ݂ƂČvZ
+	//!
+	class complex_fft
+	{
+	private:
+		size_t size_;
+		stockham fft_;						//  size_ FFTC܂ Bluestein @̏ݍ݂ɗp2̎w撷FFT
+		std::vector< complex_type > chirp_;	// exp( -i k^2 / n )
+		std::vector< complex_type > kernel_;	// conj( chirp ) FFTiݍݒŐKς݁j
+
+	public:
+		void initialize( size_t n )
+		{
+			size_ = n;
+			chirp_.clear( );
+			kernel_.clear( );
+
+			if( n == 0 || fft_.initialize( n ) )
+			{
+				return;
+			}
+
+			// Bluestein @
+			size_t m = 1;
+			while( m < 2 * n - 1 )
+			{
+				m *= 2;
+			}
+			fft_.initialize( m );
+
+			const double pi = 3.1415926535897932384626433832795;
+			chirp_.resize( n );
+			for( size_t k = 0 ; k < n ; k++ )
+			{
+				// k^2  2n ̏]ŋ߂Ċpx̐xۂ
+				unsigned long long kk = static_cast< unsigned long long >( k ) * k % ( 2 * static_cast< unsigned long long >( n ) );
+				double t = pi * static_cast< double >( kk ) / static_cast< double >( n );
+				chirp_[ k ] = complex_type( std::cos( t ), -std::sin( t ) );
+			}
+
+			std::vector< complex_type > work( m );
+			kernel_.assign( m, complex_type( 0.0, 0.0 ) );
+			kernel_[ 0 ] = std::conj( chirp_[ 0 ] ) / static_cast< double >( m );
+			for( size_t k = 1 ; k < n ; k++ )
+			{
+				kernel_[ k ] = kernel_[ m - k ] = std::conj( chirp_[ k ] ) / static_cast< double >( m );
+			}
+			fft_.transform( &kernel_[ 0 ], &work[ 0 ], -1 );
+		}
+
+		size_t size( ) const { return( size_ ); }
+
+		/// @brief transform ɕKvȍƗ̈̑傫if̌j
+		size_t work_size( ) const { return( chirp_.empty( ) ? size_ : 2 * fft_.size( ) ); }
+
+		/// @brief KȂFFTvZiisgn < 0  exp( -2i jk / n )CȊO exp( 2i jk / n )j
+		void transform( complex_type *data, complex_type *work, int isgn ) const
+		{
+			if( chirp_.empty( ) )
+			{
+				fft_.transform( data, work, isgn );
+				return;
+			}
+
+			// tϊ conj( FFT( conj( x ) ) ) ƂČvZ
+			const size_t m = fft_.size( );
+			complex_type *a = work;
+			size_t k;
+
+			for( k = 0 ; k < size_ ; k++ )
+			{
+				a[ k ] = multiply( isgn < 0 ? data[ k ] : std::conj( data[ k ] ), chirp_[ k ] );
+			}
+			for( ; k < m ; k++ )
+			{
+				a[ k ] = complex_type( 0.0, 0.0 );
+			}
+
+			fft_.transform( a, work + m, -1 );
+			for( k = 0 ; k < m ; k++ )
+			{
+				a[ k ] = multiply( a[ k ], kernel_[ k ] );
+			}
+			fft_.transform( a, work + m, 1 );
+
+			for( k = 0 ; k < size_ ; k++ )
+			{
+				complex_type v = multiply( a[ k ], chirp_[ k ] );
+				data[ k ] = isgn < 0 ? v : std::conj( v );
+			}
+		}
+
+		complex_fft( size_t n = 0 ) : size_( 0 )
+		{
+			initialize( n );
+		}
+	};
+
+
+	/// @brief f[^̔CӒFFT
+	//!
+	//!  n ̎f[^C񕉂̎g 0`n/2  n/2+1 ̕fɕϊi̎g X[ n - k ] = conj( X[ k ] )jD
+	//! n ̏ꍇ͋ԖڂCԖڂƂ钷 n/2 ̕fFFTɋAD
+	//!
+	class real_fft
+	{
+	private:
+		size_t size_;
+		complex_fft fft_;						//  n/2in ̏ꍇ nj̕fFFT
+		std::vector< complex_type > table_;	// exp( -2i k / n )C0 <= k <= n/2
+
+	public:
+		void initialize( size_t n )
+		{
+			size_ = n;
+			table_.clear( );
+
+			if( n % 2 != 0 )
+			{
+				fft_.initialize( n );
+				return;
+			}
+
+			const double pi = 3.1415926535897932384626433832795;
+			fft_.initialize( n / 2 );
+			table_.resize( n / 2 + 1 );
+			for( size_t k = 0 ; k <= n / 2 ; k++ )
+			{
+				double t = 2.0 * pi * static_cast< double >( k ) / static_cast< double >( n );
+				table_[ k ] = complex_type( std::cos( t ), -std::sin( t ) );
+			}
+		}
+
+		size_t size( ) const { return( size_ ); }
+
+		/// @brief ϊɕKvȍƗ̈̑傫if̌j
+		size_t work_size( ) const { return( fft_.size( ) + fft_.work_size( ) ); }
+
+		/// @brief f[^ inin j outin/2+1 jɕϊiexp( -2i jk / n )j
+		void forward( const double *in, complex_type *out, complex_type *work ) const
+		{
+			const size_t n = size_;
+			const size_t m = fft_.size( );
+			complex_type *z = work;
+			size_t k;
+
+			if( n % 2 != 0 )
+			{
+				for( k = 0 ; k < n ; k++ )
+				{
+					z[ k ] = complex_type( in[ k ], 0.0 );
+				}
+				fft_.transform( z, work + m, -1 );
+				for( k = 0 ; k <= n / 2 ; k++ )
+				{
+					out[ k ] = z[ k ];
+				}
+				return;
+			}
+
+			for( k = 0 ; k < m ; k++ )
+			{
+				z[ k ] = complex_type( in[ 2 * k ], in[ 2 * k + 1 ] );
+			}
+
+			fft_.transform( z, work + m, -1 );
+
+			// ԖڂƊԖڂFFTɕč
+			for( k = 0 ; k <= m ; k++ )
+			{
+				complex_type zk = z[ k < m ? k : 0 ];
+				complex_type zc = std::conj( z[ k > 0 ? m - k : 0 ] );
+				complex_type e = ( zk + zc ) * 0.5;
+				complex_type o = ( zk - zc ) * 0.5;
+				out[ k ] = e + multiply( complex_type( o.imag( ), -o.real( ) ), table_[ k ] );
+			}
+		}
+
+		/// @brief 񕉂̎g inin/2+1 jf[^ outin j𕜌iexp( 2i jk / n )CKȂj
+		void inverse( const complex_type *in, double *out, complex_type *work ) const
+		{
+			const size_t n = size_;
+			const size_t m = fft_.size( );
+			complex_type *z = work;
+			size_t k;
+
+			if( n % 2 != 0 )
+			{
+				z[ 0 ] = in[ 0 ];
+				for( k = 1 ; k <= n / 2 ; k++ )
+				{
+					z[ k ] = in[ k ];
+					z[ n - k ] = std::conj( in[ k ] );
+				}
+				fft_.transform( z, work + m, 1 );
+				for( k = 0 ; k < n ; k++ )
+				{
+					out[ k ] = z[ k ].real( );
+				}
+				return;
+			}
+
+			for( k = 0 ; k < m ; k++ )
+			{
+				complex_type xc = std::conj( in[ m - k ] );
+				complex_type e = in[ k ] + xc;
+				complex_type o = rotate( in[ k ] - xc, table_[ k ], 1 );
+				z[ k ] = e + multiply_i( o );
+			}
+
+			fft_.transform( z, work + m, 1 );
+
+			for( k = 0 ; k < m ; k++ )
+			{
+				out[ 2 * k ]     = z[ k ].real( );
+				out[ 2 * k + 1 ] = z[ k ].imag( );
+			}
+		}
+
+		real_fft( size_t n = 0 ) : size_( 0 )
+		{
+			initialize( n );
+		}
+	};
+
+
+	/// @brief 1̕ϊ̎
+	enum transform_type
+	{
+		CDFT,	///< @brief fUt[Gϊiooura_fft::cdft Ɠj
+		DDCT,	///< @brief URTCϊiooura_fft::ddct Ɠj
+		DDST	///< @brief UTCϊiooura_fft::ddst Ɠj
+	};
+
+
+	/// @brief ỸpbP[WƓ`Ef[^zuŁCCӒ1f[^ϊ
+	//!
+	//! DCT/DST  Makhoul ̕@ɂ蓯̕fFFTɋA
+	//!
+	class line_transform
+	{
+	private:
+		transform_type type_;
+		size_t size_;
+		complex_fft fft_;						// CDFT ɗp镡fFFT
+		real_fft rfft_;							// DDCTCDDST ɗpFFT
+		std::vector< complex_type > table_;		// exp( -i k / 2n )
+
+	public:
+		void initialize( transform_type type, size_t n )
+		{
+			type_ = type;
+			size_ = n;
+			fft_.initialize( type == CDFT ? n : 0 );
+			rfft_.initialize( type == CDFT ? 0 : n );
+
+			table_.clear( );
+			if( type != CDFT )
+			{
+				const double pi = 3.1415926535897932384626433832795;
+				table_.resize( n );
+				for( size_t k = 0 ; k < n ; k++ )
+				{
+					double t = pi * static_cast< double >( k ) / static_cast< double >( 2 * n );
+					table_[ k ] = complex_type( std::cos( t ), -std::sin( t ) );
+				}
+			}
+		}
+
+		/// @brief f[^̗vfiCDFT̏ꍇ͕f̌j
+		size_t size( ) const { return( size_ ); }
+
+		/// @brief 1vf double ̌
+		size_t element_size( ) const { return( type_ == CDFT ? 2 : 1 ); }
+
+		/// @brief ϊɕKvȍƗ̈̑傫if̌j
+		size_t work_size( ) const { return( type_ == CDFT ? fft_.work_size( ) : ( size_ + 1 ) / 2 + size_ / 2 + 1 + rfft_.work_size( ) ); }
+
+		/// @brief 1f[^ a ϊ
+		void operator ()( double *a, int isgn, complex_type *work ) const
+		{
+			switch( type_ )
+			{
+			case CDFT:
+				fft_.transform( reinterpret_cast< complex_type * >( a ), work, isgn );
+				break;
+
+			case DDCT:
+				ddct( a, isgn, work );
+				break;
+
+			case DDST:
+				ddst( a, isgn, work );
+				break;
+			}
+		}
+
+	protected:
+		void ddct( double *a, int isgn, complex_type *work ) const
+		{
+			// v ͎Ȃ̂ŁCFFT V ͔񕉂̎g 0`n/2 FFTň
+			const size_t n = size_;
+			const size_t h = n / 2;
+			double *v = reinterpret_cast< double * >( work );
+			complex_type *V = work + ( n + 1 ) / 2;
+			complex_type *w = V + h + 1;
+			size_t j;
+
+			if( isgn < 0 )
+			{
+				// C[ k ] = Re( exp( -i k / 2n ) FFT( v )[ k ] )Cv ͋ԖڂOCԖڂ납ׂ
+				for( j = 0 ; 2 * j < n ; j++ )
+				{
+					v[ j ] = a[ 2 * j ];
+				}
+				for( j = 0 ; 2 * j + 1 < n ; j++ )
+				{
+					v[ n - 1 - j ] = a[ 2 * j + 1 ];
+				}
+
+				rfft_.forward( v, V, w );
+
+				for( j = 0 ; j <= h ; j++ )
+				{
+					a[ j ] = table_[ j ].real( ) * V[ j ].real( ) - table_[ j ].imag( ) * V[ j ].imag( );
+				}
+				for( ; j < n ; j++ )
+				{
+					// V[ j ] = conj( V[ n - j ] )
+					a[ j ] = table_[ j ].real( ) * V[ n - j ].real( ) + table_[ j ].imag( ) * V[ n - j ].imag( );
+				}
+			}
+			else
+			{
+				// ̎菇̋tǂ
+				V[ 0 ] = complex_type( a[ 0 ], 0.0 );
+				for( j = 1 ; j <= h ; j++ )
+				{
+					V[ j ] = rotate( complex_type( a[ j ], -a[ n - j ] ), table_[ j ], 1 ) * 0.5;
+				}
+
+				rfft_.inverse( V, v, w );
+
+				for( j = 0 ; 2 * j < n ; j++ )
+				{
+					a[ 2 * j ] = v[ j ];
+				}
+				for( j = 0 ; 2 * j + 1 < n ; j++ )
+				{
+					a[ 2 * j + 1 ] = v[ n - 1 - j ];
+				}
+			}
+		}
+
+		void ddst( double *a, int isgn, complex_type *work ) const
+		{
+			// sin( ( j + 1/2 )k / n ) = ( -1 )^j cos( ( j + 1/2 )( n - k ) / n ) pDCTɋA
+			const size_t n = size_;
+			size_t j;
+
+			if( isgn < 0 )
+			{
+				for( j = 1 ; j < n ; j += 2 )
+				{
+					a[ j ] = -a[ j ];
+				}
+
+				ddct( a, isgn, work );
+
+				// a[ 0 ] = S[ n ]Ca[ k ] = S[ k ] ̏ɕׂ
+				std::reverse( a + 1, a + n );
+			}
+			else
+			{
+				std::reverse( a + 1, a + n );
+
+				ddct( a, isgn, work );
+
+				for( j = 1 ; j < n ; j += 2 )
+				{
+					a[ j ] = -a[ j ];
+				}
+			}
+		}
+
+	public:
+		line_transform( ) : type_( CDFT ), size_( 0 )
+		{
+		}
+
+		line_transform( transform_type type, size_t n ) : type_( type ), size_( 0 )
+		{
+			initialize( type, n );
+		}
+	};
+
+
+	// 3f[^ a[ n1 ][ n2 ][ n3 ] 1̎ɉ1ϊsXbh
+	// AĂȂ́CLbVCLא4܂Ƃ߂čƗ̈ɏW߂Ăϊ
+	class line_transform_thread : public mist::thread< line_transform_thread >
+	{
+	public:
+		typedef mist::thread< line_transform_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+
+	private:
+		const line_transform *transform_;
+		double ***data_;
+		size_type n1_;
+		size_type n2_;
+		size_type n3_;
+		size_type axis_;
+		int isgn_;
+		size_type thread_id_;
+		size_type thread_num_;
+
+	public:
+		void setup_parameters( const line_transform &transform, double ***data, size_type n1, size_type n2, size_type n3, size_type axis, int isgn, size_type thread_id, size_type thread_num )
+		{
+			transform_  = &transform;
+			data_       = data;
+			n1_         = n1;
+			n2_         = n2;
+			n3_         = n3;
+			axis_       = axis;
+			isgn_       = isgn;
+			thread_id_  = thread_id;
+			thread_num_ = thread_num;
+		}
+
+		const line_transform_thread& operator =( const line_transform_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				transform_ = p.transform_;
+				data_ = p.data_;
+				n1_ = p.n1_;
+				n2_ = p.n2_;
+				n3_ = p.n3_;
+				axis_ = p.axis_;
+				isgn_ = p.isgn_;
+				thread_id_ = p.thread_id_;
+				thread_num_ = p.thread_num_;
+			}
+			return( *this );
+		}
+
+		line_transform_thread( ) : transform_( NULL ), data_( NULL ), n1_( 0 ), n2_( 0 ), n3_( 0 ), axis_( 0 ), isgn_( -1 ), thread_id_( 0 ), thread_num_( 1 )
+		{
+		}
+
+		line_transform_thread( const line_transform_thread &p ) : base( p ), transform_( p.transform_ ), data_( p.data_ ), n1_( p.n1_ ), n2_( p.n2_ ), n3_( p.n3_ ),
+																	axis_( p.axis_ ), isgn_( p.isgn_ ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const size_type block = 4;
+			const line_transform &transform = *transform_;
+			const size_type e = transform.element_size( );
+			const size_type len = transform.size( );
+			std::vector< complex_type > work( transform.work_size( ) );
+
+			if( axis_ == 2 )
+			{
+				// AĂ鎲͂̂܂ܕϊ
+				size_type lines = n1_ * n2_;
+				for( size_type l = lines * thread_id_ / thread_num_ ; l < lines * ( thread_id_ + 1 ) / thread_num_ ; l++ )
+				{
+					transform( data_[ l / n2_ ][ l % n2_ ], isgn_, &work[ 0 ] );
+				}
+				return( 0 );
+			}
+
+			std::vector< double > buff( block * len * e );
+			size_type nb = ( n3_ + block - 1 ) / block;
+			size_type units = ( axis_ == 1 ? n1_ : n2_ ) * nb;
+
+			for( size_type u = units * thread_id_ / thread_num_ ; u < units * ( thread_id_ + 1 ) / thread_num_ ; u++ )
+			{
+				size_type l  = u / nb;
+				size_type k0 = ( u % nb ) * block;
+				size_type kc = n3_ - k0 < block ? n3_ - k0 : block;
+				size_type b, m, c;
+
+				for( m = 0 ; m < len ; m++ )
+				{
+					const double *p = ( axis_ == 1 ? data_[ l ][ m ] : data_[ m ][ l ] ) + k0 * e;
+					for( b = 0 ; b < kc ; b++ )
+					{
+						for( c = 0 ; c < e ; c++ )
+						{
+							buff[ ( b * len + m ) * e + c ] = p[ b * e + c ];
+						}
+					}
+				}
+
+				for( b = 0 ; b < kc ; b++ )
+				{
+					transform( &buff[ b * len * e ], isgn_, &work[ 0 ] );
+				}
+
+				for( m = 0 ; m < len ; m++ )
+				{
+					double *p = ( axis_ == 1 ? data_[ l ][ m ] : data_[ m ][ l ] ) + k0 * e;
+					for( b = 0 ; b < kc ; b++ )
+					{
+						for( c = 0 ; c < e ; c++ )
+						{
+							p[ b * e + c ] = buff[ ( b * len + m ) * e + c ];
+						}
+					}
+				}
+			}
+
+			return( 0 );
+		}
+	};
+
+
+	/// @brief 3f[^ a[ n1 ][ n2 ][ n3 ] ̊eɉāC쐬ς݂1ϊs
+	//!
+	//! ϊ̗vf1ȉ͕̎ϊȂ
+	//!
+	//! @param[in]     t1         c 1ڂ̕ϊ
+	//! @param[in]     t2         c 2ڂ̕ϊ
+	//! @param[in]     t3         c 3ڂ̕ϊ
+	//! @param[in]     n1         c 1ڂ̗vf
+	//! @param[in]     n2         c 2ڂ̗vf
+	//! @param[in]     n3         c 3ڂ̗vfiCDFT̏ꍇ͕f̌j
+	//! @param[in]     isgn       c ϊ̌iỸpbP[WƓj
+	//! @param[in,out] a          c o̓f[^
+	//! @param[in]     thread_num c gpXbh
+	//!
+	inline void transform3d( const line_transform &t1, const line_transform &t2, const line_transform &t3, size_t n1, size_t n2, size_t n3, int isgn, double ***a, size_t thread_num )
+	{
+		if( thread_num == 0 )
+		{
+			thread_num = 1;
+		}
+
+		const line_transform *transform[ 3 ] = { &t1, &t2, &t3 };
+		line_transform_thread *thread = new line_transform_thread[ thread_num ];
+
+		for( size_t axis = 0 ; axis < 3 ; axis++ )
+		{
+			if( transform[ axis ]->size( ) <= 1 )
+			{
+				// 1̕ϊ͍Pϊ
+				continue;
+			}
+
+			for( size_t i = 0 ; i < thread_num ; i++ )
+			{
+				thread[ i ].setup_parameters( *transform[ axis ], a, n1, n2, n3, axis, isgn, i, thread_num );
+			}
+
+			do_threads( thread, thread_num );
+		}
+
+		delete [] thread;
+	}
+
+
+	/// @brief 3f[^ a[ n1 ][ n2 ][ n3 ] ̊eɉ1ϊs
+	//!
+	//! @param[in]     type       c ϊ̎
+	//! @param[in]     n1         c 1ڂ̗vf
+	//! @param[in]     n2         c 2ڂ̗vf
+	//! @param[in]     n3         c 3ڂ̗vfiCDFT̏ꍇ͕f̌j
+	//! @param[in]     isgn       c ϊ̌iỸpbP[WƓj
+	//! @param[in,out] a          c o̓f[^
+	//! @param[in]     thread_num c gpXbh
+	//!
+	inline void transform3d( transform_type type, size_t n1, size_t n2, size_t n3, int isgn, double ***a, size_t thread_num )
+	{
+		line_transform t1( type, n1 ), t2, t3;
+
+		// ̎̕ϊ\͎g
+		if( n2 == n1 )
+		{
+			t2 = t1;
+		}
+		else
+		{
+			t2.initialize( type, n2 );
+		}
+
+		if( n3 == n1 )
+		{
+			t3 = t1;
+		}
+		else if( n3 == n2 )
+		{
+			t3 = t2;
+		}
+		else
+		{
+			t3.initialize( type, n3 );
+		}
+
+		transform3d( t1, t2, t3, n1, n2, n3, isgn, a, thread_num );
+	}
+
+
+	// f[^̊esix jFFTŕϊXbh
+	class real_line_transform_thread : public mist::thread< real_line_transform_thread >
+	{
+	public:
+		typedef mist::thread< real_line_transform_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+
+	private:
+		const real_fft *transform_;
+		double *real_;
+		complex_type *complex_;
+		size_type rows_;
+		int isgn_;
+		size_type thread_id_;
+		size_type thread_num_;
+
+	public:
+		void setup_parameters( const real_fft &transform, double *real, complex_type *complex, size_type rows, int isgn, size_type thread_id, size_type thread_num )
+		{
+			transform_  = &transform;
+			real_       = real;
+			complex_    = complex;
+			rows_       = rows;
+			isgn_       = isgn;
+			thread_id_  = thread_id;
+			thread_num_ = thread_num;
+		}
+
+		const real_line_transform_thread& operator =( const real_line_transform_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				transform_ = p.transform_;
+				real_ = p.real_;
+				complex_ = p.complex_;
+				rows_ = p.rows_;
+				isgn_ = p.isgn_;
+				thread_id_ = p.thread_id_;
+				thread_num_ = p.thread_num_;
+			}
+			return( *this );
+		}
+
+		real_line_transform_thread( ) : transform_( NULL ), real_( NULL ), complex_( NULL ), rows_( 0 ), isgn_( -1 ), thread_id_( 0 ), thread_num_( 1 )
+		{
+		}
+
+		real_line_transform_thread( const real_line_transform_thread &p ) : base( p ), transform_( p.transform_ ), real_( p.real_ ), complex_( p.complex_ ), rows_( p.rows_ ),
+																				isgn_( p.isgn_ ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const real_fft &transform = *transform_;
+			const size_type n = transform.size( );
+			const size_type h = n / 2 + 1;
+			std::vector< complex_type > work( transform.work_size( ) );
+
+			for( size_type r = rows_ * thread_id_ / thread_num_ ; r < rows_ * ( thread_id_ + 1 ) / thread_num_ ; r++ )
+			{
+				if( isgn_ < 0 )
+				{
+					transform.forward( real_ + r * n, complex_ + r * h, &work[ 0 ] );
+				}
+				else
+				{
+					transform.inverse( complex_ + r * h, real_ + r * n, &work[ 0 ] );
+				}
+			}
+
+			return( 0 );
+		}
+	};
+
+
+	// x A complex_type 3f[^idepth ~ height ~ widthjwsEʂ̃|C^쐬
+	inline void make_row_pointers( complex_type *data, size_t width, size_t height, size_t depth, std::vector< double * > &rows, std::vector< double ** > &planes )
+	{
+		rows.resize( height * depth );
+		planes.resize( depth );
+		for( size_t k = 0 ; k < depth ; k++ )
+		{
+			for( size_t j = 0 ; j < height ; j++ )
+			{
+				rows[ j + k * height ] = reinterpret_cast< double * >( data + ( j + k * height ) * width );
+			}
+			planes[ k ] = &rows[ k * height ];
+		}
+	}
+
+
+	/// @brief 3f[^Cx ̔񕉂̎gff[^ɕϊ
+	//!
+	//! ͂ x A depth ~ height ~ width ̎Co͂ depth ~ height ~ ( width / 2 + 1 ) ̕fD
+	//! x ̎FFŤŁCy  z ɕfFFTs
+	//!
+	//! @param[in]  tx         c x ̎FFTivf widthj
+	//! @param[in]  ty         c y ̕fFFTivf heightCCDFTj
+	//! @param[in]  tz         c z ̕fFFTivf depthCCDFTj
+	//! @param[in]  height     c y ̗vf
+	//! @param[in]  depth      c z ̗vf
+	//! @param[in]  in         c ̓f[^
+	//! @param[out] out        c o̓f[^
+	//! @param[in]  thread_num c gpXbh
+	//!
+	inline void real_transform3d( const real_fft &tx, const line_transform &ty, const line_transform &tz, size_t height, size_t depth, const double *in, complex_type *out, size_t thread_num )
+	{
+		if( thread_num == 0 )
+		{
+			thread_num = 1;
+		}
+
+		real_line_transform_thread *thread = new real_line_transform_thread[ thread_num ];
+		for( size_t i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_parameters( tx, const_cast< double * >( in ), out, height * depth, -1, i, thread_num );
+		}
+		do_threads( thread, thread_num );
+		delete [] thread;
+
+		std::vector< double * > rows;
+		std::vector< double ** > planes;
+		make_row_pointers( out, tx.size( ) / 2 + 1, height, depth, rows, planes );
+		transform3d( tz, ty, line_transform( ), depth, height, tx.size( ) / 2 + 1, -1, &planes[ 0 ], thread_num );
+	}
+
+
+	/// @brief real_transform3d ̋tϊiKȂj
+	//!
+	//! @attention ̓f[^ in ͍Ɨ̈Ƃď
+	//!
+	inline void real_inverse_transform3d( const real_fft &tx, const line_transform &ty, const line_transform &tz, size_t height, size_t depth, complex_type *in, double *out, size_t thread_num )
+	{
+		if( thread_num == 0 )
+		{
+			thread_num = 1;
+		}
+
+		std::vector< double * > rows;
+		std::vector< double ** > planes;
+		make_row_pointers( in, tx.size( ) / 2 + 1, height, depth, rows, planes );
+		transform3d( tz, ty, line_transform( ), depth, height, tx.size( ) / 2 + 1, 1, &planes[ 0 ], thread_num );
+
+		real_line_transform_thread *thread = new real_line_transform_thread[ thread_num ];
+		for( size_t i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_parameters( tx, out, in, height * depth, 1, i, thread_num );
+		}
+		do_threads( thread, thread_num );
+		delete [] thread;
+	}
+
+
+	/// @brief CӒ ooura_fft::cdftin ͕f̌2{j
+	inline void cdft( size_t n, int isgn, double *a )
+	{
+		line_transform transform( CDFT, n / 2 );
+		std::vector< complex_type > work( transform.work_size( ) );
+		transform( a, isgn, &work[ 0 ] );
+	}
+
+	/// @brief CӒ ooura_fft::ddct
+	inline void ddct( size_t n, int isgn, double *a )
+	{
+		line_transform transform( DDCT, n );
+		std::vector< complex_type > work( transform.work_size( ) );
+		transform( a, isgn, &work[ 0 ] );
+	}
+
+	/// @brief CӒ ooura_fft::ddst
+	inline void ddst( size_t n, int isgn, double *a )
+	{
+		line_transform transform( DDST, n );
+		std::vector< complex_type > work( transform.work_size( ) );
+		transform( a, isgn, &work[ 0 ] );
+	}
+
+	/// @brief CӒ ooura_fft::cdft2din2 ͕f̌2{j
+	inline void cdft2d( size_t n1, size_t n2, int isgn, double **a, size_t thread_num )
+	{
+		double **p[ 1 ] = { a };
+		transform3d( CDFT, 1, n1, n2 / 2, isgn, p, thread_num );
+	}
+
+	/// @brief CӒ ooura_fft::ddct2d
+	inline void ddct2d( size_t n1, size_t n2, int isgn, double **a, size_t thread_num )
+	{
+		double **p[ 1 ] = { a };
+		transform3d( DDCT, 1, n1, n2, isgn, p, thread_num );
+	}
+
+	/// @brief CӒ ooura_fft::ddst2d
+	inline void ddst2d( size_t n1, size_t n2, int isgn, double **a, size_t thread_num )
+	{
+		double **p[ 1 ] = { a };
+		transform3d( DDST, 1, n1, n2, isgn, p, thread_num );
+	}
+
+	/// @brief CӒ ooura_fft::cdft3din3 ͕f̌2{j
+	inline void cdft3d( size_t n1, size_t n2, size_t n3, int isgn, double ***a, size_t thread_num )
+	{
+		transform3d( CDFT, n1, n2, n3 / 2, isgn, a, thread_num );
+	}
+
+	/// @brief CӒ ooura_fft::ddct3d
+	inline void ddct3d( size_t n1, size_t n2, size_t n3, int isgn, double ***a, size_t thread_num )
+	{
+		transform3d( DDCT, n1, n2, n3, isgn, a, thread_num );
+	}
+
+	/// @brief CӒ ooura_fft::ddst3d
+	inline void ddst3d( size_t n1, size_t n2, size_t n3, int isgn, double ***a, size_t thread_num )
+	{
+		transform3d( DDST, n1, n2, n3, isgn, a, thread_num );
+	}
+}
+
+
+_MIST_END
+
+#endif	// __INCLUDE_FFT_MIXED_RADIX_H__
@@ -63,8 +63,13 @@
 #include "linear.h"
 #endif
 
+#ifndef __INCLUDE_MIST_EDGE__
+#include "edge.h"
+#endif
+
 #include <vector>
 #include <algorithm>
+#include <cmath>
 
 
 // mistOԂ̎n܂
@@ -98,6 +103,361 @@ namespace __corner_utility__
 			return( f2 < f1 );
 		}
 	};
+
+	// Harris̃R[i[x
+	struct harris_response
+	{
+		double kappa;
+
+		harris_response( double k = 0.04 ) : kappa( k ){ }
+
+		double operator ()( double xx, double yy, double xy ) const
+		{
+			return( xx * yy - xy * xy - kappa * ( xx + yy ) * ( xx + yy ) );
+		}
+	};
+
+	// Shi-TomasĩR[i[xi\e\̍ŏŗLlj
+	struct shi_tomasi_response
+	{
+		double operator ()( double xx, double yy, double xy ) const
+		{
+			double a = ( xx + yy ) * 0.5;
+			double b = ( xx - yy ) * 0.5;
+			return( a - std::sqrt( b * b + xy * xy ) );
+		}
+	};
+
+	// žvZC\e\̊evf̑ρCR[i[x̌vZ1̑ōsXbh
+	// ̕ς average_filter ƓC摜͂ݏofŐK
+	template < class Array, class Response >
+	class corner_response_thread : public mist::thread< corner_response_thread< Array, Response > >
+	{
+	public:
+		typedef mist::thread< corner_response_thread< Array, Response > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef typename Array::size_type size_type;
+		typedef typename Array::difference_type difference_type;
+		typedef typename Array::value_type value_type;
+		typedef typename __canny__::gradient_type< value_type >::value_type gradient_value_type;
+
+	private:
+		const Array *in_;
+		size_type begin_;
+		size_type end_;
+		size_type window_size_;
+		Response response_;
+		std::vector< corner_position > candidates_;
+
+	public:
+		void setup_parameters( const Array &in, size_type begin, size_type end, size_type window_size, Response response )
+		{
+			in_          = &in;
+			begin_       = begin;
+			end_         = end;
+			window_size_ = window_size;
+			response_    = response;
+			candidates_.clear( );
+		}
+
+		std::vector< corner_position > &candidates( ) { return( candidates_ ); }
+
+		const corner_response_thread& operator =( const corner_response_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				in_ = p.in_;
+				begin_ = p.begin_;
+				end_ = p.end_;
+				window_size_ = p.window_size_;
+				response_ = p.response_;
+				candidates_ = p.candidates_;
+			}
+			return( *this );
+		}
+
+		corner_response_thread( ) : in_( NULL ), begin_( 0 ), end_( 0 ), window_size_( 3 )
+		{
+		}
+
+		corner_response_thread( const corner_response_thread &p ) : base( p ), in_( p.in_ ), begin_( p.begin_ ), end_( p.end_ ),
+														window_size_( p.window_size_ ), response_( p.response_ ), candidates_( p.candidates_ )
+		{
+		}
+
+	protected:
+		// 1šz\e\̗vfidx*dx, dy*dy, dx*dyjvZ
+		void tensor_row( difference_type j, gradient_value_type *gx, gradient_value_type *gy, double *t )
+		{
+			static const int kx[ 3 ][ 3 ] = { { -1, 0, 1 }, { -2, 0, 2 }, { -1, 0, 1 } };
+			static const int ky[ 3 ][ 3 ] = { { -1, -2, -1 }, { 0, 0, 0 }, { 1, 2, 1 } };
+
+			const Array &in = *in_;
+			difference_type w = in.width( );
+			difference_type h = in.height( );
+
+			if( j == 0 || j == h - 1 || w < 3 )
+			{
+				for( difference_type i = 0 ; i < w ; i++ )
+				{
+					double dx = __canny__::border_gradient( in, i, j, kx );
+					double dy = __canny__::border_gradient( in, i, j, ky );
+					t[ 3 * i     ] = dx * dx;
+					t[ 3 * i + 1 ] = dy * dy;
+					t[ 3 * i + 2 ] = dx * dy;
+				}
+				return;
+			}
+
+			typename Array::const_pointer p0 = &in( 0, j - 1 );
+			typename Array::const_pointer p1 = &in( 0, j );
+			typename Array::const_pointer p2 = &in( 0, j + 1 );
+
+			for( difference_type i = 1 ; i < w - 1 ; i++ )
+			{
+				gradient_value_type t0 = static_cast< gradient_value_type >( p0[ i - 1 ] );
+				gradient_value_type t1 = static_cast< gradient_value_type >( p0[ i ] );
+				gradient_value_type t2 = static_cast< gradient_value_type >( p0[ i + 1 ] );
+				gradient_value_type m0 = static_cast< gradient_value_type >( p1[ i - 1 ] );
+				gradient_value_type m2 = static_cast< gradient_value_type >( p1[ i + 1 ] );
+				gradient_value_type b0 = static_cast< gradient_value_type >( p2[ i - 1 ] );
+				gradient_value_type b1 = static_cast< gradient_value_type >( p2[ i ] );
+				gradient_value_type b2 = static_cast< gradient_value_type >( p2[ i + 1 ] );
+
+				gx[ i ] = ( t2 - t0 ) + 2 * ( m2 - m0 ) + ( b2 - b0 );
+				gy[ i ] = ( b0 + 2 * b1 + b2 ) - ( t0 + 2 * t1 + t2 );
+			}
+
+			for( difference_type i = 1 ; i < w - 1 ; i++ )
+			{
+				double dx = static_cast< double >( gx[ i ] );
+				double dy = static_cast< double >( gy[ i ] );
+				t[ 3 * i     ] = dx * dx;
+				t[ 3 * i + 1 ] = dy * dy;
+				t[ 3 * i + 2 ] = dx * dy;
+			}
+
+			for( difference_type i = 0 ; i < w ; i += w - 1 )
+			{
+				double dx = __canny__::border_gradient( in, i, j, kx );
+				double dy = __canny__::border_gradient( in, i, j, ky );
+				t[ 3 * i     ] = dx * dx;
+				t[ 3 * i + 1 ] = dy * dy;
+				t[ 3 * i + 2 ] = dx * dy;
+			}
+		}
+
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const Array &in = *in_;
+			difference_type w  = in.width( );
+			difference_type h  = in.height( );
+			difference_type fw = window_size_;
+			difference_type rw = fw / 2;
+
+			std::vector< gradient_value_type > gx( w ), gy( w );
+			std::vector< double > ring( 3 * w * fw ), colsum( 3 * w, 0.0 ), prefix( 3 * ( w + 1 ), 0.0 );
+
+			// ̏c͈̔͂񂲂Ƃ̑aƂĕێCsi߂邲Ƃɏo肷sXV
+			difference_type sy = static_cast< difference_type >( begin_ ) - rw;
+			for( difference_type y = sy < 0 ? 0 : sy ; y < sy + fw && y < h ; y++ )
+			{
+				double *t = &ring[ 3 * w * ( y % fw ) ];
+				tensor_row( y, &gx[ 0 ], &gy[ 0 ], t );
+				for( difference_type i = 0 ; i < 3 * w ; i++ )
+				{
+					colsum[ i ] += t[ i ];
+				}
+			}
+
+			for( difference_type j = begin_ ; j < static_cast< difference_type >( end_ ) ; j++ )
+			{
+				if( j > static_cast< difference_type >( begin_ ) )
+				{
+					difference_type yout = j - rw - 1;
+					difference_type yin  = yout + fw;
+
+					if( yout >= 0 )
+					{
+						const double *t = &ring[ 3 * w * ( yout % fw ) ];
+						for( difference_type i = 0 ; i < 3 * w ; i++ )
+						{
+							colsum[ i ] -= t[ i ];
+						}
+					}
+
+					if( yin < h )
+					{
+						double *t = &ring[ 3 * w * ( yin % fw ) ];
+						tensor_row( yin, &gx[ 0 ], &gy[ 0 ], t );
+						for( difference_type i = 0 ; i < 3 * w ; i++ )
+						{
+							colsum[ i ] += t[ i ];
+						}
+					}
+				}
+
+				difference_type y0 = j - rw < 0 ? 0 : j - rw;
+				difference_type y1 = j - rw + fw - 1 >= h ? h - 1 : j - rw + fw - 1;
+				double fsize = static_cast< double >( y1 - y0 + 1 );
+
+				for( difference_type i = 0 ; i < w ; i++ )
+				{
+					prefix[ 3 * ( i + 1 )     ] = prefix[ 3 * i     ] + colsum[ 3 * i     ];
+					prefix[ 3 * ( i + 1 ) + 1 ] = prefix[ 3 * i + 1 ] + colsum[ 3 * i + 1 ];
+					prefix[ 3 * ( i + 1 ) + 2 ] = prefix[ 3 * i + 2 ] + colsum[ 3 * i + 2 ];
+				}
+
+				for( difference_type i = 1 ; i < w - 1 ; i++ )
+				{
+					difference_type x0 = i - rw < 0 ? 0 : i - rw;
+					difference_type x1 = i - rw + fw >= w ? w : i - rw + fw;
+					double area = fsize * static_cast< double >( x1 - x0 );
+
+					double xx = ( prefix[ 3 * x1     ] - prefix[ 3 * x0     ] ) / area;
+					double yy = ( prefix[ 3 * x1 + 1 ] - prefix[ 3 * x0 + 1 ] ) / area;
+					double xy = ( prefix[ 3 * x1 + 2 ] - prefix[ 3 * x0 + 2 ] ) / area;
+					double key = response_( xx, yy, xy );
+
+					if( key > 0 )
+					{
+						candidates_.push_back( corner_position( static_cast< int >( i ), static_cast< int >( j ), key ) );
+					}
+				}
+			}
+
+			return( 0 );
+		}
+	};
+
+	// R[i[x̌vZXbhŕSCx̑傫 min_distance ߂_ȂI
+	// Iς݂̓_ min_distance l̊iqɓo^C͂̊iq݂̂𒲂ׂ
+	template < class Array, class Response >
+	void detect_corners( const Array &in, std::vector< corner_position > &out, typename Array::size_type max_corners, double min_distance,
+							typename Array::size_type window_size, Response response, typename Array::size_type thread_num )
+	{
+		typedef typename Array::size_type       size_type;
+		typedef typename Array::difference_type difference_type;
+		typedef corner_response_thread< Array, Response > corner_thread_type;
+
+		out.clear( );
+
+		if( in.width( ) < 3 || in.height( ) < 3 || max_corners == 0 )
+		{
+			return;
+		}
+
+		if( window_size == 0 )
+		{
+			window_size = 1;
+		}
+
+		size_type rows = in.height( ) - 2;
+		if( thread_num > rows )
+		{
+			thread_num = rows;
+		}
+
+		corner_thread_type *thread = new corner_thread_type[ thread_num ];
+
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_parameters( in, 1 + rows * i / thread_num, 1 + rows * ( i + 1 ) / thread_num, window_size, response );
+		}
+
+		// XbhsāCI܂őҋ@
+		do_threads_( thread, thread_num );
+
+		std::vector< corner_position > candidates;
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			std::vector< corner_position > &c = thread[ i ].candidates( );
+			candidates.insert( candidates.end( ), c.begin( ), c.end( ) );
+		}
+
+		delete [] thread;
+
+		// Ŝ\[gCq[v狭x̑傫Ɏo
+		std::make_heap( candidates.begin( ), candidates.end( ) );
+
+		double cell = min_distance > 1.0 ? min_distance : 1.0;
+		difference_type gw = static_cast< difference_type >( in.width( ) / cell ) + 1;
+		difference_type gh = static_cast< difference_type >( in.height( ) / cell ) + 1;
+		std::vector< std::vector< size_type > > grid( gw * gh );
+		double min_distance2 = min_distance * min_distance;
+
+		while( !candidates.empty( ) && out.size( ) < max_corners )
+		{
+			std::pop_heap( candidates.begin( ), candidates.end( ) );
+			corner_position v = candidates.back( );
+			candidates.pop_back( );
+
+			difference_type cx = static_cast< difference_type >( v.x / cell );
+			difference_type cy = static_cast< difference_type >( v.y / cell );
+
+			bool flag = true;
+			for( difference_type y = cy - 1 ; y <= cy + 1 && flag ; y++ )
+			{
+				if( y < 0 || y >= gh )
+				{
+					continue;
+				}
+
+				for( difference_type x = cx - 1 ; x <= cx + 1 && flag ; x++ )
+				{
+					if( x < 0 || x >= gw )
+					{
+						continue;
+					}
+
+					const std::vector< size_type > &g = grid[ y * gw + x ];
+					for( size_type l = 0 ; l < g.size( ) ; l++ )
+					{
+						const corner_position &u = out[ g[ l ] ];
+						if( ( v.x - u.x ) * ( v.x - u.x ) + ( v.y - u.y ) * ( v.y - u.y ) < min_distance2 )
+						{
+							flag = false;
+							break;
+						}
+					}
+				}
+			}
+
+			if( flag )
+			{
+				grid[ cy * gw + cx ].push_back( out.size( ) );
+				out.push_back( v );
+			}
+		}
+	}
+
+	template < bool b >
+	struct __corner_dispatch__
+	{
+		// Zp^̉摜͂̂܂܏
+		template < class T, class Allocator, class Response >
+		static void detect( const array2< T, Allocator > &in, std::vector< corner_position > &out, typename array2< T, Allocator >::size_type max_corners, double min_distance,
+								typename array2< T, Allocator >::size_type window_size, Response response, typename array2< T, Allocator >::size_type thread_num )
+		{
+			detect_corners( in, out, max_corners, min_distance, window_size, response, thread_num );
+		}
+	};
+
+	template < >
+	struct __corner_dispatch__< false >
+	{
+		// J[摜Ȃǂ͔ZW摜ɕϊĂ珈
+		template < class T, class Allocator, class Response >
+		static void detect( const array2< T, Allocator > &in, std::vector< corner_position > &out, typename array2< T, Allocator >::size_type max_corners, double min_distance,
+								typename array2< T, Allocator >::size_type window_size, Response response, typename array2< T, Allocator >::size_type thread_num )
+		{
+			array2< double > tmp;
+			convert( in, tmp );
+			detect_corners( tmp, out, max_corners, min_distance, window_size, response, thread_num );
+		}
+	};
 }
 
 
@@ -112,7 +472,12 @@ namespace __corner_utility__
 
 /// @brief Harris̃R[i[otB^
 //! 
-//! @attention OpenMPLȏꍇ͎IɕvZs
+//! SobeltB^ɂz\e\̊evf߁C̕ςsƂ̗ݐϘaŌvZ鏈1̑ōsD
+//! R[i[̓R[i[x̑傫ɁCɑIR[i[ min_distance ȏ㗣ꂽ̂ID
+//! 
+//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+//! @attention window_size ̏ꍇ̑͒ډf̍㑤ɔfꂽ [x - window_size / 2, x + window_size / 2 - 1] ƂȂ
+//! @attention ȑO average_filter pƂ͑̎قȂ邽߁CoR[i[ςi̏ꍇ͈ȑOƓʂɂȂj
 //! 
 //! @param[in]  in           c ͉摜
 //! @param[out] out          c oꂽR[i[̍WXg
@@ -120,108 +485,84 @@ namespace __corner_utility__
 //! @param[in]  min_distance c R[i[Ԃ̋̍ŏl
 //! @param[in]  kappa        c R[i[oۂ̏ɎgpW0.04`0.15iftHg0.04j
 //! @param[in]  window_size  c R[i[oss߂ۂ̑TCYiftHg3j
+//! @param[in]  thread_num   c gpXbh
 //! 
 //! @return oR[i[
 //! 
 template < class T, class Allocator, template < typename, typename > class LIST, class TT, class AAllocator >
 typename array2< T, Allocator >::difference_type harris( const array2< T, Allocator > &in, LIST< vector2< TT >, AAllocator >&out, typename array2< T, Allocator >::size_type max_corners,
-														 double min_distance, double kappa = 0.04, typename array2< T, Allocator >::size_type window_size = 3 )
+														 double min_distance, double kappa = 0.04, typename array2< T, Allocator >::size_type window_size = 3, typename array2< T, Allocator >::size_type thread_num = 0 )
 {
 	typedef typename array2< T, Allocator >::size_type       size_type;
-	typedef typename array2< T, Allocator >::difference_type difference_type;
 
 	if( in.empty( ) )
 	{
 		return( -1 );
 	}
 
-	typedef array2< double > image_type;
-	typedef vector2< TT > ovector_type;
-	typedef rgb< double > vector_type;
-	typedef array2< vector_type > vector_image_type;
-	typedef array2< unsigned char > mask_type;
-
-	image_type tmp, k1( 3, 3 ), k2( 3, 3 ), gx, gy;
-
-	convert( in, tmp );
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
 
-	k1( 0, 0 ) = -1; k1( 1, 0 ) =  0; k1( 2, 0 ) =  1;
-	k1( 0, 1 ) = -2; k1( 1, 1 ) =  0; k1( 2, 1 ) =  2;
-	k1( 0, 2 ) = -1; k1( 1, 2 ) =  0; k1( 2, 2 ) =  1;
+	typedef vector2< TT > ovector_type;
+	typedef __corner_utility__::corner_position point_type;
+	typedef std::vector< point_type > point_list_type;
 
-	k2( 0, 0 ) = -1; k2( 1, 0 ) = -2; k2( 2, 0 ) = -1;
-	k2( 0, 1 ) =  0; k2( 1, 1 ) =  0; k2( 2, 1 ) =  0;
-	k2( 0, 2 ) = +1; k2( 1, 2 ) = +2; k2( 2, 2 ) = +1;
+	point_list_type out_list;
 
-	linear_filter( tmp, gx, k1 );
-	linear_filter( tmp, gy, k2 );
+	__corner_utility__::__corner_dispatch__< is_arithmetic< T >::value && !is_color< T >::value >::detect( in, out_list, max_corners, min_distance, window_size, __corner_utility__::harris_response( kappa ), thread_num );
 
-	vector_image_type work( in.width( ), in.height( ) ), wwork;
+	out.clear( );
 
-#ifdef _OPENMP
-	#pragma omp parallel for schedule( guided )
-#endif
-	for( int j = 0 ; j < static_cast< int >( tmp.height( ) ) ; j++ )
+	for( size_type i = 0 ; i < out_list.size( ) ; i++ )
 	{
-		for( size_type i = 0 ; i < tmp.width( ) ; i++ )
-		{
-			double dx = gx( i, j );
-			double dy = gy( i, j );
-
-			work( i, j ) = vector_type( dx * dx, dy * dy, dx * dy );
-		}
+		out.push_back( ovector_type( out_list[ i ].x, out_list[ i ].y ) );
 	}
 
-#if 0
-	window_size /= 2;
-	gaussian_filter( work, wwork, window_size * 0.5 );
-#else
-	average_filter( work, wwork, window_size, window_size );
-#endif
+	return( out.size( ) );
+}
 
-	mask_type mask( in.width( ), in.height( ) );
 
-	typedef __corner_utility__::corner_position point_type;
-	typedef std::vector< point_type > point_list_type;
-	point_list_type point_list, out_list;
+/// @brief Shi-TomasĩR[i[otB^
+//! 
+//! \e\̍ŏŗLlR[i[xƂȊO harris Ɠ菇ŃR[i[oD
+//! 
+//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+//! @attention window_size ̏ꍇ̑ harris Ɠ [x - window_size / 2, x + window_size / 2 - 1] ƂȂ
+//! 
+//! @param[in]  in           c ͉摜
+//! @param[out] out          c oꂽR[i[̍WXg
+//! @param[in]  max_corners  c oR[i[̐
+//! @param[in]  min_distance c R[i[Ԃ̋̍ŏl
+//! @param[in]  window_size  c R[i[oss߂ۂ̑TCYiftHg3j
+//! @param[in]  thread_num   c gpXbh
+//! 
+//! @return oR[i[
+//! 
+template < class T, class Allocator, template < typename, typename > class LIST, class TT, class AAllocator >
+typename array2< T, Allocator >::difference_type shi_tomasi( const array2< T, Allocator > &in, LIST< vector2< TT >, AAllocator >&out, typename array2< T, Allocator >::size_type max_corners,
+															 double min_distance, typename array2< T, Allocator >::size_type window_size = 3, typename array2< T, Allocator >::size_type thread_num = 0 )
+{
+	typedef typename array2< T, Allocator >::size_type       size_type;
 
-	for( size_type j = 1 ; j < wwork.height( ) - 1 ; j++ )
+	if( in.empty( ) )
 	{
-		for( size_type i = 1 ; i < wwork.width( ) - 1 ; i++ )
-		{
-			const vector_type &v = wwork( i, j );
-			double Mc = v.r * v.g - v.b * v.b - kappa * ( v.r + v.g ) * ( v.r + v.g );
-
-			if( Mc > 0 )
-			{
-				point_list.push_back( point_type( i, j, Mc ) );
-			}
-		}
+		return( -1 );
 	}
 
-	std::sort( point_list.begin( ), point_list.end( ), __corner_utility__::corner_position::greater );
-
-	min_distance = min_distance * min_distance;
-	for( size_type i = 0 ; i < point_list.size( ) && out_list.size( ) < max_corners ; i++ )
+	if( thread_num == 0 )
 	{
-		const point_type &v = point_list[ i ];
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
 
-		bool flag = true;
-		for( size_type l = 0 ; l < out_list.size( ) ; l++ )
-		{
-			const point_type &u = out_list[ l ];
-			if( ( v.x - u.x ) * ( v.x - u.x ) + ( v.y - u.y ) * ( v.y - u.y ) < min_distance )
-			{
-				flag = false;
-				break;
-			}
-		}
+	typedef vector2< TT > ovector_type;
+	typedef __corner_utility__::corner_position point_type;
+	typedef std::vector< point_type > point_list_type;
 
-		if( flag )
-		{
-			out_list.push_back( v );
-		}
-	}
+	point_list_type out_list;
+
+	__corner_utility__::__corner_dispatch__< is_arithmetic< T >::value && !is_color< T >::value >::detect( in, out_list, max_corners, min_distance, window_size, __corner_utility__::shi_tomasi_response( ), thread_num );
 
 	out.clear( );
 
@@ -44,6 +44,7 @@
 #define __INCLUDE_MIST_DISTANCE_TRANSFORM__
 
 #include <cmath>
+#include <cstdio>
 
 #ifndef __INCLUDE_MIST_H__
 #include "../mist.h"
@@ -1537,6 +1538,12 @@ namespace _meijster_distance_transform_
 				return( ( gu - gi + u + i ) / 2 );
 			}
 		}
+
+		template < class Val >
+		static Val Length( const Val &g )
+		{
+			return( g );
+		}
 	};
 
 	struct CDT
@@ -1564,6 +1571,36 @@ namespace _meijster_distance_transform_
 				return( ugi < iu ? ugi : iu );
 			}
 		}
+
+		template < class Val >
+		static Val Length( const Val &g )
+		{
+			return( g );
+		}
+	};
+
+	// [Nbh2拗i1iڂ̏ŋ߂2悵ėpj
+	struct EDT
+	{
+		template < class T, class Val >
+		static T Func( const T &x, const T &i, const Val &gi )
+		{
+			return( static_cast< T >( ( x - i ) * ( x - i ) + static_cast< T >( gi ) ) );
+		}
+
+		template < class T, class Val >
+		static T Sep( const T &i, const T &u, const Val &gi, const Val &gu )
+		{
+			T num = u * u - i * i + static_cast< T >( gu ) - static_cast< T >( gi );
+			T den = 2 * ( u - i );
+			return( num >= 0 ? num / den : -( ( -num + den - 1 ) / den ) );
+		}
+
+		template < class Val >
+		static Val Length( const Val &g )
+		{
+			return( g * g );
+		}
 	};
 
 	template < class Array >
@@ -1816,6 +1853,564 @@ namespace _meijster_distance_transform_
 			return( true );
 		}
 	};
+
+
+	// XuPʂ̋ϊŗpC1C1iڂ̏iOifł߂wif܂ł1j
+	template < class T, class Metric >
+	void distance_transform_line( T *p, ptrdiff_t num, ptrdiff_t stride, const T &infinity, Metric __dmy__ )
+	{
+		ptrdiff_t i;
+
+		p[ 0 ] = p[ 0 ] != 0 ? infinity : 0;
+		for( i = 1 ; i < num ; i++ )
+		{
+			if( p[ i * stride ] != 0 )
+			{
+				T v = static_cast< T >( p[ ( i - 1 ) * stride ] + 1 );
+				p[ i * stride ] = v < infinity ? v : infinity;
+			}
+		}
+
+		for( i = num - 2 ; i >= 0 ; i-- )
+		{
+			T v = static_cast< T >( p[ ( i + 1 ) * stride ] + 1 );
+			if( v < p[ i * stride ] )
+			{
+				p[ i * stride ] = v;
+			}
+		}
+
+		for( i = 0 ; i < num ; i++ )
+		{
+			p[ i * stride ] = Metric::Length( p[ i * stride ] );
+		}
+	}
+
+	// XuPʂ̋ϊŗpC1C2iڈȍ~̏i̌vZj
+	// g ͍Ɨp̃obt@łCC̒lURs[Ă珈
+	template < class T, class Metric >
+	void lower_envelope_line( T *p, ptrdiff_t num, ptrdiff_t stride, T *g, ptrdiff_t *s, ptrdiff_t *t, Metric __dmy__ )
+	{
+		ptrdiff_t u, q;
+
+		for( u = 0 ; u < num ; u++ )
+		{
+			g[ u ] = p[ u * stride ];
+		}
+
+		q = s[ 0 ] = t[ 0 ] = 0;
+
+		for( u = 1 ; u < num ; u++ )
+		{
+			while( q >= 0 && Metric::Func( t[ q ], s[ q ], g[ s[ q ] ] ) > Metric::Func( t[ q ], u, g[ u ] ) )
+			{
+				q--;
+			}
+
+			if( q < 0 )
+			{
+				q = 0;
+				s[ 0 ] = u;
+			}
+			else
+			{
+				ptrdiff_t tmp = Metric::Sep( s[ q ], u, g[ s[ q ] ], g[ u ] );
+
+				if( tmp < num - 1 )
+				{
+					q++;
+					s[ q ] = u;
+					t[ q ] = tmp + 1;
+				}
+			}
+		}
+
+		for( u = num - 1 ; u >= 0 ; u-- )
+		{
+			p[ u * stride ] = static_cast< T >( Metric::Func( u, s[ q ], g[ s[ q ] ] ) );
+			if( u == t[ q ] )
+			{
+				q--;
+			}
+		}
+	}
+
+
+	// XɘAĕ w ~ h ~ d ̃ubNɑ΂āCw肵̏sXbh
+	// eXbh́Csєтɏ̂ł͂ȂCAC̏WS
+	template < class T, class Metric >
+	class slab_distance_transform_thread : public mist::thread< slab_distance_transform_thread< T, Metric > >
+	{
+	public:
+		typedef mist::thread< slab_distance_transform_thread< T, Metric > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+		typedef T value_type;
+
+	private:
+		size_t thread_id_;
+		size_t thread_num_;
+
+		// Ώۂ̃ubN
+		value_type *ptr_;
+		size_type width_;
+		size_type height_;
+		size_type depth_;
+		value_type infinity_;
+		size_type axis_;
+		Metric dmy_;
+
+	public:
+		void setup_parameters( value_type *ptr, size_type width, size_type height, size_type depth, const value_type &infinity, size_type axis, size_type thread_id, size_type thread_num )
+		{
+			ptr_        = ptr;
+			width_      = width;
+			height_     = height;
+			depth_      = depth;
+			infinity_   = infinity;
+			axis_       = axis;
+			thread_id_  = thread_id;
+			thread_num_ = thread_num;
+		}
+
+		const slab_distance_transform_thread& operator =( const slab_distance_transform_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				thread_id_ = p.thread_id_;
+				thread_num_ = p.thread_num_;
+				ptr_ = p.ptr_;
+				width_ = p.width_;
+				height_ = p.height_;
+				depth_ = p.depth_;
+				infinity_ = p.infinity_;
+				axis_ = p.axis_;
+			}
+			return( *this );
+		}
+
+		slab_distance_transform_thread( size_type id = 0, size_type num = 1 )
+			: thread_id_( id ), thread_num_( num ), ptr_( NULL ), width_( 0 ), height_( 0 ), depth_( 0 ), infinity_( 0 ), axis_( 0 )
+		{
+		}
+		slab_distance_transform_thread( const slab_distance_transform_thread &p )
+			: base( p ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ ), ptr_( NULL ),
+			width_( p.width_ ), height_( p.height_ ), depth_( p.depth_ ), infinity_( p.infinity_ ), axis_( p.axis_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const difference_type w = width_;
+			const difference_type h = height_;
+			const difference_type d = depth_;
+
+			difference_type lines, num, stride;
+			switch( axis_ )
+			{
+			case 1:
+				lines  = w * d;
+				num    = h;
+				stride = w;
+				break;
+
+			case 2:
+				lines  = w * h;
+				num    = d;
+				stride = w * h;
+				break;
+
+			case 0:
+			default:
+				lines  = h * d;
+				num    = w;
+				stride = 1;
+				break;
+			}
+
+			difference_type lbegin = static_cast< difference_type >( lines * thread_id_ / thread_num_ );
+			difference_type lend   = static_cast< difference_type >( lines * ( thread_id_ + 1 ) / thread_num_ );
+
+			if( axis_ == 0 )
+			{
+				for( difference_type l = lbegin ; l < lend ; l++ )
+				{
+					distance_transform_line( ptr_ + l * w, num, stride, infinity_, dmy_ );
+				}
+			}
+			else
+			{
+				value_type *g = new value_type[ num ];
+				difference_type *s = new difference_type[ num ];
+				difference_type *t = new difference_type[ num ];
+
+				for( difference_type l = lbegin ; l < lend ; l++ )
+				{
+					difference_type offset = axis_ == 1 ? ( l / w ) * w * h + l % w : l;
+					lower_envelope_line( ptr_ + offset, num, stride, g, s, t, dmy_ );
+				}
+
+				delete [] g;
+				delete [] s;
+				delete [] t;
+			}
+
+			return( true );
+		}
+	};
+
+
+	// ̃ubNɑ΂āCȅɍsiwith_z  false ̏ꍇXEŶ݁j
+	template < class Thread, class T >
+	void slab_distance_transform( Thread *thread, size_t thread_num, T *ptr, size_t w, size_t h, size_t d, const T &infinity, bool with_z = true )
+	{
+		for( size_t axis = 0 ; axis < 3 ; axis++ )
+		{
+			if( ( axis == 1 && h < 2 ) || ( axis == 2 && ( d < 2 || !with_z ) ) )
+			{
+				continue;
+			}
+
+			for( size_t i = 0 ; i < thread_num ; i++ )
+			{
+				thread[ i ].setup_parameters( ptr, w, h, d, infinity, axis, i, thread_num );
+			}
+
+			do_threads_( thread, thread_num );
+		}
+	}
+
+
+	// XuPʂ̋ϊŁCԌʂێ邽߂̈ꎞt@C
+	class slab_temporary_file
+	{
+	private:
+		FILE *fp_;
+
+	public:
+		slab_temporary_file( ) : fp_( tmpfile( ) ){ }
+
+		~slab_temporary_file( )
+		{
+			if( fp_ != NULL )
+			{
+				fclose( fp_ );
+			}
+		}
+
+		bool is_open( ) const { return( fp_ != NULL ); }
+
+		// 2GB𒴂t@C߁C64bit̃ItZbgŃV[N
+		bool seek( unsigned long long offset )
+		{
+#if defined( __MIST_MSVC__ ) && __MIST_MSVC__ >= 8
+			return( _fseeki64( fp_, static_cast< __int64 >( offset ), SEEK_SET ) == 0 );
+#elif defined( __MIST_WINDOWS__ ) && __MIST_WINDOWS__ > 0
+			return( fseek( fp_, static_cast< long >( offset ), SEEK_SET ) == 0 );
+#else
+			return( fseeko( fp_, static_cast< off_t >( offset ), SEEK_SET ) == 0 );
+#endif
+		}
+
+		bool read( unsigned long long offset, void *buff, size_t bytes )
+		{
+			return( seek( offset ) && fread( buff, 1, bytes, fp_ ) == bytes );
+		}
+
+		bool write( unsigned long long offset, const void *buff, size_t bytes )
+		{
+			return( seek( offset ) && fwrite( buff, 1, bytes, fp_ ) == bytes );
+		}
+
+	private:
+		slab_temporary_file( const slab_temporary_file & );
+		const slab_temporary_file &operator =( const slab_temporary_file & );
+	};
+
+
+	// ϊŗpC1C1iڂ̏
+	// Oifł߂wif܂ł̃[Nbh2拗ƁC̔wif̈ʒuioffset Ƃz̗vfԍj߂
+	// f  NULL ̏ꍇ݂͋̂߂
+	template < class T, class F >
+	void feature_transform_line( T *p, F *f, ptrdiff_t num, ptrdiff_t stride, ptrdiff_t offset, const T &infinity )
+	{
+		ptrdiff_t i, b;
+
+		for( i = 0, b = -1 ; i < num ; i++ )
+		{
+			T &v = p[ i * stride ];
+			if( v == 0 )
+			{
+				b = i;
+			}
+
+			v = b < 0 ? infinity : static_cast< T >( i - b );
+			if( f != NULL )
+			{
+				f[ i * stride ] = static_cast< F >( b < 0 ? -1 : offset + b * stride );
+			}
+		}
+
+		for( i = num - 1, b = -1 ; i >= 0 ; i-- )
+		{
+			T &v = p[ i * stride ];
+			if( v == 0 )
+			{
+				b = i;
+			}
+			else if( b >= 0 && static_cast< T >( b - i ) < v )
+			{
+				v = static_cast< T >( b - i );
+				if( f != NULL )
+				{
+					f[ i * stride ] = static_cast< F >( offset + b * stride );
+				}
+			}
+
+			v = v * v;
+		}
+	}
+
+	// ϊŗpC1C2iڈȍ~̏i̌vZj
+	// efɂ́Cł̏Ȃ_ێwif̈ʒu`d
+	template < class T, class F, class Metric >
+	void lower_envelope_line( T *p, F *f, ptrdiff_t num, ptrdiff_t stride, T *g, F *fg, ptrdiff_t *s, ptrdiff_t *t, Metric __dmy__ )
+	{
+		ptrdiff_t u, q;
+
+		for( u = 0 ; u < num ; u++ )
+		{
+			g[ u ] = p[ u * stride ];
+			fg[ u ] = f[ u * stride ];
+		}
+
+		q = s[ 0 ] = t[ 0 ] = 0;
+
+		for( u = 1 ; u < num ; u++ )
+		{
+			while( q >= 0 && Metric::Func( t[ q ], s[ q ], g[ s[ q ] ] ) > Metric::Func( t[ q ], u, g[ u ] ) )
+			{
+				q--;
+			}
+
+			if( q < 0 )
+			{
+				q = 0;
+				s[ 0 ] = u;
+			}
+			else
+			{
+				ptrdiff_t tmp = Metric::Sep( s[ q ], u, g[ s[ q ] ], g[ u ] );
+
+				if( tmp < num - 1 )
+				{
+					q++;
+					s[ q ] = u;
+					t[ q ] = tmp + 1;
+				}
+			}
+		}
+
+		for( u = num - 1 ; u >= 0 ; u-- )
+		{
+			p[ u * stride ] = static_cast< T >( Metric::Func( u, s[ q ], g[ s[ q ] ] ) );
+			f[ u * stride ] = fg[ s[ q ] ];
+			if( u == t[ q ] )
+			{
+				q--;
+			}
+		}
+	}
+
+
+	// ϊEtϊsXbh
+	// }`̋iinsidejƐ}`Őioutsidej𓯂pX̒ŌvZD
+	// outside  feature  NULL ł悢D
+	template < class T, class F >
+	class feature_transform_thread : public mist::thread< feature_transform_thread< T, F > >
+	{
+	public:
+		typedef mist::thread< feature_transform_thread< T, F > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+		typedef T value_type;
+		typedef F feature_type;
+
+	private:
+		size_t thread_id_;
+		size_t thread_num_;
+
+		// o͗p̉摜ւ̃|C^
+		value_type   *inside_;
+		value_type   *outside_;
+		feature_type *feature_;
+		size_type width_;
+		size_type height_;
+		size_type depth_;
+		value_type infinity_;
+		size_type axis_;
+		EDT dmy_;
+
+	public:
+		void setup_parameters( value_type *inside, value_type *outside, feature_type *feature, size_type width, size_type height, size_type depth,
+								const value_type &infinity, size_type axis, size_type thread_id, size_type thread_num )
+		{
+			inside_     = inside;
+			outside_    = outside;
+			feature_    = feature;
+			width_      = width;
+			height_     = height;
+			depth_      = depth;
+			infinity_   = infinity;
+			axis_       = axis;
+			thread_id_  = thread_id;
+			thread_num_ = thread_num;
+		}
+
+		const feature_transform_thread& operator =( const feature_transform_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				thread_id_ = p.thread_id_;
+				thread_num_ = p.thread_num_;
+				inside_ = p.inside_;
+				outside_ = p.outside_;
+				feature_ = p.feature_;
+				width_ = p.width_;
+				height_ = p.height_;
+				depth_ = p.depth_;
+				infinity_ = p.infinity_;
+				axis_ = p.axis_;
+			}
+			return( *this );
+		}
+
+		feature_transform_thread( size_type id = 0, size_type num = 1 )
+			: thread_id_( id ), thread_num_( num ), inside_( NULL ), outside_( NULL ), feature_( NULL ),
+			width_( 0 ), height_( 0 ), depth_( 0 ), infinity_( 0 ), axis_( 0 )
+		{
+		}
+		feature_transform_thread( const feature_transform_thread &p )
+			: base( p ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ ), inside_( NULL ), outside_( NULL ), feature_( NULL ),
+			width_( p.width_ ), height_( p.height_ ), depth_( p.depth_ ), infinity_( p.infinity_ ), axis_( p.axis_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const difference_type w = width_;
+			const difference_type h = height_;
+			const difference_type d = depth_;
+
+			difference_type lines, num, stride;
+			switch( axis_ )
+			{
+			case 1:
+				lines  = w * d;
+				num    = h;
+				stride = w;
+				break;
+
+			case 2:
+				lines  = w * h;
+				num    = d;
+				stride = w * h;
+				break;
+
+			case 0:
+			default:
+				lines  = h * d;
+				num    = w;
+				stride = 1;
+				break;
+			}
+
+			difference_type lbegin = static_cast< difference_type >( lines * thread_id_ / thread_num_ );
+			difference_type lend   = static_cast< difference_type >( lines * ( thread_id_ + 1 ) / thread_num_ );
+
+			if( axis_ == 0 )
+			{
+				for( difference_type l = lbegin ; l < lend ; l++ )
+				{
+					feature_transform_line( inside_ + l * w, feature_ == NULL ? NULL : feature_ + l * w, num, stride, l * w, infinity_ );
+					if( outside_ != NULL )
+					{
+						feature_transform_line( outside_ + l * w, static_cast< feature_type * >( NULL ), num, stride, l * w, infinity_ );
+					}
+				}
+			}
+			else
+			{
+				value_type *g = new value_type[ num ];
+				feature_type *fg = new feature_type[ num ];
+				difference_type *s = new difference_type[ num ];
+				difference_type *t = new difference_type[ num ];
+
+				for( difference_type l = lbegin ; l < lend ; l++ )
+				{
+					difference_type offset = axis_ == 1 ? ( l / w ) * w * h + l % w : l;
+
+					if( feature_ != NULL )
+					{
+						lower_envelope_line( inside_ + offset, feature_ + offset, num, stride, g, fg, s, t, dmy_ );
+					}
+					else
+					{
+						lower_envelope_line( inside_ + offset, num, stride, g, s, t, dmy_ );
+					}
+
+					if( outside_ != NULL )
+					{
+						lower_envelope_line( outside_ + offset, num, stride, g, s, t, dmy_ );
+					}
+				}
+
+				delete [] g;
+				delete [] fg;
+				delete [] s;
+				delete [] t;
+			}
+
+			return( true );
+		}
+	};
+
+
+	// ϊEtϊ̊ȅɍs
+	template < class T, class F >
+	void feature_transform( T *inside, T *outside, F *feature, size_t w, size_t h, size_t d, size_t thread_num )
+	{
+		typedef feature_transform_thread< T, F > thread_type;
+
+		const T infinity = static_cast< T >( w + h + d );
+
+		thread_type *thread = new thread_type[ thread_num ];
+
+		for( size_t axis = 0 ; axis < 3 ; axis++ )
+		{
+			if( ( axis == 1 && h < 2 ) || ( axis == 2 && d < 2 ) )
+			{
+				continue;
+			}
+
+			for( size_t i = 0 ; i < thread_num ; i++ )
+			{
+				thread[ i ].setup_parameters( inside, outside, feature, w, h, d, infinity, axis, i, thread_num );
+			}
+
+			do_threads_( thread, thread_num );
+		}
+
+		delete [] thread;
+	}
 }
 
 
@@ -2446,8 +3041,332 @@ namespace meijster
 
 		delete [] thread;
 	}
+
+
+	/// @brief XuPʂœo͂sCȃ{[̂߂̋ϊiCDT, MDT, EDTj
+	//! 
+	//! {[Ŝɕێɋϊs܂D
+	//! ͂Z slab.depth( ) XuƂēǂݍ݁CXuXEY̏sCԌʂꎞt@Cɕۑ܂D
+	//! Z̏́Cslab ƓvfɎ܂sꎞt@Cǂݖ߂čs܂D
+	//! ̂߁CKvƂȂ郁 slab ƍƗp̐Ĉ݂ƂȂ܂D
+	//! {[Ŝ1̃XuɎ܂ꍇ́Cꎞt@Cpɏ܂D
+	//! 
+	//! o͂鋗̌^ slab ̗vf^Ō܂܂D
+	//! [Nbh2拗i_meijster_distance_transform_::EDTj߂ꍇ́Cunsigned int Ȃǂ̐^ float pĂD
+	//! 
+	//! - reader  bool reader( Array &slab, size_type z, size_type num ) ̌`ŁCslab ̐擪 num  z ` z + num - 1 ڂ̃XCXi[i0ȊỎf}`j
+	//! - writer  bool writer( const Array &slab, size_type z, size_type num ) ̌`ŁCslab ̐擪 num Ɋi[ꂽ z ` z + num - 1 ڂ̌ʂ󂯎
+	//! - writer ̓XCX̏ɌĂяo
+	//! 
+	//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+	//! @attention f̃AXyNg͍lȂ
+	//!
+	//! - Ql
+	//!     - A. Meijster, J. Roerdink, and W. Hesselink, "A general algorithm for computing distance transforms in linear time," In: Mathematical Morphology and its Applications to Image and Signal Processing, J. Goutsias, L. Vincent, and D.S. Bloomberg (eds.), Kluwer, 2000, pp. 331-340
+	//! 
+	//! @param[in,out] slab       c Xup̃obt@iƍ̓{[ƓɂCsŃXu̖w肷j
+	//! @param[in]     depth      c {[̃XCX
+	//! @param[in]     reader     c ̓Xuǂݍފ֐IuWFNg
+	//! @param[in]     writer     c o̓Xuo֐IuWFNg
+	//! @param[in]     __metric__ c ֐
+	//! @param[in]     thread_num c gpXbh
+	//! 
+	//! @retval true  c ϊɐ
+	//! @retval false c Xu̓óC͈ꎞt@C̑Ɏs
+	//! 
+	template < class Array, class Reader, class Writer, class Metric >
+	bool slab_distance_transform( Array &slab, typename Array::size_type depth, Reader reader, Writer writer, Metric __metric__, typename Array::size_type thread_num = 0 )
+	{
+		typedef typename Array::size_type  size_type;
+		typedef typename Array::value_type value_type;
+		typedef _meijster_distance_transform_::slab_distance_transform_thread< value_type, Metric > slab_distance_transform_thread;
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+
+		const size_type w  = slab.width( );
+		const size_type h  = slab.height( );
+		const size_type d  = depth;
+		const size_type sd = slab.depth( );
+
+		if( w == 0 || h == 0 || d == 0 || sd == 0 )
+		{
+			return( false );
+		}
+
+		// 1iڂ̏Ő}`ɗ^鏉liǂ̋傫Ȃlj
+		const value_type infinity = static_cast< value_type >( w + h + d );
+
+		slab_distance_transform_thread *thread = new slab_distance_transform_thread[ thread_num ];
+
+		if( d <= sd )
+		{
+			// {[Ŝ1̃XuɎ܂ꍇ
+			bool ret = reader( slab, 0, d );
+			if( ret )
+			{
+				_meijster_distance_transform_::slab_distance_transform( thread, thread_num, &slab[ 0 ], w, h, d, infinity );
+				ret = writer( slab, 0, d );
+			}
+
+			delete [] thread;
+			return( ret );
+		}
+
+		typedef unsigned long long offset_type;
+		const offset_type plane = static_cast< offset_type >( w ) * h;
+		const offset_type bytes = sizeof( value_type );
+
+		_meijster_distance_transform_::slab_temporary_file file;
+		bool ret = file.is_open( );
+
+		size_type z, y, k;
+
+		// XEY̏XuɍsCꎞt@Cɕۑ
+		for( z = 0 ; ret && z < d ; z += sd )
+		{
+			size_type num = d - z < sd ? d - z : sd;
+			ret = reader( slab, z, num );
+			if( ret )
+			{
+				_meijster_distance_transform_::slab_distance_transform( thread, thread_num, &slab[ 0 ], w, h, num, infinity, false );
+				ret = file.write( z * plane * bytes, &slab[ 0 ], static_cast< size_t >( num * plane * bytes ) );
+			}
+		}
+
+		// Z̏Cslab Ɏ܂sǂݖ߂čs
+		size_type rows = static_cast< size_type >( slab.size( ) / ( w * d ) );
+		rows = rows < 1 ? 1 : ( rows > h ? h : rows );
+
+		array< value_type > buff;
+		value_type *block = &slab[ 0 ];
+		if( rows * w * d > slab.size( ) )
+		{
+			buff.resize( rows * w * d );
+			block = &buff[ 0 ];
+		}
+
+		for( y = 0 ; ret && y < h ; y += rows )
+		{
+			size_type num = h - y < rows ? h - y : rows;
+			size_t line = static_cast< size_t >( num * w * bytes );
+
+			for( k = 0 ; ret && k < d ; k++ )
+			{
+				ret = file.read( ( k * plane + y * w ) * bytes, block + k * num * w, line );
+			}
+
+			if( ret )
+			{
+				for( size_type i = 0 ; i < thread_num ; i++ )
+				{
+					thread[ i ].setup_parameters( block, w, num, d, infinity, 2, i, thread_num );
+				}
+
+				do_threads_( thread, thread_num );
+			}
+
+			for( k = 0 ; ret && k < d ; k++ )
+			{
+				ret = file.write( ( k * plane + y * w ) * bytes, block + k * num * w, line );
+			}
+		}
+
+		buff.clear( );
+
+		// ʂXCX̏ɏo
+		for( z = 0 ; ret && z < d ; z += sd )
+		{
+			size_type num = d - z < sd ? d - z : sd;
+			ret = file.read( z * plane * bytes, &slab[ 0 ], static_cast< size_t >( num * plane * bytes ) ) && writer( slab, z, num );
+		}
+
+		delete [] thread;
+
+		return( ret );
+	}
+
+
+	/// @brief [Nbh2拗ϊƓϊiŋߖT̔wif̈ʒuj𓯎ɍs
+	//! 
+	//! eOifɂāCł߂wif܂ł̃[Nbh2拗 dist ɁC̔wif̗vfԍ feature ɏo͂܂D
+	//! wifł́C0Cvfԍ͎g̗vfԍɂȂ܂D
+	//! vfԍ n W߂ɂ́Cx = n % widthCy = ( n / width ) % heightCz = n / ( width * height ) Ƃ܂D
+	//! 摜ɔwif݂ȂꍇCfeature ɂ -1 o͂܂D
+	//! 
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+	//! @attention f̃AXyNg͍lȂ
+	//! @attention feature ̗vf^ɂ́Cptrdiff_t Ȃǂ̕t^pĂ
+	//!
+	//! - Ql
+	//!     - A. Meijster, J. Roerdink, and W. Hesselink, "A general algorithm for computing distance transforms in linear time," In: Mathematical Morphology and its Applications to Image and Signal Processing, J. Goutsias, L. Vincent, and D.S. Bloomberg (eds.), Kluwer, 2000, pp. 331-340
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] dist       c o̓[Nbh2拗摜
+	//! @param[out] feature    c ł߂wif̗vfԍi[摜
+	//! @param[in]  thread_num c gpXbh
+	//! 
+	template < class Array1, class Array2, class Array3 >
+	void feature_transform( const Array1 &in, Array2 &dist, Array3 &feature, typename Array1::size_type thread_num = 0 )
+	{
+		typedef typename Array2::size_type  size_type;
+		typedef typename Array2::value_type value_type;
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+
+		dist.resize( in.size1( ), in.size2( ), in.size3( ) );
+		dist.reso1( in.reso1( ) );
+		dist.reso2( in.reso2( ) );
+		dist.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			dist[ i ] = static_cast< value_type >( in[ i ] != 0 ? 1 : 0 );
+		}
+
+		feature.resize( in.size1( ), in.size2( ), in.size3( ) );
+		feature.reso1( in.reso1( ) );
+		feature.reso2( in.reso2( ) );
+		feature.reso3( in.reso3( ) );
+
+		if( dist.empty( ) )
+		{
+			return;
+		}
+
+		_meijster_distance_transform_::feature_transform( &dist[ 0 ], static_cast< value_type * >( NULL ), &feature[ 0 ], dist.width( ), dist.height( ), dist.depth( ), thread_num );
+	}
+
+
+	/// @brief t[Nbhϊ
+	//! 
+	//! }`i0ȊỎfjł͍ł߂wif܂ł̃[Nbhɕ̕tlC
+	//! }`Oł͍ł߂}`f܂ł̃[Nbho͂܂D
+	//! }`ƊŐ͓pX̒œɌvZ邽߁C}`Ƃ̔]摜ɑ΂2񋗗ϊsKv͂܂D
+	//! o͂2拗ł͂Ȃ[NbhɂȂ邽߁Co͉摜ɂ float ܂ double ^pĂD
+	//! 
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+	//! @attention f̃AXyNg͍lȂ
+	//!
+	//! - Ql
+	//!     - A. Meijster, J. Roerdink, and W. Hesselink, "A general algorithm for computing distance transforms in linear time," In: Mathematical Morphology and its Applications to Image and Signal Processing, J. Goutsias, L. Vincent, and D.S. Bloomberg (eds.), Kluwer, 2000, pp. 331-340
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͕t摜
+	//! @param[in]  thread_num c gpXbh
+	//! 
+	template < class Array1, class Array2 >
+	void signed_distance_transform( const Array1 &in, Array2 &out, typename Array1::size_type thread_num = 0 )
+	{
+		typedef typename Array2::size_type  size_type;
+		typedef typename Array2::value_type value_type;
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+
+		// }`ŐvZ邽߂̍Ɨpz
+		array< value_type > outside( in.size( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			outside[ i ] = static_cast< value_type >( in[ i ] != 0 ? 0 : 1 );
+		}
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < out.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( outside[ i ] == 0 ? 1 : 0 );
+		}
+
+		if( out.empty( ) )
+		{
+			return;
+		}
+
+		_meijster_distance_transform_::feature_transform( &out[ 0 ], &outside[ 0 ], static_cast< ptrdiff_t * >( NULL ), out.width( ), out.height( ), out.depth( ), thread_num );
+
+		for( size_type i = 0 ; i < out.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( std::sqrt( static_cast< double >( outside[ i ] ) ) - std::sqrt( static_cast< double >( out[ i ] ) ) );
+		}
+	}
+}
+
+
+/// @brief [Nbhϊ
+namespace euclidean
+{
+	/// @brief XuPʂœo͂sCȃ{[̂߂̃[Nbh2拗ϊ
+	//! 
+	//! A. Meijster ɂASYpāC{[ŜɕێɃ[Nbh2拗vZ܂D
+	//! reader  writer ̌` meijster::slab_distance_transform ƓłD
+	//! slab ̗vf^ɂ́Cunsigned int Ȃǂ̐^i2拗j float pĂD
+	//! 
+	//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+	//! @attention f̃AXyNg͍lȂ
+	//! 
+	//! @param[in,out] slab       c Xup̃obt@iƍ̓{[ƓɂCsŃXu̖w肷j
+	//! @param[in]     depth      c {[̃XCX
+	//! @param[in]     reader     c ̓Xuǂݍފ֐IuWFNg
+	//! @param[in]     writer     c o̓Xuo֐IuWFNg
+	//! @param[in]     thread_num c gpXbh
+	//! 
+	//! @retval true  c ϊɐ
+	//! @retval false c Xu̓óC͈ꎞt@C̑Ɏs
+	//! 
+	template < class Array, class Reader, class Writer >
+	bool slab_distance_transform( Array &slab, typename Array::size_type depth, Reader reader, Writer writer, typename Array::size_type thread_num = 0 )
+	{
+		_meijster_distance_transform_::EDT metric;
+		return( meijster::slab_distance_transform( slab, depth, reader, writer, metric, thread_num ) );
+	}
+
+
+	/// @brief [Nbh2拗ϊƓϊiŋߖT̔wif̈ʒuj𓯎ɍs
+	//! 
+	//! ڍׂ meijster::feature_transform QƂĂD
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] dist       c o̓[Nbh2拗摜
+	//! @param[out] feature    c ł߂wif̗vfԍi[摜
+	//! @param[in]  thread_num c gpXbh
+	//! 
+	template < class Array1, class Array2, class Array3 >
+	void feature_transform( const Array1 &in, Array2 &dist, Array3 &feature, typename Array1::size_type thread_num = 0 )
+	{
+		meijster::feature_transform( in, dist, feature, thread_num );
+	}
+
+
+	/// @brief t[Nbhϊi}`j
+	//! 
+	//! ڍׂ meijster::signed_distance_transform QƂĂD
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͕t摜
+	//! @param[in]  thread_num c gpXbh
+	//! 
+	template < class Array1, class Array2 >
+	void signed_distance_transform( const Array1 &in, Array2 &out, typename Array1::size_type thread_num = 0 )
+	{
+		meijster::signed_distance_transform( in, out, thread_num );
+	}
 }
 
+
 /// @}
 //  A. Meijster ɂ鋗ϊO[v̏I
 
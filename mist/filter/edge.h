@@ -81,246 +81,424 @@ _MIST_BEGIN
 //!  @{
 
 
-/// @brief CannỹGbWotB^
-//! 
-//! @attention ͂Əo͂́CIuWFNgł삷
-//! @attention OpenMPLȏꍇ͎IɕvZs
-//! 
-//! @param[in]  in            c ͉摜
-//! @param[out] out           c o͉摜
-//! @param[in]  lower         c qXeVXl̉
-//! @param[in]  upper         c qXeVXl̏
-//! @param[in]  useL2gradient c L2̃OfBGgvZ邩ǂiftHgfalsej
-//! @param[in]  fgval         c GbWfiOijɑliftHg255j
-//! @param[in]  bgval         c wifɑliftHg0j
-//! @param[in]  thread_num    c gpXbh
-//! 
-//! @retval true  c tB^Oɐ
-//! @retval false c ͉摜̏ꍇ
-//! 
-template < class T1, class T2, class Allocator1, class Allocator2 >
-inline bool canny( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, double lower, double upper, bool useL2gradient = false, const typename array2< T2, Allocator2 >::value_type &fgval = typename array2< T2, Allocator2 >::value_type( 255 ), const typename array2< T2, Allocator2 >::value_type &bgval = typename array2< T2, Allocator2 >::value_type( 0 ), typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+// CannỹGbWotB^̎
+namespace __canny__
 {
-	typedef typename array2< T1, Allocator1 >::size_type       size_type;
-	typedef typename array2< T1, Allocator1 >::difference_type difference_type;
-	if( in.empty( ) )
+	// SobeltB^̌vZɗp^i8E16rbg̐摜͐ZŌzvZj
+	template < class T > struct gradient_type                   { typedef double value_type; };
+	template < >         struct gradient_type< unsigned char >  { typedef int value_type; };
+	template < >         struct gradient_type< signed char >    { typedef int value_type; };
+	template < >         struct gradient_type< char >           { typedef int value_type; };
+	template < >         struct gradient_type< unsigned short > { typedef int value_type; };
+	template < >         struct gradient_type< signed short >   { typedef int value_type; };
+
+	// 摜̉̌z linear_filter ƓKi͂ݏoW̘aŐKjŌvZ
+	template < class Array >
+	inline double border_gradient( const Array &in, typename Array::difference_type i, typename Array::difference_type j, const int k[ 3 ][ 3 ] )
 	{
-		return( false );
-	}
+		typedef typename Array::difference_type difference_type;
 
-	// lւĂꍇւ̑Ώ
-	if( lower > upper )
-	{
-		double ttt = lower;
-		lower = upper;
-		upper = ttt;
-	}
+		difference_type w = in.width( );
+		difference_type h = in.height( );
+		double value = 0.0;
+		int sum = 0;
 
-	typedef array2< double > image_type;
-	typedef array2< unsigned char > mask_type;
+		for( difference_type m = 0 ; m < 3 ; m++ )
+		{
+			difference_type y = j + m - 1;
+			if( y < 0 || y >= h )
+			{
+				continue;
+			}
 
-	image_type tmp, k1( 3, 3 ), k2( 3, 3 ), gx, gy;
+			for( difference_type l = 0 ; l < 3 ; l++ )
+			{
+				difference_type x = i + l - 1;
+				if( x < 0 || x >= w )
+				{
+					continue;
+				}
 
-	convert( in, tmp );
+				value += k[ m ][ l ] * static_cast< double >( in( x, y ) );
+				sum += k[ m ][ l ];
+			}
+		}
+
+		return( sum == 0 ? value : value / sum );
+	}
 
-	k1( 0, 0 ) = -1; k1( 1, 0 ) =  0; k1( 2, 0 ) =  1;
-	k1( 0, 1 ) = -2; k1( 1, 1 ) =  0; k1( 2, 1 ) =  2;
-	k1( 0, 2 ) = -1; k1( 1, 2 ) =  0; k1( 2, 2 ) =  1;
+	template < class Array >
+	inline double border_magnitude( const Array &in, typename Array::difference_type i, typename Array::difference_type j, bool useL2gradient )
+	{
+		static const int kx[ 3 ][ 3 ] = { { -1, 0, 1 }, { -2, 0, 2 }, { -1, 0, 1 } };
+		static const int ky[ 3 ][ 3 ] = { { -1, -2, -1 }, { 0, 0, 0 }, { 1, 2, 1 } };
 
-	k2( 0, 0 ) = -1; k2( 1, 0 ) = -2; k2( 2, 0 ) = -1;
-	k2( 0, 1 ) =  0; k2( 1, 1 ) =  0; k2( 2, 1 ) =  0;
-	k2( 0, 2 ) = +1; k2( 1, 2 ) = +2; k2( 2, 2 ) = +1;
+		double dx = border_gradient( in, i, j, kx );
+		double dy = border_gradient( in, i, j, ky );
 
-	linear_filter( tmp, gx, k1, thread_num );
-	linear_filter( tmp, gy, k2, thread_num );
+		return( useL2gradient ? std::sqrt( dx * dx + dy * dy ) : std::abs( dx ) + std::abs( dy ) );
+	}
 
-	if( useL2gradient )
+	// SobeltB^CzxCɑl}3s̃obt@p1̑ōsXbh
+	// Ss͈̔͂ƂɏCGbWf̈ʒuL^
+	template < class Array >
+	class canny_thread : public mist::thread< canny_thread< Array > >
 	{
-#ifdef _OPENMP
-		#pragma omp parallel for
-#endif
-		for( int i = 0 ; i < static_cast< int >( tmp.size( ) ) ; i++ )
+	public:
+		typedef mist::thread< canny_thread< Array > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef typename Array::size_type size_type;
+		typedef typename Array::difference_type difference_type;
+		typedef typename Array::value_type value_type;
+		typedef typename gradient_type< value_type >::value_type gradient_value_type;
+		typedef array2< unsigned char > mask_type;
+
+	private:
+		const Array *in_;
+		mask_type *mask_;
+		size_type begin_;
+		size_type end_;
+		double lower_;
+		double upper_;
+		bool useL2gradient_;
+		std::vector< size_type > strong_;
+
+	public:
+		void setup_parameters( const Array &in, mask_type &mask, size_type begin, size_type end, double lower, double upper, bool useL2gradient )
 		{
-			tmp[ i ] = std::sqrt( gx[ i ] * gx[ i ] + gy[ i ] * gy[ i ] );
+			in_            = &in;
+			mask_          = &mask;
+			begin_         = begin;
+			end_           = end;
+			lower_         = lower;
+			upper_         = upper;
+			useL2gradient_ = useL2gradient;
+			strong_.clear( );
 		}
-	}
-	else
-	{
-#ifdef _OPENMP
-		#pragma omp parallel for
-#endif
-		for( int i = 0 ; i < static_cast< int >( tmp.size( ) ) ; i++ )
+
+		const std::vector< size_type > &strong_edges( ) const { return( strong_ ); }
+
+		const canny_thread& operator =( const canny_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				in_ = p.in_;
+				mask_ = p.mask_;
+				begin_ = p.begin_;
+				end_ = p.end_;
+				lower_ = p.lower_;
+				upper_ = p.upper_;
+				useL2gradient_ = p.useL2gradient_;
+				strong_ = p.strong_;
+			}
+			return( *this );
+		}
+
+		canny_thread( ) : in_( NULL ), mask_( NULL ), begin_( 0 ), end_( 0 ), lower_( 0 ), upper_( 0 ), useL2gradient_( false )
 		{
-			tmp[ i ] = std::abs( gx[ i ] ) + std::abs( gy[ i ] );
 		}
-	}
 
-	mask_type mask( in.width( ), in.height( ) );
+		canny_thread( const canny_thread &p ) : base( p ), in_( p.in_ ), mask_( p.mask_ ), begin_( p.begin_ ), end_( p.end_ ),
+												lower_( p.lower_ ), upper_( p.upper_ ), useL2gradient_( p.useL2gradient_ ), strong_( p.strong_ )
+		{
+		}
 
-#ifdef _OPENMP
-	#pragma omp parallel for schedule( guided )
-#endif
-	for( int j = 1 ; j < static_cast< int >( tmp.height( ) - 1 ) ; j++ )
-	{
-		for( size_type i = 1 ; i < tmp.width( ) - 1 ; i++ )
+	protected:
+		// 1šzƌzxvZ
+		void compute_row( difference_type j, gradient_value_type *gx, gradient_value_type *gy, double *mag )
 		{
-			double dx = gx( i, j );
-			double dy = gy( i, j );
-			double sign = dx * dy < 0 ? -1 : +1;
+			const Array &in = *in_;
+			difference_type w = in.width( );
+			difference_type h = in.height( );
+
+			if( j == 0 || j == h - 1 )
+			{
+				for( difference_type i = 0 ; i < w ; i++ )
+				{
+					mag[ i ] = border_magnitude( in, i, j, useL2gradient_ );
+				}
+				return;
+			}
 
-			dx = std::abs( dx );
-			dy = std::abs( dy );
+			typename Array::const_pointer p0 = &in( 0, j - 1 );
+			typename Array::const_pointer p1 = &in( 0, j );
+			typename Array::const_pointer p2 = &in( 0, j + 1 );
 
-			double val = tmp( i, j );
+			for( difference_type i = 1 ; i < w - 1 ; i++ )
+			{
+				gradient_value_type t0 = static_cast< gradient_value_type >( p0[ i - 1 ] );
+				gradient_value_type t1 = static_cast< gradient_value_type >( p0[ i ] );
+				gradient_value_type t2 = static_cast< gradient_value_type >( p0[ i + 1 ] );
+				gradient_value_type m0 = static_cast< gradient_value_type >( p1[ i - 1 ] );
+				gradient_value_type m2 = static_cast< gradient_value_type >( p1[ i + 1 ] );
+				gradient_value_type b0 = static_cast< gradient_value_type >( p2[ i - 1 ] );
+				gradient_value_type b1 = static_cast< gradient_value_type >( p2[ i ] );
+				gradient_value_type b2 = static_cast< gradient_value_type >( p2[ i + 1 ] );
+
+				gx[ i ] = ( t2 - t0 ) + 2 * ( m2 - m0 ) + ( b2 - b0 );
+				gy[ i ] = ( b0 + 2 * b1 + b2 ) - ( t0 + 2 * t1 + t2 );
+			}
 
-			if( val > lower )
+			if( useL2gradient_ )
 			{
-				// dy / dx < tan( 22.5 / 180.0 / 3.1415926535897932384626433832795 )
-				if( dy < dx * 0.4142135623730950488016887242097 )
+				for( difference_type i = 1 ; i < w - 1 ; i++ )
 				{
-					// 0x
-					if( val > tmp( i - 1, j ) && val >= tmp( i + 1, j ) )
-					{
-						if( val > upper )
-						{
-							mask( i, j ) = 2;
-						}
-						else
-						{
-							mask( i, j ) = 1;
-						}
-					}
+					double dx = static_cast< double >( gx[ i ] );
+					double dy = static_cast< double >( gy[ i ] );
+					mag[ i ] = std::sqrt( dx * dx + dy * dy );
 				}
-				// dy / dx < tan( ( 22.5 + 45.0 ) / 180.0 / 3.1415926535897932384626433832795 )
-				else if( dy > dx * 2.4142135623730950488016887242097 )
+			}
+			else
+			{
+				for( difference_type i = 1 ; i < w - 1 ; i++ )
 				{
-					// 90x
-					if( val > tmp( i, j - 1 ) && val >= tmp( i, j + 1 ) )
-					{
-						if( val > upper )
-						{
-							mask( i, j ) = 2;
-						}
-						else
-						{
-							mask( i, j ) = 1;
-						}
-					}
+					mag[ i ] = static_cast< double >( ( gx[ i ] < 0 ? -gx[ i ] : gx[ i ] ) + ( gy[ i ] < 0 ? -gy[ i ] : gy[ i ] ) );
 				}
-				else
+			}
+
+			mag[ 0 ] = border_magnitude( in, 0, j, useL2gradient_ );
+			mag[ w - 1 ] = border_magnitude( in, w - 1, j, useL2gradient_ );
+		}
+
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const Array &in = *in_;
+			mask_type &mask = *mask_;
+			difference_type w = in.width( );
+
+			std::vector< gradient_value_type > gbuff( 6 * w );
+			std::vector< double > mbuff( 3 * w );
+			gradient_value_type *gx[ 3 ], *gy[ 3 ];
+			double *mag[ 3 ];
+
+			for( size_type n = 0 ; n < 3 ; n++ )
+			{
+				gx[ n ]  = &gbuff[ ( 2 * n ) * w ];
+				gy[ n ]  = &gbuff[ ( 2 * n + 1 ) * w ];
+				mag[ n ] = &mbuff[ n * w ];
+			}
+
+			compute_row( begin_ - 1, gx[ ( begin_ - 1 ) % 3 ], gy[ ( begin_ - 1 ) % 3 ], mag[ ( begin_ - 1 ) % 3 ] );
+			compute_row( begin_, gx[ begin_ % 3 ], gy[ begin_ % 3 ], mag[ begin_ % 3 ] );
+
+			for( size_type j = begin_ ; j < end_ ; j++ )
+			{
+				compute_row( j + 1, gx[ ( j + 1 ) % 3 ], gy[ ( j + 1 ) % 3 ], mag[ ( j + 1 ) % 3 ] );
+
+				const gradient_value_type *px = gx[ j % 3 ];
+				const gradient_value_type *py = gy[ j % 3 ];
+				const double *mp = mag[ ( j - 1 ) % 3 ];
+				const double *mc = mag[ j % 3 ];
+				const double *mn = mag[ ( j + 1 ) % 3 ];
+				unsigned char *pm = &mask( 0, j );
+
+				for( difference_type i = 1 ; i < w - 1 ; i++ )
 				{
-					if( sign < 0 )
+					double val = mc[ i ];
+
+					if( val <= lower_ )
+					{
+						continue;
+					}
+
+					gradient_value_type gdx = px[ i ];
+					gradient_value_type gdy = py[ i ];
+					bool negative = ( gdx < 0 && gdy > 0 ) || ( gdx > 0 && gdy < 0 );
+					double dx = std::abs( static_cast< double >( gdx ) );
+					double dy = std::abs( static_cast< double >( gdy ) );
+					bool is_max;
+
+					// dy / dx < tan( 22.5 / 180.0 / 3.1415926535897932384626433832795 )
+					if( dy < dx * 0.4142135623730950488016887242097 )
+					{
+						// 0x
+						is_max = val > mc[ i - 1 ] && val >= mc[ i + 1 ];
+					}
+					// dy / dx < tan( ( 22.5 + 45.0 ) / 180.0 / 3.1415926535897932384626433832795 )
+					else if( dy > dx * 2.4142135623730950488016887242097 )
+					{
+						// 90x
+						is_max = val > mp[ i ] && val >= mn[ i ];
+					}
+					else if( negative )
 					{
 						// 45x
-						if( val > tmp( i - 1, j + 1 ) && val > tmp( i + 1, j - 1 ) )
-						{
-							if( val > upper )
-							{
-								mask( i, j ) = 2;
-							}
-							else
-							{
-								mask( i, j ) = 1;
-							}
-						}
+						is_max = val > mn[ i - 1 ] && val > mp[ i + 1 ];
 					}
 					else
 					{
 						// 135x
-						if( val > tmp( i - 1, j - 1 ) && val > tmp( i + 1, j + 1 ) )
+						is_max = val > mp[ i - 1 ] && val > mn[ i + 1 ];
+					}
+
+					if( is_max )
+					{
+						if( val > upper_ )
+						{
+							pm[ i ] = 2;
+							strong_.push_back( j * w + i );
+						}
+						else
 						{
-							if( val > upper )
-							{
-								mask( i, j ) = 2;
-							}
-							else
-							{
-								mask( i, j ) = 1;
-							}
+							pm[ i ] = 1;
 						}
 					}
 				}
 			}
-		}
-	}
-
-	typedef vector2< size_type > vector_type;
-	typedef std::list< vector_type > point_list_type;
-	point_list_type point_list;
 
-	for( size_type j = 1 ; j < tmp.height( ) - 1 ; j++ )
-	{
-		for( size_type i = 1 ; i < tmp.width( ) - 1 ; i++ )
-		{
-			if( mask( i, j ) == 1 )
-			{
-				if( mask( i - 1, j - 1 ) == 2 || mask( i, j - 1 ) == 2 || mask( i + 1, j - 1 ) == 2 || 
-					mask( i - 1, j     ) == 2                          || mask( i + 1, j     ) == 2 || 
-					mask( i - 1, j + 1 ) == 2 || mask( i, j + 1 ) == 2 || mask( i + 1, j + 1 ) == 2 )
-				{
-					mask( i, j ) = 2;
-					point_list.push_back( vector_type( i, j ) );
-				}
-			}
+			return( 0 );
 		}
-	}
+	};
 
-	while( !point_list.empty( ) )
+	// GbWfN_ƂāC8ߖTŘAアGbWfǐՂ
+	template < class Array >
+	bool canny( const Array &in, array2< unsigned char > &mask, double lower, double upper, bool useL2gradient, typename Array::size_type thread_num )
 	{
-		vector_type v = point_list.front( );
-		point_list.pop_front( );
-		size_type i = v.x;
-		size_type j = v.y;
+		typedef typename Array::size_type       size_type;
+		typedef typename Array::difference_type difference_type;
+		typedef canny_thread< Array > canny_thread_type;
 
-		if( mask( i - 1, j - 1 ) == 1 )
-		{
-			mask( i - 1, j - 1 ) = 2;
-			point_list.push_back( vector_type( i - 1, j - 1 ) );
-		}
-		if( mask( i, j - 1 ) == 1 )
+		mask.resize( in.width( ), in.height( ) );
+		mask.fill( );
+
+		if( in.width( ) < 3 || in.height( ) < 3 )
 		{
-			mask( i, j - 1 ) = 2;
-			point_list.push_back( vector_type( i, j - 1 ) );
+			return( true );
 		}
-		if( mask( i + 1, j - 1 ) == 1 )
+
+		size_type rows = in.height( ) - 2;
+		if( thread_num > rows )
 		{
-			mask( i + 1, j - 1 ) = 2;
-			point_list.push_back( vector_type( i + 1, j - 1 ) );
+			thread_num = rows;
 		}
-		if( mask( i - 1, j ) == 1 )
+
+		canny_thread_type *thread = new canny_thread_type[ thread_num ];
+
+		for( size_type i = 0 ; i < thread_num ; i++ )
 		{
-			mask( i - 1, j ) = 2;
-			point_list.push_back( vector_type( i - 1, j ) );
+			thread[ i ].setup_parameters( in, mask, 1 + rows * i / thread_num, 1 + rows * ( i + 1 ) / thread_num, lower, upper, useL2gradient );
 		}
-		if( mask( i + 1, j ) == 1 )
+
+		// XbhsāCI܂őҋ@
+		do_threads_( thread, thread_num );
+
+		std::vector< size_type > stack;
+		for( size_type i = 0 ; i < thread_num ; i++ )
 		{
-			mask( i + 1, j ) = 2;
-			point_list.push_back( vector_type( i + 1, j ) );
+			const std::vector< size_type > &strong = thread[ i ].strong_edges( );
+			stack.insert( stack.end( ), strong.begin( ), strong.end( ) );
 		}
-		if( mask( i - 1, j + 1 ) == 1 )
+
+		delete [] thread;
+
+		// GbWf͉摜͈̉͂ɂ݂Ȃ߁CߖT͈̔̓`FbN͕sv
+		difference_type w = mask.width( );
+		const difference_type offset[ 8 ] = { -w - 1, -w, -w + 1, -1, 1, w - 1, w, w + 1 };
+		unsigned char *pm = &mask[ 0 ];
+
+		while( !stack.empty( ) )
 		{
-			mask( i - 1, j + 1 ) = 2;
-			point_list.push_back( vector_type( i - 1, j + 1 ) );
+			size_type indx = stack.back( );
+			stack.pop_back( );
+
+			for( size_type n = 0 ; n < 8 ; n++ )
+			{
+				size_type nindx = indx + offset[ n ];
+				if( pm[ nindx ] == 1 )
+				{
+					pm[ nindx ] = 2;
+					stack.push_back( nindx );
+				}
+			}
 		}
-		if( mask( i, j + 1 ) == 1 )
+
+		return( true );
+	}
+
+	template < bool b >
+	struct __canny_dispatch__
+	{
+		// Zp^̉摜͂̂܂܏
+		template < class T, class Allocator >
+		static bool canny( const array2< T, Allocator > &in, array2< unsigned char > &mask, double lower, double upper, bool useL2gradient, typename array2< T, Allocator >::size_type thread_num )
 		{
-			mask( i, j + 1 ) = 2;
-			point_list.push_back( vector_type( i, j + 1 ) );
+			return( __canny__::canny( in, mask, lower, upper, useL2gradient, thread_num ) );
 		}
-		if( mask( i + 1, j + 1 ) == 1 )
+	};
+
+	template < >
+	struct __canny_dispatch__< false >
+	{
+		// J[摜Ȃǂ͔ZW摜ɕϊĂ珈
+		template < class T, class Allocator >
+		static bool canny( const array2< T, Allocator > &in, array2< unsigned char > &mask, double lower, double upper, bool useL2gradient, typename array2< T, Allocator >::size_type thread_num )
 		{
-			mask( i + 1, j + 1 ) = 2;
-			point_list.push_back( vector_type( i + 1, j + 1 ) );
+			array2< double > tmp;
+			convert( in, tmp );
+			return( __canny__::canny( tmp, mask, lower, upper, useL2gradient, thread_num ) );
 		}
+	};
+}
+
+
+/// @brief CannỹGbWotB^
+//! 
+//! SobeltB^ɂžvZCzx̌vZCɑl}𐔍s̃obt@p1̑ōsC
+//! GbWfN_ƂqXeVXlŃGbWǐՂD
+//! 8rbgE16rbg̐摜ł͌z𐮐ZŌvZD
+//! 
+//! @attention ͂Əo͂́CIuWFNgł삷
+//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in]  in            c ͉摜
+//! @param[out] out           c o͉摜
+//! @param[in]  lower         c qXeVXl̉
+//! @param[in]  upper         c qXeVXl̏
+//! @param[in]  useL2gradient c L2̃OfBGgvZ邩ǂiftHgfalsej
+//! @param[in]  fgval         c GbWfiOijɑliftHg255j
+//! @param[in]  bgval         c wifɑliftHg0j
+//! @param[in]  thread_num    c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+inline bool canny( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, double lower, double upper, bool useL2gradient = false, const typename array2< T2, Allocator2 >::value_type &fgval = typename array2< T2, Allocator2 >::value_type( 255 ), const typename array2< T2, Allocator2 >::value_type &bgval = typename array2< T2, Allocator2 >::value_type( 0 ), typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+{
+	typedef typename array2< T1, Allocator1 >::size_type       size_type;
+	if( in.empty( ) )
+	{
+		return( false );
 	}
 
-	out.resize( in.width( ), in.height( ) );
-	out.reso( in.reso1( ), in.reso2( ) );
+	// lւĂꍇւ̑Ώ
+	if( lower > upper )
+	{
+		double ttt = lower;
+		lower = upper;
+		upper = ttt;
+	}
 
-#ifdef _OPENMP
-	#pragma omp parallel for
-#endif
-	for( int i = 0 ; i < static_cast< int >( out.size( ) ) ; i++ )
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
+	typedef array2< unsigned char > mask_type;
+
+	mask_type mask;
+
+	__canny__::__canny_dispatch__< is_arithmetic< T1 >::value && !is_color< T1 >::value >::canny( in, mask, lower, upper, useL2gradient, thread_num );
+
+	double r1 = in.reso1( );
+	double r2 = in.reso2( );
+
+	out.resize( mask.width( ), mask.height( ) );
+	out.reso( r1, r2 );
+
+	for( size_type i = 0 ; i < out.size( ) ; i++ )
 	{
 		out[ i ] = mask[ i ] == 2 ? fgval : bgval;
 	}
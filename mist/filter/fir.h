@@ -43,13 +43,277 @@
 #include "../config/type_trait.h"
 #endif
 
+#ifndef __INCLUDE_FFT_H__
+#include "../fft/fft.h"
+#endif
+
 #include <cmath>
 #include <functional>
+#include <vector>
 
 // mistOԂ̎n܂
 _MIST_BEGIN
 
 
+//! @addtogroup fir_group FIRtB^
+//!
+//! @code ̃wb_CN[h
+//! #include <mist/filter/fir.h>
+//! @endcode
+//!
+//!  @{
+
+
+/// @brief ͂𕡐ɕė^邱Ƃ̂łFIRtB^
+//!
+//! W h[ k ] ɑ΂ y[ n ] =  h[ k ] x[ n - k ] vZD
+//! ÕubN̖̓͂ԂƂĕێ邽߁CMCӂ̒̃ubNɕ filter JԂĂяoƂŁC
+//! MŜxɏꍇƓʂD
+//! ^bvȂꍇ͏o͂̃ubNɑ΂ϘaZŒڌvZC^bvꍇFFTp Overlap-Save @ŌvZD
+//!
+//! @code gp
+//! mist::fir_filter f( coef );
+//! while( ... )
+//! {
+//!     f.filter( in, out );   // in ǂݍ݂Ȃ珈
+//! }
+//! @endcode
+//!
+class fir_filter
+{
+public:
+	typedef size_t size_type;			///< @brief Ȃ̐\^DRei̗vfCevfw肷ƂȂǂɗpCIɂ size_t ^Ɠ
+	typedef ptrdiff_t difference_type;	///< @brief t̐\^DRei̗vfCevfw肷ƂȂǂɗpCIɂ ptrdiff_t ^Ɠ
+
+	/// @brief ̃^bv葽ꍇ Overlap-Save @p
+	_MIST_CONST( size_type, direct_max_taps, 32 );
+
+private:
+	std::vector< double > coef_;		// ԕɔ]tB^W
+	std::vector< double > history_;		// O̓́i^bv - 1 j
+	std::vector< double > work_;		// ڌvZp̍Ɨ̈
+	std::vector< double > output_;		// ڌvZp̏o͂̍Ɨ̈
+
+	size_type fft_size_;				// Overlap-Save @ŗpFFT̓_i0̏ꍇ͒ڌvZj
+	std::vector< double > spectrum_;	// tB^W̃XyNgiooura_fft::rdft ̌`j
+	std::vector< double > fft_data_;
+	std::vector< double > fft_w_;
+	std::vector< int > fft_ip_;
+
+public:
+	/// @brief ̃tB^쐬iW set_coefficients Őݒ肷j
+	fir_filter( ) : fft_size_( 0 )
+	{
+	}
+
+	/// @brief tB^W coef tB^쐬
+	//!
+	//! @param[in] coef   c tB^W
+	//! @param[in] use_fft c ^bv direct_max_taps 葽ꍇFFTp邩ǂ
+	//!
+	template < class T, class Allocator >
+	fir_filter( const array< T, Allocator > &coef, bool use_fft = true ) : fft_size_( 0 )
+	{
+		set_coefficients( coef, use_fft );
+	}
+
+	/// @brief tB^Wݒ肵CԂ
+	//!
+	//! @param[in] coef   c tB^W
+	//! @param[in] use_fft c ^bv direct_max_taps 葽ꍇFFTp邩ǂ
+	//!
+	template < class T, class Allocator >
+	void set_coefficients( const array< T, Allocator > &coef, bool use_fft = true )
+	{
+		size_type taps = coef.size( );
+
+		coef_.resize( taps );
+		for( size_type k = 0 ; k < taps ; k++ )
+		{
+			coef_[ taps - 1 - k ] = static_cast< double >( coef[ k ] );
+		}
+
+		fft_size_ = 0;
+		spectrum_.clear( );
+		fft_data_.clear( );
+		fft_w_.clear( );
+		fft_ip_.clear( );
+
+		if( use_fft && taps > direct_max_taps )
+		{
+			// 1ubNŏȂƂ^bvx̏o͂悤ɁC^bv4{ȏ2ׂ̂Ƃ
+			fft_size_ = 1;
+			while( fft_size_ < taps * 4 )
+			{
+				fft_size_ <<= 1;
+			}
+
+			spectrum_.resize( fft_size_, 0.0 );
+			fft_data_.resize( fft_size_ );
+			fft_w_.resize( fft_size_ / 2 );
+			fft_ip_.resize( static_cast< size_type >( std::sqrt( static_cast< double >( fft_size_ / 2 ) ) ) + 3 );
+			fft_ip_[ 0 ] = 0;
+
+			for( size_type k = 0 ; k < taps ; k++ )
+			{
+				spectrum_[ k ] = static_cast< double >( coef[ k ] );
+			}
+
+			ooura_fft::rdft( static_cast< int >( fft_size_ ), 1, &spectrum_[ 0 ], &fft_ip_[ 0 ], &fft_w_[ 0 ] );
+
+			// tϊ̐KW炩ߊ|Ă
+			double scale = 2.0 / static_cast< double >( fft_size_ );
+			for( size_type k = 0 ; k < fft_size_ ; k++ )
+			{
+				spectrum_[ k ] *= scale;
+			}
+		}
+
+		reset( );
+	}
+
+	/// @brief ԁiߋ̓́j0ɖ߂
+	void reset( )
+	{
+		history_.assign( taps( ) > 0 ? taps( ) - 1 : 0, 0.0 );
+	}
+
+	/// @brief tB^̃^bv
+	size_type taps( ) const { return( coef_.size( ) ); }
+
+	/// @brief Overlap-Save @pĂ邩ǂ
+	bool use_fft( ) const { return( fft_size_ != 0 ); }
+
+	/// @brief ͐M̑ɃtB^Kp
+	//!
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//!
+	//! @param[in]  in  c ͐MiǑĂяoŗ^M̑j
+	//! @param[out] out c o͐M
+	//!
+	template < class T1, class Allocator1, class T2, class Allocator2 >
+	void filter( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
+	{
+		size_type num = in.size( );
+
+		if( taps( ) == 0 )
+		{
+			out.resize( num );
+			out.fill( );
+			return;
+		}
+
+		// ͂ߋ̓͂̌ɘA
+		size_type hnum = history_.size( );
+		work_.resize( hnum + num );
+		std::copy( history_.begin( ), history_.end( ), work_.begin( ) );
+		for( size_type i = 0 ; i < num ; i++ )
+		{
+			work_[ hnum + i ] = static_cast< double >( in[ i ] );
+		}
+
+		output_.resize( num );
+		if( num > 0 )
+		{
+			if( use_fft( ) )
+			{
+				overlap_save( &work_[ 0 ], &output_[ 0 ], num );
+			}
+			else
+			{
+				direct( &work_[ 0 ], &output_[ 0 ], num );
+			}
+		}
+
+		// ̓͂̂߂ɕۑ
+		std::copy( work_.begin( ) + num, work_.end( ), history_.begin( ) );
+
+		out.resize( num );
+		for( size_type i = 0 ; i < num ; i++ )
+		{
+			out[ i ] = static_cast< T2 >( output_[ i ] );
+		}
+	}
+
+private:
+	// x[ 0 ... num + taps - 2 ]  num ̏o͂𒼐ڌvZ
+	// o͂̃ubNƂɌW̃[vOɂ邱ƂŁC̃[vAɑ΂ϘaZƂȂxNg₷Ȃ
+	void direct( const double *x, double *y, size_type num ) const
+	{
+		const size_type block = 1024;
+		const size_type taps = coef_.size( );
+		const double *h = &coef_[ 0 ];
+
+		for( size_type n0 = 0 ; n0 < num ; n0 += block )
+		{
+			size_type len = num - n0 < block ? num - n0 : block;
+			double *yy = y + n0;
+			const double *xx = x + n0;
+
+			for( size_type i = 0 ; i < len ; i++ )
+			{
+				yy[ i ] = 0.0;
+			}
+
+			for( size_type k = 0 ; k < taps ; k++ )
+			{
+				const double c = h[ k ];
+				const double *xk = xx + k;
+				for( size_type i = 0 ; i < len ; i++ )
+				{
+					yy[ i ] += c * xk[ i ];
+				}
+			}
+		}
+	}
+
+	// x[ 0 ... num + taps - 2 ]  num ̏o͂ Overlap-Save @ŌvZ
+	void overlap_save( const double *x, double *y, size_type num )
+	{
+		const size_type taps = coef_.size( );
+		const size_type step = fft_size_ - taps + 1;
+		double *a = &fft_data_[ 0 ];
+		const double *H = &spectrum_[ 0 ];
+
+		for( size_type n0 = 0 ; n0 < num ; n0 += step )
+		{
+			size_type len = num - n0 < step ? num - n0 : step;
+			size_type valid = len + taps - 1;
+
+			for( size_type i = 0 ; i < valid ; i++ )
+			{
+				a[ i ] = x[ n0 + i ];
+			}
+			for( size_type i = valid ; i < fft_size_ ; i++ )
+			{
+				a[ i ] = 0.0;
+			}
+
+			ooura_fft::rdft( static_cast< int >( fft_size_ ), 1, a, &fft_ip_[ 0 ], &fft_w_[ 0 ] );
+
+			// rdft ̌`Ŋi[ꂽXyNgm̐ρia[ 0 ]Ca[ 1 ] ͒ƃiCLXgg̎lj
+			a[ 0 ] *= H[ 0 ];
+			a[ 1 ] *= H[ 1 ];
+			for( size_type k = 2 ; k < fft_size_ ; k += 2 )
+			{
+				double re = a[ k ] * H[ k ] - a[ k + 1 ] * H[ k + 1 ];
+				double im = a[ k ] * H[ k + 1 ] + a[ k + 1 ] * H[ k ];
+				a[ k ]     = re;
+				a[ k + 1 ] = im;
+			}
+
+			ooura_fft::rdft( static_cast< int >( fft_size_ ), -1, a, &fft_ip_[ 0 ], &fft_w_[ 0 ] );
+
+			// zݍ݂̉e󂯂Ȃ taps - 1 Ԗڈȍ~o͂ƂȂ
+			for( size_type i = 0 ; i < len ; i++ )
+			{
+				y[ n0 + i ] = a[ taps - 1 + i ];
+			}
+		}
+	}
+};
+
+
 namespace __fir_filter__
 {
 
@@ -58,28 +322,45 @@ namespace __fir_filter__
 		const array<T, Allocator>& in,
 		array<T, Allocator>& out,
 		int order,
-		const array<T, Allocator>& coef,
+		const array<T, Allocator>& coef)
 	{
-		array<double> buf(order, 0.0);
-
-		out.resize(in.size());
+		array<double> c(order);
 
-		double output;
-		for(int n = 0; n < in.size(); n ++)
+		for(int k = 0; k < order; k ++)
 		{
-			for(int k = 0; k < order - 1; k ++)
-			{
-				buf[k] = coef[k] * in[n] + buf[k + 1];
-			}
-			buf[order - 1] = coef[order - 1] * in[n];
-
-			out[n] = buf[0];
+			c[k] = static_cast<double>(coef[k]);
 		}
+
+		fir_filter f(c);
+		f.filter(in, out);
 	}
 
 }
 
 
+/// @brief FIRtB^Kp
+//!
+//! W h[ k ] ɑ΂ out[ n ] =  h[ k ] in[ n - k ] vZiin[ n ]  n < 0 0ƂjD
+//! ^bv fir_filter::direct_max_taps 葽ꍇFFTp Overlap-Save @ŌvZD
+//!
+//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+//!
+//! @param[in]  in   c ͐M
+//! @param[out] out  c o͐M
+//! @param[in]  coef c tB^W
+//!
+template < class T1, class Allocator1, class T2, class Allocator2, class T3, class Allocator3 >
+void fir( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out, const array< T3, Allocator3 > &coef )
+{
+	fir_filter f( coef );
+	f.filter( in, out );
+}
+
+
+/// @}
+//  FIRtB^O[v̏I
+
+
 // mistOԂ̏I
 _MIST_END
 
@@ -35,7 +35,11 @@
 #define __INCLUDE_MIST_HOUGH__
 
 #ifndef __INCLUDE_MIST_H__
-#include "mist.h"
+#include "../mist.h"
+#endif
+
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
 #endif
 
 #include <complex>
@@ -86,6 +90,33 @@ namespace __hough_detail__
 		}
 	};
 
+	// [Ԃ̋ɑ_
+	struct hough_peak
+	{
+		size_t count;
+		size_t rho;
+		size_t angle;
+
+		hough_peak( size_t c, size_t r, size_t a ) : count( c ), rho( r ), angle( a ){ }
+
+		// [̑ɕׁC̏ꍇ͒ő鏇ԁiρCƂ̏jƂ
+		bool operator <( const hough_peak &p ) const
+		{
+			if( count != p.count )
+			{
+				return( count > p.count );
+			}
+			else if( rho != p.rho )
+			{
+				return( rho < p.rho );
+			}
+			else
+			{
+				return( angle < p.angle );
+			}
+		}
+	};
+
 	class accumulator
 	{
 	public:
@@ -110,15 +141,22 @@ namespace __hough_detail__
 			this->operator ()( static_cast< difference_type >( rho + ( get_rho_size( ) - 1 ) / 2 ), angle ) ++;
 		}
 
-		void convert_to_counter( hough_counter &c, size_type threshold ) const
+		// ρCƂ̃CfbNXŎw肵Zɓ[
+		void count_up_cell( size_type rho, size_type angle )
+		{
+			this->operator ()( rho, angle ) ++;
+		}
+
+		// [l傫ɑ_C[̑ȉꍇ̓ρCƂ̏jɎo
+		// max_count 0ȊȌꍇ́C max_count ݂̂o
+		void convert_to_counter( hough_counter &c, size_type threshold, size_type max_count = 0, size_type thread_num = 1 ) const;
+
+		// ς͈̔ [ rho_begin, rho_end ) ɂɑ_o
+		void collect_peaks( std::vector< hough_peak > &peaks, size_type rho_begin, size_type rho_end, size_type threshold ) const
 		{
-			int rho_size = static_cast< int >( get_rho_size( ) );
 			size_type angle_size = get_angle_size( );
 
-#ifdef _OPENMP
-			#pragma omp parallel for schedule( guided )
-#endif
-			for( int rho = 0 ; rho < rho_size ; ++rho )
+			for( size_type rho = rho_begin ; rho < rho_end ; ++rho )
 			{
 				for( size_type angle = 0 ; angle < angle_size ; ++angle )
 				{
@@ -126,17 +164,28 @@ namespace __hough_detail__
 
 					if( ( count > threshold ) && is_peak_cell( rho, angle ) )
 					{
-#ifdef _OPENMP
-						#pragma omp critical
-#endif
-						{
-							c.insert( std::make_pair( count, std::complex< int >( rho - ( rho_size - 1 ) / 2, angle ) ) );
-						}
+						peaks.push_back( hough_peak( count, rho, angle ) );
 					}
 				}
 			}
 		}
 
+		size_type get_rho_size( ) const
+		{
+			return( data_.size2( ) - 2 );
+		}
+
+		size_type get_angle_size( ) const
+		{
+			return( data_.size1( ) - 2 );
+		}
+
+		// [擾iρCƂ͂ƂɃCfbNXj
+		size_type count( size_type rho, size_type angle ) const
+		{
+			return( at( rho, angle ) );
+		}
+
 	private:
 		size_type & operator ()( size_type rho, size_type angle )
 		{
@@ -158,16 +207,6 @@ namespace __hough_detail__
 			return( this->operator ()( rho, angle ) );
 		}
 
-		size_type get_rho_size( ) const
-		{
-			return( data_.size2( ) - 2 );
-		}
-
-		size_type get_angle_size( ) const
-		{
-			return( data_.size1( ) - 2 );
-		}
-
 		bool is_peak_cell( size_type rho, size_type angle ) const
 		{
 			size_type level = at( rho, angle );
@@ -179,42 +218,877 @@ namespace __hough_detail__
 		}
 	};
 
+	// [fiangle ͌zɑΉƂ̃CfbNXŁC̏ꍇ͑SẴƂɓ[j
+	struct hough_point
+	{
+		typedef ptrdiff_t difference_type;
+
+		difference_type x;
+		difference_type y;
+		difference_type angle;
+
+		hough_point( difference_type xx, difference_type yy, difference_type a = -1 ) : x( xx ), y( yy ), angle( a ){ }
+	};
+
+	// Ƃ͈̔͂Ƃɓ[𕪒SXbh
+	// eXbh͓[Ԃ̈قȂZɂ̂ݏނ߁Cr͕sv
+	// points ̐擪 all_num ͑SẴƂɓ[Cc͌z̃ƂƂ offset[  ]  offset[  + 1 ] ͈̔͂ɕׂĂ
+	class hough_vote_thread : public mist::thread< hough_vote_thread >
+	{
+	public:
+		typedef mist::thread< hough_vote_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+	private:
+		const std::vector< hough_point > *points_;
+		const trigonometric_table *table_;
+		accumulator *accumulator_;
+		size_type all_num_;
+		const size_type *offset_;
+		size_type angle_begin_;
+		size_type angle_end_;
+		difference_type angle_range_;
+
+	public:
+		void setup_parameters( const std::vector< hough_point > &points, size_type all_num, const size_type *offset, const trigonometric_table &table, accumulator &acc, size_type angle_begin, size_type angle_end, difference_type angle_range )
+		{
+			points_      = &points;
+			all_num_     = all_num;
+			offset_      = offset;
+			table_       = &table;
+			accumulator_ = &acc;
+			angle_begin_ = angle_begin;
+			angle_end_   = angle_end;
+			angle_range_ = angle_range;
+		}
+
+		const hough_vote_thread& operator =( const hough_vote_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				points_ = p.points_;
+				all_num_ = p.all_num_;
+				offset_ = p.offset_;
+				table_ = p.table_;
+				accumulator_ = p.accumulator_;
+				angle_begin_ = p.angle_begin_;
+				angle_end_ = p.angle_end_;
+				angle_range_ = p.angle_range_;
+			}
+			return( *this );
+		}
+
+		hough_vote_thread( ) : points_( NULL ), table_( NULL ), accumulator_( NULL ), all_num_( 0 ), offset_( NULL ), angle_begin_( 0 ), angle_end_( 0 ), angle_range_( -1 )
+		{
+		}
+
+		hough_vote_thread( const hough_vote_thread &p ) : base( p ), points_( p.points_ ), table_( p.table_ ), accumulator_( p.accumulator_ ), all_num_( p.all_num_ ), offset_( p.offset_ ),
+															angle_begin_( p.angle_begin_ ), angle_end_( p.angle_end_ ), angle_range_( p.angle_range_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const std::vector< hough_point > &points = *points_;
+			const trigonometric_table &table = *table_;
+			accumulator &acc = *accumulator_;
+			difference_type angle_size = table.size( );
+
+			for( size_type angle = angle_begin_ ; angle < angle_end_ ; ++angle )
+			{
+				double c = table.cos( angle );
+				double s = table.sin( angle );
+
+				for( size_type n = 0 ; n < all_num_ ; n++ )
+				{
+					const hough_point &p = points[ n ];
+					acc.count_up( static_cast< difference_type >( p.x * c + p.y * s + 0.5 ), angle );
+				}
+
+				if( offset_ == NULL )
+				{
+					continue;
+				}
+
+				// z }angle_range ͈̔͂ɂf݂̂𒲂ׂiƂ͎΂ŏ񂷂j
+				for( difference_type a = static_cast< difference_type >( angle ) - angle_range_ ; a <= static_cast< difference_type >( angle ) + angle_range_ ; a++ )
+				{
+					size_type aa = static_cast< size_type >( ( a + angle_size ) % angle_size );
+					for( size_type n = offset_[ aa ] ; n < offset_[ aa + 1 ] ; n++ )
+					{
+						const hough_point &p = points[ n ];
+						acc.count_up( static_cast< difference_type >( p.x * c + p.y * s + 0.5 ), angle );
+					}
+				}
+			}
+
+			return( 0 );
+		}
+	};
+
+	// ς͈̔͂Ƃɋɑ_TCʂ݂̌̂cXbh
+	class hough_peak_thread : public mist::thread< hough_peak_thread >
+	{
+	public:
+		typedef mist::thread< hough_peak_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+
+	private:
+		const accumulator *accumulator_;
+		size_type rho_begin_;
+		size_type rho_end_;
+		size_type threshold_;
+		size_type max_count_;
+		std::vector< hough_peak > peaks_;
+
+	public:
+		void setup_parameters( const accumulator &acc, size_type rho_begin, size_type rho_end, size_type threshold, size_type max_count )
+		{
+			accumulator_ = &acc;
+			rho_begin_   = rho_begin;
+			rho_end_     = rho_end;
+			threshold_   = threshold;
+			max_count_   = max_count;
+			peaks_.clear( );
+		}
+
+		const std::vector< hough_peak > &peaks( ) const { return( peaks_ ); }
+
+		const hough_peak_thread& operator =( const hough_peak_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				accumulator_ = p.accumulator_;
+				rho_begin_ = p.rho_begin_;
+				rho_end_ = p.rho_end_;
+				threshold_ = p.threshold_;
+				max_count_ = p.max_count_;
+				peaks_ = p.peaks_;
+			}
+			return( *this );
+		}
+
+		hough_peak_thread( ) : accumulator_( NULL ), rho_begin_( 0 ), rho_end_( 0 ), threshold_( 0 ), max_count_( 0 )
+		{
+		}
+
+		hough_peak_thread( const hough_peak_thread &p ) : base( p ), accumulator_( p.accumulator_ ), rho_begin_( p.rho_begin_ ), rho_end_( p.rho_end_ ),
+															threshold_( p.threshold_ ), max_count_( p.max_count_ ), peaks_( p.peaks_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			accumulator_->collect_peaks( peaks_, rho_begin_, rho_end_, threshold_ );
+
+			if( max_count_ > 0 && peaks_.size( ) > max_count_ )
+			{
+				std::partial_sort( peaks_.begin( ), peaks_.begin( ) + max_count_, peaks_.end( ) );
+				peaks_.erase( peaks_.begin( ) + max_count_, peaks_.end( ) );
+			}
+
+			return( 0 );
+		}
+	};
+
+	// [Ԃς͈̔͂ƂɃXbhŕSċɑ_TC[̑ɕׂ
+	inline void find_peaks( const accumulator &acc, std::vector< hough_peak > &peaks, size_t threshold, size_t max_count, size_t thread_num )
+	{
+		typedef size_t size_type;
+
+		size_type rho_size = acc.get_rho_size( );
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+		if( thread_num > rho_size )
+		{
+			thread_num = rho_size > 0 ? rho_size : 1;
+		}
+
+		hough_peak_thread *thread = new hough_peak_thread[ thread_num ];
+
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_parameters( acc, rho_size * i / thread_num, rho_size * ( i + 1 ) / thread_num, threshold, max_count );
+		}
+
+		// XbhsāCI܂őҋ@
+		do_threads_( thread, thread_num );
+
+		// eXbh̏ʌ𓝍
+		peaks.clear( );
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			peaks.insert( peaks.end( ), thread[ i ].peaks( ).begin( ), thread[ i ].peaks( ).end( ) );
+		}
+
+		delete [] thread;
+
+		std::sort( peaks.begin( ), peaks.end( ) );
+
+		if( max_count > 0 && peaks.size( ) > max_count )
+		{
+			peaks.erase( peaks.begin( ) + max_count, peaks.end( ) );
+		}
+	}
+
+	inline void accumulator::convert_to_counter( hough_counter &c, size_type threshold, size_type max_count, size_type thread_num ) const
+	{
+		std::vector< hough_peak > peaks;
+		find_peaks( *this, peaks, threshold, max_count, thread_num );
+
+		int offset = static_cast< int >( ( get_rho_size( ) - 1 ) / 2 );
+		for( size_type i = 0 ; i < peaks.size( ) ; i++ )
+		{
+			c.insert( c.end( ), std::make_pair( peaks[ i ].count, std::complex< int >( static_cast< int >( peaks[ i ].rho ) - offset, static_cast< int >( peaks[ i ].angle ) ) ) );
+		}
+	}
+
 	template < class T, class Allocator, class FUNCTOR >
-	accumulator hough_transform( const array2< T, Allocator >& input, double rho_resolution, const trigonometric_table & table, FUNCTOR f )
+	void collect_points( const array2< T, Allocator > &input, std::vector< hough_point > &points, FUNCTOR f )
+	{
+		typedef typename array2< T, Allocator >::size_type size_type;
+
+		points.clear( );
+
+		for( size_type j = 0 ; j < input.height( ) ; j++ )
+		{
+			for( size_type i = 0 ; i < input.width( ) ; i++ )
+			{
+				if( f( input( i, j ) ) )
+				{
+					points.push_back( hough_point( i, j ) );
+				}
+			}
+		}
+	}
+
+	// f ( x, y ) ɂSobeltB^̌z߂
+	// 摜̊O͍ł߂f̒lŕ₤
+	template < class T, class Allocator >
+	void sobel_gradient( const array2< T, Allocator > &image, ptrdiff_t x, ptrdiff_t y, double &gx, double &gy )
+	{
+		typedef ptrdiff_t difference_type;
+
+		difference_type w = image.width( );
+		difference_type h = image.height( );
+
+		double v[ 3 ][ 3 ];
+		for( difference_type m = 0 ; m < 3 ; m++ )
+		{
+			difference_type yy = y + m - 1;
+			yy = yy < 0 ? 0 : ( yy >= h ? h - 1 : yy );
+			for( difference_type l = 0 ; l < 3 ; l++ )
+			{
+				difference_type xx = x + l - 1;
+				xx = xx < 0 ? 0 : ( xx >= w ? w - 1 : xx );
+				v[ m ][ l ] = static_cast< double >( image( xx, yy ) );
+			}
+		}
+
+		gx = ( v[ 0 ][ 2 ] - v[ 0 ][ 0 ] ) + 2.0 * ( v[ 1 ][ 2 ] - v[ 1 ][ 0 ] ) + ( v[ 2 ][ 2 ] - v[ 2 ][ 0 ] );
+		gy = ( v[ 2 ][ 0 ] + 2.0 * v[ 2 ][ 1 ] + v[ 2 ][ 2 ] ) - ( v[ 0 ][ 0 ] + 2.0 * v[ 0 ][ 1 ] + v[ 0 ][ 2 ] );
+	}
+
+	// efSobeltB^ɂz߁CΉƂ̃CfbNXݒ肷
+	template < class T, class Allocator >
+	void set_gradient_angle( const array2< T, Allocator > &image, std::vector< hough_point > &points, double theta_resolution, size_t angle_size )
+	{
+		typedef ptrdiff_t difference_type;
+
+		const double pi = 3.1415926535897932384626433832795;
+
+		for( size_t n = 0 ; n < points.size( ) ; n++ )
+		{
+			hough_point &p = points[ n ];
+
+			double gx, gy;
+			sobel_gradient( image, p.x, p.y, gx, gy );
+
+			if( gx == 0.0 && gy == 0.0 )
+			{
+				// z܂Ȃf͑SẴƂɓ[
+				p.angle = -1;
+			}
+			else
+			{
+				double theta = std::atan2( gy, gx );
+				if( theta < 0.0 )
+				{
+					theta += pi;
+				}
+
+				difference_type angle = static_cast< difference_type >( theta / theta_resolution + 0.5 );
+				p.angle = angle % static_cast< difference_type >( angle_size );
+			}
+		}
+	}
+
+	// Ƃ͈̔͂XbhŕSē[iangle_range ̏ꍇ͑SẴƂɓ[j
+	inline void vote( const std::vector< hough_point > &points, const trigonometric_table &table, accumulator &acc, ptrdiff_t angle_range, size_t thread_num )
+	{
+		typedef size_t size_type;
+
+		size_type angle_size = table.size( );
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+		if( thread_num > angle_size )
+		{
+			thread_num = angle_size > 0 ? angle_size : 1;
+		}
+		if( angle_range >= 0 && static_cast< size_type >( 2 * angle_range + 1 ) >= angle_size )
+		{
+			angle_range = -1;
+		}
+
+		// zfƂƂɕבւCefǧz̋ߖT̃Ƃ݂̂𒲂ׂ悤ɂ
+		std::vector< hough_point > sorted;
+		std::vector< size_type > offset;
+		size_type all_num = points.size( );
+
+		if( angle_range >= 0 )
+		{
+			offset.resize( angle_size + 2, 0 );
+			for( size_type n = 0 ; n < points.size( ) ; n++ )
+			{
+				offset[ points[ n ].angle < 0 ? 0 : points[ n ].angle + 2 ]++;
+			}
+
+			all_num = offset[ 0 ];
+			offset[ 0 ] = 0;
+			offset[ 1 ] = all_num;
+			for( size_type a = 2 ; a < offset.size( ) ; a++ )
+			{
+				offset[ a ] += offset[ a - 1 ];
+			}
+
+			sorted.resize( points.size( ), hough_point( 0, 0 ) );
+			for( size_type n = 0 ; n < points.size( ) ; n++ )
+			{
+				sorted[ offset[ points[ n ].angle < 0 ? 0 : points[ n ].angle + 1 ]++ ] = points[ n ];
+			}
+		}
+
+		hough_vote_thread *thread = new hough_vote_thread[ thread_num ];
+
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			if( angle_range >= 0 )
+			{
+				thread[ i ].setup_parameters( sorted, all_num, &offset[ 0 ], table, acc, angle_size * i / thread_num, angle_size * ( i + 1 ) / thread_num, angle_range );
+			}
+			else
+			{
+				thread[ i ].setup_parameters( points, all_num, NULL, table, acc, angle_size * i / thread_num, angle_size * ( i + 1 ) / thread_num, angle_range );
+			}
+		}
+
+		// XbhsāCI܂őҋ@
+		do_threads_( thread, thread_num );
+
+		delete [] thread;
+	}
+
+	template < class T, class Allocator, class FUNCTOR >
+	accumulator hough_transform( const array2< T, Allocator >& input, double rho_resolution, const trigonometric_table & table, FUNCTOR f, size_t thread_num = 0 )
 	{
 		typedef typename array2< T, Allocator >::size_type       size_type;
-		typedef typename array2< T, Allocator >::difference_type difference_type;
-		typedef typename array2< T, Allocator >::value_type      value_type;
 
 		const size_type angle_size = table.size( );
 		const size_type rho_size   = static_cast< size_type >( ( ( input.width( ) + input.height( ) ) * 2 + 1 ) / rho_resolution );
 
 		accumulator accumulator( rho_size, angle_size );
 
-		int height = static_cast< int >( input.height( ) );
+		std::vector< hough_point > points;
+		collect_points( input, points, f );
+		vote( points, table, accumulator, -1, thread_num );
 
-#ifdef _OPENMP
-		#pragma omp parallel for schedule( guided )
-#endif
-		for( int j = 0 ; j < height ; j++ )
+		return( accumulator );
+	}
+
+	// ~oœ[fidxCdy ͌z̒PʃxNgj
+	struct circle_point
+	{
+		double x;
+		double y;
+		double dx;
+		double dy;
+
+		circle_point( double xx, double yy, double ddx, double ddy ) : x( xx ), y( yy ), dx( ddx ), dy( ddy ){ }
+	};
+
+	// o~icount ͉~ŌzSGbWf̐j
+	struct circle_candidate
+	{
+		size_t count;
+		double x;
+		double y;
+		double r;
+
+		circle_candidate( size_t c, double xx, double yy, double rr ) : count( c ), x( xx ), y( yy ), r( rr ){ }
+
+		bool operator <( const circle_candidate &c ) const
+		{
+			if( count != c.count )
+			{
+				return( count > c.count );
+			}
+			else if( y != c.y )
+			{
+				return( y < c.y );
+			}
+			else
+			{
+				return( x < c.x );
+			}
+		}
+	};
+
+	// S̓[Ԃ resolution [pixel] ԊũZŕ\Ƃ̃Z̈ʒu߂
+	inline ptrdiff_t circle_cell( double v, double resolution )
+	{
+		double c = ( v + 0.5 ) / resolution;
+		return( c < 0.0 ? -1 : static_cast< ptrdiff_t >( c ) );
+	}
+
+	// 1iKFz̒ɒS𓊕[Xbh
+	// [ԁiϕyCƕxƂĎgpjsƂɕSCeXbh͒Ssɂ̂ݏ
+	class hough_circle_vote_thread : public mist::thread< hough_circle_vote_thread >
+	{
+	public:
+		typedef mist::thread< hough_circle_vote_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+	private:
+		const std::vector< circle_point > *points_;
+		accumulator *accumulator_;
+		double resolution_;
+		double min_radius_;
+		double max_radius_;
+		size_type row_begin_;
+		size_type row_end_;
+
+	public:
+		void setup_parameters( const std::vector< circle_point > &points, accumulator &acc, double resolution, double min_radius, double max_radius, size_type row_begin, size_type row_end )
+		{
+			points_      = &points;
+			accumulator_ = &acc;
+			resolution_  = resolution;
+			min_radius_  = min_radius;
+			max_radius_  = max_radius;
+			row_begin_   = row_begin;
+			row_end_     = row_end;
+		}
+
+		const hough_circle_vote_thread& operator =( const hough_circle_vote_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				points_ = p.points_;
+				accumulator_ = p.accumulator_;
+				resolution_ = p.resolution_;
+				min_radius_ = p.min_radius_;
+				max_radius_ = p.max_radius_;
+				row_begin_ = p.row_begin_;
+				row_end_ = p.row_end_;
+			}
+			return( *this );
+		}
+
+		hough_circle_vote_thread( ) : points_( NULL ), accumulator_( NULL ), resolution_( 1.0 ), min_radius_( 0.0 ), max_radius_( 0.0 ), row_begin_( 0 ), row_end_( 0 )
+		{
+		}
+
+		hough_circle_vote_thread( const hough_circle_vote_thread &p ) : base( p ), points_( p.points_ ), accumulator_( p.accumulator_ ), resolution_( p.resolution_ ),
+																		min_radius_( p.min_radius_ ), max_radius_( p.max_radius_ ), row_begin_( p.row_begin_ ), row_end_( p.row_end_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const std::vector< circle_point > &points = *points_;
+			accumulator &acc = *accumulator_;
+			difference_type cols = acc.get_angle_size( );
+			difference_type row_begin = row_begin_;
+			difference_type row_end = row_end_;
+
+			// SsɒS蓾y͈̔́i1Z̗]Tj
+			double ymin = ( row_begin - 1 ) * resolution_ - 0.5;
+			double ymax = ( row_end + 1 ) * resolution_ - 0.5;
+
+			// 1̉f瓯Z֏dē[Ȃ悤ɁCZԊu̔ȉ݂̍rω
+			double step = resolution_ < 1.0 ? resolution_ * 0.5 : 0.5;
+
+			for( size_type n = 0 ; n < points.size( ) ; n++ )
+			{
+				const circle_point &p = points[ n ];
+
+				// 邢~ƈÂ~̗o邽߁Cz̐ɓ[
+				for( int sign = -1 ; sign <= 1 ; sign += 2 )
+				{
+					double ux = sign * p.dx;
+					double uy = sign * p.dy;
+					double rmin = min_radius_;
+					double rmax = max_radius_;
+
+					if( uy > 1.0e-12 )
+					{
+						rmin = std::max( rmin, ( ymin - p.y ) / uy );
+						rmax = std::min( rmax, ( ymax - p.y ) / uy );
+					}
+					else if( uy < -1.0e-12 )
+					{
+						rmin = std::max( rmin, ( ymax - p.y ) / uy );
+						rmax = std::min( rmax, ( ymin - p.y ) / uy );
+					}
+					else if( p.y < ymin || p.y > ymax )
+					{
+						continue;
+					}
+
+					difference_type prow = -1, pcol = -1;
+					for( double r = rmin ; r <= rmax ; r += step )
+					{
+						difference_type col = circle_cell( p.x + r * ux, resolution_ );
+						difference_type row = circle_cell( p.y + r * uy, resolution_ );
+
+						if( row < row_begin || row >= row_end || col < 0 || col >= cols || ( row == prow && col == pcol ) )
+						{
+							continue;
+						}
+
+						acc.count_up_cell( row, col );
+						prow = row;
+						pcol = col;
+					}
+				}
+			}
+
+			return( 0 );
+		}
+	};
+
+	// 2iKFŠ₲ƂɒS̋̃qXgO쐬Ca肷Xbh
+	// GbWf cell fl̊iqƂɕׂĂiiq c ̉f offset[ c ]  offset[ c + 1 ] ͈̔́jCS̋ߖT̊iq݂̂𒲂ׂ
+	class hough_circle_radius_thread : public mist::thread< hough_circle_radius_thread >
+	{
+	public:
+		typedef mist::thread< hough_circle_radius_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+		typedef ptrdiff_t difference_type;
+
+	private:
+		const std::vector< circle_point > *points_;
+		const size_type *offset_;
+		size_type cell_;
+		size_type grid_width_;
+		size_type grid_height_;
+		const std::vector< hough_peak > *peaks_;
+		double resolution_;
+		double min_radius_;
+		double max_radius_;
+		size_type threshold_;
+		size_type begin_;
+		size_type end_;
+		std::vector< circle_candidate > circles_;
+
+	public:
+		void setup_parameters( const std::vector< circle_point > &points, const size_type *offset, size_type cell, size_type grid_width, size_type grid_height,
+								const std::vector< hough_peak > &peaks, double resolution, double min_radius, double max_radius, size_type threshold, size_type begin, size_type end )
+		{
+			points_      = &points;
+			offset_      = offset;
+			cell_        = cell;
+			grid_width_  = grid_width;
+			grid_height_ = grid_height;
+			peaks_       = &peaks;
+			resolution_  = resolution;
+			min_radius_  = min_radius;
+			max_radius_  = max_radius;
+			threshold_   = threshold;
+			begin_       = begin;
+			end_         = end;
+			circles_.clear( );
+		}
+
+		const std::vector< circle_candidate > &circles( ) const { return( circles_ ); }
+
+		const hough_circle_radius_thread& operator =( const hough_circle_radius_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				points_ = p.points_;
+				offset_ = p.offset_;
+				cell_ = p.cell_;
+				grid_width_ = p.grid_width_;
+				grid_height_ = p.grid_height_;
+				peaks_ = p.peaks_;
+				resolution_ = p.resolution_;
+				min_radius_ = p.min_radius_;
+				max_radius_ = p.max_radius_;
+				threshold_ = p.threshold_;
+				begin_ = p.begin_;
+				end_ = p.end_;
+				circles_ = p.circles_;
+			}
+			return( *this );
+		}
+
+		hough_circle_radius_thread( ) : points_( NULL ), offset_( NULL ), cell_( 1 ), grid_width_( 0 ), grid_height_( 0 ), peaks_( NULL ), resolution_( 1.0 ), min_radius_( 0.0 ), max_radius_( 0.0 ), threshold_( 0 ), begin_( 0 ), end_( 0 )
+		{
+		}
+
+		hough_circle_radius_thread( const hough_circle_radius_thread &p ) : base( p ), points_( p.points_ ), offset_( p.offset_ ), cell_( p.cell_ ), grid_width_( p.grid_width_ ),
+																			grid_height_( p.grid_height_ ), peaks_( p.peaks_ ), resolution_( p.resolution_ ),
+																			min_radius_( p.min_radius_ ), max_radius_( p.max_radius_ ), threshold_( p.threshold_ ),
+																			begin_( p.begin_ ), end_( p.end_ ), circles_( p.circles_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			// zƒS֌̂Ȃp30xȓ̉f݂̂~̓_ƂĐ
+			const double cos_limit = 0.86602540378443864676;
+
+			const std::vector< circle_point > &points = *points_;
+			const std::vector< hough_peak > &peaks = *peaks_;
+
+			difference_type rbegin = static_cast< difference_type >( std::floor( min_radius_ ) );
+			difference_type rend   = static_cast< difference_type >( std::ceil( max_radius_ ) ) + 1;
+			size_type bins = static_cast< size_type >( rend - rbegin );
+
+			std::vector< size_type > hist( bins );
+			std::vector< double > sum( bins );
+
+			for( size_type n = begin_ ; n < end_ ; n++ )
+			{
+				double cx = peaks[ n ].angle * resolution_ + ( resolution_ - 1.0 ) * 0.5;
+				double cy = peaks[ n ].rho * resolution_ + ( resolution_ - 1.0 ) * 0.5;
+
+				std::fill( hist.begin( ), hist.end( ), 0 );
+				std::fill( sum.begin( ), sum.end( ), 0.0 );
+
+				// S max_radius + 1 ȓ̉f܂ފiq͈̔
+				size_type gx0 = grid_index( cx - max_radius_ - 1.0, grid_width_ );
+				size_type gx1 = grid_index( cx + max_radius_ + 1.0, grid_width_ );
+				size_type gy0 = grid_index( cy - max_radius_ - 1.0, grid_height_ );
+				size_type gy1 = grid_index( cy + max_radius_ + 1.0, grid_height_ );
+
+				for( size_type gy = gy0 ; gy <= gy1 ; gy++ )
+				{
+					for( size_type gx = gx0 ; gx <= gx1 ; gx++ )
+					{
+						const size_type g = gx + gy * grid_width_;
+
+						for( size_type i = offset_[ g ] ; i < offset_[ g + 1 ] ; i++ )
+						{
+							const circle_point &p = points[ i ];
+							double x = p.x - cx;
+							double y = p.y - cy;
+
+							if( std::abs( x ) > max_radius_ + 1.0 || std::abs( y ) > max_radius_ + 1.0 )
+							{
+								continue;
+							}
+
+							double d = std::sqrt( x * x + y * y );
+							if( d < min_radius_ - 0.5 || d > max_radius_ + 0.5 || std::abs( x * p.dx + y * p.dy ) < cos_limit * d )
+							{
+								continue;
+							}
+
+							difference_type b = static_cast< difference_type >( d + 0.5 ) - rbegin;
+							if( 0 <= b && b < static_cast< difference_type >( bins ) )
+							{
+								hist[ b ]++;
+								sum[ b ] += d;
+							}
+						}
+					}
+				}
+
+				// ʎq덷lėאڂ3̃r̍vőƂȂ锼aI
+				size_type best = 0, count = 0;
+				for( size_type b = 0 ; b < bins ; b++ )
+				{
+					size_type c = hist[ b ] + ( b > 0 ? hist[ b - 1 ] : 0 ) + ( b + 1 < bins ? hist[ b + 1 ] : 0 );
+					if( c > count )
+					{
+						count = c;
+						best = b;
+					}
+				}
+
+				if( count > threshold_ )
+				{
+					double s = sum[ best ] + ( best > 0 ? sum[ best - 1 ] : 0.0 ) + ( best + 1 < bins ? sum[ best + 1 ] : 0.0 );
+					circles_.push_back( circle_candidate( count, cx, cy, s / static_cast< double >( count ) ) );
+				}
+			}
+
+			return( 0 );
+		}
+
+		// W v ܂ފiq̈ʒu [ 0, size ) ͈̔͂ŋ߂
+		size_type grid_index( double v, size_type size ) const
+		{
+			if( v < 0.0 )
+			{
+				return( 0 );
+			}
+
+			size_type g = static_cast< size_type >( v ) / cell_;
+			return( g < size ? g : size - 1 );
+		}
+	};
+
+	template < class T1, class Allocator1, class T2, class Allocator2, class FUNCTOR >
+	void hough_circle( const array2< T1, Allocator1 > &input, const array2< T2, Allocator2 > &image, std::vector< circle_candidate > &circles,
+						double min_radius, double max_radius, size_t threshold, double resolution, double min_distance, FUNCTOR f, size_t thread_num )
+	{
+		typedef size_t size_type;
+
+		circles.clear( );
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+
+		// z܂GbWfo
+		std::vector< circle_point > points;
+		for( size_type j = 0 ; j < input.height( ) ; j++ )
 		{
 			for( size_type i = 0 ; i < input.width( ) ; i++ )
 			{
 				if( f( input( i, j ) ) )
 				{
-#ifdef _OPENMP
-					#pragma omp critical
-#endif
-					for( size_type angle = 0 ; angle < angle_size ; ++angle )
+					double gx, gy;
+					sobel_gradient( image, i, j, gx, gy );
+
+					double len = std::sqrt( gx * gx + gy * gy );
+					if( len > 0.0 )
 					{
-						difference_type rho = static_cast< difference_type >( i * table.cos( angle ) + j * table.sin( angle ) + 0.5 );
-						accumulator.count_up( rho, angle );
+						points.push_back( circle_point( static_cast< double >( i ), static_cast< double >( j ), gx / len, gy / len ) );
 					}
 				}
 			}
 		}
 
-		return( accumulator );
+		// S̓[Ԃ͉摜 resolution ԊũZɕ傫ƂCa͎̎Ȃ
+		size_type cols = static_cast< size_type >( input.width( ) / resolution ) + 1;
+		size_type rows = static_cast< size_type >( input.height( ) / resolution ) + 1;
+		accumulator acc( rows, cols );
+
+		{
+			size_type num = thread_num > rows ? rows : thread_num;
+			hough_circle_vote_thread *thread = new hough_circle_vote_thread[ num ];
+
+			for( size_type i = 0 ; i < num ; i++ )
+			{
+				thread[ i ].setup_parameters( points, acc, resolution, min_radius, max_radius, rows * i / num, rows * ( i + 1 ) / num );
+			}
+
+			// XbhsāCI܂őҋ@
+			do_threads_( thread, num );
+
+			delete [] thread;
+		}
+
+		// Šo
+		std::vector< hough_peak > peaks;
+		find_peaks( acc, peaks, threshold, 0, thread_num );
+
+		if( peaks.empty( ) )
+		{
+			return;
+		}
+
+		{
+			// GbWf (max_radius + 1) fl̊iqƂɕבւ
+			size_type cell = static_cast< size_type >( max_radius ) + 1;
+			size_type gw = input.width( ) / cell + 1;
+			size_type gh = input.height( ) / cell + 1;
+
+			std::vector< size_type > offset( gw * gh + 2, 0 );
+			for( size_type n = 0 ; n < points.size( ) ; n++ )
+			{
+				offset[ static_cast< size_type >( points[ n ].x ) / cell + static_cast< size_type >( points[ n ].y ) / cell * gw + 2 ]++;
+			}
+			for( size_type g = 2 ; g < offset.size( ) ; g++ )
+			{
+				offset[ g ] += offset[ g - 1 ];
+			}
+
+			std::vector< circle_point > sorted( points.size( ), circle_point( 0.0, 0.0, 0.0, 0.0 ) );
+			for( size_type n = 0 ; n < points.size( ) ; n++ )
+			{
+				sorted[ offset[ static_cast< size_type >( points[ n ].x ) / cell + static_cast< size_type >( points[ n ].y ) / cell * gw + 1 ]++ ] = points[ n ];
+			}
+
+			size_type num = thread_num > peaks.size( ) ? peaks.size( ) : thread_num;
+			hough_circle_radius_thread *thread = new hough_circle_radius_thread[ num ];
+
+			for( size_type i = 0 ; i < num ; i++ )
+			{
+				thread[ i ].setup_parameters( sorted, &offset[ 0 ], cell, gw, gh, peaks, resolution, min_radius, max_radius, threshold, peaks.size( ) * i / num, peaks.size( ) * ( i + 1 ) / num );
+			}
+
+			// XbhsāCI܂őҋ@
+			do_threads_( thread, num );
+
+			std::vector< circle_candidate > candidates;
+			for( size_type i = 0 ; i < num ; i++ )
+			{
+				candidates.insert( candidates.end( ), thread[ i ].circles( ).begin( ), thread[ i ].circles( ).end( ) );
+			}
+
+			delete [] thread;
+
+			std::sort( candidates.begin( ), candidates.end( ) );
+
+			// Ɍo~Ƃ̒SԂ̋ min_distance 菬͎菜
+			double limit = min_distance * min_distance;
+			for( size_type i = 0 ; i < candidates.size( ) ; i++ )
+			{
+				const circle_candidate &c = candidates[ i ];
+				bool duplicate = false;
+
+				for( size_type k = 0 ; k < circles.size( ) && !duplicate ; k++ )
+				{
+					const circle_candidate &d = circles[ k ];
+					duplicate = ( c.x - d.x ) * ( c.x - d.x ) + ( c.y - d.y ) * ( c.y - d.y ) < limit;
+				}
+
+				if( !duplicate )
+				{
+					circles.push_back( c );
+				}
+			}
+		}
 	}
 
 	template < template < typename, typename > class LINES, class TT, class AAllocator >
@@ -275,22 +1149,23 @@ namespace line
 	//! @param[in]  theta_resolution c ƕ\ [radian]
 	//! @param[in]  threshold        c 𒊏oۂ̂liΉ铊[l傫ꍇ̂ݐƂĒoj.
 	//! @param[in]  value_functor    c ͉摜璼\fǂ𔻒肷t@N^.
+	//! @param[in]  thread_num       c gpXbhi0̏ꍇ͎gp\CPUj
 	//! 
 	//! @retval true  c Houghϊɂ蒼܂ꍇ
 	//! @retval false c 1{܂Ȃꍇ
 	//!
 	template < class T, class Allocator, template < typename, typename > class LINES, class TT, class AAllocator, class FUNCTOR >
-	bool hough_transform( const array2< T, Allocator >& input, LINES< TT, AAllocator > &lines, std::size_t max_lines, double rho_resolution, double theta_resolution, size_t threshold, FUNCTOR value_functor )
+	bool hough_transform( const array2< T, Allocator >& input, LINES< TT, AAllocator > &lines, std::size_t max_lines, double rho_resolution, double theta_resolution, size_t threshold, FUNCTOR value_functor, size_t thread_num = 0 )
 	{
 		//Op֐e[u쐬
 		__hough_detail__::trigonometric_table table = __hough_detail__::trigonometric_table( rho_resolution, theta_resolution );
 
 		// Houghϊ...-ƕʂ
-		__hough_detail__::accumulator accumulator = __hough_detail__::hough_transform( input, rho_resolution, table, value_functor );
+		__hough_detail__::accumulator accumulator = __hough_detail__::hough_transform( input, rho_resolution, table, value_functor, thread_num );
 
 		// -ƕʂCount̑̂珇Ɏo
 		__hough_detail__::hough_counter counter;
-		accumulator.convert_to_counter( counter, threshold );
+		accumulator.convert_to_counter( counter, threshold, max_lines, thread_num );
 
 		// tHoughϊ
 		__hough_detail__::hough_inverse( counter, lines, rho_resolution, theta_resolution, max_lines );
@@ -315,6 +1190,162 @@ namespace line
 	{
 		return( hough_transform( input, lines, max_lines, rho_resolution, theta_resolution, threshold, __hough_detail__::foreground_evaluator( ) ) );
 	}
+
+	/// @brief z𗘗p Hough ϊij
+	//!
+	//! GbWfƂɔZW摜 image SobeltB^z߁C̖@z }delta_theta ͈̔͂ɂƂɂ̂ݓ[D
+	//! z0̉f͑SẴƂɓ[D
+	//!
+	//! @param[in]  input            c ͉摜iGbW摜j
+	//! @param[in]  image            c z߂邽߂̔ZW摜i͉摜ƓTCYj
+	//! @param[out] lines            c ܂Q̃Xgi͋ɍWŕ\j.
+	//! @param[in]  max_lines        c o钼̍ő{.
+	//! @param[in]  rho_resolution   c ϕ\ [pixel]
+	//! @param[in]  theta_resolution c ƕ\ [radian]
+	//! @param[in]  threshold        c 𒊏oۂ̂liΉ铊[l傫ꍇ̂ݐƂĒoj.
+	//! @param[in]  delta_theta      c z瓊[Ƃ͈̔ [radian]
+	//! @param[in]  value_functor    c ͉摜璼\fǂ𔻒肷t@N^.
+	//! @param[in]  thread_num       c gpXbhi0̏ꍇ͎gp\CPUj
+	//! 
+	//! @retval true  c Houghϊɂ蒼܂ꍇ
+	//! @retval false c 1{܂Ȃꍇ
+	//!
+	template < class T1, class Allocator1, class T2, class Allocator2, template < typename, typename > class LINES, class TT, class AAllocator, class FUNCTOR >
+	bool gradient_hough_transform( const array2< T1, Allocator1 >& input, const array2< T2, Allocator2 >& image, LINES< TT, AAllocator > &lines, std::size_t max_lines,
+									double rho_resolution, double theta_resolution, size_t threshold, double delta_theta, FUNCTOR value_functor, size_t thread_num = 0 )
+	{
+		typedef typename array2< T1, Allocator1 >::size_type size_type;
+
+		lines.clear( );
+
+		if( input.width( ) != image.width( ) || input.height( ) != image.height( ) )
+		{
+			return( false );
+		}
+
+		//Op֐e[u쐬
+		__hough_detail__::trigonometric_table table = __hough_detail__::trigonometric_table( rho_resolution, theta_resolution );
+
+		const size_type rho_size = static_cast< size_type >( ( ( input.width( ) + input.height( ) ) * 2 + 1 ) / rho_resolution );
+		__hough_detail__::accumulator accumulator( rho_size, table.size( ) );
+
+		// GbWfƂɌz߂ē[
+		std::vector< __hough_detail__::hough_point > points;
+		__hough_detail__::collect_points( input, points, value_functor );
+		__hough_detail__::set_gradient_angle( image, points, theta_resolution, table.size( ) );
+		__hough_detail__::vote( points, table, accumulator, static_cast< ptrdiff_t >( std::ceil( delta_theta / theta_resolution ) ), thread_num );
+
+		// -ƕʂCount̑̂珇Ɏo
+		__hough_detail__::hough_counter counter;
+		accumulator.convert_to_counter( counter, threshold, max_lines, thread_num );
+
+		// tHoughϊ
+		__hough_detail__::hough_inverse( counter, lines, rho_resolution, theta_resolution, max_lines );
+
+		return( !lines.empty( ) );
+	}
+
+	/// @brief z𗘗p Hough ϊij
+	//!
+	//! @param[in]  input            c ͉摜iGbW摜j
+	//! @param[in]  image            c z߂邽߂̔ZW摜i͉摜ƓTCYj
+	//! @param[out] lines            c ܂Q̃Xgi͋ɍWŕ\j.
+	//! @param[in]  max_lines        c o钼̍ő{.
+	//! @param[in]  rho_resolution   c ϕ\ [pixel]iftHgl 1.0j
+	//! @param[in]  theta_resolution c ƕ\ [radian]iftHgl ΁360j
+	//! @param[in]  threshold        c 𒊏oۂ̂liftHgl 100j.
+	//! @param[in]  delta_theta      c z瓊[Ƃ͈̔ [radian]iftHgl ΁36j
+	//! 
+	//! @retval true  c Houghϊɂ蒼܂ꍇ
+	//! @retval false c 1{܂Ȃꍇ
+	//!
+	template < class T1, class Allocator1, class T2, class Allocator2, template < typename, typename > class LINES, class TT, class AAllocator >
+	bool gradient_hough_transform( const array2< T1, Allocator1 >& input, const array2< T2, Allocator2 >& image, LINES< TT, AAllocator > &lines, std::size_t max_lines,
+									double rho_resolution = 1.0, double theta_resolution = 3.1415926535897932384626433832795 / 360.0, size_t threshold = 100, double delta_theta = 3.1415926535897932384626433832795 / 36.0 )
+	{
+		return( gradient_hough_transform( input, image, lines, max_lines, rho_resolution, theta_resolution, threshold, delta_theta, __hough_detail__::foreground_evaluator( ) ) );
+	}
+}
+
+
+/// @brief ~ɑ΂Houghϊ
+namespace circle
+{
+	/// @brief Hough ϊi~j
+	//!
+	//! 2iK̓[ɂ~oD
+	//! 1iKł́CGbWfƂɔZW摜 image SobeltB^z߁Cz̒ŒS̋
+	//! [ min_radius, max_radius ] ƂȂʒuɒS𓊕[D[Ԃ͉摜 resolution ԊũZɕ2złC
+	//! a͈̔͂ɂ炸gpʂ͉摜TCY 1/resolution^2 xɗ}D
+	//! 2iKł́CŠ₲ƂɌzSGbWf܂ł̋̃qXgO쐬Ca肷D
+	//!
+	//! @attention 1̒Sɑ΂1̔â݂߂邽߁CS~͍łf̑~݂̂o
+	//!
+	//! @param[in]  input         c ͉摜iGbW摜j
+	//! @param[in]  image         c z߂邽߂̔ZW摜i͉摜ƓTCYj
+	//! @param[out] circles       c ܂~̃Xgi~͒SxWCyWCȁ value_type( x, y, r ) Ŋi[j
+	//! @param[in]  max_circles   c o~̍ő吔
+	//! @param[in]  min_radius    c o~̍ŏa [pixel]
+	//! @param[in]  max_radius    c o~̍ő唼a [pixel]
+	//! @param[in]  threshold     c ~𒊏oۂ̂liSւ̓[Ɖ~̉fƂɂl傫ꍇ̂݉~ƂĒoj
+	//! @param[in]  resolution    c S̓[Ԃ̃Z̑傫 [pixel]
+	//! @param[in]  min_distance  c o~̒SԂ̍ŏ [pixel]i~̉f~D悷j
+	//! @param[in]  value_functor c ͉摜~\fǂ𔻒肷t@N^
+	//! @param[in]  thread_num    c gpXbhi0̏ꍇ͎gp\CPUj
+	//! 
+	//! @retval true  c ~܂ꍇ
+	//! @retval false c ~1܂Ȃꍇ
+	//!
+	template < class T1, class Allocator1, class T2, class Allocator2, template < typename, typename > class CIRCLES, class TT, class AAllocator, class FUNCTOR >
+	bool hough_transform( const array2< T1, Allocator1 >& input, const array2< T2, Allocator2 >& image, CIRCLES< TT, AAllocator > &circles, std::size_t max_circles,
+							double min_radius, double max_radius, size_t threshold, double resolution, double min_distance, FUNCTOR value_functor, size_t thread_num = 0 )
+	{
+		typedef typename CIRCLES< TT, AAllocator >::value_type value_type;
+
+		circles.clear( );
+
+		if( input.width( ) != image.width( ) || input.height( ) != image.height( ) || input.empty( ) )
+		{
+			return( false );
+		}
+		else if( min_radius < 0.0 || max_radius < min_radius || resolution <= 0.0 )
+		{
+			return( false );
+		}
+
+		std::vector< __hough_detail__::circle_candidate > candidates;
+		__hough_detail__::hough_circle( input, image, candidates, min_radius, max_radius, threshold, resolution, min_distance, value_functor, thread_num );
+
+		for( size_t i = 0 ; i < candidates.size( ) && circles.size( ) < max_circles ; i++ )
+		{
+			circles.push_back( value_type( candidates[ i ].x, candidates[ i ].y, candidates[ i ].r ) );
+		}
+
+		return( !circles.empty( ) );
+	}
+
+	/// @brief Hough ϊi~j
+	//!
+	//! @param[in]  input       c ͉摜iGbW摜j
+	//! @param[in]  image       c z߂邽߂̔ZW摜i͉摜ƓTCYj
+	//! @param[out] circles     c ܂~̃Xgi~͒SxWCyWCȁ value_type( x, y, r ) Ŋi[j
+	//! @param[in]  max_circles c o~̍ő吔
+	//! @param[in]  min_radius  c o~̍ŏa [pixel]
+	//! @param[in]  max_radius  c o~̍ő唼a [pixel]
+	//! @param[in]  threshold   c ~𒊏oۂ̂liftHgl 50j
+	//! @param[in]  resolution  c S̓[Ԃ̃Z̑傫 [pixel]iftHgl 1.0j
+	//! 
+	//! @attention o~̒SԂ̍ŏ min_radius Ƃ
+	//! 
+	//! @retval true  c ~܂ꍇ
+	//! @retval false c ~1܂Ȃꍇ
+	//!
+	template < class T1, class Allocator1, class T2, class Allocator2, template < typename, typename > class CIRCLES, class TT, class AAllocator >
+	bool hough_transform( const array2< T1, Allocator1 >& input, const array2< T2, Allocator2 >& image, CIRCLES< TT, AAllocator > &circles, std::size_t max_circles,
+							double min_radius, double max_radius, size_t threshold = 50, double resolution = 1.0 )
+	{
+		return( hough_transform( input, image, circles, max_circles, min_radius, max_radius, threshold, resolution, min_radius, __hough_detail__::foreground_evaluator( ) ) );
+	}
 }
 
 /// @}
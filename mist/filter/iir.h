@@ -45,6 +45,7 @@
 
 #include <cmath>
 #include <functional>
+#include <vector>
 
 // mistOԂ̎n܂
 _MIST_BEGIN
@@ -113,6 +114,257 @@ namespace __iir_filter__
 }
 
 
+//! @addtogroup iir_group IIRtB^
+//!
+//! @code ̃wb_CN[h
+//! #include <mist/filter/iir.h>
+//! @endcode
+//!
+//!  @{
+
+
+/// @brief 2IIRtB^ioCNbhjcڑtB^
+//!
+//! ei̓`B֐ H( z ) = ( b0 + b1 z^-1 + b2 z^-2 ) / ( a0 + a1 z^-1 + a2 z^-2 ) łC]u^ڌ`IIŌvZD
+//! IIRtB^2̒iɕiSOS`jďcڑ邱ƂŁCW̗ʎq덷ɑ΂ĈɌvZłD
+//! ei̓Ԃ`lƂɕێ邽߁CMCӂ̒̃ubNɕ filter JԂĂяoƂŁC
+//! MŜxɏꍇƓʂD
+//!
+//! `l̐ḾCx`lCyԂƂ array2 ŗ^iWAVt@CƓC^[[u`jD
+//! ̑S`lAɑ΂ēWŏ邽߁C`l̃[vxNg₷D
+//!
+//! @code gp
+//! mist::biquad_filter f( 2 );              // 2`l
+//! f.add_section( b0, b1, b2, a0, a1, a2 );
+//! while( ... )
+//! {
+//!     f.filter( in, out );                 // in( `l,  )
+//! }
+//! @endcode
+//!
+class biquad_filter
+{
+public:
+	typedef size_t size_type;			///< @brief Ȃ̐\^DRei̗vfCevfw肷ƂȂǂɗpCIɂ size_t ^Ɠ
+	typedef ptrdiff_t difference_type;	///< @brief t̐\^DRei̗vfCevfw肷ƂȂǂɗpCIɂ ptrdiff_t ^Ɠ
+
+	/// @brief a0 ŐK1ǐW
+	struct section
+	{
+		double b0;
+		double b1;
+		double b2;
+		double a1;
+		double a2;
+	};
+
+private:
+	std::vector< section > sections_;
+	size_type channels_;
+	std::vector< double > state_;		// iƂ z1iS`ljCz2iS`lj̏Ɋi[
+	std::vector< double > work_;
+
+public:
+	/// @brief channel_num `l̐M̃tB^쐬
+	biquad_filter( size_type channel_num = 1 ) : channels_( channel_num == 0 ? 1 : channel_num )
+	{
+	}
+
+	/// @brief SOS`̌WtB^쐬
+	//!
+	//! @param[in] sos         c 1s1ǐW b0, b1, b2, a0, a1, a2 ׂzi6Cij
+	//! @param[in] channel_num c `l
+	//!
+	template < class T, class Allocator >
+	biquad_filter( const array2< T, Allocator > &sos, size_type channel_num = 1 ) : channels_( channel_num == 0 ? 1 : channel_num )
+	{
+		if( sos.width( ) >= 6 )
+		{
+			for( size_type j = 0 ; j < sos.height( ) ; j++ )
+			{
+				add_section( static_cast< double >( sos( 0, j ) ), static_cast< double >( sos( 1, j ) ), static_cast< double >( sos( 2, j ) ),
+							 static_cast< double >( sos( 3, j ) ), static_cast< double >( sos( 4, j ) ), static_cast< double >( sos( 5, j ) ) );
+			}
+		}
+	}
+
+	/// @brief i𖖔ɒǉCԂ
+	void add_section( double b0, double b1, double b2, double a0, double a1, double a2 )
+	{
+		section s;
+		s.b0 = b0 / a0;
+		s.b1 = b1 / a0;
+		s.b2 = b2 / a0;
+		s.a1 = a1 / a0;
+		s.a2 = a2 / a0;
+		sections_.push_back( s );
+		reset( );
+	}
+
+	/// @brief SĂ̒i폜
+	void clear( )
+	{
+		sections_.clear( );
+		state_.clear( );
+	}
+
+	/// @brief `lύXCԂ
+	void channels( size_type channel_num )
+	{
+		channels_ = channel_num == 0 ? 1 : channel_num;
+		reset( );
+	}
+
+	/// @brief Ԃ0ɖ߂
+	void reset( )
+	{
+		state_.assign( sections_.size( ) * 2 * channels_, 0.0 );
+	}
+
+	/// @brief `l
+	size_type channels( ) const { return( channels_ ); }
+
+	/// @brief i
+	size_type sections( ) const { return( sections_.size( ) ); }
+
+	/// @brief 1`l̐M̑ɃtB^Kp
+	//!
+	//! @attention `l1̏ꍇ̂ݗpł
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//!
+	//! @param[in]  in  c ͐MiǑĂяoŗ^M̑j
+	//! @param[out] out c o͐M
+	//!
+	//! @return `l1łȂꍇ false
+	//!
+	template < class T1, class Allocator1, class T2, class Allocator2 >
+	bool filter( const array< T1, Allocator1 > &in, array< T2, Allocator2 > &out )
+	{
+		if( channels_ != 1 )
+		{
+			return( false );
+		}
+
+		size_type num = in.size( );
+		work_.resize( num );
+		for( size_type i = 0 ; i < num ; i++ )
+		{
+			work_[ i ] = static_cast< double >( in[ i ] );
+		}
+
+		if( num > 0 )
+		{
+			process( &work_[ 0 ], num );
+		}
+
+		out.resize( num );
+		for( size_type i = 0 ; i < num ; i++ )
+		{
+			out[ i ] = static_cast< T2 >( work_[ i ] );
+		}
+
+		return( true );
+	}
+
+	/// @brief `l̐M̑ɃtB^Kp
+	//!
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//!
+	//! @param[in]  in  c ͐Mix`lCyԁj
+	//! @param[out] out c o͐M
+	//!
+	//! @return ͂̕`lƈقȂꍇ false
+	//!
+	template < class T1, class Allocator1, class T2, class Allocator2 >
+	bool filter( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out )
+	{
+		if( in.width( ) != channels_ )
+		{
+			return( false );
+		}
+
+		size_type num = in.height( );
+		double rx = in.reso1( );
+		double ry = in.reso2( );
+
+		work_.resize( num * channels_ );
+		for( size_type i = 0 ; i < work_.size( ) ; i++ )
+		{
+			work_[ i ] = static_cast< double >( in[ i ] );
+		}
+
+		if( num > 0 )
+		{
+			process( &work_[ 0 ], num );
+		}
+
+		out.resize( channels_, num );
+		out.reso1( rx );
+		out.reso2( ry );
+		for( size_type i = 0 ; i < work_.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< T2 >( work_[ i ] );
+		}
+
+		return( true );
+	}
+
+private:
+	// C^[[u` num Tvɑ΂ĊeiԂɓKp
+	// iƂɑSTv邱ƂŌWWX^ɕێ܂܌vZłCeł̓`l̘A[vƂȂ
+	void process( double *x, size_type num )
+	{
+		const size_type ch = channels_;
+
+		for( size_type s = 0 ; s < sections_.size( ) ; s++ )
+		{
+			const double b0 = sections_[ s ].b0;
+			const double b1 = sections_[ s ].b1;
+			const double b2 = sections_[ s ].b2;
+			const double a1 = sections_[ s ].a1;
+			const double a2 = sections_[ s ].a2;
+			double *z1 = &state_[ s * 2 * ch ];
+			double *z2 = z1 + ch;
+
+			if( ch == 1 )
+			{
+				double w1 = z1[ 0 ];
+				double w2 = z2[ 0 ];
+				for( size_type n = 0 ; n < num ; n++ )
+				{
+					double v = x[ n ];
+					double y = b0 * v + w1;
+					w1 = b1 * v - a1 * y + w2;
+					w2 = b2 * v - a2 * y;
+					x[ n ] = y;
+				}
+				z1[ 0 ] = w1;
+				z2[ 0 ] = w2;
+			}
+			else
+			{
+				for( size_type n = 0 ; n < num ; n++ )
+				{
+					double *xx = x + n * ch;
+					for( size_type c = 0 ; c < ch ; c++ )
+					{
+						double v = xx[ c ];
+						double y = b0 * v + z1[ c ];
+						z1[ c ] = b1 * v - a1 * y + z2[ c ];
+						z2[ c ] = b2 * v - a2 * y;
+						xx[ c ] = y;
+					}
+				}
+			}
+		}
+	}
+};
+
+
+/// @}
+//  IIRtB^O[v̏I
+
+
 // mistOԂ̏I
 _MIST_END
 
@@ -47,8 +47,13 @@
 #include "../limits.h"
 #endif
 
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+
 #include <vector>
 #include <list>
+#include <algorithm>
 
 
 
@@ -56,6 +61,122 @@
 _MIST_BEGIN
 
 
+/// @brief xOɏWvA̓v
+//! 
+//! 2摜̏ꍇ́CZW͏0ƂȂ
+//! 
+struct region_statistics
+{
+	typedef size_t size_type;				///< @brief Ȃ̐\^
+	typedef ptrdiff_t difference_type;		///< @brief t̐\^
+
+	size_type label;			///< @brief xԍ
+	size_type count;			///< @brief f
+	difference_type min_x;		///< @brief Oڒ̂ X W̍ŏl
+	difference_type min_y;		///< @brief Oڒ̂ Y W̍ŏl
+	difference_type min_z;		///< @brief Oڒ̂ Z W̍ŏl
+	difference_type max_x;		///< @brief Oڒ̂ X W̍ől
+	difference_type max_y;		///< @brief Oڒ̂ Y W̍ől
+	difference_type max_z;		///< @brief Oڒ̂ Z W̍ől
+	double sum_x;				///< @brief f X W̑ai1[gj
+	double sum_y;				///< @brief f Y W̑ai1[gj
+	double sum_z;				///< @brief f Z W̑ai1[gj
+	double sum;					///< @brief ZWl̑aiZW摜w肵ꍇ̂݁j
+	double minimum;				///< @brief ZWl̍ŏliZW摜w肵ꍇ̂݁j
+	double maximum;				///< @brief ZWl̍őliZW摜w肵ꍇ̂݁j
+
+	/// @brief f܂܂Ȃvʂŏ
+	region_statistics( size_type l = 0 ) : label( l ), count( 0 ), min_x( 0 ), min_y( 0 ), min_z( 0 ), max_x( 0 ), max_y( 0 ), max_z( 0 ),
+											sum_x( 0 ), sum_y( 0 ), sum_z( 0 ), sum( 0 ), minimum( 0 ), maximum( 0 )
+	{
+	}
+
+	/// @brief dS X W
+	double center_x( ) const { return( count == 0 ? 0.0 : sum_x / static_cast< double >( count ) ); }
+
+	/// @brief dS Y W
+	double center_y( ) const { return( count == 0 ? 0.0 : sum_y / static_cast< double >( count ) ); }
+
+	/// @brief dS Z W
+	double center_z( ) const { return( count == 0 ? 0.0 : sum_z / static_cast< double >( count ) ); }
+
+	/// @brief ZWl̕ϒl
+	double mean( ) const { return( count == 0 ? 0.0 : sum / static_cast< double >( count ) ); }
+
+	/// @brief W ( i, j, k ) ̉fǉ
+	void append( difference_type i, difference_type j, difference_type k )
+	{
+		if( count == 0 )
+		{
+			min_x = max_x = i;
+			min_y = max_y = j;
+			min_z = max_z = k;
+		}
+		else
+		{
+			min_x = i < min_x ? i : min_x;
+			min_y = j < min_y ? j : min_y;
+			min_z = k < min_z ? k : min_z;
+			max_x = i > max_x ? i : max_x;
+			max_y = j > max_y ? j : max_y;
+			max_z = k > max_z ? k : max_z;
+		}
+
+		sum_x += static_cast< double >( i );
+		sum_y += static_cast< double >( j );
+		sum_z += static_cast< double >( k );
+		count++;
+	}
+
+	/// @brief W ( i, j, k ) ̔ZWl v ̉fǉ
+	void append( difference_type i, difference_type j, difference_type k, double v )
+	{
+		if( count == 0 )
+		{
+			minimum = maximum = v;
+		}
+		else
+		{
+			minimum = v < minimum ? v : minimum;
+			maximum = v > maximum ? v : maximum;
+		}
+
+		sum += v;
+		append( i, j, k );
+	}
+
+	/// @brief A̕ʂ̕ŏWvvʂ𓝍
+	void merge( const region_statistics &r )
+	{
+		if( r.count == 0 )
+		{
+			return;
+		}
+		else if( count == 0 )
+		{
+			size_type l = label;
+			*this = r;
+			label = l;
+			return;
+		}
+
+		min_x = r.min_x < min_x ? r.min_x : min_x;
+		min_y = r.min_y < min_y ? r.min_y : min_y;
+		min_z = r.min_z < min_z ? r.min_z : min_z;
+		max_x = r.max_x > max_x ? r.max_x : max_x;
+		max_y = r.max_y > max_y ? r.max_y : max_y;
+		max_z = r.max_z > max_z ? r.max_z : max_z;
+		minimum = r.minimum < minimum ? r.minimum : minimum;
+		maximum = r.maximum > maximum ? r.maximum : maximum;
+		sum_x += r.sum_x;
+		sum_y += r.sum_y;
+		sum_z += r.sum_z;
+		sum += r.sum;
+		count += r.count;
+	}
+};
+
+
 namespace __labeling_controller__
 {
 	template < class T > struct default_label_num2
@@ -121,6 +242,18 @@ namespace __labeling_controller__
 
 			return( 0 );
 		}
+
+		// ς݂̋ߖTf̑ΈʒuiL ̕тƓԁj
+		static inline void offset( size_t n, ptrdiff_t &x, ptrdiff_t &y, ptrdiff_t &z )
+		{
+			static const ptrdiff_t ox[] = {  0,  0, -1,  0, -1,  1,  0, -1,  1, -1,  1, -1,  1 };
+			static const ptrdiff_t oy[] = {  0, -1,  0, -1,  0,  0,  1, -1, -1, -1, -1,  1,  1 };
+			static const ptrdiff_t oz[] = { -1,  0,  0, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1 };
+
+			x = ox[ n ];
+			y = oy[ n ];
+			z = oz[ n ];
+		}
 	};
 
 	template < >
@@ -147,6 +280,18 @@ namespace __labeling_controller__
 
 			return( 0 );
 		}
+
+		// ς݂̋ߖTf̑ΈʒuiL ̕тƓԁj
+		static inline void offset( size_t n, ptrdiff_t &x, ptrdiff_t &y, ptrdiff_t &z )
+		{
+			static const ptrdiff_t ox[] = {  0,  0, -1,  0, -1,  1,  0, -1,  1 };
+			static const ptrdiff_t oy[] = {  0, -1,  0, -1,  0,  0,  1, -1, -1 };
+			static const ptrdiff_t oz[] = { -1,  0,  0, -1, -1, -1, -1,  0,  0 };
+
+			x = ox[ n ];
+			y = oy[ n ];
+			z = oz[ n ];
+		}
 	};
 
 	template < >
@@ -167,6 +312,18 @@ namespace __labeling_controller__
 
 			return( 0 );
 		}
+
+		// ς݂̋ߖTf̑ΈʒuiL ̕тƓԁj
+		static inline void offset( size_t n, ptrdiff_t &x, ptrdiff_t &y, ptrdiff_t &z )
+		{
+			static const ptrdiff_t ox[] = {  0,  0, -1 };
+			static const ptrdiff_t oy[] = {  0, -1,  0 };
+			static const ptrdiff_t oz[] = { -1,  0,  0 };
+
+			x = ox[ n ];
+			y = oy[ n ];
+			z = oz[ n ];
+		}
 	};
 
 	template < >
@@ -188,6 +345,18 @@ namespace __labeling_controller__
 
 			return( 0 );
 		}
+
+		// ς݂̋ߖTf̑ΈʒuiL ̕тƓԁj
+		static inline void offset( size_t n, ptrdiff_t &x, ptrdiff_t &y, ptrdiff_t &z )
+		{
+			static const ptrdiff_t ox[] = { -1,  0,  1, -1 };
+			static const ptrdiff_t oy[] = { -1, -1, -1,  0 };
+			static const ptrdiff_t oz[] = {  0,  0,  0,  0 };
+
+			x = ox[ n ];
+			y = oy[ n ];
+			z = oz[ n ];
+		}
 	};
 
 	template < >
@@ -207,6 +376,18 @@ namespace __labeling_controller__
 
 			return( 0 );
 		}
+
+		// ς݂̋ߖTf̑ΈʒuiL ̕тƓԁj
+		static inline void offset( size_t n, ptrdiff_t &x, ptrdiff_t &y, ptrdiff_t &z )
+		{
+			static const ptrdiff_t ox[] = {  0, -1 };
+			static const ptrdiff_t oy[] = { -1,  0 };
+			static const ptrdiff_t oz[] = {  0,  0 };
+
+			x = ox[ n ];
+			y = oy[ n ];
+			z = oz[ n ];
+		}
 	};
 
 
@@ -390,171 +571,498 @@ namespace __labeling_controller__
 
 		return( label_num );
 	}
-}
 
+	// 񃉃xOŗp Union-Findief̗vfԍm[hƂC͏ɘAōŏ̗vfԍƂȂj
+	// ̕tւ͔rōsCoH̒Zk͍ȊÕm[hɑ΂Ă̂ݍs߁C̃Xbh瓯ɑł
+	// vfԍ 2^32 fȏ̉摜ł悤 size_t ŕێir|C^ōsj
+	inline size_t find_root( volatile size_t *parent, size_t x )
+	{
+		while( parent[ x ] != x )
+		{
+			size_t p = parent[ x ];
+			size_t g = parent[ p ];
+			if( p != g )
+			{
+				parent[ x ] = g;
+			}
+			x = g;
+		}
+		return( x );
+	}
+
+	inline void merge_root( volatile size_t *parent, size_t a, size_t b )
+	{
+		for( ;; )
+		{
+			a = find_root( parent, a );
+			b = find_root( parent, b );
 
+			if( a == b )
+			{
+				return;
+			}
+			else if( a < b )
+			{
+				size_t tmp = a;
+				a = b;
+				b = tmp;
+			}
 
+			// vfԍ̑傫̍C̍ɂȂւ
+			if( atomic_compare_and_swap( parent[ a ], a, b ) )
+			{
+				return;
+			}
+		}
+	}
 
-//! @addtogroup labeling_group xO
-//!
-//! @code ̃wb_CN[h
-//! #include <mist/filter/labeling.h>
-//! @endcode
-//!
-//!  @{
 
+	// A̓vʂWvȂꍇɗp_~[̏WvNX
+	struct null_accumulator
+	{
+		void initialize( size_t /* label_num */ ){ }
+		void operator ()( size_t /* label */, size_t /* index */, ptrdiff_t /* i */, ptrdiff_t /* j */, ptrdiff_t /* k */ ){ }
+		void merge( const null_accumulator & /* a */ ){ }
+	};
 
-/// @brief 2摜ɑ΂4ߖT^xO
-//! 
-//! 2摜ɑ΂4ߖT^xO
-//! 
-//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
-//! 
-//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKv
-//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
-//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
-//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
-//! 
-//! @param[in]  in        c ͉摜
-//! @param[out] out       c o͉摜
-//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
-//! @param[in]  f         c is󋵂ԂR[obN֐
-//! 
-//! @return 蓖Ăꂽx
-//! 
-template < class T1, class T2, class Allocator1, class Allocator2, class Functor >
-typename array2< T2, Allocator2 >::size_type labeling4( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label, Functor f )
-{
-	typedef typename array2< T2, Allocator2 >::size_type  size_type;
-	typedef typename array2< T2, Allocator2 >::value_type value_type;
 
-	if( max_label == 0 )
+	// x蓖ĂfA̓vʂWvNXiintensity  NULL ̏ꍇ͔ZWlWvȂj
+	template < class T >
+	struct region_accumulator
 	{
-		if( is_float< value_type >::value )
+		std::vector< region_statistics > table;
+		const T *intensity;
+
+		region_accumulator( const T *p = NULL ) : intensity( p ){ }
+
+		void initialize( size_t label_num )
 		{
-			max_label = type_limits< size_type >::maximum( );
+			table.resize( label_num + 1 );
+			for( size_t l = 0 ; l < table.size( ) ; l++ )
+			{
+				table[ l ] = region_statistics( l );
+			}
 		}
-		else
+
+		void operator ()( size_t label, size_t index, ptrdiff_t i, ptrdiff_t j, ptrdiff_t k )
 		{
-			max_label = static_cast< size_type >( type_limits< value_type >::maximum( ) );
+			if( intensity == NULL )
+			{
+				table[ label ].append( i, j, k );
+			}
+			else
+			{
+				table[ label ].append( i, j, k, static_cast< double >( intensity[ index ] ) );
+			}
 		}
-	}
 
-	out.resize( in.size1( ), in.size2( ) );
-	out.reso1( in.reso1( ) );
-	out.reso2( in.reso2( ) );
+		void merge( const region_accumulator &a )
+		{
+			for( size_t l = 0 ; l < table.size( ) ; l++ )
+			{
+				table[ l ].merge( a.table[ l ] );
+			}
+		}
+	};
 
-	for( size_type i = 0 ; i < in.size( ) ; i++ )
+
+	// 摜Xui3摜łZC2摜łYjɕĕɃxOsXbh
+	//
+	// stage 0 c Xu Union-Find ɂ鉼xOs
+	// stage 1 c Xu̐擪ʂƁC1ÕXu̍ŏIʂƂ̊Ԃ̘A𓝍
+	// stage 2 c Xu̍iA̐擪fj̐𐔂
+	// stage 3 c Xu̍ɁCɒʂԍ̃x蓖Ă
+	// stage 4 c ȊỎfɁC̃x蓖Ă
+	//
+	// stage 3  4 Ńx蓖Ăf́CXbh̏WvNXɓn
+	template < class Array, class neighbor, class Accumulator = null_accumulator >
+	class parallel_labeling_thread : public mist::thread< parallel_labeling_thread< Array, neighbor, Accumulator > >
 	{
-		out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
-	}
-	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 4 >( ), f ) );
-}
+	public:
+		typedef mist::thread< parallel_labeling_thread< Array, neighbor, Accumulator > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef typename Array::size_type size_type;
+		typedef typename Array::difference_type difference_type;
+		typedef typename Array::value_type value_type;
 
+	private:
+		// o͗p̉摜ւ̃|C^
+		Array *in_;
+		volatile size_t *parent_;
+		size_type begin_;
+		size_type end_;
+		size_type stage_;
+		size_type label_offset_;
+		size_type label_max_;
+		size_type root_num_;
+		Accumulator accumulator_;
+
+	public:
+		void setup_parameters( Array &in, volatile size_t *parent, size_type begin, size_type end, size_type label_max )
+		{
+			in_        = &in;
+			parent_    = parent;
+			begin_     = begin;
+			end_       = end;
+			label_max_ = label_max;
+		}
 
-/// @brief 2摜ɑ΂4ߖT^xO
-//! 
-//! 2摜ɑ΂4ߖT^xO
-//! 
-//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
-//! 
-//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
-//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
-//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
-//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
-//! 
-//! @param[in]  in        c ͉摜
-//! @param[out] out       c o͉摜
-//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
-//! 
-//! @return 蓖Ăꂽx
-//! 
-template < class T1, class T2, class Allocator1, class Allocator2 >
-typename array2< T2, Allocator2 >::size_type labeling4( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num2< T2 >::value )
-{
-	return( labeling4( in, out, max_label, __mist_dmy_callback__( ) ) );
-}
+		void setup_stage( size_type stage, size_type label_offset = 0 )
+		{
+			stage_ = stage;
+			label_offset_ = label_offset;
+		}
 
+		size_type root_num( ) const { return( root_num_ ); }
+		Accumulator &accumulator( ) { return( accumulator_ ); }
 
-/// @brief 2摜ɑ΂8ߖT^xO
-//! 
-//! 2摜ɑ΂8ߖT^xO
-//! 
-//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
-//! 
-//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
-//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
-//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
-//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
-//! 
-//! @param[in]  in        c ͉摜
-//! @param[out] out       c o͉摜
-//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
-//! @param[in]  f         c is󋵂ԂR[obN֐
-//! 
-//! @return 蓖Ăꂽx
-//! 
-template < class T1, class T2, class Allocator1, class Allocator2, class Functor >
-typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label, Functor f )
-{
-	typedef typename array2< T2, Allocator2 >::size_type  size_type;
-	typedef typename array2< T2, Allocator2 >::value_type value_type;
+		const parallel_labeling_thread& operator =( const parallel_labeling_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				in_ = p.in_;
+				parent_ = p.parent_;
+				begin_ = p.begin_;
+				end_ = p.end_;
+				stage_ = p.stage_;
+				label_offset_ = p.label_offset_;
+				label_max_ = p.label_max_;
+				root_num_ = p.root_num_;
+				accumulator_ = p.accumulator_;
+			}
+			return( *this );
+		}
 
-	if( max_label == 0 )
-	{
-		if( is_float< value_type >::value )
+		parallel_labeling_thread( ) : in_( NULL ), parent_( NULL ), begin_( 0 ), end_( 0 ), stage_( 0 ), label_offset_( 0 ), label_max_( 0 ), root_num_( 0 )
 		{
-			max_label = type_limits< size_type >::maximum( );
 		}
-		else
+
+		parallel_labeling_thread( const parallel_labeling_thread &p ) : base( p ), in_( p.in_ ), parent_( p.parent_ ), begin_( p.begin_ ), end_( p.end_ ),
+															stage_( p.stage_ ), label_offset_( p.label_offset_ ), label_max_( p.label_max_ ), root_num_( p.root_num_ ),
+															accumulator_( p.accumulator_ )
 		{
-			max_label = static_cast< size_type >( type_limits< value_type >::maximum( ) );
 		}
-	}
 
-	out.resize( in.size1( ), in.size2( ) );
-	out.reso1( in.reso1( ) );
-	out.reso2( in.reso2( ) );
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			Array &in = *in_;
+			volatile size_t *parent = parent_;
+
+			const difference_type w = in.width( );
+			const difference_type h = in.height( );
+			const difference_type d = in.depth( );
+			const bool is_3d = d > 1;
+
+			// SXu͈̔
+			const difference_type sz = is_3d ? begin_ : 0;
+			const difference_type ez = is_3d ? end_ : 1;
+			const difference_type sy = is_3d ? 0 : begin_;
+			const difference_type ey = is_3d ? h : end_;
+
+			difference_type ox[ neighbor::array_num ], oy[ neighbor::array_num ], oz[ neighbor::array_num ], diff[ neighbor::array_num ];
+			for( size_type l = 0 ; l < neighbor::array_num ; l++ )
+			{
+				neighbor::offset( l, ox[ l ], oy[ l ], oz[ l ] );
+				diff[ l ] = ox[ l ] + ( oy[ l ] + oz[ l ] * h ) * w;
+			}
 
-	for( size_type i = 0 ; i < in.size( ) ; i++ )
-	{
-		out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
-	}
-	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 8 >( ), f ) );
-}
+			difference_type i, j, k;
+			size_type l;
 
+			switch( stage_ )
+			{
+			case 0:
+				for( k = sz ; k < ez ; k++ )
+				{
+					for( j = sy ; j < ey ; j++ )
+					{
+						size_type index = static_cast< size_type >( ( k * h + j ) * w );
+						for( i = 0 ; i < w ; i++, index++ )
+						{
+							if( in[ index ] == 0 )
+							{
+								continue;
+							}
 
-/// @brief 2摜ɑ΂8ߖT^xO
-//! 
-//! 2摜ɑ΂8ߖT^xO
-//! 
-//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
-//! 
-//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
-//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
-//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
-//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
-//! 
-//! @param[in]  in        c ͉摜
-//! @param[out] out       c o͉摜
-//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
-//! 
-//! @return 蓖Ăꂽx
-//! 
-template < class T1, class T2, class Allocator1, class Allocator2 >
-inline typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num2< T2 >::value )
-{
-	return( labeling8( in, out, max_label, __mist_dmy_callback__( ) ) );
-}
+							parent[ index ] = index;
 
+							for( l = 0 ; l < neighbor::array_num ; l++ )
+							{
+								difference_type x = i + ox[ l ], y = j + oy[ l ], z = k + oz[ l ];
+								if( 0 <= x && x < w && sy <= y && y < h && sz <= z && in[ index + diff[ l ] ] != 0 )
+								{
+									merge_root( parent, index, static_cast< size_type >( index + diff[ l ] ) );
+								}
+							}
+						}
+					}
+				}
+				break;
 
-/// @brief 3摜ɑ΂6ߖT^xO
-//! 
-//! 3摜ɑ΂6ߖT^xO
-//! 
-//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
-//! 
-//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
+			case 1:
+				if( begin_ > 0 )
+				{
+					// 1ÕXu̍ŏIʂƐڂf݂̂𒲂ׂ
+					for( k = sz ; k < ( is_3d ? sz + 1 : ez ) ; k++ )
+					{
+						for( j = sy ; j < ( is_3d ? ey : sy + 1 ) ; j++ )
+						{
+							size_type index = static_cast< size_type >( ( k * h + j ) * w );
+							for( i = 0 ; i < w ; i++, index++ )
+							{
+								if( in[ index ] == 0 )
+								{
+									continue;
+								}
+
+								for( l = 0 ; l < neighbor::array_num ; l++ )
+								{
+									difference_type x = i + ox[ l ], y = j + oy[ l ], z = k + oz[ l ];
+									if( ( is_3d ? z : y ) == static_cast< difference_type >( begin_ ) - 1 && 0 <= x && x < w && 0 <= y && y < h && 0 <= z && in[ index + diff[ l ] ] != 0 )
+									{
+										merge_root( parent, index, static_cast< size_type >( index + diff[ l ] ) );
+									}
+								}
+							}
+						}
+					}
+				}
+				break;
+
+			case 2:
+				root_num_ = 0;
+				for( k = sz ; k < ez ; k++ )
+				{
+					for( j = sy ; j < ey ; j++ )
+					{
+						size_type index = static_cast< size_type >( ( k * h + j ) * w );
+						for( i = 0 ; i < w ; i++, index++ )
+						{
+							if( in[ index ] != 0 && find_root( parent, index ) == index )
+							{
+								root_num_++;
+							}
+						}
+					}
+				}
+				break;
+
+			case 3:
+				{
+					size_type label = label_offset_;
+					for( k = sz ; k < ez ; k++ )
+					{
+						for( j = sy ; j < ey ; j++ )
+						{
+							size_type index = static_cast< size_type >( ( k * h + j ) * w );
+							for( i = 0 ; i < w ; i++, index++ )
+							{
+								if( in[ index ] != 0 && parent[ index ] == index )
+								{
+									// o̓xlo̓f[^^̍ől𒴂ꍇ́Cől蓖Ă
+									label = label < label_max_ ? label + 1 : label_max_;
+									in[ index ] = static_cast< value_type >( label );
+									accumulator_( label, index, i, j, k );
+								}
+							}
+						}
+					}
+				}
+				break;
+
+			case 4:
+			default:
+				for( k = sz ; k < ez ; k++ )
+				{
+					for( j = sy ; j < ey ; j++ )
+					{
+						size_type index = static_cast< size_type >( ( k * h + j ) * w );
+						for( i = 0 ; i < w ; i++, index++ )
+						{
+							if( in[ index ] != 0 && parent[ index ] != index )
+							{
+								in[ index ] = in[ find_root( parent, index ) ];
+								accumulator_( static_cast< size_type >( in[ index ] ), index, i, j, k );
+							}
+						}
+					}
+				}
+				break;
+			}
+
+			return( true );
+		}
+	};
+
+
+	template < class Array, class neighbor, class Accumulator >
+	typename Array::size_type parallel_labeling( Array &in, typename Array::size_type label_max, const neighbor /* dmy */, Accumulator &accumulator, typename Array::size_type thread_num )
+	{
+		typedef typename Array::size_type size_type;
+		typedef parallel_labeling_thread< Array, neighbor, Accumulator > parallel_labeling_thread;
+
+		if( in.empty( ) )
+		{
+			accumulator.initialize( 0 );
+			return( 0 );
+		}
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+
+		// 3摜łZɁC2摜łYɕ
+		const size_type outer = in.depth( ) > 1 ? in.depth( ) : in.height( );
+		thread_num = thread_num < outer ? thread_num : outer;
+
+		size_t *parent = new size_t[ in.size( ) ];
+
+		parallel_labeling_thread *thread = new parallel_labeling_thread[ thread_num ];
+
+		size_type i, stage;
+		for( i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_parameters( in, parent, outer * i / thread_num, outer * ( i + 1 ) / thread_num, label_max );
+		}
+
+		// XủxOCXuԂ̓C̐グ
+		for( stage = 0 ; stage < 3 ; stage++ )
+		{
+			for( i = 0 ; i < thread_num ; i++ )
+			{
+				thread[ i ].setup_stage( stage );
+			}
+			do_threads_( thread, thread_num );
+		}
+
+		// eXuŊ蓖Ă郉x̊Jnԍ߁CɃx蓖Ă
+		size_type label_num = 0;
+		for( i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_stage( 3, label_num );
+			label_num += thread[ i ].root_num( );
+		}
+
+		label_num = label_num < label_max ? label_num : label_max;
+
+		accumulator.initialize( label_num );
+		for( i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].accumulator( ) = accumulator;
+		}
+
+		do_threads_( thread, thread_num );
+
+		for( i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_stage( 4 );
+		}
+		do_threads_( thread, thread_num );
+
+		// XbhɏWvʂ𓝍
+		for( i = 0 ; i < thread_num ; i++ )
+		{
+			accumulator.merge( thread[ i ].accumulator( ) );
+		}
+
+		delete [] thread;
+		delete [] parent;
+
+		return( label_num );
+	}
+
+	template < class Array, class neighbor >
+	inline typename Array::size_type parallel_labeling( Array &in, typename Array::size_type label_max, const neighbor dmy, typename Array::size_type thread_num )
+	{
+		null_accumulator accumulator;
+		return( parallel_labeling( in, label_max, dmy, accumulator, thread_num ) );
+	}
+
+	// 2lς݂̉摜 in ɃxOCA̓vʂ regions Ɋi[iregions[ l - 1 ] x l ɑΉj
+	template < class Array, class neighbor, class T >
+	typename Array::size_type parallel_labeling( Array &in, const neighbor dmy, const T *intensity, std::vector< region_statistics > &regions, typename Array::size_type thread_num )
+	{
+		typedef typename Array::size_type  size_type;
+		typedef typename Array::value_type value_type;
+
+		size_type max_label = is_float< value_type >::value ? type_limits< size_type >::maximum( ) : static_cast< size_type >( type_limits< value_type >::maximum( ) );
+
+		region_accumulator< T > accumulator( intensity );
+		size_type label_num = parallel_labeling( in, max_label, dmy, accumulator, thread_num );
+
+		regions.assign( accumulator.table.begin( ) + 1, accumulator.table.end( ) );
+
+		return( label_num );
+	}
+
+
+	// Ȃ傫r֐IuWFNgi傫ꍇ̓xԍ̏D悷j
+	struct region_size_greater
+	{
+		bool operator ()( const region_statistics &r1, const region_statistics &r2 ) const
+		{
+			return( r1.count > r2.count || ( r1.count == r2.count && r1.label < r2.label ) );
+		}
+	};
+
+
+	// keep[ l - 1 ]  true ̘Â݂cCɃxU蒼
+	template < class Array >
+	typename Array::size_type select_regions( Array &label, std::vector< region_statistics > &regions, const std::vector< bool > &keep )
+	{
+		typedef typename Array::size_type  size_type;
+		typedef typename Array::value_type value_type;
+
+		std::vector< size_type > table( regions.size( ) + 1, 0 );
+		std::vector< region_statistics > tmp;
+
+		size_type l;
+		for( l = 0 ; l < regions.size( ) ; l++ )
+		{
+			if( keep[ l ] )
+			{
+				tmp.push_back( regions[ l ] );
+				tmp.back( ).label = tmp.size( );
+				table[ regions[ l ].label ] = tmp.size( );
+			}
+		}
+
+		// vʂ͏Wvς݂̂߁C摜̓x̕tւ݂̂s
+		for( size_type i = 0 ; i < label.size( ) ; i++ )
+		{
+			size_type v = static_cast< size_type >( label[ i ] );
+			label[ i ] = static_cast< value_type >( v < table.size( ) ? table[ v ] : 0 );
+		}
+
+		regions.swap( tmp );
+
+		return( regions.size( ) );
+	}
+}
+
+
+
+
+//! @addtogroup labeling_group xO
+//!
+//! @code ̃wb_CN[h
+//! #include <mist/filter/labeling.h>
+//! @endcode
+//!
+//!  @{
+
+
+/// @brief 2摜ɑ΂4ߖT^xO
+//! 
+//! 2摜ɑ΂4ߖT^xO
+//! 
+//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+//! 
+//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKv
 //! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
 //! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
 //! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
@@ -567,10 +1075,10 @@ inline typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1,
 //! @return 蓖Ăꂽx
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2, class Functor >
-typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label, Functor f )
+typename array2< T2, Allocator2 >::size_type labeling4( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label, Functor f )
 {
-	typedef typename array3< T2, Allocator2 >::size_type  size_type;
-	typedef typename array3< T2, Allocator2 >::value_type value_type;
+	typedef typename array2< T2, Allocator2 >::size_type  size_type;
+	typedef typename array2< T2, Allocator2 >::value_type value_type;
 
 	if( max_label == 0 )
 	{
@@ -584,21 +1092,21 @@ typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Alloca
 		}
 	}
 
-	out.resize( in.size1( ), in.size2( ), in.size3( ) );
+	out.resize( in.size1( ), in.size2( ) );
 	out.reso1( in.reso1( ) );
 	out.reso2( in.reso2( ) );
-	out.reso3( in.reso3( ) );
 
 	for( size_type i = 0 ; i < in.size( ) ; i++ )
 	{
 		out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
 	}
-	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 6 >( ), f ) );
+	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 4 >( ), f ) );
 }
 
-/// @brief 3摜ɑ΂6ߖT^xO
+
+/// @brief 2摜ɑ΂4ߖT^xO
 //! 
-//! 3摜ɑ΂6ߖT^xO
+//! 2摜ɑ΂4ߖT^xO
 //! 
 //! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
 //! 
@@ -614,15 +1122,15 @@ typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Alloca
 //! @return 蓖Ăꂽx
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-inline typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num3< T2 >::value )
+typename array2< T2, Allocator2 >::size_type labeling4( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num2< T2 >::value )
 {
-	return( labeling6( in, out, max_label, __mist_dmy_callback__( ) ) );
+	return( labeling4( in, out, max_label, __mist_dmy_callback__( ) ) );
 }
 
 
-/// @brief 3摜ɑ΂18ߖT^xO
+/// @brief 2摜ɑ΂8ߖT^xO
 //! 
-//! 3摜ɑ΂18ߖT^xO
+//! 2摜ɑ΂8ߖT^xO
 //! 
 //! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
 //! 
@@ -639,10 +1147,10 @@ inline typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1,
 //! @return 蓖Ăꂽx
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2, class Functor >
-typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label, Functor f )
+typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label, Functor f )
 {
-	typedef typename array3< T2, Allocator2 >::size_type  size_type;
-	typedef typename array3< T2, Allocator2 >::value_type value_type;
+	typedef typename array2< T2, Allocator2 >::size_type  size_type;
+	typedef typename array2< T2, Allocator2 >::value_type value_type;
 
 	if( max_label == 0 )
 	{
@@ -656,21 +1164,21 @@ typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Alloc
 		}
 	}
 
-	out.resize( in.size1( ), in.size2( ), in.size3( ) );
+	out.resize( in.size1( ), in.size2( ) );
 	out.reso1( in.reso1( ) );
 	out.reso2( in.reso2( ) );
-	out.reso3( in.reso3( ) );
 
 	for( size_type i = 0 ; i < in.size( ) ; i++ )
 	{
 		out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
 	}
-	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 18 >( ), f ) );
+	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 8 >( ), f ) );
 }
 
-/// @brief 3摜ɑ΂18ߖT^xO
+
+/// @brief 2摜ɑ΂8ߖT^xO
 //! 
-//! 3摜ɑ΂18ߖT^xO
+//! 2摜ɑ΂8ߖT^xO
 //! 
 //! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
 //! 
@@ -686,15 +1194,15 @@ typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Alloc
 //! @return 蓖Ăꂽx
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-inline typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num3< T2 >::value )
+inline typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num2< T2 >::value )
 {
-	return( labeling18( in, out, max_label, __mist_dmy_callback__( ) ) );
+	return( labeling8( in, out, max_label, __mist_dmy_callback__( ) ) );
 }
 
 
-/// @brief 3摜ɑ΂26ߖT^xO
+/// @brief 3摜ɑ΂6ߖT^xO
 //! 
-//! 3摜ɑ΂26ߖT^xO
+//! 3摜ɑ΂6ߖT^xO
 //! 
 //! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
 //! 
@@ -711,7 +1219,7 @@ inline typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1
 //! @return 蓖Ăꂽx
 //! 
 template < class T1, class T2, class Allocator1, class Allocator2, class Functor >
-typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label, Functor f )
+typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label, Functor f )
 {
 	typedef typename array3< T2, Allocator2 >::size_type  size_type;
 	typedef typename array3< T2, Allocator2 >::value_type value_type;
@@ -737,13 +1245,12 @@ typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Alloc
 	{
 		out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
 	}
-	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 26 >( ), f ) );
+	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 6 >( ), f ) );
 }
 
-
-/// @brief 3摜ɑ΂26ߖT^xO
+/// @brief 3摜ɑ΂6ߖT^xO
 //! 
-//! 3摜ɑ΂26ߖT^xO
+//! 3摜ɑ΂6ߖT^xO
 //! 
 //! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
 //! 
@@ -756,55 +1263,200 @@ typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Alloc
 //! @param[out] out       c o͉摜
 //! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
 //! 
+//! @return 蓖Ăꂽx
+//! 
 template < class T1, class T2, class Allocator1, class Allocator2 >
-inline typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num3< T2 >::value )
+inline typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num3< T2 >::value )
 {
-	return( labeling26( in, out, max_label, __mist_dmy_callback__( ) ) );
+	return( labeling6( in, out, max_label, __mist_dmy_callback__( ) ) );
 }
 
 
-
-
-/// @brief ͈͓ł̍ő̃x𒊏o
+/// @brief 3摜ɑ΂18ߖT^xO
 //! 
-//! 2摜ɑ΂8ߖT^xOpāCőA𒊏o
+//! 3摜ɑ΂18ߖT^xO
 //! 
-//! @attention ͂Əo͂摜IuWFNgł삷
+//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+//! 
+//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
+//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
+//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
+//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
 //! 
 //! @param[in]  in        c ͉摜
 //! @param[out] out       c o͉摜
-//! @param[in]  sx        c X̏̈ʒu
-//! @param[in]  ex        c X̑傫̈ʒu
-//! @param[in]  sy        c Y̏̈ʒu
-//! @param[in]  ey        c Y̑傫̈ʒu
-//! @param[in]  max_label c őŊ蓖Ă郉x
+//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
+//! @param[in]  f         c is󋵂ԂR[obN֐
 //! 
-template < class T1,  class T2, class Allocator1, class Allocator2 >
-void maximum_region(
-						const array2< T1, Allocator1 > &in,
-						array2< T2, Allocator2 > &out,
-						typename array2< T1, Allocator1 >::size_type sx,
-						typename array2< T1, Allocator1 >::size_type ex,
-						typename array2< T1, Allocator1 >::size_type sy,
-						typename array2< T1, Allocator1 >::size_type ey,
-						typename array2< T1, Allocator1 >::size_type max_label = __labeling_controller__::default_label_num2< T2 >::value
-					)
+//! @return 蓖Ăꂽx
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2, class Functor >
+typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label, Functor f )
 {
-	typedef typename array2< T1, Allocator1 >::size_type size_type;
-	typedef typename array2< T1, Allocator1 >::difference_type difference_type;
-
-	array2< size_type > tmp;
-	size_type i, j;
-
-	size_type label_num = mist::labeling8( in, tmp, max_label );
-
-	// w肳ꂽ͈͓̍ő僉xT
-	sx = sx < 0 ? 0 : sx;
-	sy = sy < 0 ? 0 : sy;
-	sx = sx < in.width( )  ? sx : in.width( )  - 1;
-	sy = sy < in.height( ) ? sy : in.height( ) - 1;
+	typedef typename array3< T2, Allocator2 >::size_type  size_type;
+	typedef typename array3< T2, Allocator2 >::value_type value_type;
 
-	ex = ex < 0 ? 0 : ex;
+	if( max_label == 0 )
+	{
+		if( is_float< value_type >::value )
+		{
+			max_label = type_limits< size_type >::maximum( );
+		}
+		else
+		{
+			max_label = static_cast< size_type >( type_limits< value_type >::maximum( ) );
+		}
+	}
+
+	out.resize( in.size1( ), in.size2( ), in.size3( ) );
+	out.reso1( in.reso1( ) );
+	out.reso2( in.reso2( ) );
+	out.reso3( in.reso3( ) );
+
+	for( size_type i = 0 ; i < in.size( ) ; i++ )
+	{
+		out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+	}
+	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 18 >( ), f ) );
+}
+
+/// @brief 3摜ɑ΂18ߖT^xO
+//! 
+//! 3摜ɑ΂18ߖT^xO
+//! 
+//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+//! 
+//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
+//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
+//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
+//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
+//! 
+//! @param[in]  in        c ͉摜
+//! @param[out] out       c o͉摜
+//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
+//! 
+//! @return 蓖Ăꂽx
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+inline typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num3< T2 >::value )
+{
+	return( labeling18( in, out, max_label, __mist_dmy_callback__( ) ) );
+}
+
+
+/// @brief 3摜ɑ΂26ߖT^xO
+//! 
+//! 3摜ɑ΂26ߖT^xO
+//! 
+//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+//! 
+//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
+//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
+//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
+//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
+//! 
+//! @param[in]  in        c ͉摜
+//! @param[out] out       c o͉摜
+//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
+//! @param[in]  f         c is󋵂ԂR[obN֐
+//! 
+//! @return 蓖Ăꂽx
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2, class Functor >
+typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label, Functor f )
+{
+	typedef typename array3< T2, Allocator2 >::size_type  size_type;
+	typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+	if( max_label == 0 )
+	{
+		if( is_float< value_type >::value )
+		{
+			max_label = type_limits< size_type >::maximum( );
+		}
+		else
+		{
+			max_label = static_cast< size_type >( type_limits< value_type >::maximum( ) );
+		}
+	}
+
+	out.resize( in.size1( ), in.size2( ), in.size3( ) );
+	out.reso1( in.reso1( ) );
+	out.reso2( in.reso2( ) );
+	out.reso3( in.reso3( ) );
+
+	for( size_type i = 0 ; i < in.size( ) ; i++ )
+	{
+		out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+	}
+	return( __labeling_controller__::labeling( out, max_label, __labeling_controller__::neighbors< 26 >( ), f ) );
+}
+
+
+/// @brief 3摜ɑ΂26ߖT^xO
+//! 
+//! 3摜ɑ΂26ߖT^xO
+//! 
+//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+//! 
+//! Cf[^^ char ^𗘗pꍇ́CxI[o[t[Ȃ悤ɒӂKvȂ߁Cshort  int 𗘗p邱Ƃ߂܂D
+//! ŁCxƂ͍ŏIIɓ̈̐ł͂ȂCƒɔꎞIȃxw߁Cf[^^ char ̏ꍇɂ̓I[o[t[\ɑ傫Ȃ܂D
+//! ܂Cő僉x𒴂ꍇ͎Iɍő僉xXVD̂߁Cgpʂ\D
+//! l max_label 傫Ƃ邱ƂŃ̍Ċmۂ荂ɓ삷悤ɂȂîCʂjD
+//! 
+//! @param[in]  in        c ͉摜
+//! @param[out] out       c o͉摜
+//! @param[in]  max_label c őŊ蓖Ă郉x̃ftHgl
+//! 
+template < class T1, class T2, class Allocator1, class Allocator2 >
+inline typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type max_label = __labeling_controller__::default_label_num3< T2 >::value )
+{
+	return( labeling26( in, out, max_label, __mist_dmy_callback__( ) ) );
+}
+
+
+
+
+/// @brief ͈͓ł̍ő̃x𒊏o
+//! 
+//! 2摜ɑ΂8ߖT^xOpāCőA𒊏o
+//! 
+//! @attention ͂Əo͂摜IuWFNgł삷
+//! 
+//! @param[in]  in        c ͉摜
+//! @param[out] out       c o͉摜
+//! @param[in]  sx        c X̏̈ʒu
+//! @param[in]  ex        c X̑傫̈ʒu
+//! @param[in]  sy        c Y̏̈ʒu
+//! @param[in]  ey        c Y̑傫̈ʒu
+//! @param[in]  max_label c őŊ蓖Ă郉x
+//! 
+template < class T1,  class T2, class Allocator1, class Allocator2 >
+void maximum_region(
+						const array2< T1, Allocator1 > &in,
+						array2< T2, Allocator2 > &out,
+						typename array2< T1, Allocator1 >::size_type sx,
+						typename array2< T1, Allocator1 >::size_type ex,
+						typename array2< T1, Allocator1 >::size_type sy,
+						typename array2< T1, Allocator1 >::size_type ey,
+						typename array2< T1, Allocator1 >::size_type max_label = __labeling_controller__::default_label_num2< T2 >::value
+					)
+{
+	typedef typename array2< T1, Allocator1 >::size_type size_type;
+	typedef typename array2< T1, Allocator1 >::difference_type difference_type;
+
+	array2< size_type > tmp;
+	size_type i, j;
+
+	size_type label_num = mist::labeling8( in, tmp, max_label );
+
+	// w肳ꂽ͈͓̍ő僉xT
+	sx = sx < 0 ? 0 : sx;
+	sy = sy < 0 ? 0 : sy;
+	sx = sx < in.width( )  ? sx : in.width( )  - 1;
+	sy = sy < in.height( ) ? sy : in.height( ) - 1;
+
+	ex = ex < 0 ? 0 : ex;
 	ey = ey < 0 ? 0 : ey;
 	ex = ex < in.width( )  ? ex : in.width( )  - 1;
 	ey = ey < in.height( ) ? ey : in.height( ) - 1;
@@ -2411,6 +3063,652 @@ namespace he
 }
 
 
+namespace parallel
+{
+	/// @brief ł2摜ɑ΂4ߖT^xO
+	//! 
+	//! 摜ỸXuɕCeXu Union-Find pĕɃxOCXűEŘA𓝍
+	//! 蓖Ă郉x mist::labeling4 ƓiŐɌA 1, 2, ... Ɣԍtj
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention Ɨ̈Ƃĉf size_t ^̔zmۂ܂
+	//! @attention xo̓f[^^̍ől𒴂ꍇ́CAɂ͍ől蓖Ă܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array2< T2, Allocator2 >::size_type labeling4( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array2< T2, Allocator2 >::size_type  size_type;
+		typedef typename array2< T2, Allocator2 >::value_type value_type;
+
+		size_type max_label = is_float< value_type >::value ? type_limits< size_type >::maximum( ) : static_cast< size_type >( type_limits< value_type >::maximum( ) );
+
+		out.resize( in.size1( ), in.size2( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, max_label, __labeling_controller__::neighbors< 4 >( ), thread_num ) );
+	}
+
+
+	/// @brief ł2摜ɑ΂4ߖT^xOiA̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڋ`CfW̑aWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array2< T2, Allocator2 >::size_type labeling4( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array2< T2, Allocator2 >::size_type  size_type;
+		typedef typename array2< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 4 >( ), static_cast< const double * >( NULL ), regions, thread_num ) );
+	}
+
+
+	/// @brief ł2摜ɑ΂4ߖT^xOiA̓vʂƔZWl̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڋ`CfW̑aƁCZW摜 intensity ̔ZWl̑aEŏlEőlWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention ZW摜Ɠ͉摜̑傫قȂꍇ́C0Ԃ܂
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[in]  intensity  c vʂWvZW摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class T3, class Allocator1, class Allocator2, class Allocator3 >
+	typename array2< T2, Allocator2 >::size_type labeling4( const array2< T1, Allocator1 > &in, const array2< T3, Allocator3 > &intensity, array2< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		if( in.width( ) != intensity.width( ) || in.height( ) != intensity.height( ) )
+		{
+			regions.clear( );
+			return( 0 );
+		}
+		else if( in.empty( ) )
+		{
+			return( labeling4( in, out, regions, thread_num ) );
+		}
+
+		typedef typename array2< T2, Allocator2 >::size_type  size_type;
+		typedef typename array2< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 4 >( ), &intensity[ 0 ], regions, thread_num ) );
+	}
+
+
+	/// @brief ł2摜ɑ΂8ߖT^xO
+	//! 
+	//! 摜ỸXuɕCeXu Union-Find pĕɃxOCXűEŘA𓝍
+	//! 蓖Ă郉x mist::labeling8 ƓiŐɌA 1, 2, ... Ɣԍtj
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention Ɨ̈Ƃĉf size_t ^̔zmۂ܂
+	//! @attention xo̓f[^^̍ől𒴂ꍇ́CAɂ͍ől蓖Ă܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array2< T2, Allocator2 >::size_type  size_type;
+		typedef typename array2< T2, Allocator2 >::value_type value_type;
+
+		size_type max_label = is_float< value_type >::value ? type_limits< size_type >::maximum( ) : static_cast< size_type >( type_limits< value_type >::maximum( ) );
+
+		out.resize( in.size1( ), in.size2( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, max_label, __labeling_controller__::neighbors< 8 >( ), thread_num ) );
+	}
+
+
+	/// @brief ł2摜ɑ΂8ߖT^xOiA̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڋ`CfW̑aWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1, Allocator1 > &in, array2< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array2< T2, Allocator2 >::size_type  size_type;
+		typedef typename array2< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 8 >( ), static_cast< const double * >( NULL ), regions, thread_num ) );
+	}
+
+
+	/// @brief ł2摜ɑ΂8ߖT^xOiA̓vʂƔZWl̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڋ`CfW̑aƁCZW摜 intensity ̔ZWl̑aEŏlEőlWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention ZW摜Ɠ͉摜̑傫قȂꍇ́C0Ԃ܂
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[in]  intensity  c vʂWvZW摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class T3, class Allocator1, class Allocator2, class Allocator3 >
+	typename array2< T2, Allocator2 >::size_type labeling8( const array2< T1, Allocator1 > &in, const array2< T3, Allocator3 > &intensity, array2< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array2< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		if( in.width( ) != intensity.width( ) || in.height( ) != intensity.height( ) )
+		{
+			regions.clear( );
+			return( 0 );
+		}
+		else if( in.empty( ) )
+		{
+			return( labeling8( in, out, regions, thread_num ) );
+		}
+
+		typedef typename array2< T2, Allocator2 >::size_type  size_type;
+		typedef typename array2< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 8 >( ), &intensity[ 0 ], regions, thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂6ߖT^xO
+	//! 
+	//! 摜Z̃XuɕCeXu Union-Find pĕɃxOCXűEŘA𓝍
+	//! 蓖Ă郉x mist::labeling6 ƓiŐɌA 1, 2, ... Ɣԍtj
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention Ɨ̈Ƃĉf size_t ^̔zmۂ܂
+	//! @attention xo̓f[^^̍ől𒴂ꍇ́CAɂ͍ől蓖Ă܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		size_type max_label = is_float< value_type >::value ? type_limits< size_type >::maximum( ) : static_cast< size_type >( type_limits< value_type >::maximum( ) );
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, max_label, __labeling_controller__::neighbors< 6 >( ), thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂6ߖT^xOiA̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڒ́CfW̑aWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 6 >( ), static_cast< const double * >( NULL ), regions, thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂6ߖT^xOiA̓vʂƔZWl̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڒ́CfW̑aƁCZW摜 intensity ̔ZWl̑aEŏlEőlWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention ZW摜Ɠ͉摜̑傫قȂꍇ́C0Ԃ܂
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[in]  intensity  c vʂWvZW摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class T3, class Allocator1, class Allocator2, class Allocator3 >
+	typename array3< T2, Allocator2 >::size_type labeling6( const array3< T1, Allocator1 > &in, const array3< T3, Allocator3 > &intensity, array3< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		if( in.width( ) != intensity.width( ) || in.height( ) != intensity.height( ) || in.depth( ) != intensity.depth( ) )
+		{
+			regions.clear( );
+			return( 0 );
+		}
+		else if( in.empty( ) )
+		{
+			return( labeling6( in, out, regions, thread_num ) );
+		}
+
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 6 >( ), &intensity[ 0 ], regions, thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂18ߖT^xO
+	//! 
+	//! 摜Z̃XuɕCeXu Union-Find pĕɃxOCXűEŘA𓝍
+	//! 蓖Ă郉x mist::labeling18 ƓiŐɌA 1, 2, ... Ɣԍtj
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention Ɨ̈Ƃĉf size_t ^̔zmۂ܂
+	//! @attention xo̓f[^^̍ől𒴂ꍇ́CAɂ͍ől蓖Ă܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		size_type max_label = is_float< value_type >::value ? type_limits< size_type >::maximum( ) : static_cast< size_type >( type_limits< value_type >::maximum( ) );
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, max_label, __labeling_controller__::neighbors< 18 >( ), thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂18ߖT^xOiA̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڒ́CfW̑aWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 18 >( ), static_cast< const double * >( NULL ), regions, thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂18ߖT^xOiA̓vʂƔZWl̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڒ́CfW̑aƁCZW摜 intensity ̔ZWl̑aEŏlEőlWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention ZW摜Ɠ͉摜̑傫قȂꍇ́C0Ԃ܂
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[in]  intensity  c vʂWvZW摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class T3, class Allocator1, class Allocator2, class Allocator3 >
+	typename array3< T2, Allocator2 >::size_type labeling18( const array3< T1, Allocator1 > &in, const array3< T3, Allocator3 > &intensity, array3< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		if( in.width( ) != intensity.width( ) || in.height( ) != intensity.height( ) || in.depth( ) != intensity.depth( ) )
+		{
+			regions.clear( );
+			return( 0 );
+		}
+		else if( in.empty( ) )
+		{
+			return( labeling18( in, out, regions, thread_num ) );
+		}
+
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 18 >( ), &intensity[ 0 ], regions, thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂26ߖT^xO
+	//! 
+	//! 摜Z̃XuɕCeXu Union-Find pĕɃxOCXűEŘA𓝍
+	//! 蓖Ă郉x mist::labeling26 ƓiŐɌA 1, 2, ... Ɣԍtj
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention Ɨ̈Ƃĉf size_t ^̔zmۂ܂
+	//! @attention xo̓f[^^̍ől𒴂ꍇ́CAɂ͍ől蓖Ă܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		size_type max_label = is_float< value_type >::value ? type_limits< size_type >::maximum( ) : static_cast< size_type >( type_limits< value_type >::maximum( ) );
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, max_label, __labeling_controller__::neighbors< 26 >( ), thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂26ߖT^xOiA̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڒ́CfW̑aWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class Allocator1, class Allocator2 >
+	typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 26 >( ), static_cast< const double * >( NULL ), regions, thread_num ) );
+	}
+
+
+	/// @brief ł3摜ɑ΂26ߖT^xOiA̓vʂƔZWl̓vʂ𓯎ɏWvj
+	//! 
+	//! x̊蓖ĂƓɁCeẢfCOڒ́CfW̑aƁCZW摜 intensity ̔ZWl̑aEŏlEőlWv
+	//! regions[ l - 1 ] Ƀx l ̘A̓vʂi[
+	//! 
+	//! @attention ͂Əo͂摜IuWFNgłxO邱Ƃ\ł
+	//! @attention ZW摜Ɠ͉摜̑傫قȂꍇ́C0Ԃ܂
+	//! @attention XbhɃx̏Wvpe[umۂ܂
+	//! 
+	//! @param[in]  in         c ͉摜
+	//! @param[in]  intensity  c vʂWvZW摜
+	//! @param[out] out        c o͉摜
+	//! @param[out] regions    c A̓v
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	template < class T1, class T2, class T3, class Allocator1, class Allocator2, class Allocator3 >
+	typename array3< T2, Allocator2 >::size_type labeling26( const array3< T1, Allocator1 > &in, const array3< T3, Allocator3 > &intensity, array3< T2, Allocator2 > &out, std::vector< region_statistics > &regions, typename array3< T2, Allocator2 >::size_type thread_num = 0 )
+	{
+		if( in.width( ) != intensity.width( ) || in.height( ) != intensity.height( ) || in.depth( ) != intensity.depth( ) )
+		{
+			regions.clear( );
+			return( 0 );
+		}
+		else if( in.empty( ) )
+		{
+			return( labeling26( in, out, regions, thread_num ) );
+		}
+
+		typedef typename array3< T2, Allocator2 >::size_type  size_type;
+		typedef typename array3< T2, Allocator2 >::value_type value_type;
+
+		out.resize( in.size1( ), in.size2( ), in.size3( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
+		}
+
+		return( __labeling_controller__::parallel_labeling( out, __labeling_controller__::neighbors< 26 >( ), &intensity[ 0 ], regions, thread_num ) );
+	}
+}
+
+/// @brief vʕt̃xOʂCf min_count ̘A菜
+//! 
+//! xOɏWvvʂp邽߁CȂ傫𐔂ƂȂCx̕tւ݂̂s
+//! cAɂ́C̃x 1, 2, ... ƐU蒼x蓖ĂCregions ɋl߂
+//! 
+//! @param[in,out] label     c mist::parallel::labeling* œꂽx摜
+//! @param[in,out] regions   c mist::parallel::labeling* œꂽA̓v
+//! @param[in]     min_count c cA̍ŏ̉f
+//! 
+//! @return cA̐
+//! 
+template < class Array >
+typename Array::size_type remove_small_regions( Array &label, std::vector< region_statistics > &regions, typename Array::size_type min_count )
+{
+	std::vector< bool > keep( regions.size( ) );
+	for( size_t l = 0 ; l < regions.size( ) ; l++ )
+	{
+		keep[ l ] = regions[ l ].count >= min_count;
+	}
+
+	return( __labeling_controller__::select_regions( label, regions, keep ) );
+}
+
+
+/// @brief vʕt̃xOʂCf̑傫 num ̘Â݂c
+//! 
+//! xOɏWvvʂp邽߁CȂ傫𐔂ƂȂCx̕tւ݂̂s
+//! cAɂ́C̃x 1, 2, ... ƐU蒼x蓖ĂCregions ɋl߂
+//! 
+//! @attention fAꍇ́Cxԍ̏D悵Ďc
+//! 
+//! @param[in,out] label   c mist::parallel::labeling* œꂽx摜
+//! @param[in,out] regions c mist::parallel::labeling* œꂽA̓v
+//! @param[in]     num     c cA̐
+//! 
+//! @return cA̐
+//! 
+template < class Array >
+typename Array::size_type keep_largest_regions( Array &label, std::vector< region_statistics > &regions, typename Array::size_type num )
+{
+	std::vector< region_statistics > tmp( regions );
+	std::vector< bool > keep( regions.size( ), false );
+
+	num = num < tmp.size( ) ? num : tmp.size( );
+	std::partial_sort( tmp.begin( ), tmp.begin( ) + num, tmp.end( ), __labeling_controller__::region_size_greater( ) );
+
+	for( size_t l = 0 ; l < num ; l++ )
+	{
+		keep[ tmp[ l ].label - 1 ] = true;
+	}
+
+	return( __labeling_controller__::select_regions( label, regions, keep ) );
+}
+
+
 /// @}
 //  xOO[v̏I
 
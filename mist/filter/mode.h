@@ -28,7 +28,7 @@
 
 /// @file mist/filter/mode.h
 //!
-//! @brief ẻ摜ɑΉCCӂ̍\vfɑΉQl摜ɑ΂ŕpltB^itB^js߂̃Cu
+//! @brief ẻ摜ɑΉCCӂ̍\vfɑΉQl摜ёlx摜ɑ΂ŕpltB^itB^js߂̃Cu
 //!
 //! @attention \vf̌`͓ʌ`łȂĂ͂ȂȂ
 //!
@@ -52,6 +52,7 @@
 
 #include <vector>
 #include <cmath>
+#include <algorithm>
 
 
 // mistOԂ̎n܂
@@ -617,6 +618,186 @@ namespace __mode__
 			}
 		}
 	}
+
+
+	// lx摜̍ŕplp萔ԂŒǐՂ邽߂̃qXgO
+	// pxxpxƂ̑oXgŊǗCőpx̃Xg̐擪ŕplƂ
+	// x num ƓCfbNX͉摜̊O\Cpxɂ͐Ȃ
+	class label_histogram
+	{
+	public:
+		typedef size_t size_type;
+
+	private:
+		size_type num_;
+		size_type max_;
+		std::vector< size_type > count_;
+		std::vector< size_type > prev_;
+		std::vector< size_type > next_;
+		std::vector< size_type > head_;
+
+	public:
+		label_histogram( size_type num, size_type window ) : num_( num ), max_( 0 ), count_( num, 0 ), prev_( num, num ), next_( num, num ), head_( window + 1, num )
+		{
+		}
+
+		void add( size_type l )
+		{
+			if( l < num_ )
+			{
+				size_type c = count_[ l ];
+				if( c > 0 )
+				{
+					unlink( l, c );
+				}
+
+				count_[ l ] = ++c;
+				link( l, c );
+
+				if( c > max_ )
+				{
+					max_ = c;
+				}
+			}
+		}
+
+		void remove( size_type l )
+		{
+			if( l < num_ )
+			{
+				size_type c = count_[ l ];
+				unlink( l, c );
+
+				count_[ l ] = --c;
+				if( c > 0 )
+				{
+					link( l, c );
+				}
+
+				while( max_ > 0 && head_[ max_ ] == num_ )
+				{
+					max_--;
+				}
+			}
+		}
+
+		// ډf̃xőpxƓ̏ꍇ́Cډf̃xD悷
+		size_type mode( size_type l ) const
+		{
+			if( max_ == 0 || ( l < num_ && count_[ l ] == max_ ) )
+			{
+				return( l );
+			}
+			else
+			{
+				return( head_[ max_ ] );
+			}
+		}
+
+	private:
+		void link( size_type l, size_type c )
+		{
+			size_type n = head_[ c ];
+			prev_[ l ] = num_;
+			next_[ l ] = n;
+			if( n != num_ )
+			{
+				prev_[ n ] = l;
+			}
+			head_[ c ] = l;
+		}
+
+		void unlink( size_type l, size_type c )
+		{
+			size_type p = prev_[ l ];
+			size_type n = next_[ l ];
+			if( p != num_ )
+			{
+				next_[ p ] = n;
+			}
+			else
+			{
+				head_[ c ] = n;
+			}
+			if( n != num_ )
+			{
+				prev_[ n ] = p;
+			}
+		}
+	};
+
+	// in    : xqXgÕCfbNXɕϊ摜i摜̊O̓xj
+	// out   : o͉摜
+	// table : CfbNXo͉flւ̕ϊe[u
+	template < class Array1, class Array2, class Functor >
+	void label_mode( const Array1 &in, Array2 &out, const std::vector< typename Array2::value_type > &table,
+						const std::vector< ptrdiff_t > &object, const std::vector< ptrdiff_t > &update_in, const std::vector< ptrdiff_t > &update_out,
+						typename Array1::size_type thread_idy, typename Array1::size_type thread_numy,
+						typename Array1::size_type thread_idz, typename Array1::size_type thread_numz, Functor f )
+	{
+		typedef typename Array1::size_type       size_type;
+		typedef typename Array1::const_pointer   const_pointer;
+		typedef std::vector< ptrdiff_t >		 list_type;
+		typedef list_type::const_iterator        const_iterator;
+
+		size_type w = in.width( );
+		size_type h = in.height( );
+		size_type d = in.depth( );
+
+		const bool bprogress1 = thread_idy == 0 && d == 1;
+		const bool bprogress2 = thread_idz == 0 && d > 1;
+
+		label_histogram hist( table.size( ), object.size( ) );
+
+		for( size_type k = thread_idz ; k < d ; k += thread_numz )
+		{
+			for( size_type j = thread_idy ; j < h ; j += thread_numy )
+			{
+				const_pointer p = &in( 0, j, k );
+				for( const_iterator ite = object.begin( ) ; ite != object.end( ) ; ++ite )
+				{
+					hist.add( p[ *ite ] );
+				}
+
+				out( 0, j, k ) = table[ hist.mode( p[ 0 ] ) ];
+
+				for( size_type i = 1 ; i < w ; i++ )
+				{
+					p = &in( i, j, k );
+
+					// \vf甲Z
+					for( const_iterator ite = update_out.begin( ) ; ite != update_out.end( ) ; ++ite )
+					{
+						hist.remove( p[ *ite ] );
+					}
+
+					// \vfɐV
+					for( const_iterator ite = update_in.begin( ) ; ite != update_in.end( ) ; ++ite )
+					{
+						hist.add( p[ *ite ] );
+					}
+
+					out( i, j, k ) = table[ hist.mode( p[ 0 ] ) ];
+				}
+
+				// qXgOŜɍςނ悤Cs̍\vf̉f菜ċɖ߂
+				for( const_iterator ite = object.begin( ) ; ite != object.end( ) ; ++ite )
+				{
+					hist.remove( p[ *ite ] );
+				}
+
+				if( bprogress1 )
+				{
+					f( static_cast< double >( j + 1 ) / static_cast< double >( h ) * 100.0 );
+				}
+			}
+
+			if( bprogress2 )
+			{
+				f( static_cast< double >( k + 1 ) / static_cast< double >( d ) * 100.0 );
+			}
+		}
+	}
 }
 
 
@@ -730,6 +911,151 @@ namespace __mode_controller__
 			return( true );
 		}
 	};
+
+
+	template < class T1, class Allocator1, class T2, class Allocator2, class Functor >
+	void label_mode( const marray< array2< T1, Allocator1 > > &in, array2< T2, Allocator2 > &out, const std::vector< T2 > &table,
+						const std::vector< ptrdiff_t > &object, const std::vector< ptrdiff_t > &update_in, const std::vector< ptrdiff_t > &update_out,
+						typename array2< T1, Allocator1 >::size_type thread_id, typename array2< T1, Allocator1 >::size_type thread_num, Functor f )
+	{
+		__mode__::label_mode( in, out, table, object, update_in, update_out, thread_id, thread_num, 0, 1, f );
+	}
+
+	template < class T1, class Allocator1, class T2, class Allocator2, class Functor >
+	void label_mode( const marray< array3< T1, Allocator1 > > &in, array3< T2, Allocator2 > &out, const std::vector< T2 > &table,
+						const std::vector< ptrdiff_t > &object, const std::vector< ptrdiff_t > &update_in, const std::vector< ptrdiff_t > &update_out,
+						typename array3< T1, Allocator1 >::size_type thread_id, typename array3< T1, Allocator1 >::size_type thread_num, Functor f )
+	{
+		__mode__::label_mode( in, out, table, object, update_in, update_out, 0, 1, thread_id, thread_num, f );
+	}
+
+
+	// flqXgÕCfbNXɕϊ
+	// ^Œl͈̔͂ꍇ͉fl璼ڃCfbNX߁C
+	// ȊȌꍇĩx摜Ȃǁj͉摜Ɍl݂̂ŃqXgO\
+	template < class Array1, class Array2 >
+	void create_label_index( const Array1 &in, Array2 &index, std::vector< typename Array1::value_type > &table )
+	{
+		typedef typename Array1::size_type  size_type;
+		typedef typename Array1::value_type value_type;
+		typedef typename Array2::value_type index_type;
+
+		value_type min = in[ 0 ];
+		value_type max = in[ 0 ];
+		for( size_type i = 1 ; i < in.size( ) ; i++ )
+		{
+			if( in[ i ] < min )
+			{
+				min = in[ i ];
+			}
+			else if( in[ i ] > max )
+			{
+				max = in[ i ];
+			}
+		}
+
+		if( is_integer< value_type >::value && static_cast< double >( max ) - static_cast< double >( min ) < 65536.0 )
+		{
+			table.resize( static_cast< size_type >( max - min ) + 1 );
+			for( size_type i = 0 ; i < table.size( ) ; i++ )
+			{
+				table[ i ] = static_cast< value_type >( min + i );
+			}
+
+			for( size_type i = 0 ; i < in.size( ) ; i++ )
+			{
+				index[ i ] = static_cast< index_type >( in[ i ] - min );
+			}
+		}
+		else
+		{
+			table.assign( in.begin( ), in.end( ) );
+			std::sort( table.begin( ), table.end( ) );
+			table.erase( std::unique( table.begin( ), table.end( ) ), table.end( ) );
+
+			for( size_type i = 0 ; i < in.size( ) ; i++ )
+			{
+				index[ i ] = static_cast< index_type >( std::lower_bound( table.begin( ), table.end( ), in[ i ] ) - table.begin( ) );
+			}
+		}
+	}
+
+
+	template < class T1, class T2, class Functor >
+	class label_mode_thread : public mist::thread< label_mode_thread< T1, T2, Functor > >
+	{
+	public:
+		typedef mist::thread< label_mode_thread< T1, T2, Functor > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef typename T1::size_type size_type;
+		typedef typename T1::difference_type difference_type;
+		typedef typename T2::value_type value_type;
+		typedef std::vector< difference_type >  list_type;
+		typedef std::vector< value_type >  table_type;
+
+	private:
+		size_t thread_id_;
+		size_t thread_num_;
+
+		// o͗p̉摜ւ̃|C^
+		const T1 *in_;
+		T2 *out_;
+		const table_type *table_;
+		list_type *object_;
+		list_type *update_in_;
+		list_type *update_out_;
+
+		Functor f_;
+
+	public:
+		void setup_parameters( const T1 &in, T2 &out, const table_type &table, list_type &object, list_type &update_in, list_type &update_out, size_type thread_id, size_type thread_num, Functor f )
+		{
+			in_  = &in;
+			out_ = &out;
+			table_ = &table;
+			object_ = &object;
+			update_in_ = &update_in;
+			update_out_ = &update_out;
+			thread_id_ = thread_id;
+			thread_num_ = thread_num;
+			f_ = f;
+		}
+
+		const label_mode_thread& operator =( const label_mode_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				thread_id_ = p.thread_id_;
+				thread_num_ = p.thread_num_;
+				in_ = p.in_;
+				out_ = p.out_;
+				table_ = p.table_;
+				object_ = p.object_;
+				update_in_ = p.update_in_;
+				update_out_ = p.update_out_;
+				f_ = p.f_;
+			}
+			return( *this );
+		}
+
+		label_mode_thread( size_type id = 0, size_type num = 1 ) : thread_id_( id ), thread_num_( num ),
+													in_( NULL ), out_( NULL ), table_( NULL ), object_( NULL ), update_in_( NULL ),  update_out_( NULL )
+		{
+		}
+		label_mode_thread( const label_mode_thread &p ) : base( p ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ ),
+												in_( p.in_ ), out_( p.out_ ), table_( p.table_ ), object_( p.object_ ), update_in_( p.update_in_ ), update_out_( p.update_out_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			label_mode( *in_, *out_, *table_, *object_, *update_in_, *update_out_, thread_id_, thread_num_, f_ );
+			return( true );
+		}
+	};
 }
 
 
@@ -980,6 +1306,266 @@ inline bool mode( array3< T, Allocator > &in, double radius, typename array3< T,
 
 
 
+
+
+/// @brief Cӂ̍\vfɑΉlx摜̍ŕpltB^
+//! 
+//! lx摜̊efC\vfōł郉xɒuD
+//! \vf̈ړɔďo肷f݂̂ŃqXgOXVCŕpl͏p萔Ԃŋ߂D
+//! fl͈̔͂Lꍇ́C摜Ɍl݂̂ŃqXgO\D
+//! őpx̃xꍇ́Cډf̃xD悷D摜̊O͕pxɐȂD
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] s          c ŕpltB^ɗp\vf
+//! @param[in] f          c is󋵂ԂR[obN֐
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator, class Functor >
+bool label_mode( array2< T, Allocator > &in, const mode_filter::mode_structure &s, Functor f, typename array2< T, Allocator >::size_type thread_num )
+{
+	if( in.empty( ) )
+	{
+		return( false );
+	}
+
+	typedef typename array2< T, Allocator >::value_type       value_type;
+	typedef typename array2< T, Allocator >::size_type        size_type;
+	typedef typename array2< T, Allocator >::difference_type  difference_type;
+	typedef array2< unsigned int > index_image_type;
+	typedef __mode_controller__::label_mode_thread< marray< index_image_type >, array2< T, Allocator >, Functor > label_mode_thread;
+	typedef std::vector< difference_type >  list_type;
+
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
+	std::vector< value_type > table;
+	marray< index_image_type > index;
+
+	{
+		index_image_type tmp( in.width( ), in.height( ) );
+		__mode_controller__::create_label_index( in, tmp, table );
+		index = marray< index_image_type >( tmp, s.margin_x, s.margin_y, static_cast< unsigned int >( table.size( ) ) );
+	}
+
+	list_type object     = mode_filter::create_pointer_diff_list( index, s.object );
+	list_type update_in  = mode_filter::create_pointer_diff_list( index, s.update_in );
+	list_type update_out = mode_filter::create_pointer_diff_list( index, s.update_out );
+
+	label_mode_thread *thread = new label_mode_thread[ thread_num ];
+
+	for( size_type i = 0 ; i < thread_num ; i++ )
+	{
+		thread[ i ].setup_parameters( index, in, table, object, update_in, update_out, i, thread_num, f );
+	}
+
+	f( 0.0 );
+
+	// XbhsāCI܂őҋ@
+	do_threads_( thread, thread_num );
+
+	f( 100.1 );
+
+	delete [] thread;
+
+	return( true );
+}
+
+
+/// @brief Cӂ̍\vfɑΉlx摜̍ŕpltB^
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] s          c ŕpltB^ɗp\vf
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator >
+bool label_mode( array2< T, Allocator > &in, const mode_filter::mode_structure &s, typename array2< T, Allocator >::size_type thread_num = 0 )
+{
+	return( label_mode( in, s, __mist_dmy_callback__( ), thread_num ) );
+}
+
+
+/// @brief ~\vfƂ鑽lx摜̍ŕpltB^
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] radius     c ~̔aiPʂ͉fj
+//! @param[in] f          c is󋵂ԂR[obN֐
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator, class Functor >
+inline bool label_mode( array2< T, Allocator > &in, double radius, Functor f, typename array2< T, Allocator >::size_type thread_num )
+{
+	return( label_mode( in, mode_filter::circle( radius, in.reso1( ), in.reso2( ) ), f, thread_num ) );
+}
+
+
+/// @brief ~\vfƂ鑽lx摜̍ŕpltB^
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] radius     c ~̔aiPʂ͉fj
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator >
+inline bool label_mode( array2< T, Allocator > &in, double radius, typename array2< T, Allocator >::size_type thread_num = 0 )
+{
+	return( label_mode( in, mode_filter::circle( radius, in.reso1( ), in.reso2( ) ), __mist_dmy_callback__( ), thread_num ) );
+}
+
+
+
+/// @brief Cӂ̍\vfɑΉlx摜̍ŕpltB^
+//! 
+//! lx摜̊efC\vfōł郉xɒuD
+//! \vf̈ړɔďo肷f݂̂ŃqXgOXVCŕpl͏p萔Ԃŋ߂D
+//! fl͈̔͂Lꍇ́C摜Ɍl݂̂ŃqXgO\D
+//! őpx̃xꍇ́Cډf̃xD悷D摜̊O͕pxɐȂD
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] s          c ŕpltB^ɗp\vf
+//! @param[in] f          c is󋵂ԂR[obN֐
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator, class Functor >
+bool label_mode( array3< T, Allocator > &in, const mode_filter::mode_structure &s, Functor f, typename array3< T, Allocator >::size_type thread_num )
+{
+	if( in.empty( ) )
+	{
+		return( false );
+	}
+
+	typedef typename array3< T, Allocator >::value_type       value_type;
+	typedef typename array3< T, Allocator >::size_type        size_type;
+	typedef typename array3< T, Allocator >::difference_type  difference_type;
+	typedef array3< unsigned int > index_image_type;
+	typedef __mode_controller__::label_mode_thread< marray< index_image_type >, array3< T, Allocator >, Functor > label_mode_thread;
+	typedef std::vector< difference_type >  list_type;
+
+	if( thread_num == 0 )
+	{
+		thread_num = static_cast< size_type >( get_cpu_num( ) );
+	}
+
+	std::vector< value_type > table;
+	marray< index_image_type > index;
+
+	{
+		index_image_type tmp( in.width( ), in.height( ), in.depth( ) );
+		__mode_controller__::create_label_index( in, tmp, table );
+		index = marray< index_image_type >( tmp, s.margin_x, s.margin_y, s.margin_z, static_cast< unsigned int >( table.size( ) ) );
+	}
+
+	list_type object     = mode_filter::create_pointer_diff_list( index, s.object );
+	list_type update_in  = mode_filter::create_pointer_diff_list( index, s.update_in );
+	list_type update_out = mode_filter::create_pointer_diff_list( index, s.update_out );
+
+	label_mode_thread *thread = new label_mode_thread[ thread_num ];
+
+	for( size_type i = 0 ; i < thread_num ; i++ )
+	{
+		thread[ i ].setup_parameters( index, in, table, object, update_in, update_out, i, thread_num, f );
+	}
+
+	f( 0.0 );
+
+	// XbhsāCI܂őҋ@
+	do_threads_( thread, thread_num );
+
+	f( 100.1 );
+
+	delete [] thread;
+
+	return( true );
+}
+
+
+/// @brief Cӂ̍\vfɑΉlx摜̍ŕpltB^
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] s          c ŕpltB^ɗp\vf
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator >
+bool label_mode( array3< T, Allocator > &in, const mode_filter::mode_structure &s, typename array3< T, Allocator >::size_type thread_num = 0 )
+{
+	return( label_mode( in, s, __mist_dmy_callback__( ), thread_num ) );
+}
+
+
+/// @brief \vfƂ鑽lx摜̍ŕpltB^
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] radius     c ̔aiPʂ͉fj
+//! @param[in] f          c is󋵂ԂR[obN֐
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator, class Functor >
+inline bool label_mode( array3< T, Allocator > &in, double radius, Functor f, typename array3< T, Allocator >::size_type thread_num )
+{
+	return( label_mode( in, mode_filter::sphere( radius, in.reso1( ), in.reso2( ), in.reso3( ) ), f, thread_num ) );
+}
+
+
+/// @brief \vfƂ鑽lx摜̍ŕpltB^
+//! 
+//! @attention ͂Əo͂́CMISTReiIuWFNggp
+//! @attention CPU0w肵ꍇ́Cgp\CPUIɎ擾
+//! 
+//! @param[in,out] in     c o͉摜
+//! @param[in] radius     c ̔aiPʂ͉fj
+//! @param[in] thread_num c gpXbh
+//! 
+//! @retval true  c tB^Oɐ
+//! @retval false c ͉摜̏ꍇ
+//! 
+template < class T, class Allocator >
+inline bool label_mode( array3< T, Allocator > &in, double radius, typename array3< T, Allocator >::size_type thread_num = 0 )
+{
+	return( label_mode( in, mode_filter::sphere( radius, in.reso1( ), in.reso2( ), in.reso3( ) ), __mist_dmy_callback__( ), thread_num ) );
+}
+
 /// @}
 //  ŕpltB^O[v̏I
 
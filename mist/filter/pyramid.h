@@ -0,0 +1,594 @@
+// 
+// Copyright (c) 2003-2011, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+/// @file mist/filter/pyramid.h
+//!
+//! @brief 摜̑d𑜓xs~bhiKEVAEvVAj߂̃Cu
+//!
+
+#ifndef __INCLUDE_MIST_PYRAMID__
+#define __INCLUDE_MIST_PYRAMID__
+
+
+#ifndef __INCLUDE_MIST_H__
+#include "../mist.h"
+#endif
+
+// J[摜̐ݒǂݍ
+#ifndef __INCLUDE_MIST_COLOR_H__
+#include "../config/color.h"
+#endif
+
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+
+#ifndef __INCLUDE_FILTER_LINEAR_FILTER_H__
+#include "linear.h"
+#endif
+
+#include <vector>
+
+
+
+// mistOԂ̎n܂
+_MIST_BEGIN
+
+
+namespace __pyramid__
+{
+	typedef size_t    size_type;
+	typedef ptrdiff_t difference_type;
+
+	// [ł͐܂ԂʒủfQƂi[̉f͏dȂj
+	inline difference_type mirror( difference_type i, difference_type n )
+	{
+		if( n == 1 )
+		{
+			return( 0 );
+		}
+
+		while( i < 0 || i >= n )
+		{
+			i = i < 0 ? -i : 2 * n - 2 - i;
+		}
+
+		return( i );
+	}
+
+	// g厞ɎQƂe𑜓x̉fʒuiׂ𑜓xŐ܂ԂʒuɑΉj
+	inline difference_type coarse_index( difference_type j, difference_type n, difference_type m )
+	{
+		if( j < 0 )
+		{
+			j = -j;
+		}
+		else if( j >= n )
+		{
+			j = ( m % 2 == 1 ) ? 2 * n - 2 - j : 2 * n - 1 - j;
+		}
+
+		return( j < 0 ? 0 : ( j >= n ? n - 1 : j ) );
+	}
+
+	// 񍀌W [ 1 4 6 4 1 ] / 16 ŕȂ 1/2 ɏk
+	template < class T1, class T2 >
+	void reduce_line( const T1 *src, difference_type sstep, size_type n, T2 *dst, difference_type dstep, size_type m )
+	{
+		typedef __linear__::__promote_pixel_converter_< T1 > converter1;
+		typedef __linear__::__promote_pixel_converter_< T2 > converter2;
+
+		const difference_type len = static_cast< difference_type >( n );
+
+		for( size_type j = 0 ; j < m ; j++ )
+		{
+			difference_type c = static_cast< difference_type >( 2 * j );
+
+			if( c >= 2 && c + 2 < len )
+			{
+				const T1 *p = src + ( c - 2 ) * sstep;
+				dst[ j * dstep ] = converter2::convert_from( ( converter1::convert_to( p[ 0 ] ) + converter1::convert_to( p[ 4 * sstep ] ) ) * ( 1.0 / 16.0 )
+															+ ( converter1::convert_to( p[ sstep ] ) + converter1::convert_to( p[ 3 * sstep ] ) ) * ( 4.0 / 16.0 )
+															+ converter1::convert_to( p[ 2 * sstep ] ) * ( 6.0 / 16.0 ) );
+			}
+			else
+			{
+				dst[ j * dstep ] = converter2::convert_from( ( converter1::convert_to( src[ mirror( c - 2, len ) * sstep ] ) + converter1::convert_to( src[ mirror( c + 2, len ) * sstep ] ) ) * ( 1.0 / 16.0 )
+															+ ( converter1::convert_to( src[ mirror( c - 1, len ) * sstep ] ) + converter1::convert_to( src[ mirror( c + 1, len ) * sstep ] ) ) * ( 4.0 / 16.0 )
+															+ converter1::convert_to( src[ mirror( c, len ) * sstep ] ) * ( 6.0 / 16.0 ) );
+			}
+		}
+	}
+
+	// k̓]uiW2{ [ 1 4 6 4 1 ] / 8j2{Ɋg傷
+	template < class T1, class T2 >
+	void expand_line( const T1 *src, difference_type sstep, size_type n, T2 *dst, difference_type dstep, size_type m )
+	{
+		typedef __linear__::__promote_pixel_converter_< T1 > converter1;
+		typedef __linear__::__promote_pixel_converter_< T2 > converter2;
+
+		const difference_type len = static_cast< difference_type >( n );
+		const difference_type num = static_cast< difference_type >( m );
+
+		for( difference_type i = 0 ; i < num ; i++ )
+		{
+			difference_type j = i / 2;
+			difference_type j0 = coarse_index( j - 1, len, num );
+			difference_type j1 = coarse_index( j, len, num );
+			difference_type j2 = coarse_index( j + 1, len, num );
+
+			if( i % 2 == 0 )
+			{
+				dst[ i * dstep ] = converter2::convert_from( ( converter1::convert_to( src[ j0 * sstep ] ) + converter1::convert_to( src[ j2 * sstep ] ) ) * ( 1.0 / 8.0 )
+															+ converter1::convert_to( src[ j1 * sstep ] ) * ( 6.0 / 8.0 ) );
+			}
+			else
+			{
+				dst[ i * dstep ] = converter2::convert_from( ( converter1::convert_to( src[ j1 * sstep ] ) + converter1::convert_to( src[ j2 * sstep ] ) ) * 0.5 );
+			}
+		}
+	}
+
+	template < class T1, class T2 >
+	struct line_parameter
+	{
+		const T1  *src;
+		T2        *dst;
+		size_type size[ 3 ];	// ͂̊e̗vf
+		size_type axis;			// 鎲
+		size_type length;		// o͂̏鎲̗vf
+		bool      expand;
+		size_type first;		// S鑖͈̔
+		size_type last;
+	};
+
+	template < class T1, class T2 >
+	void line_function( const line_parameter< T1, T2 > &p )
+	{
+		const size_type w = p.size[ 0 ], h = p.size[ 1 ];
+		const size_type n = p.size[ p.axis ], m = p.length;
+
+		difference_type sstep, dstep;
+		switch( p.axis )
+		{
+		case 0:
+			sstep = dstep = 1;
+			break;
+
+		case 1:
+			sstep = dstep = static_cast< difference_type >( w );
+			break;
+
+		default:
+			sstep = dstep = static_cast< difference_type >( w * h );
+			break;
+		}
+
+		for( size_type l = p.first ; l < p.last ; l++ )
+		{
+			size_type soff, doff;
+			switch( p.axis )
+			{
+			case 0:
+				soff = l * n;
+				doff = l * m;
+				break;
+
+			case 1:
+				soff = ( l / w ) * w * n + l % w;
+				doff = ( l / w ) * w * m + l % w;
+				break;
+
+			default:
+				soff = doff = l;
+				break;
+			}
+
+			if( p.expand )
+			{
+				expand_line( p.src + soff, sstep, n, p.dst + doff, dstep, m );
+			}
+			else
+			{
+				reduce_line( p.src + soff, sstep, n, p.dst + doff, dstep, m );
+			}
+		}
+	}
+
+	// 傫 size 3f[^ axis  length ɏkigjDXbhɕz
+	template < class T1, class T2 >
+	void transform_axis( const T1 *src, T2 *dst, size_type size[ 3 ], size_type axis, size_type length, bool expand, size_type thread_num )
+	{
+		size_type lines = size[ 0 ] * size[ 1 ] * size[ 2 ] / size[ axis ];
+		if( thread_num > lines )
+		{
+			thread_num = lines;
+		}
+
+		std::vector< line_parameter< T1, T2 > > param( thread_num );
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			line_parameter< T1, T2 > &p = param[ i ];
+			p.src     = src;
+			p.dst     = dst;
+			p.size[ 0 ] = size[ 0 ];
+			p.size[ 1 ] = size[ 1 ];
+			p.size[ 2 ] = size[ 2 ];
+			p.axis    = axis;
+			p.length  = length;
+			p.expand  = expand;
+			p.first   = lines * i / thread_num;
+			p.last    = lines * ( i + 1 ) / thread_num;
+		}
+
+		if( thread_num == 1 )
+		{
+			line_function( param[ 0 ] );
+		}
+		else
+		{
+			do_threads( &param[ 0 ], thread_num, line_function< T1, T2 > );
+		}
+
+		size[ axis ] = length;
+	}
+
+	//  in 傫 out ̊e̗vfɍ킹ĕ^ŏkigjDwork1Cwork2 ͍Ɨ̈
+	template < class Array1, class Array2, class Work >
+	void resample( const Array1 &in, Array2 &out, Work &work1, Work &work2, bool expand, size_type thread_num )
+	{
+		size_type size[ 3 ] = { in.width( ), in.height( ), in.depth( ) };
+		size_type osize[ 3 ] = { out.width( ), out.height( ), out.depth( ) };
+
+		// vf1̂܂ܕςȂ͏Ȃ
+		size_type axes[ 3 ], num = 0;
+		for( size_type a = 0 ; a < 3 ; a++ )
+		{
+			if( size[ a ] > 1 || osize[ a ] > 1 )
+			{
+				axes[ num++ ] = a;
+			}
+		}
+
+		if( num == 0 )
+		{
+			transform_axis( &in[ 0 ], &out[ 0 ], size, 0, 1, expand, 1 );
+			return;
+		}
+		else if( num == 1 )
+		{
+			transform_axis( &in[ 0 ], &out[ 0 ], size, axes[ 0 ], osize[ axes[ 0 ] ], expand, thread_num );
+			return;
+		}
+
+		// řʂ͐xۂ promote_type ŕێ
+		size_type work_size = in.size( ) > out.size( ) ? in.size( ) : out.size( );
+		if( work1.size( ) < work_size )
+		{
+			work1.resize( work_size );
+		}
+		if( num > 2 && work2.size( ) < work_size )
+		{
+			work2.resize( work_size );
+		}
+
+		typename Work::value_type *p1 = &work1[ 0 ];
+		typename Work::value_type *p2 = num > 2 ? &work2[ 0 ] : NULL;
+
+		transform_axis( &in[ 0 ], p1, size, axes[ 0 ], osize[ axes[ 0 ] ], expand, thread_num );
+		for( size_type i = 1 ; i + 1 < num ; i++ )
+		{
+			transform_axis( p1, p2, size, axes[ i ], osize[ axes[ i ] ], expand, thread_num );
+			std::swap( p1, p2 );
+		}
+		transform_axis( p1, &out[ 0 ], size, axes[ num - 1 ], osize[ axes[ num - 1 ] ], expand, thread_num );
+	}
+}
+
+
+//! @addtogroup pyramid_group 摜s~bh
+//!
+//! @code ̃wb_CN[h
+//! #include <mist/filter/pyramid.h>
+//! @endcode
+//!
+//! 2摜iarray2j3摜iarray3j̑d𑜓x\D
+//! eKw1ׂKw񍀌W [ 1 4 6 4 1 ] / 16 ̕^tB^ŕCe 1/2i[؂グjɊԈč쐬D
+//! Kw͍ŏɎQƂꂽƂɍ쐬Cȍ~͕ێĂ̂ԂD
+//! eKw͒ʏ array2 / array3 Ȃ̂ŁĈ܂ܑ̃tB^ɓnƂłD
+//!
+//! @attention QƎ̍쐬 const o֐̒œԂύX邽߁Cs~bh𕡐̃Xbh瓯ɎQƂĂ͂ȂȂD
+//! @attention ̃XbhŋLꍇ́C build_all őSĂ̊Kw쐬ĂƁD
+//!
+//! @code gp
+//! mist::array2< unsigned char > in;
+//! mist::read_bmp( in, "hoge.bmp" );
+//!
+//! mist::image_pyramid< mist::array2< unsigned char > > pyr( in, 4 );
+//!
+//! mist::array2< double > edge;
+//! mist::laplacian_filter( pyr[ 2 ], edge );   // 1/4 ̉𑜓x̉摜ɑ΂ď
+//! const mist::array2< double > &band = pyr.laplacian( 0 );   // łׂKw̃vVA
+//! @endcode
+//!
+//!  @{
+
+
+/// @brief KEVAEvVAs~bh
+//!
+//! gp\ȗvf^́CZp^ mist::rgb< Zp^ > Ɍ܂D
+//! kEǧvŹCvf^Zp^̏ꍇ double ^Cmist::rgb< Zp^ > ̏ꍇ mist::rgb< double > ōs܂D
+//!
+//! @param Array c s~bh̊eKw̌^iarray2 ܂ array3j
+//!
+template < class Array >
+class image_pyramid
+{
+public:
+	typedef Array array_type;									///< @brief KEVAs~bh̊eKw̌^
+	typedef typename Array::value_type value_type;				///< @brief f̌^
+	typedef typename Array::size_type size_type;				///< @brief Ȃ̐\^
+	typedef typename __linear__::__promote_pixel_converter_< value_type >::promote_type promote_type;	///< @brief vZɗpf̌^
+	typedef typename Array::template rebind< promote_type >::other band_type;	///< @brief vVAs~bh̊eKw̌^
+
+private:
+	size_type levels_;
+	size_type thread_num_;
+	mutable size_type built_;							// 쐬ς݂̃KEVAs~bh̊Kw
+	mutable std::vector< array_type > gaussian_;
+	mutable std::vector< band_type > laplacian_;
+	mutable std::vector< bool > laplacian_built_;
+	mutable std::vector< promote_type > work1_;			// ^tB^̍Ɨ̈ič\zɂėpj
+	mutable std::vector< promote_type > work2_;
+
+public:
+	/// @brief ̃s~bh쐬
+	//!
+	//! @param[in] thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+	//!
+	image_pyramid( size_type thread_num = 0 ) : levels_( 0 ), built_( 0 )
+	{
+		this->thread_num( thread_num );
+	}
+
+	/// @brief 摜 in  levels Kw̃s~bh쐬
+	//!
+	//! @param[in] in         c łׂKw̉摜
+	//! @param[in] levels     c Kwi0̏ꍇ͍ł1fɂȂ܂Łj
+	//! @param[in] thread_num c gpXbhi0̏ꍇ͎gp\CPUj
+	//!
+	image_pyramid( const array_type &in, size_type levels = 0, size_type thread_num = 0 ) : levels_( 0 ), built_( 0 )
+	{
+		this->thread_num( thread_num );
+		build( in, levels );
+	}
+
+	/// @brief 摜 in łׂKwƂăs~bh蒼
+	//!
+	//! Kw 1 ȍ~͎QƂꂽƂɍ쐬D
+	//! 傫̉摜ō蒼ꍇ́CeKwƍƗ̈̃ėpD
+	//!
+	//! @param[in] in     c łׂKw̉摜
+	//! @param[in] levels c Kwi0̏ꍇ͍ł1fɂȂ܂Łj
+	//!
+	//! @retval true  c ɐݒłꍇ
+	//! @retval false c ͉摜̏ꍇ
+	//!
+	bool build( const array_type &in, size_type levels = 0 )
+	{
+		if( in.empty( ) )
+		{
+			clear( );
+			return( false );
+		}
+
+		levels_ = levels == 0 ? max_levels( in ) : levels;
+		gaussian_.resize( levels_ );
+		laplacian_.resize( levels_ );
+		laplacian_built_.assign( levels_, false );
+
+		gaussian_[ 0 ] = in;
+		built_ = 1;
+
+		return( true );
+	}
+
+	/// @brief SĂ̊Kw쐬
+	//!
+	//! 쐬 levelCoperator []Claplacian ԂύXȂȂ邽߁C̃Xbh瓯ɎQƂłD
+	//!
+	//! @param[in] with_laplacian c vVAs~bh̑SĂ̊Kw쐬邩ǂ
+	//!
+	void build_all( bool with_laplacian = true )
+	{
+		if( empty( ) )
+		{
+			return;
+		}
+
+		level( levels_ - 1 );
+
+		if( with_laplacian )
+		{
+			for( size_type l = 0 ; l < levels_ ; l++ )
+			{
+				laplacian( l );
+			}
+		}
+	}
+
+	/// @brief SĂ̊KwƍƗ̈j
+	void clear( )
+	{
+		levels_ = built_ = 0;
+		gaussian_.clear( );
+		laplacian_.clear( );
+		laplacian_built_.clear( );
+		work1_.clear( );
+		work2_.clear( );
+	}
+
+	/// @brief KwԂ
+	size_type size( ) const { return( levels_ ); }
+
+	/// @brief s~bh󂩂ǂ
+	bool empty( ) const { return( levels_ == 0 ); }
+
+	/// @brief kEgɎgpXbhԂ
+	size_type thread_num( ) const { return( thread_num_ ); }
+
+	/// @brief kEgɎgpXbhݒ肷i0̏ꍇ͎gp\CPUj
+	size_type thread_num( size_type num )
+	{
+		return( thread_num_ = num == 0 ? static_cast< size_type >( get_cpu_num( ) ) : num );
+	}
+
+	/// @brief KEVAs~bh̑ l Kwi0 ̉𑜓xjԂ
+	//!
+	//! @attention l ͊KwłȂĂ͂ȂȂ
+	//! @attention 쐬̊Kw쐬邽߁Cbuild_all ̑O̓XbhZ[tł͂Ȃ
+	//!
+	const array_type &level( size_type l ) const
+	{
+		while( built_ <= l )
+		{
+			reduce( gaussian_[ built_ - 1 ], gaussian_[ built_ ] );
+			built_++;
+		}
+
+		return( gaussian_[ l ] );
+	}
+
+	/// @brief KEVAs~bh̑ l KwԂilevel( l ) Ɠj
+	const array_type &operator []( size_type l ) const { return( level( l ) ); }
+
+	/// @brief vVAs~bh̑ l KwԂ
+	//!
+	//!  l Kw̃KEVA摜ƁC l + 1 Kwg債摜Ƃ̍ԂD
+	//! łeKw̓KEVA摜̂̂ƂȂ邽߁CSĂ̊KẘgƉZŌ̉摜𕜌łD
+	//!
+	//! @attention l ͊KwłȂĂ͂ȂȂ
+	//! @attention 쐬̊Kw쐬邽߁Cbuild_all ̑O̓XbhZ[tł͂Ȃ
+	//!
+	const band_type &laplacian( size_type l ) const
+	{
+		if( !laplacian_built_[ l ] )
+		{
+			band_type &band = laplacian_[ l ];
+			const array_type &g = level( l );
+
+			if( l + 1 < levels_ )
+			{
+				expand( level( l + 1 ), band, g.width( ), g.height( ), g.depth( ) );
+				for( size_type i = 0 ; i < band.size( ) ; i++ )
+				{
+					band[ i ] = __linear__::__promote_pixel_converter_< value_type >::convert_to( g[ i ] ) - band[ i ];
+				}
+			}
+			else
+			{
+				band.resize( g.width( ), g.height( ), g.depth( ) );
+				for( size_type i = 0 ; i < band.size( ) ; i++ )
+				{
+					band[ i ] = __linear__::__promote_pixel_converter_< value_type >::convert_to( g[ i ] );
+				}
+			}
+
+			band.reso1( g.reso1( ) );
+			band.reso2( g.reso2( ) );
+			band.reso3( g.reso3( ) );
+			laplacian_built_[ l ] = true;
+		}
+
+		return( laplacian_[ l ] );
+	}
+
+	/// @brief eKw̉摜 in  2 {Ɋg債C傫 width ~ height ~ depth ̉摜 out 쐬
+	//!
+	//! kɗptB^̓]uŕԂDvVAs~bh̍쐬CeKw̌ʂׂKw̏lɂꍇɗpD
+	//!
+	//! @attention s~bh̍Ɨ̈gp邽߁C̃Xbh瓯ɌĂяoĂ͂ȂȂ
+	//!
+	//! @param[in]  in     c eKw̉摜
+	//! @param[out] out    c g債摜
+	//! @param[in]  width  c gX̗vf
+	//! @param[in]  height c gY̗vf
+	//! @param[in]  depth  c gZ̗vf
+	//!
+	template < class Array1, class Array2 >
+	void expand( const Array1 &in, Array2 &out, size_type width, size_type height, size_type depth = 1 ) const
+	{
+		out.resize( width, height, depth );
+		__pyramid__::resample( in, out, work1_, work2_, true, thread_num_ );
+	}
+
+private:
+	// łivf1̎j1fɂȂ܂ł̊Kw
+	static size_type max_levels( const array_type &in )
+	{
+		size_type size[ 3 ] = { in.width( ), in.height( ), in.depth( ) };
+		size_type levels = 1;
+		size_type min = 0;
+		for( size_type a = 0 ; a < 3 ; a++ )
+		{
+			if( size[ a ] > 1 && ( min == 0 || size[ a ] < min ) )
+			{
+				min = size[ a ];
+			}
+		}
+
+		while( min > 1 )
+		{
+			min = ( min + 1 ) / 2;
+			levels++;
+		}
+
+		return( levels );
+	}
+
+	// e 1/2 ɊԈ̂ŁCk̉fԊu2{ɂȂivf1̎͂̂܂܁j
+	void reduce( const array_type &in, array_type &out ) const
+	{
+		out.resize( ( in.width( ) + 1 ) / 2, ( in.height( ) + 1 ) / 2, ( in.depth( ) + 1 ) / 2 );
+		out.reso1( in.width( ) > 1 ? in.reso1( ) * 2.0 : in.reso1( ) );
+		out.reso2( in.height( ) > 1 ? in.reso2( ) * 2.0 : in.reso2( ) );
+		out.reso3( in.depth( ) > 1 ? in.reso3( ) * 2.0 : in.reso3( ) );
+		__pyramid__::resample( in, out, work1_, work2_, false, thread_num_ );
+	}
+};
+
+
+/// @}
+//  摜s~bhO[v̏I
+
+
+// mistOԂ̏I
+_MIST_END
+
+
+#endif // __INCLUDE_MIST_PYRAMID__
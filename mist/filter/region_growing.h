@@ -47,9 +47,14 @@
 #include "../vector.h"
 #endif
 
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+
 #include <deque>
 #include <vector>
 #include <cmath>
+#include <cstdlib>
 
 
 // mistOԂ̎n܂
@@ -987,6 +992,563 @@ typename Array1::difference_type region_growing( const Array1 &in, Array2 &out,
 }
 
 
+// ̈g@̓ŗp^Ȃ
+namespace __parallel_region_growing__
+{
+	typedef size_t		size_type;
+	typedef ptrdiff_t	difference_type;
+
+	// \vf̉f̑Έʒu
+	struct offset_type
+	{
+		difference_type x;
+		difference_type y;
+		difference_type z;
+		difference_type diff;
+
+		offset_type( difference_type xx = 0, difference_type yy = 0, difference_type zz = 0, difference_type d = 0 ) : x( xx ), y( yy ), z( zz ), diff( d ){ }
+	};
+
+	typedef std::vector< offset_type > offset_list_type;
+
+
+	// \vf̉f̑ΈʒũXg쐬
+	template < class Component >
+	offset_list_type create_component_list( const Component &components, difference_type width, difference_type height )
+	{
+		offset_list_type list;
+
+		difference_type w = components.width( );
+		difference_type h = components.height( );
+		difference_type d = components.depth( );
+		difference_type cx = w / 2;
+		difference_type cy = h / 2;
+		difference_type cz = d / 2;
+
+		for( difference_type k = 0 ; k < d ; k++ )
+		{
+			for( difference_type j = 0 ; j < h ; j++ )
+			{
+				for( difference_type i = 0 ; i < w ; i++ )
+				{
+					if( components( i - cx, j - cy, k - cz ) )
+					{
+						list.push_back( offset_type( i - cx, j - cy, k - cz, ( i - cx ) + ( ( j - cy ) + ( k - cz ) * height ) * width ) );
+					}
+				}
+			}
+		}
+
+		return( list );
+	}
+
+
+	// 钍ړ_̎ɒړ_ɂȂf̑ΈʒũXg쐬
+	template < class Component >
+	offset_list_type create_update_list( const Component &components, difference_type width, difference_type height )
+	{
+		if( components.expand_mode( ) == region_growing_utility::ALL )
+		{
+			return( create_component_list( components, width, height ) );
+		}
+
+		offset_list_type list;
+
+		for( difference_type k = -1 ; k <= 1 ; k++ )
+		{
+			for( difference_type j = -1 ; j <= 1 ; j++ )
+			{
+				for( difference_type i = -1 ; i <= 1 ; i++ )
+				{
+					difference_type n = ( i != 0 ? 1 : 0 ) + ( j != 0 ? 1 : 0 ) + ( k != 0 ? 1 : 0 );
+					bool flag = false;
+
+					switch( components.expand_mode( ) )
+					{
+					case region_growing_utility::NC4:
+						flag = k == 0 && n == 1;
+						break;
+
+					case region_growing_utility::NC8:
+						flag = k == 0 && n >= 1;
+						break;
+
+					case region_growing_utility::NC6:
+						flag = n == 1;
+						break;
+
+					case region_growing_utility::NC18:
+						flag = n == 1 || n == 2;
+						break;
+
+					case region_growing_utility::NC26:
+					default:
+						flag = n >= 1;
+						break;
+					}
+
+					if( flag )
+					{
+						list.push_back( offset_type( i, j, k, i + ( j + k * height ) * width ) );
+					}
+				}
+			}
+		}
+
+		return( list );
+	}
+
+
+	// gJn_摜ɑ݂ꍇɁC̉f̈ʒuԂ
+	template < class T, class Allocator, class PointType >
+	inline bool point_index( const array2< T, Allocator > &in, const PointType &pt, size_type &indx )
+	{
+		difference_type x = static_cast< difference_type >( pt.x );
+		difference_type y = static_cast< difference_type >( pt.y );
+
+		if( x < 0 || x >= static_cast< difference_type >( in.width( ) ) || y < 0 || y >= static_cast< difference_type >( in.height( ) ) )
+		{
+			return( false );
+		}
+
+		indx = x + y * in.width( );
+		return( true );
+	}
+
+	template < class T, class Allocator, class PointType >
+	inline bool point_index( const array3< T, Allocator > &in, const PointType &pt, size_type &indx )
+	{
+		difference_type x = static_cast< difference_type >( pt.x );
+		difference_type y = static_cast< difference_type >( pt.y );
+		difference_type z = static_cast< difference_type >( pt.z );
+
+		if( x < 0 || x >= static_cast< difference_type >( in.width( ) ) || y < 0 || y >= static_cast< difference_type >( in.height( ) ) || z < 0 || z >= static_cast< difference_type >( in.depth( ) ) )
+		{
+			return( false );
+		}
+
+		indx = x + ( y + z * in.height( ) ) * in.width( );
+		return( true );
+	}
+
+
+	// SXbhŋLf[^
+	struct shared_data
+	{
+		std::vector< unsigned int >			visited;	// ړ_Ƃēo^ς݂̉f̃rbg
+		std::vector< unsigned int >			accepted;	// hԂς݂̉f̃rbg
+		std::vector< unsigned int >			blocked;	// ΏۊO}XÑrbgi}XNw肵Ȃꍇ͋j
+		std::vector< std::deque< size_type > >	queue;	// Xbh̒ړ_̃Xg
+		simple_lock_object					*locks;		// ړ_̃Xg̔rpIuWFNg
+		volatile unsigned int				idle;		// 钍ړ_Xbh̐
+
+		shared_data( size_type num, size_type thread_num ) : visited( ( num + 31 ) / 32, 0 ), accepted( ( num + 31 ) / 32, 0 ), queue( thread_num ), idle( 0 )
+		{
+			locks = new simple_lock_object[ thread_num ];
+		}
+
+		~shared_data( )
+		{
+			delete [] locks;
+		}
+
+		static bool test( const std::vector< unsigned int > &bits, size_type i )
+		{
+			return( ( bits[ i >> 5 ] & ( 1u << ( i & 31 ) ) ) != 0 );
+		}
+
+		// rbg𗧂āCɗĂꍇ false Ԃ
+		static bool test_and_set( std::vector< unsigned int > &bits, size_type i )
+		{
+			unsigned int bit = 1u << ( i & 31 );
+			volatile unsigned int &v = bits[ i >> 5 ];
+			return( ( v & bit ) == 0 && ( atomic_or( v, bit ) & bit ) == 0 );
+		}
+
+	private:
+		shared_data( const shared_data & );
+		const shared_data &operator =( const shared_data & );
+	};
+
+
+	// eXbh͎g̒ړ_ǏIȃX^bNŏCꂽړ_L̃XgɈڂ
+	// L̃XgɂȂꍇ́C̃Xbh̃Xg璍ړ_Dď𑱂
+	template < class Array1, class Array2, class Condition >
+	class region_growing_thread : public mist::thread< region_growing_thread< Array1, Array2, Condition > >
+	{
+	public:
+		typedef mist::thread< region_growing_thread< Array1, Array2, Condition > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef typename Array1::value_type value_type;
+		typedef typename Array2::value_type out_value_type;
+
+	private:
+		size_type thread_id_;
+		size_type thread_num_;
+
+		const Array1 *in_;
+		Array2 *out_;
+		out_value_type output_value_;
+		const offset_list_type *clist_;
+		const offset_list_type *ulist_;
+		const Condition *condition_;
+		bool require_all_elements_;
+		shared_data *shared_;
+		size_type num_painted_;
+
+	public:
+		void setup_parameters( const Array1 &in, Array2 &out, out_value_type output_value, const offset_list_type &clist, const offset_list_type &ulist,
+								const Condition &condition, shared_data &shared, size_type thread_id, size_type thread_num )
+		{
+			in_  = &in;
+			out_ = &out;
+			output_value_ = output_value;
+			clist_ = &clist;
+			ulist_ = &ulist;
+			condition_ = &condition;
+			require_all_elements_ = condition.require_all_elements( );
+			shared_ = &shared;
+			thread_id_  = thread_id;
+			thread_num_ = thread_num;
+		}
+
+		size_type num_painted( ) const { return( num_painted_ ); }
+
+		region_growing_thread( size_type id = 0, size_type num = 1 ) : thread_id_( id ), thread_num_( num ), in_( NULL ), out_( NULL ), output_value_( ),
+											clist_( NULL ), ulist_( NULL ), condition_( NULL ), require_all_elements_( false ), shared_( NULL ), num_painted_( 0 )
+		{
+		}
+
+	protected:
+		// g̃Xg̖璍ړ_o
+		bool pop( std::vector< size_type > &stack )
+		{
+			std::deque< size_type > &que = shared_->queue[ thread_id_ ];
+			shared_->locks[ thread_id_ ].lock( );
+			for( size_type n = 0 ; n < 256 && !que.empty( ) ; n++ )
+			{
+				stack.push_back( que.back( ) );
+				que.pop_back( );
+			}
+			shared_->locks[ thread_id_ ].unlock( );
+			return( !stack.empty( ) );
+		}
+
+		// ̃Xbh̃Xg̐擪C̒ړ_D
+		bool steal( std::vector< size_type > &stack )
+		{
+			for( size_type t = 1 ; t < thread_num_ && stack.empty( ) ; t++ )
+			{
+				size_type victim = ( thread_id_ + t ) % thread_num_;
+				std::deque< size_type > &que = shared_->queue[ victim ];
+				shared_->locks[ victim ].lock( );
+				size_type num = ( que.size( ) + 1 ) / 2;
+				for( size_type n = 0 ; n < num ; n++ )
+				{
+					stack.push_back( que.front( ) );
+					que.pop_front( );
+				}
+				shared_->locks[ victim ].unlock( );
+			}
+			return( !stack.empty( ) );
+		}
+
+		// ǏIȃX^bŇÂ̔C̃Xbho悤ɋL̃XgɈڂ
+		void flush( std::vector< size_type > &stack )
+		{
+			size_type num = stack.size( ) / 2;
+			std::deque< size_type > &que = shared_->queue[ thread_id_ ];
+			shared_->locks[ thread_id_ ].lock( );
+			que.insert( que.end( ), stack.begin( ), stack.begin( ) + num );
+			shared_->locks[ thread_id_ ].unlock( );
+			stack.erase( stack.begin( ), stack.begin( ) + num );
+		}
+
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const Array1 &in = *in_;
+			Array2 &out = *out_;
+			const offset_list_type &clist = *clist_;
+			const offset_list_type &ulist = *ulist_;
+			shared_data &shared = *shared_;
+			const bool has_mask = !shared.blocked.empty( );
+
+			const difference_type w = in.width( );
+			const difference_type h = in.height( );
+			const difference_type d = in.depth( );
+
+			// \vfƎ̒ړ_摜Ɏ܂邩ǂ𔻒肷͈
+			difference_type rx = 1, ry = 1, rz = 1;
+			for( size_type n = 0 ; n < clist.size( ) ; n++ )
+			{
+				rx = rx > std::abs( clist[ n ].x ) ? rx : std::abs( clist[ n ].x );
+				ry = ry > std::abs( clist[ n ].y ) ? ry : std::abs( clist[ n ].y );
+				rz = rz > std::abs( clist[ n ].z ) ? rz : std::abs( clist[ n ].z );
+			}
+			for( size_type n = 0 ; n < ulist.size( ) ; n++ )
+			{
+				rx = rx > std::abs( ulist[ n ].x ) ? rx : std::abs( ulist[ n ].x );
+				ry = ry > std::abs( ulist[ n ].y ) ? ry : std::abs( ulist[ n ].y );
+				rz = rz > std::abs( ulist[ n ].z ) ? rz : std::abs( ulist[ n ].z );
+			}
+
+			std::vector< size_type > stack;
+			std::vector< value_type > element( clist.size( ) );		// g̔ɗpf̔z
+			std::vector< size_type > elist( clist.size( ) );		// g̔ɗpf̈ʒuoz
+
+			num_painted_ = 0;
+
+			for( ;; )
+			{
+				if( stack.empty( ) && !pop( stack ) )
+				{
+					// 钍ړ_ꍇ́C̃Xbh璍ړ_D
+					// SẴXbhɏ钍ړ_Ȃ_ŏI
+					if( atomic_add( shared.idle, 1 ) + 1 == thread_num_ )
+					{
+						break;
+					}
+
+					for( ;; )
+					{
+						atomic_add( shared.idle, static_cast< unsigned int >( -1 ) );
+						if( steal( stack ) )
+						{
+							break;
+						}
+						else if( atomic_add( shared.idle, 1 ) + 1 == thread_num_ )
+						{
+							return( true );
+						}
+						sleep( 0 );
+					}
+				}
+
+				const size_type cur = stack.back( );
+				stack.pop_back( );
+
+				const difference_type x = cur % w;
+				const difference_type y = ( cur / w ) % h;
+				const difference_type z = cur / ( w * h );
+				const bool inside = rx <= x && x < w - rx && ry <= y && y < h - ry && rz <= z && z < d - rz;
+
+				// gɗpf񋓂
+				// ŁC摜OƏΏۊO}XN̉f͔͈͂Ɋ܂߂Ȃ
+				// ܂CgSfKvƂȂꍇ́CłɓhԂfO
+				size_type num = 0;
+				for( size_type n = 0 ; n < clist.size( ) ; n++ )
+				{
+					const offset_type &o = clist[ n ];
+					if( !inside && ( x + o.x < 0 || x + o.x >= w || y + o.y < 0 || y + o.y >= h || z + o.z < 0 || z + o.z >= d ) )
+					{
+						continue;
+					}
+
+					size_type indx = cur + o.diff;
+					if( ( has_mask && shared_data::test( shared.blocked, indx ) ) || ( !require_all_elements_ && shared_data::test( shared.accepted, indx ) ) )
+					{
+						continue;
+					}
+
+					element[ num ] = in[ indx ];
+					elist[ num ]   = indx;
+					num++;
+				}
+
+				// g̔s
+				if( ( require_all_elements_ && num == 0 ) || !( *condition_ )( element, num ) )
+				{
+					continue;
+				}
+
+				// 𖞂\vf̉fׂĂhԂ
+				// hԂ̌́CŏɓhԂ̃rbg𗧂ĂXbĥ݂
+				for( size_type n = 0 ; n < num ; n++ )
+				{
+					if( shared_data::test_and_set( shared.accepted, elist[ n ] ) )
+					{
+						num_painted_ += out[ elist[ n ] ] != output_value_ ? 1 : 0;
+						out[ elist[ n ] ] = output_value_;
+					}
+				}
+
+				// \vfɂĎ̒ړ_肵CX^bNɒǉ
+				for( size_type n = 0 ; n < ulist.size( ) ; n++ )
+				{
+					const offset_type &o = ulist[ n ];
+					if( !inside && ( x + o.x < 0 || x + o.x >= w || y + o.y < 0 || y + o.y >= h || z + o.z < 0 || z + o.z >= d ) )
+					{
+						continue;
+					}
+
+					size_type indx = cur + o.diff;
+					if( has_mask && shared_data::test( shared.blocked, indx ) )
+					{
+						continue;
+					}
+					else if( shared_data::test_and_set( shared.visited, indx ) )
+					{
+						stack.push_back( indx );
+					}
+				}
+
+				// ړ_̖Xbh݂ꍇ́C߂ɋL̃XgɈڂ
+				if( thread_num_ > 1 && ( stack.size( ) > 1024 || ( shared.idle > 0 && stack.size( ) > 16 ) ) )
+				{
+					flush( stack );
+				}
+			}
+
+			return( true );
+		}
+	};
+}
+
+
+/// @brief 񏈗ł̗̈g@
+//! 
+//! ̈g@ŗp֐̕񏈗
+//! 
+namespace parallel
+{
+	/// @brief Cӂ̍\vfƏpāC̃Xbhŗ̈gs֐
+	//!
+	//! eXbh͒ړ_̃XgCXgɂȂXbh͑̃Xbh̃Xg璍ړ_Dď𑱂D
+	//! ړ_ƓhԂς݂̉f́CSXbhŋLrbgŊǗ邽߁CƗ̈1f2rbgi}XNw肷ꍇ3rbgjƂȂD
+	//! g\vf̊efɑ΂锻iless, greater, equal, range Ȃǁjł΁Cʂ mist::region_growing ƈvD
+	//!
+	//! @attention hԂőfw肷邱Ƃ͂ł܂
+	//!
+	//! @param[in]  in           c ͉摜
+	//! @param[out] out          c o̓}[Nf[^
+	//! @param[in]  mask         c ΏۊO}XN
+	//! @param[in]  start_points c ̈g̊Jn_̃Xgiw肷ꍇ́Cstd::vectorȂǂ̃Xgɑ邱Ɓj
+	//! @param[in]  output_value c o̓}[Nf[^ɏޒl
+	//! @param[in]  components   c ̈gɗp\vf
+	//! @param[in]  condition    c \vf̉fׂ
+	//! @param[in]  thread_num   c gpXbhi0̏ꍇCPUgpj
+	//!
+	//! @return ͉摜sK؂ȏꍇ -1 ԂDȊȌꍇ́ChԂfԂD
+	//! 
+	template < class Array1, class Array2, class MaskType, class PointList, class Component, class Condition >
+	typename Array1::difference_type region_growing( const Array1 &in, Array2 &out, const MaskType &mask, const PointList &start_points, typename Array2::value_type output_value,
+															const Component &components, const Condition &condition, typename Array1::size_type thread_num )
+	{
+		if( in.empty( ) || is_same_object( in, out ) )
+		{
+			return( -1 );
+		}
+
+		typedef typename Array1::size_type			size_type;
+		typedef typename Array1::difference_type	difference_type;
+		typedef __parallel_region_growing__::shared_data shared_data;
+		typedef __parallel_region_growing__::region_growing_thread< Array1, Array2, Condition > region_growing_thread;
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
+
+		const difference_type w = in.width( );
+		const difference_type h = in.height( );
+		const difference_type d = in.depth( );
+
+		__parallel_region_growing__::offset_list_type clist = __parallel_region_growing__::create_component_list( components, w, h );	// \vf̉f̃Xg
+		__parallel_region_growing__::offset_list_type ulist = __parallel_region_growing__::create_update_list( components, w, h );		// 钍ړ_̎ɒړ_ɂȂf̃Xg
+
+		shared_data shared( in.size( ), thread_num );
+
+		// }XN̓erbgɔf
+		if( !mask.empty( ) )
+		{
+			shared.blocked.resize( shared.visited.size( ), 0 );
+			for( difference_type k = 0, indx = 0 ; k < d ; k++ )
+			{
+				for( difference_type j = 0 ; j < h ; j++ )
+				{
+					for( difference_type i = 0 ; i < w ; i++, indx++ )
+					{
+						if( mask( i, j, k ) )
+						{
+							shared.blocked[ indx >> 5 ] |= 1u << ( indx & 31 );
+						}
+					}
+				}
+			}
+		}
+
+		typedef __region_growing_utility__::point_list_converter< PointList > start_point_list_converter;
+		typedef typename start_point_list_converter::point_list_type start_point_list_type;
+		start_point_list_type sps = start_point_list_converter::create_point_list( start_points );
+
+		// 摜ɑ݂gJn_CeXbh̃XgɏԂɊ蓖Ă
+		size_type count = 0;
+		for( typename start_point_list_type::const_iterator ite = sps.begin( ) ; ite != sps.end( ) ; ++ite )
+		{
+			size_type indx;
+			if( !__parallel_region_growing__::point_index( in, *ite, indx ) )
+			{
+				continue;
+			}
+			else if( ( shared.blocked.empty( ) || !shared_data::test( shared.blocked, indx ) ) && shared_data::test_and_set( shared.visited, indx ) )
+			{
+				shared.queue[ count++ % thread_num ].push_back( indx );
+			}
+		}
+
+		// o͉摜̑傫`FbN
+		if( in.size( ) != out.size( ) )
+		{
+			out.resize( in.width( ), in.height( ), in.depth( ) );
+			out.reso1( in.reso1( ) );
+			out.reso2( in.reso2( ) );
+			out.reso3( in.reso3( ) );
+		}
+
+		region_growing_thread *thread = new region_growing_thread[ thread_num ];
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			thread[ i ].setup_parameters( in, out, output_value, clist, ulist, condition, shared, i, thread_num );
+		}
+
+		do_threads_( thread, thread_num );
+
+		size_type num_painted = 0;
+		for( size_type i = 0 ; i < thread_num ; i++ )
+		{
+			num_painted += thread[ i ].num_painted( );
+		}
+
+		delete [] thread;
+
+		return( num_painted );
+	}
+
+
+	/// @brief Cӂ̍\vfƏpāC̃Xbhŗ̈gs֐
+	//!
+	//! ΏۊO}XNݒ肵Ȃ̈g@
+	//!
+	//! @param[in]  in           c ͉摜
+	//! @param[out] out          c o̓}[Nf[^
+	//! @param[in]  start_points c ̈g̊Jn_̃Xgiw肷ꍇ́Cstd::vectorȂǂ̃Xgɑ邱Ɓj
+	//! @param[in]  output_value c o̓}[Nf[^ɏޒl
+	//! @param[in]  components   c ̈gɗp\vf
+	//! @param[in]  condition    c \vf̉fׂ
+	//! @param[in]  thread_num   c gpXbhi0̏ꍇCPUgpj
+	//!
+	//! @return ͉摜sK؂ȏꍇ -1 ԂDȊȌꍇ́ChԂfԂD
+	//!
+	template < class Array1, class Array2, class PointList, class Component, class Condition >
+	typename Array1::difference_type region_growing( const Array1 &in, Array2 &out, const PointList &start_points, typename Array2::value_type output_value,
+											const Component &components, const Condition &condition, typename Array1::size_type thread_num = 0 )
+	{
+		return( parallel::region_growing( in, out, __region_growing_utility__::no_mask( ), start_points, output_value, components, condition, thread_num ) );
+	}
+}
+
+
 /// @}
 //  ̈g@O[v̏I
 
@@ -0,0 +1,890 @@
+// 
+// Copyright (c) 2003-2011, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+/// @file mist/filter/run_length.h
+//!
+//! @brief OX\2l摜ƁCPʂƂxOEEfoASY
+//!
+//! Oif̏Ȃ2l摜ɑ΂āCfł͂Ȃ̐ɔႵvZʂŏs
+//!
+
+#ifndef __INCLUDE_MIST_RUN_LENGTH__
+#define __INCLUDE_MIST_RUN_LENGTH__
+
+
+#ifndef __INCLUDE_MIST_H__
+#include "../mist.h"
+#endif
+
+#include <vector>
+
+
+// mistOԂ̎n܂
+_MIST_BEGIN
+
+
+//! @addtogroup run_length_group OX\2l摜
+//!
+//! @code ̃wb_CN[h
+//! #include <mist/filter/run_length.h>
+//! @endcode
+//!
+//! @code OX\pxO̎gp
+//! mist::run_length_mask mask;
+//! mist::convert( in, mask );                              // 2l摜OX\ɕϊ
+//!
+//! std::vector< size_t > label;
+//! size_t num = mist::run_length::labeling26( mask, label );  // ̃x߂
+//!
+//! mist::run_length::convert( mask, label, out );          // x摜ɕϊ
+//! @endcode
+//!
+//!  @{
+
+
+/// @brief es̑Oif [start, end) ̗̃ŕ\2l摜
+//! 
+//! s ( j, k ) ̑ɕсCes̃ X W̏ɕԁDאڂ郉͕K1fȏ㗣ĂD
+//! 
+//! @code OX\̍쐬
+//! mist::run_length_mask mask( width, height, depth );
+//! for( k = 0 ; k < depth ; k++ )
+//! {
+//!     for( j = 0 ; j < height ; j++ )
+//!     {
+//!         mask.append( start, end );    // s ( j, k ) Ƀǉ
+//!         mask.end_row( );              // ̍sɐi
+//!     }
+//! }
+//! @endcode
+//! 
+class run_length_mask
+{
+public:
+	typedef size_t size_type;				///< @brief Ȃ̐\^
+	typedef ptrdiff_t difference_type;		///< @brief t̐\^
+
+	/// @brief X W [start, end) ̑Oif̕
+	struct run_type
+	{
+		size_type start;	///< @brief ̐擪 X W
+		size_type end;		///< @brief ̖̎ X W
+
+		run_type( size_type s = 0, size_type e = 0 ) : start( s ), end( e ){ }
+	};
+
+protected:
+	size_type width_;
+	size_type height_;
+	size_type depth_;
+	double reso1_;
+	double reso2_;
+	double reso3_;
+	std::vector< size_type > rows_;		// es̐擪̃̔ԍiŌ̗vf̓̑j
+	std::vector< run_type > runs_;
+
+public:
+	size_type width( ) const { return( width_ ); }				///< @brief X̉fԂ
+	size_type height( ) const { return( height_ ); }			///< @brief ỶfԂ
+	size_type depth( ) const { return( depth_ ); }				///< @brief Z̉fԂ
+	size_type size( ) const { return( width_ * height_ * depth_ ); }	///< @brief SfԂ
+
+	double reso1( double r1 ){ return( reso1_ = r1 ); }		///< @brief X̉𑜓x r1 ɐݒ肵Cݒ̒lԂ
+	double reso1( ) const { return( reso1_ ); }					///< @brief X̉𑜓xԂ
+	double reso2( double r2 ){ return( reso2_ = r2 ); }		///< @brief Ỷ𑜓x r2 ɐݒ肵Cݒ̒lԂ
+	double reso2( ) const { return( reso2_ ); }					///< @brief Ỷ𑜓xԂ
+	double reso3( double r3 ){ return( reso3_ = r3 ); }		///< @brief Z̉𑜓x r3 ɐݒ肵Cݒ̒lԂ
+	double reso3( ) const { return( reso3_ ); }					///< @brief Z̉𑜓xԂ
+
+	/// @brief s̐iheight ~ depthjԂ
+	size_type row_num( ) const { return( height_ * depth_ ); }
+
+	/// @brief ̑Ԃ
+	size_type run_num( ) const { return( runs_.size( ) ); }
+
+	/// @brief n Ԗڂ̃Ԃ
+	const run_type &run( size_type n ) const { return( runs_[ n ] ); }
+
+	/// @brief s ri= j + k ~ heightj̐擪̃̔ԍԂ
+	size_type row_begin( size_type r ) const { return( rows_[ r ] ); }
+
+	/// @brief s ri= j + k ~ heightj̖̃̎̔ԍԂ
+	size_type row_end( size_type r ) const { return( rows_[ r + 1 ] ); }
+
+	/// @brief Oif̑Ԃ
+	size_type count( ) const
+	{
+		size_type num = 0;
+		for( size_type n = 0 ; n < runs_.size( ) ; n++ )
+		{
+			num += runs_[ n ].end - runs_[ n ].start;
+		}
+		return( num );
+	}
+
+	/// @brief SĂ̍s쐬ς݂ǂԂ
+	bool is_complete( ) const { return( rows_.size( ) == row_num( ) + 1 ); }
+
+	/// @brief 摜̑傫ύXCSẴ폜
+	void resize( size_type w, size_type h, size_type d = 1 )
+	{
+		width_  = w;
+		height_ = h;
+		depth_  = d;
+		runs_.clear( );
+		rows_.clear( );
+		rows_.push_back( 0 );
+	}
+
+	/// @brief SẴ폜C摜̑傫0ɂ
+	void clear( )
+	{
+		resize( 0, 0, 0 );
+	}
+
+	/// @brief 쐬̍s̖ [start, end) ̃ǉ
+	//! 
+	//! @attention  X W̏ɁC1fȏ㗣ĒǉKv
+	//! 
+	void append( size_type start, size_type end )
+	{
+		if( start < end )
+		{
+			runs_.push_back( run_type( start, end ) );
+		}
+	}
+
+	/// @brief 쐬̍sm肵C̍sɐi
+	void end_row( )
+	{
+		rows_.push_back( runs_.size( ) );
+	}
+
+	/// @brief i[̈\񂷂
+	void reserve( size_type num )
+	{
+		runs_.reserve( num );
+	}
+
+	/// @brief 傫 w ~ h ~ d ̋2l摜쐬
+	run_length_mask( size_type w = 0, size_type h = 0, size_type d = 1 ) : width_( w ), height_( h ), depth_( d ), reso1_( 1.0 ), reso2_( 1.0 ), reso3_( 1.0 )
+	{
+		rows_.push_back( 0 );
+	}
+};
+
+
+/// @brief 2l摜OX\ɕϊi0ȊỎfOiƂj
+//! 
+//! @param[in]  in  c ͉摜
+//! @param[out] out c OX\2l摜
+//! 
+template < class T, class Allocator >
+void convert( const array2< T, Allocator > &in, run_length_mask &out )
+{
+	typedef run_length_mask::size_type size_type;
+
+	out.resize( in.width( ), in.height( ), 1 );
+	out.reso1( in.reso1( ) );
+	out.reso2( in.reso2( ) );
+	out.reso3( 1.0 );
+
+	for( size_type j = 0 ; j < in.height( ) ; j++ )
+	{
+		size_type i = 0;
+		while( i < in.width( ) )
+		{
+			for( ; i < in.width( ) && in( i, j ) == 0 ; i++ );
+			size_type s = i;
+			for( ; i < in.width( ) && in( i, j ) != 0 ; i++ );
+			out.append( s, i );
+		}
+		out.end_row( );
+	}
+}
+
+
+/// @brief 3摜OX\ɕϊi0ȊỎfOiƂj
+//! 
+//! @param[in]  in  c ͉摜
+//! @param[out] out c OX\2l摜
+//! 
+template < class T, class Allocator >
+void convert( const array3< T, Allocator > &in, run_length_mask &out )
+{
+	typedef run_length_mask::size_type size_type;
+
+	out.resize( in.width( ), in.height( ), in.depth( ) );
+	out.reso1( in.reso1( ) );
+	out.reso2( in.reso2( ) );
+	out.reso3( in.reso3( ) );
+
+	for( size_type k = 0 ; k < in.depth( ) ; k++ )
+	{
+		for( size_type j = 0 ; j < in.height( ) ; j++ )
+		{
+			size_type i = 0;
+			while( i < in.width( ) )
+			{
+				for( ; i < in.width( ) && in( i, j, k ) == 0 ; i++ );
+				size_type s = i;
+				for( ; i < in.width( ) && in( i, j, k ) != 0 ; i++ );
+				out.append( s, i );
+			}
+			out.end_row( );
+		}
+	}
+}
+
+
+/// @brief OX\2l摜2摜ɕϊ
+//! 
+//! @param[in]  in    c OX\2l摜
+//! @param[out] out   c o͉摜
+//! @param[in]  value c Oifɑl
+//! 
+template < class T, class Allocator >
+void convert( const run_length_mask &in, array2< T, Allocator > &out, typename array2< T, Allocator >::value_type value = 1 )
+{
+	typedef run_length_mask::size_type size_type;
+
+	out.resize( in.width( ), in.height( ) * in.depth( ) );
+	out.reso1( in.reso1( ) );
+	out.reso2( in.reso2( ) );
+	out.fill( );
+
+	for( size_type r = 0 ; r < in.row_num( ) ; r++ )
+	{
+		for( size_type n = in.row_begin( r ) ; n < in.row_end( r ) ; n++ )
+		{
+			for( size_type i = in.run( n ).start ; i < in.run( n ).end ; i++ )
+			{
+				out( i, r ) = value;
+			}
+		}
+	}
+}
+
+
+/// @brief OX\2l摜3摜ɕϊ
+//! 
+//! @param[in]  in    c OX\2l摜
+//! @param[out] out   c o͉摜
+//! @param[in]  value c Oifɑl
+//! 
+template < class T, class Allocator >
+void convert( const run_length_mask &in, array3< T, Allocator > &out, typename array3< T, Allocator >::value_type value = 1 )
+{
+	typedef run_length_mask::size_type size_type;
+
+	out.resize( in.width( ), in.height( ), in.depth( ) );
+	out.reso1( in.reso1( ) );
+	out.reso2( in.reso2( ) );
+	out.reso3( in.reso3( ) );
+	out.fill( );
+
+	for( size_type r = 0 ; r < in.row_num( ) ; r++ )
+	{
+		typename array3< T, Allocator >::pointer p = &out[ 0 ] + r * in.width( );
+		for( size_type n = in.row_begin( r ) ; n < in.row_end( r ) ; n++ )
+		{
+			for( size_type i = in.run( n ).start ; i < in.run( n ).end ; i++ )
+			{
+				p[ i ] = value;
+			}
+		}
+	}
+}
+
+/// @}
+//  OX\O[v̏I
+
+
+namespace __run_length_controller__
+{
+	typedef run_length_mask::size_type       size_type;
+	typedef run_length_mask::difference_type difference_type;
+	typedef run_length_mask::run_type        run_type;
+
+	// ߖT̍s̑Έʒu ( dy, dz ) ƁCX ɉfꂽf܂łߖTƂ邩iexj\
+	template < int nc >
+	struct neighbors
+	{
+		// 26ߖT
+		_MIST_CONST( size_type, row_num, 8 );
+
+		static inline void row( size_type n, difference_type &dy, difference_type &dz, difference_type &ex )
+		{
+			static const difference_type oy[] = { -1, 1,  0, 0, -1,  1, -1, 1 };
+			static const difference_type oz[] = {  0, 0, -1, 1, -1, -1,  1, 1 };
+			dy = oy[ n ];
+			dz = oz[ n ];
+			ex = 1;
+		}
+	};
+
+	template < >
+	struct neighbors< 18 >
+	{
+		_MIST_CONST( size_type, row_num, 8 );
+
+		static inline void row( size_type n, difference_type &dy, difference_type &dz, difference_type &ex )
+		{
+			static const difference_type oy[] = { -1, 1,  0, 0, -1,  1, -1, 1 };
+			static const difference_type oz[] = {  0, 0, -1, 1, -1, -1,  1, 1 };
+			dy = oy[ n ];
+			dz = oz[ n ];
+			ex = n < 4 ? 1 : 0;
+		}
+	};
+
+	template < >
+	struct neighbors< 6 >
+	{
+		_MIST_CONST( size_type, row_num, 4 );
+
+		static inline void row( size_type n, difference_type &dy, difference_type &dz, difference_type &ex )
+		{
+			static const difference_type oy[] = { -1, 1,  0, 0 };
+			static const difference_type oz[] = {  0, 0, -1, 1 };
+			dy = oy[ n ];
+			dz = oz[ n ];
+			ex = 0;
+		}
+	};
+
+	template < >
+	struct neighbors< 8 >
+	{
+		_MIST_CONST( size_type, row_num, 2 );
+
+		static inline void row( size_type n, difference_type &dy, difference_type &dz, difference_type &ex )
+		{
+			dy = n == 0 ? -1 : 1;
+			dz = 0;
+			ex = 1;
+		}
+	};
+
+	template < >
+	struct neighbors< 4 >
+	{
+		_MIST_CONST( size_type, row_num, 2 );
+
+		static inline void row( size_type n, difference_type &dy, difference_type &dz, difference_type &ex )
+		{
+			dy = n == 0 ? -1 : 1;
+			dz = 0;
+			ex = 0;
+		}
+	};
+
+
+	// ɘAōŏ̃ԍƂȂ Union-Find
+	inline size_type find_root( std::vector< size_type > &parent, size_type x )
+	{
+		while( parent[ x ] != x )
+		{
+			parent[ x ] = parent[ parent[ x ] ];
+			x = parent[ x ];
+		}
+		return( x );
+	}
+
+	inline void merge_root( std::vector< size_type > &parent, size_type a, size_type b )
+	{
+		a = find_root( parent, a );
+		b = find_root( parent, b );
+		if( a < b )
+		{
+			parent[ b ] = a;
+		}
+		else if( b < a )
+		{
+			parent[ a ] = b;
+		}
+	}
+
+
+	template < class neighbor >
+	size_type labeling( const run_length_mask &in, std::vector< size_type > &label, const neighbor /* dmy */ )
+	{
+		const difference_type h = in.height( );
+		const difference_type d = in.depth( );
+
+		std::vector< size_type > &parent = label;
+		parent.resize( in.run_num( ) );
+		for( size_type n = 0 ; n < parent.size( ) ; n++ )
+		{
+			parent[ n ] = n;
+		}
+
+		for( difference_type k = 0 ; k < d ; k++ )
+		{
+			for( difference_type j = 0 ; j < h ; j++ )
+			{
+				const size_type r = j + k * h;
+
+				for( size_type l = 0 ; l < neighbor::row_num ; l++ )
+				{
+					difference_type dy, dz, ex;
+					neighbor::row( l, dy, dz, ex );
+
+					// ς݂̍ŝ݂𒲂ׂ
+					if( dz > 0 || ( dz == 0 && dy > 0 ) || j + dy < 0 || j + dy >= h || k + dz < 0 )
+					{
+						continue;
+					}
+
+					const size_type rr = ( j + dy ) + ( k + dz ) * h;
+
+					// X  ex fLƂɏdȂ郉̑g𓝍
+					size_type n = in.row_begin( r ), m = in.row_begin( rr );
+					while( n < in.row_end( r ) && m < in.row_end( rr ) )
+					{
+						const run_type &a = in.run( n );
+						const run_type &b = in.run( m );
+
+						if( b.start < a.end + ex && a.start < b.end + ex )
+						{
+							merge_root( parent, n, m );
+						}
+
+						if( b.end < a.end )
+						{
+							m++;
+						}
+						else
+						{
+							n++;
+						}
+					}
+				}
+			}
+		}
+
+		// ̃ɑɃx蓖Ă
+		size_type label_num = 0;
+		for( size_type n = 0 ; n < parent.size( ) ; n++ )
+		{
+			if( parent[ n ] == n )
+			{
+				label[ n ] = ++label_num;
+			}
+			else
+			{
+				label[ n ] = label[ parent[ n ] ];
+			}
+		}
+
+		return( label_num );
+	}
+
+
+	//  [s, t)  X  ex fk out ɒǉireplicate  true ̏ꍇ͉摜̒[ł͎kȂj
+	inline void erode_run( size_type s, size_type t, size_type ex, size_type width, bool replicate, std::vector< run_type > &out )
+	{
+		size_type ss = replicate && s == 0 ? 0 : s + ex;
+		size_type tt = replicate && t == width ? width : ( t > ex ? t - ex : 0 );
+		if( ss < tt )
+		{
+			out.push_back( run_type( ss, tt ) );
+		}
+	}
+
+	// ɕ2̗̃̋ʕ߂
+	inline void intersect_runs( const std::vector< run_type > &r1, const std::vector< run_type > &r2, std::vector< run_type > &out )
+	{
+		out.clear( );
+
+		size_type n = 0, m = 0;
+		while( n < r1.size( ) && m < r2.size( ) )
+		{
+			size_type s = r1[ n ].start > r2[ m ].start ? r1[ n ].start : r2[ m ].start;
+			size_type t = r1[ n ].end < r2[ m ].end ? r1[ n ].end : r2[ m ].end;
+			if( s < t )
+			{
+				out.push_back( run_type( s, t ) );
+			}
+
+			if( r1[ n ].end < r2[ m ].end )
+			{
+				n++;
+			}
+			else
+			{
+				m++;
+			}
+		}
+	}
+
+
+	template < class neighbor >
+	size_type boundary( const run_length_mask &in, run_length_mask &out, bool boundary_is_border, const neighbor /* dmy */ )
+	{
+		const difference_type w = in.width( );
+		const difference_type h = in.height( );
+		const difference_type d = in.depth( );
+		const bool replicate = !boundary_is_border;
+
+		run_length_mask tmp( w, h, d );
+		tmp.reso1( in.reso1( ) );
+		tmp.reso2( in.reso2( ) );
+		tmp.reso3( in.reso3( ) );
+
+		std::vector< run_type > inside, work, cover;
+		size_type count = 0;
+
+		for( difference_type k = 0 ; k < d ; k++ )
+		{
+			for( difference_type j = 0 ; j < h ; j++ )
+			{
+				const size_type r = j + k * h;
+				size_type n;
+
+				// s̍ẺfOił͈
+				inside.clear( );
+				for( n = in.row_begin( r ) ; n < in.row_end( r ) ; n++ )
+				{
+					erode_run( in.run( n ).start, in.run( n ).end, 1, w, replicate, inside );
+				}
+
+				// ߖT̊esŁCX  ex f͈̔͂SđOił͈͂Ƃ̋ʕ߂
+				for( size_type l = 0 ; l < neighbor::row_num && !inside.empty( ) ; l++ )
+				{
+					difference_type dy, dz, ex;
+					neighbor::row( l, dy, dz, ex );
+
+					difference_type y = j + dy, z = k + dz;
+					if( y < 0 || y >= h || z < 0 || z >= d )
+					{
+						if( boundary_is_border )
+						{
+							inside.clear( );
+							break;
+						}
+
+						// 摜̊O͒[̉f̂Ƃ݂Ȃ
+						y = y < 0 ? 0 : ( y >= h ? h - 1 : y );
+						z = z < 0 ? 0 : ( z >= d ? d - 1 : z );
+					}
+
+					const size_type rr = y + z * h;
+
+					cover.clear( );
+					for( n = in.row_begin( rr ) ; n < in.row_end( rr ) ; n++ )
+					{
+						erode_run( in.run( n ).start, in.run( n ).end, ex, w, replicate, cover );
+					}
+
+					intersect_runs( inside, cover, work );
+					inside.swap( work );
+				}
+
+				// ͈̔͂菜EfƂȂ
+				size_type m = 0;
+				for( n = in.row_begin( r ) ; n < in.row_end( r ) ; n++ )
+				{
+					size_type s = in.run( n ).start;
+					const size_type t = in.run( n ).end;
+
+					for( ; m < inside.size( ) && inside[ m ].start < t ; m++ )
+					{
+						tmp.append( s, inside[ m ].start );
+						count += inside[ m ].start - s;
+						s = inside[ m ].end;
+					}
+
+					tmp.append( s, t );
+					count += t - s;
+				}
+
+				tmp.end_row( );
+			}
+		}
+
+		out = tmp;
+
+		return( count );
+	}
+}
+
+
+//! @addtogroup run_length_group OX\2l摜
+//!
+//!  @{
+
+
+/// @brief OX\2l摜ɑ΂郉xOƋEfo
+//! 
+//! PʂƂď邽߁CvZʂ͉fł͂Ȃ̐ɔႷD
+//! 蓖Ă郉x mist::labeling4 ȂǂƓiŐɌA 1, 2, ... ƔԍtjD
+//! 
+//! Efo boundary_is_border = false Ƃʂ mist::boundary4 ȂǂƓɂȂD
+//! boundary_is_border = true ̏ꍇ͉摜̊OɐڂfEƂ邪Cmist::boundary4 Ȃǂ͊e̐擪2fڂEƂ邽߁C
+//! ̉f̂݌ʂقȂD
+//! 
+namespace run_length
+{
+	/// @brief OX\2摜ɑ΂4ߖT^xO
+	//! 
+	//! dȂi܂͋ߖTŐڂj̑g Union-Find œC̃x߂
+	//! 
+	//! @param[in]  in    c OX\2l摜
+	//! @param[out] label c ̃xilabel[ n ]  n Ԗڂ̃̃xj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	inline run_length_mask::size_type labeling4( const run_length_mask &in, std::vector< run_length_mask::size_type > &label )
+	{
+		return( __run_length_controller__::labeling( in, label, __run_length_controller__::neighbors< 4 >( ) ) );
+	}
+
+
+	/// @brief OX\2摜ɑ΂8ߖT^xO
+	//! 
+	//! dȂi܂͋ߖTŐڂj̑g Union-Find œC̃x߂
+	//! 
+	//! @param[in]  in    c OX\2l摜
+	//! @param[out] label c ̃xilabel[ n ]  n Ԗڂ̃̃xj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	inline run_length_mask::size_type labeling8( const run_length_mask &in, std::vector< run_length_mask::size_type > &label )
+	{
+		return( __run_length_controller__::labeling( in, label, __run_length_controller__::neighbors< 8 >( ) ) );
+	}
+
+
+	/// @brief OX\3摜ɑ΂6ߖT^xO
+	//! 
+	//! dȂi܂͋ߖTŐڂj̑g Union-Find œC̃x߂
+	//! 
+	//! @param[in]  in    c OX\2l摜
+	//! @param[out] label c ̃xilabel[ n ]  n Ԗڂ̃̃xj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	inline run_length_mask::size_type labeling6( const run_length_mask &in, std::vector< run_length_mask::size_type > &label )
+	{
+		return( __run_length_controller__::labeling( in, label, __run_length_controller__::neighbors< 6 >( ) ) );
+	}
+
+
+	/// @brief OX\3摜ɑ΂18ߖT^xO
+	//! 
+	//! dȂi܂͋ߖTŐڂj̑g Union-Find œC̃x߂
+	//! 
+	//! @param[in]  in    c OX\2l摜
+	//! @param[out] label c ̃xilabel[ n ]  n Ԗڂ̃̃xj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	inline run_length_mask::size_type labeling18( const run_length_mask &in, std::vector< run_length_mask::size_type > &label )
+	{
+		return( __run_length_controller__::labeling( in, label, __run_length_controller__::neighbors< 18 >( ) ) );
+	}
+
+
+	/// @brief OX\3摜ɑ΂26ߖT^xO
+	//! 
+	//! dȂi܂͋ߖTŐڂj̑g Union-Find œC̃x߂
+	//! 
+	//! @param[in]  in    c OX\2l摜
+	//! @param[out] label c ̃xilabel[ n ]  n Ԗڂ̃̃xj
+	//! 
+	//! @return 蓖Ăꂽx
+	//! 
+	inline run_length_mask::size_type labeling26( const run_length_mask &in, std::vector< run_length_mask::size_type > &label )
+	{
+		return( __run_length_controller__::labeling( in, label, __run_length_controller__::neighbors< 26 >( ) ) );
+	}
+
+
+	/// @brief OX\2l摜Cwi4ߖTŐڂ鋫Ef𒊏o
+	//! 
+	//! wi4ߖTŐڂ鋫EfOX\ŏo͂
+	//! 
+	//! @attention ͂Əo͂IuWFNgł삷
+	//! 
+	//! @param[in]  in     c OX\2l摜
+	//! @param[out] out    c Ef̃OX\
+	//! @param[in]  boundary_is_border c 摜̊OwiƂ݂Ȃǂifalse ̏ꍇ͒[̉f̂Ƃ݂Ȃj
+	//! 
+	//! @return Ef
+	//! 
+	inline run_length_mask::size_type boundary4( const run_length_mask &in, run_length_mask &out, bool boundary_is_border = true )
+	{
+		return( __run_length_controller__::boundary( in, out, boundary_is_border, __run_length_controller__::neighbors< 4 >( ) ) );
+	}
+
+
+	/// @brief OX\2l摜Cwi8ߖTŐڂ鋫Ef𒊏o
+	//! 
+	//! wi8ߖTŐڂ鋫EfOX\ŏo͂
+	//! 
+	//! @attention ͂Əo͂IuWFNgł삷
+	//! 
+	//! @param[in]  in     c OX\2l摜
+	//! @param[out] out    c Ef̃OX\
+	//! @param[in]  boundary_is_border c 摜̊OwiƂ݂Ȃǂifalse ̏ꍇ͒[̉f̂Ƃ݂Ȃj
+	//! 
+	//! @return Ef
+	//! 
+	inline run_length_mask::size_type boundary8( const run_length_mask &in, run_length_mask &out, bool boundary_is_border = true )
+	{
+		return( __run_length_controller__::boundary( in, out, boundary_is_border, __run_length_controller__::neighbors< 8 >( ) ) );
+	}
+
+
+	/// @brief OX\2l摜Cwi6ߖTŐڂ鋫Ef𒊏o
+	//! 
+	//! wi6ߖTŐڂ鋫EfOX\ŏo͂
+	//! 
+	//! @attention ͂Əo͂IuWFNgł삷
+	//! 
+	//! @param[in]  in     c OX\2l摜
+	//! @param[out] out    c Ef̃OX\
+	//! @param[in]  boundary_is_border c 摜̊OwiƂ݂Ȃǂifalse ̏ꍇ͒[̉f̂Ƃ݂Ȃj
+	//! 
+	//! @return Ef
+	//! 
+	inline run_length_mask::size_type boundary6( const run_length_mask &in, run_length_mask &out, bool boundary_is_border = true )
+	{
+		return( __run_length_controller__::boundary( in, out, boundary_is_border, __run_length_controller__::neighbors< 6 >( ) ) );
+	}
+
+
+	/// @brief OX\2l摜Cwi18ߖTŐڂ鋫Ef𒊏o
+	//! 
+	//! wi18ߖTŐڂ鋫EfOX\ŏo͂
+	//! 
+	//! @attention ͂Əo͂IuWFNgł삷
+	//! 
+	//! @param[in]  in     c OX\2l摜
+	//! @param[out] out    c Ef̃OX\
+	//! @param[in]  boundary_is_border c 摜̊OwiƂ݂Ȃǂifalse ̏ꍇ͒[̉f̂Ƃ݂Ȃj
+	//! 
+	//! @return Ef
+	//! 
+	inline run_length_mask::size_type boundary18( const run_length_mask &in, run_length_mask &out, bool boundary_is_border = true )
+	{
+		return( __run_length_controller__::boundary( in, out, boundary_is_border, __run_length_controller__::neighbors< 18 >( ) ) );
+	}
+
+
+	/// @brief OX\2l摜Cwi26ߖTŐڂ鋫Ef𒊏o
+	//! 
+	//! wi26ߖTŐڂ鋫EfOX\ŏo͂
+	//! 
+	//! @attention ͂Əo͂IuWFNgł삷
+	//! 
+	//! @param[in]  in     c OX\2l摜
+	//! @param[out] out    c Ef̃OX\
+	//! @param[in]  boundary_is_border c 摜̊OwiƂ݂Ȃǂifalse ̏ꍇ͒[̉f̂Ƃ݂Ȃj
+	//! 
+	//! @return Ef
+	//! 
+	inline run_length_mask::size_type boundary26( const run_length_mask &in, run_length_mask &out, bool boundary_is_border = true )
+	{
+		return( __run_length_controller__::boundary( in, out, boundary_is_border, __run_length_controller__::neighbors< 26 >( ) ) );
+	}
+
+
+	/// @brief ̃x2̃x摜쐬
+	//! 
+	//! @param[in]  in    c OX\2l摜
+	//! @param[in]  label c ̃x
+	//! @param[out] out   c o͉摜
+	//! 
+	template < class T, class Allocator >
+	void convert( const run_length_mask &in, const std::vector< run_length_mask::size_type > &label, array2< T, Allocator > &out )
+	{
+		typedef run_length_mask::size_type size_type;
+		typedef typename array2< T, Allocator >::value_type value_type;
+
+		out.resize( in.width( ), in.height( ) * in.depth( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.fill( );
+
+		for( size_type r = 0 ; r < in.row_num( ) ; r++ )
+		{
+			for( size_type n = in.row_begin( r ) ; n < in.row_end( r ) ; n++ )
+			{
+				for( size_type i = in.run( n ).start ; i < in.run( n ).end ; i++ )
+				{
+					out( i, r ) = static_cast< value_type >( label[ n ] );
+				}
+			}
+		}
+	}
+
+
+	/// @brief ̃x3̃x摜쐬
+	//! 
+	//! @param[in]  in    c OX\2l摜
+	//! @param[in]  label c ̃x
+	//! @param[out] out   c o͉摜
+	//! 
+	template < class T, class Allocator >
+	void convert( const run_length_mask &in, const std::vector< run_length_mask::size_type > &label, array3< T, Allocator > &out )
+	{
+		typedef run_length_mask::size_type size_type;
+		typedef typename array3< T, Allocator >::value_type value_type;
+
+		out.resize( in.width( ), in.height( ), in.depth( ) );
+		out.reso1( in.reso1( ) );
+		out.reso2( in.reso2( ) );
+		out.reso3( in.reso3( ) );
+		out.fill( );
+
+		for( size_type r = 0 ; r < in.row_num( ) ; r++ )
+		{
+			typename array3< T, Allocator >::pointer p = &out[ 0 ] + r * in.width( );
+			for( size_type n = in.row_begin( r ) ; n < in.row_end( r ) ; n++ )
+			{
+				for( size_type i = in.run( n ).start ; i < in.run( n ).end ; i++ )
+				{
+					p[ i ] = static_cast< value_type >( label[ n ] );
+				}
+			}
+		}
+	}
+}
+
+
+/// @}
+//  OX\O[v̏I
+
+
+// mistOԂ̏I
+_MIST_END
+
+
+#endif // __INCLUDE_MIST_RUN_LENGTH__
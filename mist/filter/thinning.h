@@ -57,6 +57,10 @@
 #include "distance.h"
 #endif
 
+#ifndef __INCLUDE_MIST_THREAD__
+#include "../thread.h"
+#endif
+
 #include <vector>
 
 
@@ -1316,8 +1320,153 @@ namespace __euclidean_utility__
 		return( out );
 	}
 
+	// TuTCNɂ1f̏
+	// f26ߖTɂ鋫Efɂ́Cꎞۑ_̍Ĕ肪Kvł邱Ƃil2jt
+	template < class T, class Allocator, class Neighbor, class Difference >
+	inline void delete_border_point( array3< T, Allocator > &in, const border< T > &bb, const Difference diff[ 27 ], const Difference nc6[ 6 ], std::vector< border< T > > &blist, Neighbor /* __dmy__ */ )
+	{
+		typedef typename array3< T, Allocator >::size_type size_type;
+		typedef typename array3< T, Allocator >::pointer pointer;
+		typedef border< T > border_type;
+		typedef Neighbor neighbor_type;
+
+		int val[ 27 ];
+		border_type b = bb;
+		pointer p = &in[ b.diff ];
+
+		create_neighbor_list( p, val, diff );
+
+		//s\Ȃꎞۑ_
+		if( !neighbor_type::is_deletable( val ) )
+		{
+			b.value = 16;
+			blist.push_back( b );
+			return;
+		}
+
+		size_type num = 0, i;
+
+		// g𒲂ׂ
+		for( i = 0 ; i < 9 && num < 2 ; i++ )
+		{
+			if( val[ i ] > 0 )
+			{
+				num++;
+			}
+		}
+		for( i = 10 ; i < 27 && num < 2 ; i++ )
+		{
+			if( val[ i ] > 0 )
+			{
+				num++;
+			}
+		}
+
+		//[_Ȃivۑ_
+		if( num > 1 )
+		{
+			//f̏
+			p[ 0 ] = 0;
+
+			// ߖT̋EfɍĔ̈t
+			for( i = 0 ; i < 27 ; i++ )
+			{
+				if( p[ diff[ i ] ] == 1 )
+				{
+					p[ diff[ i ] ] = 2;
+				}
+			}
+
+			for( i = 0 ; i < 6 ; i++ )
+			{
+				if( p[ nc6[ i ] ] > 20 )
+				{
+					blist.push_back( border_type( b.diff + nc6[ i ], p[ nc6[ i ] ] ) );
+					p[ nc6[ i ] ] = 1;
+				}
+			}
+		}
+	}
+
+	// TuTCN1TutB[hɏXbh
+	template < class T, class Allocator, class Neighbor >
+	class thinning_thread : public mist::thread< thinning_thread< T, Allocator, Neighbor > >
+	{
+	public:
+		typedef mist::thread< thinning_thread< T, Allocator, Neighbor > > base;
+		typedef typename base::thread_exit_type thread_exit_type;
+		typedef typename array3< T, Allocator >::size_type size_type;
+		typedef typename array3< T, Allocator >::difference_type difference_type;
+		typedef border< T > border_type;
+		typedef std::vector< border_type > border_list_type;
+
+	private:
+		array3< T, Allocator > *in_;
+		const border_list_type *list_;
+		const difference_type *diff_;
+		const difference_type *nc6_;
+		size_type begin_;
+		size_type end_;
+		border_list_type blist_;
+
+	public:
+		void setup_parameters( array3< T, Allocator > &in, const border_list_type &list, size_type begin, size_type end, const difference_type *diff, const difference_type *nc6 )
+		{
+			in_    = &in;
+			list_  = &list;
+			begin_ = begin;
+			end_   = end;
+			diff_  = diff;
+			nc6_   = nc6;
+			blist_.clear( );
+		}
+
+		border_list_type &border_list( ) { return( blist_ ); }
+
+		const thinning_thread& operator =( const thinning_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				in_ = p.in_;
+				list_ = p.list_;
+				diff_ = p.diff_;
+				nc6_ = p.nc6_;
+				begin_ = p.begin_;
+				end_ = p.end_;
+				blist_ = p.blist_;
+			}
+			return( *this );
+		}
+
+		thinning_thread( ) : in_( NULL ), list_( NULL ), diff_( NULL ), nc6_( NULL ), begin_( 0 ), end_( 0 )
+		{
+		}
+
+		thinning_thread( const thinning_thread &p ) : base( p ), in_( p.in_ ), list_( p.list_ ), diff_( p.diff_ ), nc6_( p.nc6_ ),
+														begin_( p.begin_ ), end_( p.end_ ), blist_( p.blist_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			const border_list_type &list = *list_;
+			for( size_type l = begin_ ; l < end_ ; l++ )
+			{
+				delete_border_point( *in_, list[ l ], diff_, nc6_, blist_, Neighbor( ) );
+			}
+			return( 0 );
+		}
+	};
+
+	// thread_num 1̏ꍇ́CTuTCN̊eXg]ʂ胉X^ɏ
+	// thread_num 2ȏ̏ꍇ́CW3Ŋ]ɂ27̃TutB[hɕĊeTutB[hɏ
+	// TutB[h̉fǂ26ߖTdȂȂ߁CɏĂ݂ɓǂݏf͖C̏ԂɂˑȂ
+	// ̂߁C2ȏ̃Xbhł͍אʂ̓Xbhɂ炸ɂȂ
 	template < class T, class Allocator, class Neighbor >
-	void thinning( array3< T, Allocator > &in, Neighbor __dmy__ )
+	void thinning( array3< T, Allocator > &in, Neighbor /* __dmy__ */, typename array3< T, Allocator >::size_type thread_num = 1 )
 	{
 		typedef typename array3< T, Allocator >::size_type size_type;
 		typedef typename array3< T, Allocator >::difference_type difference_type;
@@ -1327,6 +1476,12 @@ namespace __euclidean_utility__
 		typedef Neighbor neighbor_type;
 		typedef border< T > border_type;
 		typedef std::vector< border_type > border_list_type;
+		typedef thinning_thread< T, Allocator, Neighbor > thinning_thread_type;
+
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_type >( get_cpu_num( ) );
+		}
 
 		// Step1 ϊ
 		euclidean::distance_transform( in, in );
@@ -1454,6 +1609,10 @@ namespace __euclidean_utility__
 		slist[ 7 ].reserve( blist.size( ) );
 		slist[ 8 ].reserve( blist.size( ) );
 
+		// TutB[hƂ̕񏈗ɗp郊XgƃXbh
+		border_list_type sub[ 27 ];
+		thinning_thread_type *thread = thread_num > 1 ? new thinning_thread_type[ thread_num ] : NULL;
+
 		size_type count = 0, loop = 0;
 
 		do
@@ -1466,7 +1625,8 @@ namespace __euclidean_utility__
 				border_type &b = blist[ l ];
 				pointer p = &in[ b.diff ];
 
-				if( b.value <= min )
+				// ꎞۑ_͑ÕTCN̍Ōɔς݂ŁCȍ~ɉf͍̏sĂȂߍĔ肵Ȃ
+				if( b.value <= min && b.value != 16 )
 				{
 					create_neighbor_list( p, val, diff );
 
@@ -1534,75 +1694,58 @@ namespace __euclidean_utility__
 			{
 				border_list_type &list = slist[ ll ];
 
+				if( thread_num < 2 )
+				{
+					// 1Xbh̏ꍇ͏]ʂ胉X^ɏ
+					for( size_type l = 0 ; l < list.size( ) ; l++ )
+					{
+						delete_border_point( in, list[ l ], diff, nc6, blist, neighbor_type( ) );
+					}
+
+					// ȍ~̏̂߂ɃXgɂiŎgp郁eʂ͕ωȂj
+					list.clear( );
+					continue;
+				}
+
+				// W3Ŋ]27̃TutB[hɕ
+				for( size_type s = 0 ; s < 27 ; s++ )
+				{
+					sub[ s ].clear( );
+				}
+
 				for( size_type l = 0 ; l < list.size( ) ; l++ )
 				{
-					border_type &b = list[ l ];
-					pointer p = &in[ b.diff ];
+					size_type indx = static_cast< size_type >( list[ l ].diff );
+					size_type i = indx % in.width( );
+					size_type j = ( indx / in.width( ) ) % in.height( );
+					size_type k = indx / ( in.width( ) * in.height( ) );
+					sub[ i % 3 + ( j % 3 ) * 3 + ( k % 3 ) * 9 ].push_back( list[ l ] );
+				}
 
-					create_neighbor_list( p, val, diff );
+				for( size_type s = 0 ; s < 27 ; s++ )
+				{
+					border_list_type &slst = sub[ s ];
 
-					//s\Ȃꎞۑ_
-					if( !neighbor_type::is_deletable( val ) )
+					if( slst.size( ) < thread_num * 16 )
 					{
-						b.value = 16;
-						blist.push_back( b );
+						for( size_type l = 0 ; l < slst.size( ) ; l++ )
+						{
+							delete_border_point( in, slst[ l ], diff, nc6, blist, neighbor_type( ) );
+						}
 					}
 					else
 					{
-						size_type num = 0, i;
-
-						// g𒲂ׂ
-						for( i = 0 ; i < 9 && num < 2 ; i++ )
+						for( size_type t = 0 ; t < thread_num ; t++ )
 						{
-							if( val[ i ] > 0 )
-							{
-								num++;
-							}
-						}
-						for( i = 10 ; i < 27 && num < 2 ; i++ )
-						{
-							if( val[ i ] > 0 )
-							{
-								num++;
-							}
+							thread[ t ].setup_parameters( in, slst, slst.size( ) * t / thread_num, slst.size( ) * ( t + 1 ) / thread_num, diff, nc6 );
 						}
 
-						//[_Ȃivۑ_
-						if( num > 1 )
-						{
-							//f̏
-							p[ 0 ] = 0;
+						do_threads_( thread, thread_num );
 
-							if( p[ nc6[ 0 ] ] > 20 )
-							{
-								blist.push_back( border_type( b.diff + nc6[ 0 ], p[ nc6[ 0 ] ] ) );
-								p[ nc6[ 0 ] ] = 1;
-							}
-							if( p[ nc6[ 1 ] ] > 20 )
-							{
-								blist.push_back( border_type( b.diff + nc6[ 1 ], p[ nc6[ 1 ] ] ) );
-								p[ nc6[ 1 ] ] = 1;
-							}
-							if( p[ nc6[ 2 ] ] > 20 )
-							{
-								blist.push_back( border_type( b.diff + nc6[ 2 ], p[ nc6[ 2 ] ] ) );
-								p[ nc6[ 2 ] ] = 1;
-							}
-							if( p[ nc6[ 3 ] ] > 20 )
-							{
-								blist.push_back( border_type( b.diff + nc6[ 3 ], p[ nc6[ 3 ] ] ) );
-								p[ nc6[ 3 ] ] = 1;
-							}
-							if( p[ nc6[ 4 ] ] > 20 )
-							{
-								blist.push_back( border_type( b.diff + nc6[ 4 ], p[ nc6[ 4 ] ] ) );
-								p[ nc6[ 4 ] ] = 1;
-							}
-							if( p[ nc6[ 5 ] ] > 20 )
-							{
-								blist.push_back( border_type( b.diff + nc6[ 5 ], p[ nc6[ 5 ] ] ) );
-								p[ nc6[ 5 ] ] = 1;
-							}
+						for( size_type t = 0 ; t < thread_num ; t++ )
+						{
+							border_list_type &tlist = thread[ t ].border_list( );
+							blist.insert( blist.end( ), tlist.begin( ), tlist.end( ) );
 						}
 					}
 				}
@@ -1611,13 +1754,16 @@ namespace __euclidean_utility__
 				list.clear( );
 			}
 
+			// ߖT̉fꂽꎞۑ_݂̂Ĕ肷
 			for( size_type l = 0 ; l < blist.size( ) ; l++ )
 			{
 				border_type &b = blist[ l ];
 				pointer p = &in[ b.diff ];
 
-				if( b.value == 16 )
+				if( b.value == 16 && p[ 0 ] == 2 )
 				{
+					p[ 0 ] = 1;
+
 					create_neighbor_list( p, val, diff );
 
 					if( neighbor_type::is_deletable( val ) )
@@ -1650,6 +1796,8 @@ namespace __euclidean_utility__
 
 		std::cout << std::endl;
 
+		delete [] thread;
+
 		// Step6 ㏈
 		for( size_type i = 0 ; i < in.size( ) ; i++ )
 		{
@@ -2165,11 +2313,18 @@ namespace euclidean
 	//! ̂߁Co͉摜̃f[^^ unsinged char ̏ꍇɂ́C摜̃TCYɂĂ͋ϊŌ܂Ős܂D
 	//! אsꍇ́Cunsigned short 傫l\łf[^^𗘗pĂD 
 	//!
-	//! @param[in]  in  c ͉摜
-	//! @param[out] out c o͉摜i012lj
+	//! thread_num 2ȏw肷ƁCTuTCNW3Ŋ]ɂ27̃TutB[hɕāCeTutB[hɏ܂D
+	//! TutB[h̉fǂ26ߖTdȂȂ߁C2ȏ̃Xbhł͍אʂ̓Xbhɂ炸ɂȂ܂D
+	//!
+	//! @attention thread_num 1ilj̏ꍇ͏]ʂ胉X^ɏ܂D2ȏ̏ꍇƂ͉f̏قȂ邽߁CאʂvƂ͌܂D
+	//! @attention thread_num 0w肵ꍇ́CCPU1ł΃X^C2ȏł΃TutB[hŏ܂D
+	//!
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜i012lj
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
 	//!
 	template < class T1, class T2, class Allocator1, class Allocator2 >
-	void thinning6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+	void thinning6( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 1 )
 	{
 		typedef typename array3< T2, Allocator2 >::size_type  size_type;
 		typedef typename array3< T2, Allocator2 >::value_type value_type;
@@ -2186,7 +2341,7 @@ namespace euclidean
 			{
 				out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
 			}
-			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 6 >( ) );
+			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 6 >( ), thread_num );
 		}
 		else
 		{
@@ -2202,7 +2357,7 @@ namespace euclidean
 			{
 				out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
 			}
-			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 6 >( ) );
+			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 6 >( ), thread_num );
 
 			out.reso1( r1 );
 			out.reso2( r2 );
@@ -2228,11 +2383,18 @@ namespace euclidean
 	//! ̂߁Co͉摜̃f[^^ unsinged char ̏ꍇɂ́C摜̃TCYɂĂ͋ϊŌ܂Ős܂D
 	//! אsꍇ́Cunsigned short 傫l\łf[^^𗘗pĂD 
 	//!
-	//! @param[in]  in  c ͉摜
-	//! @param[out] out c o͉摜i012lj
+	//! thread_num 2ȏw肷ƁCTuTCNW3Ŋ]ɂ27̃TutB[hɕāCeTutB[hɏ܂D
+	//! TutB[h̉fǂ26ߖTdȂȂ߁C2ȏ̃Xbhł͍אʂ̓Xbhɂ炸ɂȂ܂D
+	//!
+	//! @attention thread_num 1ilj̏ꍇ͏]ʂ胉X^ɏ܂D2ȏ̏ꍇƂ͉f̏قȂ邽߁CאʂvƂ͌܂D
+	//! @attention thread_num 0w肵ꍇ́CCPU1ł΃X^C2ȏł΃TutB[hŏ܂D
+	//!
+	//! @param[in]  in         c ͉摜
+	//! @param[out] out        c o͉摜i012lj
+	//! @param[in]  thread_num c gpXbhi0̏ꍇCPUgpj
 	//!
 	template < class T1, class T2, class Allocator1, class Allocator2 >
-	void thinning26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out )
+	void thinning26( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, typename array3< T1, Allocator1 >::size_type thread_num = 1 )
 	{
 		typedef typename array3< T2, Allocator2 >::size_type  size_type;
 		typedef typename array3< T2, Allocator2 >::value_type value_type;
@@ -2249,7 +2411,7 @@ namespace euclidean
 			{
 				out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
 			}
-			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 26 >( ) );
+			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 26 >( ), thread_num );
 		}
 		else
 		{
@@ -2265,7 +2427,7 @@ namespace euclidean
 			{
 				out[ i ] = static_cast< value_type >( in[ i ] > 0 ? 1 : 0 );
 			}
-			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 26 >( ) );
+			__euclidean_utility__::thinning( out, __euclidean_utility__::neighbor< 26 >( ), thread_num );
 
 			out.reso1( r1 );
 			out.reso2( r2 );
@@ -45,6 +45,12 @@
 #include "vector.h"
 #endif
 
+#ifndef __INCLUDE_MIST_INTERPOLATE__
+#include "interpolate.h"
+#endif
+
+#include <algorithm>
+
 _MIST_BEGIN
 
 
@@ -216,11 +222,245 @@ namespace detail
 			dy1 = ( dy1 > static_cast< int >( ty[ i ] ) ) ? dy1 : static_cast< int >( ty[ i ] );
 		}
 	}
+
+	// 3̃AtBϊ y = A x + t ̋tϊ߂Dm[ 0 .. 11 ] ɋtϊ 3 ~ 4 ssƂɊi[
+	template< class T, class Allocator >
+	bool inverse_affine3( const matrix< T, Allocator > &mat, double m[ 12 ] )
+	{
+		if( ( mat.rows( ) != 3 && mat.rows( ) != 4 ) || mat.cols( ) != 4 )
+		{
+			return( false );
+		}
+
+		double a00 = mat( 0, 0 ), a01 = mat( 0, 1 ), a02 = mat( 0, 2 );
+		double a10 = mat( 1, 0 ), a11 = mat( 1, 1 ), a12 = mat( 1, 2 );
+		double a20 = mat( 2, 0 ), a21 = mat( 2, 1 ), a22 = mat( 2, 2 );
+
+		double c00 = a11 * a22 - a12 * a21;
+		double c01 = a02 * a21 - a01 * a22;
+		double c02 = a01 * a12 - a02 * a11;
+		double det = a00 * c00 + a10 * c01 + a20 * c02;
+
+		if( det == 0.0 )
+		{
+			return( false );
+		}
+
+		double idet = 1.0 / det;
+		m[ 0 ] = c00 * idet;
+		m[ 1 ] = c01 * idet;
+		m[ 2 ] = c02 * idet;
+		m[ 4 ] = ( a12 * a20 - a10 * a22 ) * idet;
+		m[ 5 ] = ( a00 * a22 - a02 * a20 ) * idet;
+		m[ 6 ] = ( a02 * a10 - a00 * a12 ) * idet;
+		m[ 8 ] = ( a10 * a21 - a11 * a20 ) * idet;
+		m[ 9 ] = ( a01 * a20 - a00 * a21 ) * idet;
+		m[ 10 ] = ( a00 * a11 - a01 * a10 ) * idet;
+
+		double tx = mat( 0, 3 ), ty = mat( 1, 3 ), tz = mat( 2, 3 );
+		m[ 3 ] = -( m[ 0 ] * tx + m[ 1 ] * ty + m[ 2 ] * tz );
+		m[ 7 ] = -( m[ 4 ] * tx + m[ 5 ] * ty + m[ 6 ] * tz );
+		m[ 11 ] = -( m[ 8 ] * tx + m[ 9 ] * ty + m[ 10 ] * tz );
+
+		return( true );
+	}
+
+	// ͍̓W p + x d SĂ̎ [ 0, size - 1 ] ɓ x ͈̔ [ xs, xe ] ߂
+	inline bool clip_scanline( const double p[ 3 ], const double d[ 3 ], const double size[ 3 ], int width, int &xs, int &xe )
+	{
+		const double eps = 1.0e-9;
+		double lo = 0.0, hi = width - 1.0;
+
+		for( int a = 0 ; a < 3 ; a++ )
+		{
+			double upper = size[ a ] - 1.0;
+			if( d[ a ] == 0.0 )
+			{
+				if( p[ a ] < -eps || p[ a ] > upper + eps )
+				{
+					return( false );
+				}
+			}
+			else
+			{
+				double t0 = ( -eps - p[ a ] ) / d[ a ];
+				double t1 = ( upper + eps - p[ a ] ) / d[ a ];
+				lo = std::max( lo, std::min( t0, t1 ) );
+				hi = std::min( hi, std::max( t0, t1 ) );
+			}
+		}
+
+		if( lo > hi )
+		{
+			return( false );
+		}
+
+		xs = static_cast< int >( std::ceil( lo ) );
+		xe = static_cast< int >( std::floor( hi ) );
+		return( xs <= xe );
+	}
+
+	inline double clamp_coordinate( double v, double upper )
+	{
+		return( v < 0.0 ? 0.0 : ( v > upper ? upper : v ) );
+	}
+
+	// 3摜̔Cӂ̈ʒu ( x, y, z ) ̒l߂ԕ@iW [ 0, size - 1 ] ͈͓̔Ƃj
+	struct nearest_sampler3
+	{
+		template< class T1, class Allocator1, class T2 >
+		static void sample( const array3< T1, Allocator1 > &in, double x, double y, double z, T2 &out )
+		{
+			out = in( static_cast< size_t >( x + 0.5 ), static_cast< size_t >( y + 0.5 ), static_cast< size_t >( z + 0.5 ) );
+		}
+	};
+
+	struct linear_sampler3
+	{
+		template< class T1, class Allocator1, class T2 >
+		static void sample( const array3< T1, Allocator1 > &in, double x, double y, double z, T2 &out )
+		{
+			size_t i1 = static_cast< size_t >( x ), j1 = static_cast< size_t >( y ), k1 = static_cast< size_t >( z );
+			size_t i2 = i1 < in.width( ) - 1 ? i1 + 1 : i1;
+			size_t j2 = j1 < in.height( ) - 1 ? j1 + 1 : j1;
+			size_t k2 = k1 < in.depth( ) - 1 ? k1 + 1 : k1;
+			__interpolate_utility__::round( __linear__::_linear_< is_color< T1 >::value >::interpolate( in, i1, i2, j1, j2, k1, k2, x - i1, y - j1, z - k1 ), out );
+		}
+	};
+
+	struct cubic_sampler3
+	{
+		static void neighbors( double v, size_t n, size_t ii[ 4 ], double &t )
+		{
+			ii[ 1 ] = static_cast< size_t >( v );
+			ii[ 0 ] = ii[ 1 ] > 0     ? ii[ 1 ] - 1 : ii[ 1 ];
+			ii[ 2 ] = ii[ 1 ] < n - 1 ? ii[ 1 ] + 1 : ii[ 1 ];
+			ii[ 3 ] = ii[ 2 ] < n - 1 ? ii[ 2 ] + 1 : ii[ 2 ];
+			t = v - ii[ 1 ];
+		}
+
+		template< class T1, class Allocator1, class T2 >
+		static void sample( const array3< T1, Allocator1 > &in, double x, double y, double z, T2 &out )
+		{
+			size_t ii[ 4 ], jj[ 4 ], kk[ 4 ];
+			neighbors( x, in.width( ), ii, x );
+			neighbors( y, in.height( ), jj, y );
+			neighbors( z, in.depth( ), kk, z );
+			__interpolate_utility__::round( __cubic__::_cubic_< is_color< T1 >::value >::interpolate( in, ii, jj, kk, x, y, z ), out );
+		}
+	};
+
+	// tϊ m pāCo͉摜 ( y, z )  [ y0, y1 ) ~ [ z0, z1 ) ̊eϊ
+	template< class Sampler, class T1, class Allocator1, class T2, class Allocator2 >
+	void affine_transform3( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const double m[ 12 ], int y0, int y1, int z0, int z1 )
+	{
+		const double size[ 3 ] = { static_cast< double >( in.width( ) ), static_cast< double >( in.height( ) ), static_cast< double >( in.depth( ) ) };
+		const double d[ 3 ] = { m[ 0 ], m[ 4 ], m[ 8 ] };
+		const int w = static_cast< int >( out.width( ) );
+
+#pragma omp parallel for schedule( guided )
+		for( int z = z0 ; z < z1 ; ++z )
+		{
+			for( int y = y0 ; y < y1 ; ++y )
+			{
+				// x = 0 ł͍̓WDȍ~ x ̑ d 𑫂Ă
+				double p[ 3 ];
+				p[ 0 ] = m[ 1 ] * y + m[ 2 ] * z + m[ 3 ];
+				p[ 1 ] = m[ 5 ] * y + m[ 6 ] * z + m[ 7 ];
+				p[ 2 ] = m[ 9 ] * y + m[ 10 ] * z + m[ 11 ];
+
+				int xs, xe;
+				if( !clip_scanline( p, d, size, w, xs, xe ) )
+				{
+					continue;
+				}
+
+				double sx = p[ 0 ] + d[ 0 ] * xs;
+				double sy = p[ 1 ] + d[ 1 ] * xs;
+				double sz = p[ 2 ] + d[ 2 ] * xs;
+				for( int x = xs ; x <= xe ; ++x )
+				{
+					Sampler::sample( in, clamp_coordinate( sx, size[ 0 ] - 1.0 ), clamp_coordinate( sy, size[ 1 ] - 1.0 ), clamp_coordinate( sz, size[ 2 ] - 1.0 ), out( x, y, z ) );
+					sx += d[ 0 ];
+					sy += d[ 1 ];
+					sz += d[ 2 ];
+				}
+			}
+		}
+	}
+
+	template< class Sampler, class T1, class Allocator1, class T2, class Allocator2, class T3, class Allocator3 >
+	bool transform3( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const matrix< T3, Allocator3 > &mat )
+	{
+		double m[ 12 ];
+		if( in.empty( ) || out.empty( ) || !inverse_affine3( mat, m ) )
+		{
+			return( false );
+		}
+
+		// ͉摜8_ϊCo͉摜̂ĺ͈iYCZjɑ肷
+		double lo[ 3 ] = {  1.0e300,  1.0e300,  1.0e300 };
+		double hi[ 3 ] = { -1.0e300, -1.0e300, -1.0e300 };
+		for( int c = 0 ; c < 8 ; c++ )
+		{
+			double v[ 3 ] = { c & 1 ? in.width( ) - 1.0 : 0.0, c & 2 ? in.height( ) - 1.0 : 0.0, c & 4 ? in.depth( ) - 1.0 : 0.0 };
+			for( int a = 0 ; a < 3 ; a++ )
+			{
+				double u = mat( a, 0 ) * v[ 0 ] + mat( a, 1 ) * v[ 1 ] + mat( a, 2 ) * v[ 2 ] + mat( a, 3 );
+				lo[ a ] = std::min( lo[ a ], u );
+				hi[ a ] = std::max( hi[ a ], u );
+			}
+		}
+
+		int y0 = static_cast< int >( std::max( 0.0, std::floor( lo[ 1 ] ) ) );
+		int z0 = static_cast< int >( std::max( 0.0, std::floor( lo[ 2 ] ) ) );
+		int y1 = static_cast< int >( std::min( static_cast< double >( out.height( ) ), std::floor( hi[ 1 ] ) + 1.0 ) );
+		int z1 = static_cast< int >( std::min( static_cast< double >( out.depth( ) ), std::floor( hi[ 2 ] ) + 1.0 ) );
+
+		affine_transform3< Sampler >( in, out, m, y0, y1, z0, z1 );
+
+		return( true );
+	}
+
+	template< class Sampler, class T1, class Allocator1, class T2, class Allocator2, class Allocator3 >
+	bool warp3( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const array3< vector3< double >, Allocator3 > &field )
+	{
+		if( in.empty( ) || out.empty( ) || field.width( ) != out.width( ) || field.height( ) != out.height( ) || field.depth( ) != out.depth( ) )
+		{
+			return( false );
+		}
+
+		const double uw = in.width( ) - 1.0, uh = in.height( ) - 1.0, ud = in.depth( ) - 1.0;
+		const int w = static_cast< int >( out.width( ) );
+		const int h = static_cast< int >( out.height( ) );
+		const int d = static_cast< int >( out.depth( ) );
+
+#pragma omp parallel for schedule( guided )
+		for( int z = 0 ; z < d ; ++z )
+		{
+			for( int y = 0 ; y < h ; ++y )
+			{
+				for( int x = 0 ; x < w ; ++x )
+				{
+					const vector3< double > &u = field( x, y, z );
+					double sx = x + u.x, sy = y + u.y, sz = z + u.z;
+
+					if( 0.0 <= sx && sx <= uw && 0.0 <= sy && sy <= uh && 0.0 <= sz && sz <= ud )
+					{
+						Sampler::sample( in, sx, sy, sz, out( x, y, z ) );
+					}
+				}
+			}
+		}
+
+		return( true );
+	}
 }
 
 namespace nearest
 {
 	/// @brief transform array2
+	//! @attention ͉摜̍W؂̂ĂĉfIԁi3 nearest::transform / warp ͎ľܓj
 	//! @param[in]  in  is input array
 	//! @param[out] out is output array
 	//! @param[int] mat is transformation matrix
@@ -256,6 +496,44 @@ namespace nearest
 			}
 		}
 	}
+
+	/// @brief transform array3 by an affine matrix
+	//!
+	//! ͉摜̉f ( x, y, z ) Cmat ɂďo͉摜̈ʒu mat * ( x, y, z, 1 ) ֈڂD
+	//! o͉摜͑Ƃɋtϊ̑𑫂ȂŋߖTԂŋ߁C͉摜͈̔͊OɑΉf͕ύXȂD
+	//!
+	//! @attention ŋߖT̉f͓͉摜̍WľܓđIԁi2 nearest::transform ͐؂̂Ă邽߁Cfj
+	//!
+	//! @param[in]  in  is input array
+	//! @param[out] out is output array (must be allocated in advance)
+	//! @param[in]  mat is 4x4 (or 3x4) affine transformation matrix
+	//!
+	//! @return false if mat is singular or arrays are empty
+	//! 
+	template< class T1, class Allocator1, class T2, class Allocator2, class T3, class Allocator3 >
+	bool transform( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const matrix< T3, Allocator3 > &mat )
+	{
+		return( detail::transform3< detail::nearest_sampler3 >( in, out, mat ) );
+	}
+
+	/// @brief warp array3 by a dense displacement field
+	//!
+	//! o͉摜̉f ( x, y, z ) ̒lC͉摜̈ʒu ( x, y, z ) + field( x, y, z ) ŋߖTԂŋ߂D
+	//! ψʂ͉fPʂƂC͉摜͈̔͊OɑΉf͕ύXȂD
+	//!
+	//! @attention ŋߖT̉f͓͉摜̍WľܓđI
+	//!
+	//! @param[in]  in    is input array
+	//! @param[out] out   is output array (must be allocated in advance)
+	//! @param[in]  field is displacement field (same size as out)
+	//!
+	//! @return false if the size of field differs from out
+	//! 
+	template< class T1, class Allocator1, class T2, class Allocator2, class Allocator3 >
+	bool warp( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const array3< vector3< double >, Allocator3 > &field )
+	{
+		return( detail::warp3< detail::nearest_sampler3 >( in, out, field ) );
+	}
 }
 
 namespace linear
@@ -359,6 +637,40 @@ namespace linear
 			}
 		}
 	}
+
+	/// @brief transform array3 by an affine matrix
+	//!
+	//! ͉摜̉f ( x, y, z ) Cmat ɂďo͉摜̈ʒu mat * ( x, y, z, 1 ) ֈڂD
+	//! o͉摜͑Ƃɋtϊ̑𑫂Ȃ`Ԃŋ߁C͉摜͈̔͊OɑΉf͕ύXȂD
+	//!
+	//! @param[in]  in  is input array
+	//! @param[out] out is output array (must be allocated in advance)
+	//! @param[in]  mat is 4x4 (or 3x4) affine transformation matrix
+	//!
+	//! @return false if mat is singular or arrays are empty
+	//! 
+	template< class T1, class Allocator1, class T2, class Allocator2, class T3, class Allocator3 >
+	bool transform( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const matrix< T3, Allocator3 > &mat )
+	{
+		return( detail::transform3< detail::linear_sampler3 >( in, out, mat ) );
+	}
+
+	/// @brief warp array3 by a dense displacement field
+	//!
+	//! o͉摜̉f ( x, y, z ) ̒lC͉摜̈ʒu ( x, y, z ) + field( x, y, z ) `Ԃŋ߂D
+	//! ψʂ͉fPʂƂC͉摜͈̔͊OɑΉf͕ύXȂD
+	//!
+	//! @param[in]  in    is input array
+	//! @param[out] out   is output array (must be allocated in advance)
+	//! @param[in]  field is displacement field (same size as out)
+	//!
+	//! @return false if the size of field differs from out
+	//! 
+	template< class T1, class Allocator1, class T2, class Allocator2, class Allocator3 >
+	bool warp( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const array3< vector3< double >, Allocator3 > &field )
+	{
+		return( detail::warp3< detail::linear_sampler3 >( in, out, field ) );
+	}
 }
 
 namespace cubic
@@ -470,6 +782,40 @@ namespace cubic
 			}
 		}
 	}
+
+	/// @brief transform array3 by an affine matrix
+	//!
+	//! ͉摜̉f ( x, y, z ) Cmat ɂďo͉摜̈ʒu mat * ( x, y, z, 1 ) ֈڂD
+	//! o͉摜͑Ƃɋtϊ̑𑫂Ȃ3Ԃŋ߁C͉摜͈̔͊OɑΉf͕ύXȂD
+	//!
+	//! @param[in]  in  is input array
+	//! @param[out] out is output array (must be allocated in advance)
+	//! @param[in]  mat is 4x4 (or 3x4) affine transformation matrix
+	//!
+	//! @return false if mat is singular or arrays are empty
+	//! 
+	template< class T1, class Allocator1, class T2, class Allocator2, class T3, class Allocator3 >
+	bool transform( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const matrix< T3, Allocator3 > &mat )
+	{
+		return( detail::transform3< detail::cubic_sampler3 >( in, out, mat ) );
+	}
+
+	/// @brief warp array3 by a dense displacement field
+	//!
+	//! o͉摜̉f ( x, y, z ) ̒lC͉摜̈ʒu ( x, y, z ) + field( x, y, z ) 3Ԃŋ߂D
+	//! ψʂ͉fPʂƂC͉摜͈̔͊OɑΉf͕ύXȂD
+	//!
+	//! @param[in]  in    is input array
+	//! @param[out] out   is output array (must be allocated in advance)
+	//! @param[in]  field is displacement field (same size as out)
+	//!
+	//! @return false if the size of field differs from out
+	//! 
+	template< class T1, class Allocator1, class T2, class Allocator2, class Allocator3 >
+	bool warp( const array3< T1, Allocator1 > &in, array3< T2, Allocator2 > &out, const array3< vector3< double >, Allocator3 > &field )
+	{
+		return( detail::warp3< detail::cubic_sampler3 >( in, out, field ) );
+	}
 }
 
 _MIST_END
@@ -47,6 +47,10 @@
 #include "thread.h"
 #endif
 
+#ifndef __INCLUDE_MIST_VECTOR__
+#include "vector.h"
+#endif
+
 
 #include <cmath>
 
@@ -2189,6 +2193,275 @@ namespace __sinc__
 
 
 
+// ƂɕԁiXJ[l̉摜̂݁j
+// ԂɗpẻfԍƏd݂͏o̗͂EsEXCXŌ܂邽߁C炩ߕ\ɂĂC
+// XCYCZ̏1̕ԂsDZɕKvȓ̓XCXXYԌʂ͎g
+namespace __separable__
+{
+	enum kernel_type
+	{
+		Linear,
+		Cubic,
+		Bspline,
+		Sinc,
+	};
+
+	// 1̎ɂāCo͂̊eʒuŎQƂ͂̉fԍƏd
+	struct axis_table
+	{
+		size_t taps;
+		std::vector< size_t > index;
+		std::vector< double > weight;
+	};
+
+	inline void make_table( kernel_type type, size_t isize, size_t osize, axis_table &t )
+	{
+		if( isize == 1 && osize == 1 )
+		{
+			// Ԃ̕KvȂ
+			t.taps = 1;
+			t.index.assign( 1, 0 );
+			t.weight.assign( 1, 1.0 );
+			return;
+		}
+
+		t.taps = type == Linear ? 2 : ( type == Sinc ? isize : 4 );
+		t.index.resize( osize * t.taps );
+		t.weight.resize( osize * t.taps );
+
+		double s = static_cast< double >( isize ) / static_cast< double >( osize );
+
+		for( size_t o = 0 ; o < osize ; o++ )
+		{
+			size_t *ii = &t.index[ o * t.taps ];
+			double *w = &t.weight[ o * t.taps ];
+			double x = s * o;
+			size_t i1 = static_cast< size_t >( x );
+			x -= i1;
+
+			switch( type )
+			{
+			case Linear:
+				ii[ 0 ] = i1;
+				ii[ 1 ] = i1 < isize - 1 ? i1 + 1 : i1;
+				w[ 0 ] = 1.0 - x;
+				w[ 1 ] = x;
+				break;
+
+			case Cubic:
+			case Bspline:
+				ii[ 1 ] = i1;
+				ii[ 0 ] = ii[ 1 ] > 0         ? ii[ 1 ] - 1 : ii[ 1 ];
+				ii[ 2 ] = ii[ 1 ] < isize - 1 ? ii[ 1 ] + 1 : ii[ 1 ];
+				ii[ 3 ] = ii[ 2 ] < isize - 1 ? ii[ 2 ] + 1 : ii[ 2 ];
+				if( type == Cubic )
+				{
+					w[ 0 ] = __cubic__::sinc2( 1 + x );
+					w[ 1 ] = __cubic__::sinc1( x );
+					w[ 2 ] = __cubic__::sinc1( 1 - x );
+					w[ 3 ] = __cubic__::sinc2( 2 - x );
+				}
+				else
+				{
+					w[ 0 ] = __bspline__::bspline2( 1 + x );
+					w[ 1 ] = __bspline__::bspline1( x );
+					w[ 2 ] = __bspline__::bspline1( 1 - x );
+					w[ 3 ] = __bspline__::bspline2( 2 - x );
+				}
+				break;
+
+			case Sinc:
+			default:
+				for( size_t i = 0 ; i < isize ; i++ )
+				{
+					ii[ i ] = i;
+					w[ i ]  = __sinc__::sinc( static_cast< double >( i ) - static_cast< double >( i1 ) + x );
+				}
+				break;
+			}
+		}
+	}
+
+	// ̓XCX kk Co͂ X  [ i0, i1 )CY  [ j0, j1 ) ͈̔͂ɂ XY ɕԂ
+	template < class Array >
+	void interpolate_slice( const Array &in, size_t kk, const axis_table &tx, const axis_table &ty,
+							size_t i0, size_t i1, size_t j0, size_t j1, std::vector< double > &xbuf, double *slice )
+	{
+		typedef typename Array::size_type size_type;
+
+		const size_type iw = in.width( );
+		const size_type ih = in.height( );
+		const size_type ow = i1 - i0;
+		const size_type tapx = tx.taps;
+		const size_type tapy = ty.taps;
+
+		// Y ̕ԂŎQƂ͂̍s͈̔
+		size_type rmin = ih, rmax = 0;
+		for( size_type n = j0 * tapy ; n < j1 * tapy ; n++ )
+		{
+			rmin = ty.index[ n ] < rmin ? ty.index[ n ] : rmin;
+			rmax = ty.index[ n ] > rmax ? ty.index[ n ] : rmax;
+		}
+
+		xbuf.resize( ( rmax - rmin + 1 ) * ow );
+
+		// X 
+		for( size_type r = rmin ; r <= rmax ; r++ )
+		{
+			size_type offset = ( kk * ih + r ) * iw;
+			double *p = &xbuf[ ( r - rmin ) * ow ];
+			for( size_type i = i0 ; i < i1 ; i++ )
+			{
+				const size_t *ii = &tx.index[ i * tapx ];
+				const double *w = &tx.weight[ i * tapx ];
+				double v = 0.0;
+				for( size_type t = 0 ; t < tapx ; t++ )
+				{
+					v += in[ offset + ii[ t ] ] * w[ t ];
+				}
+				p[ i - i0 ] = v;
+			}
+		}
+
+		// Y iA1s̐ϘaȂ̂ŃxNgj
+		for( size_type j = j0 ; j < j1 ; j++ )
+		{
+			double *q = slice + ( j - j0 ) * ow;
+			for( size_type i = 0 ; i < ow ; i++ )
+			{
+				q[ i ] = 0.0;
+			}
+			for( size_type t = 0 ; t < tapy ; t++ )
+			{
+				const double w = ty.weight[ j * tapy + t ];
+				const double *p = &xbuf[ ( ty.index[ j * tapy + t ] - rmin ) * ow ];
+				for( size_type i = 0 ; i < ow ; i++ )
+				{
+					q[ i ] += p[ i ] * w;
+				}
+			}
+		}
+	}
+
+	template < bool b >
+	struct _separable_
+	{
+		template < class Array1, class Array2 >
+		static bool interpolate( const Array1 &in, Array2 &out, kernel_type type, size_t thread_id, size_t thread_num )
+		{
+			typedef typename Array1::size_type  size_type;
+			typedef typename Array1::value_type value_type;
+
+			const size_type iw = in.width( );
+			const size_type ih = in.height( );
+			const size_type id = in.depth( );
+			const size_type ow = out.width( );
+			const size_type oh = out.height( );
+			const size_type od = out.depth( );
+
+			axis_table tx, ty, tz;
+			make_table( type, iw, ow, tx );
+			make_table( type, ih, oh, ty );
+			make_table( type, id, od, tz );
+
+			// o͂̍łO̎Xbhŕ
+			size_type i0 = 0, i1 = ow, j0 = 0, j1 = oh, k0 = 0, k1 = od;
+			if( od > 1 )
+			{
+				k0 = od * thread_id / thread_num;
+				k1 = od * ( thread_id + 1 ) / thread_num;
+			}
+			else if( oh > 1 )
+			{
+				j0 = oh * thread_id / thread_num;
+				j1 = oh * ( thread_id + 1 ) / thread_num;
+			}
+			else
+			{
+				i0 = ow * thread_id / thread_num;
+				i1 = ow * ( thread_id + 1 ) / thread_num;
+			}
+
+			if( i0 >= i1 || j0 >= j1 || k0 >= k1 )
+			{
+				return( true );
+			}
+
+			const size_type sw = i1 - i0;
+			const size_type ssize = sw * ( j1 - j0 );
+			const size_type tapz = tz.taps;
+
+			// XY ɕԍς݂̓̓XCXێ̈iZɘA tapz ێΏՓ˂Ȃj
+			const size_type slots = tapz < id ? tapz : id;
+			std::vector< double > slices( slots * ssize ), acc( ssize ), xbuf;
+			std::vector< size_type > cached( slots, id );
+
+			double min = type_limits< value_type >::minimum( );
+			double max = type_limits< value_type >::maximum( );
+
+			for( size_type k = k0 ; k < k1 ; k++ )
+			{
+				for( size_type n = 0 ; n < ssize ; n++ )
+				{
+					acc[ n ] = 0.0;
+				}
+
+				for( size_type t = 0 ; t < tapz ; t++ )
+				{
+					size_type kk = tz.index[ k * tapz + t ];
+					size_type s = kk % slots;
+					double *slice = &slices[ s * ssize ];
+					if( cached[ s ] != kk )
+					{
+						interpolate_slice( in, kk, tx, ty, i0, i1, j0, j1, xbuf, slice );
+						cached[ s ] = kk;
+					}
+
+					const double w = tz.weight[ k * tapz + t ];
+					for( size_type n = 0 ; n < ssize ; n++ )
+					{
+						acc[ n ] += slice[ n ] * w;
+					}
+				}
+
+				for( size_type j = j0 ; j < j1 ; j++ )
+				{
+					const double *p = &acc[ ( j - j0 ) * sw ];
+					for( size_type i = i0 ; i < i1 ; i++ )
+					{
+						double pix = p[ i - i0 ];
+						pix = pix > min ? pix : min;
+						pix = pix < max ? pix : max;
+						__interpolate_utility__::round( pix, out( i, j, k ) );
+					}
+				}
+			}
+
+			return( true );
+		}
+	};
+
+	template < >
+	struct _separable_< true >
+	{
+		// J[摜͏]ǂfƂɕԂ
+		template < class Array1, class Array2 >
+		static bool interpolate( const Array1 &, Array2 &, kernel_type, size_t, size_t )
+		{
+			return( false );
+		}
+	};
+
+	template < class Array1, class Array2 >
+	inline bool interpolate( const Array1 &in, Array2 &out, kernel_type type, size_t thread_id, size_t thread_num )
+	{
+		return( _separable_< is_color< typename Array1::value_type >::value >::interpolate( in, out, type, thread_id, thread_num ) );
+	}
+}
+
+
+
+
 // 摜Ԃ̃Xbh
 namespace __interpolate_controller__
 {
@@ -2406,20 +2679,32 @@ namespace __interpolate_controller__
 				break;
 
 			case Cubic:
-				cubic__( *in_, *out_, thread_id_, thread_num_ );
+				if( !__separable__::interpolate( *in_, *out_, __separable__::Cubic, thread_id_, thread_num_ ) )
+				{
+					cubic__( *in_, *out_, thread_id_, thread_num_ );
+				}
 				break;
 
 			case Bspline:
-				bspline__( *in_, *out_, thread_id_, thread_num_ );
+				if( !__separable__::interpolate( *in_, *out_, __separable__::Bspline, thread_id_, thread_num_ ) )
+				{
+					bspline__( *in_, *out_, thread_id_, thread_num_ );
+				}
 				break;
 
 			case Sinc:
-				sinc__( *in_, *out_, thread_id_, thread_num_ );
+				if( !__separable__::interpolate( *in_, *out_, __separable__::Sinc, thread_id_, thread_num_ ) )
+				{
+					sinc__( *in_, *out_, thread_id_, thread_num_ );
+				}
 				break;
 
 			case Linear:
 			default:
-				linear__( *in_, *out_, thread_id_, thread_num_ );
+				if( !__separable__::interpolate( *in_, *out_, __separable__::Linear, thread_id_, thread_num_ ) )
+				{
+					linear__( *in_, *out_, thread_id_, thread_num_ );
+				}
 				break;
 			}
 
@@ -3516,7 +3801,243 @@ namespace cubic
 
 
 
+// Ԍ^3BXvČW߂ċA^tB^iM. Unser, "Splines: a perfect fit for signal and image processing", 1999j
+namespace __bspline__
+{
+	// 1{̐M civf njCÊƂ BXvCWɕϊ
+	inline void prefilter_line( double *c, size_t n )
+	{
+		if( n < 2 )
+		{
+			return;
+		}
+
+		const double z = std::sqrt( 3.0 ) - 2.0;	// 3BXvC̋
+		const double lambda = ( 1.0 - z ) * ( 1.0 - 1.0 / z );
+		const size_t horizon = static_cast< size_t >( std::ceil( std::log( 1.0e-17 ) / std::log( std::abs( z ) ) ) );	// ł؂덷ۂߌ덷ȉɂȂ鍀
+
+		for( size_t k = 0 ; k < n ; k++ )
+		{
+			c[ k ] *= lambda;
+		}
+
+		// ʓItB^̏l
+		double sum = c[ 0 ];
+		if( horizon < n )
+		{
+			double zn = z;
+			for( size_t k = 1 ; k < horizon ; k++ )
+			{
+				sum += zn * c[ k ];
+				zn *= z;
+			}
+		}
+		else
+		{
+			double zn = z;
+			double iz = 1.0 / z;
+			double z2n = std::pow( z, static_cast< double >( n - 1 ) );
+			sum += z2n * c[ n - 1 ];
+			z2n *= z2n * iz;
+			for( size_t k = 1 ; k < n - 1 ; k++ )
+			{
+				sum += ( zn + z2n ) * c[ k ];
+				zn *= z;
+				z2n *= iz;
+			}
+			sum /= 1.0 - zn * zn;
+		}
+		c[ 0 ] = sum;
+
+		// ʓItB^
+		for( size_t k = 1 ; k < n ; k++ )
+		{
+			c[ k ] += z * c[ k - 1 ];
+		}
+
+		// ʓItB^
+		c[ n - 1 ] = ( z / ( z * z - 1.0 ) ) * ( z * c[ n - 2 ] + c[ n - 1 ] );
+		for( size_t k = n - 1 ; k > 0 ; k-- )
+		{
+			c[ k - 1 ] = z * ( c[ k ] - c[ k - 1 ] );
+		}
+	}
+
+	// Eŉfԍ i  [ 0, n ) ɐ܂Ԃ
+	inline ptrdiff_t mirror( ptrdiff_t i, ptrdiff_t n )
+	{
+		if( n == 1 )
+		{
+			return( 0 );
+		}
+
+		ptrdiff_t period = 2 * n - 2;
+		i = i < 0 ? -i : i;
+		i %= period;
+		return( i < n ? i : period - i );
+	}
+
+	// 3BXvC̏d݂ƁC̔̏d݂vZit  0 <= t < 1 ̏j
+	inline void weights( double t, double w[ 4 ], double d[ 4 ] )
+	{
+		double s = 1.0 - t;
+		w[ 0 ] = s * s * s / 6.0;
+		w[ 1 ] = bspline1( t );
+		w[ 2 ] = bspline1( s );
+		w[ 3 ] = t * t * t / 6.0;
+		d[ 0 ] = -0.5 * s * s;
+		d[ 1 ] = ( 1.5 * t - 2.0 ) * t;
+		d[ 2 ] = -( 1.5 * s - 2.0 ) * s;
+		d[ 3 ] = 0.5 * t * t;
+	}
+
+	// width ~ height ~ depth ̃f[^ axis i0:XC1:YC2:Zj̑SĂ̗ċA^tB^ŏXbh
+	class prefilter_thread : public mist::thread< prefilter_thread >
+	{
+	public:
+		typedef mist::thread< prefilter_thread > base;
+		typedef base::thread_exit_type thread_exit_type;
+		typedef size_t size_type;
+
+	private:
+		double *data_;
+		size_type width_;
+		size_type height_;
+		size_type depth_;
+		size_type axis_;
+		size_type thread_id_;
+		size_type thread_num_;
+
+	public:
+		void setup_parameters( double *data, size_type width, size_type height, size_type depth, size_type axis, size_type thread_id, size_type thread_num )
+		{
+			data_       = data;
+			width_      = width;
+			height_     = height;
+			depth_      = depth;
+			axis_       = axis;
+			thread_id_  = thread_id;
+			thread_num_ = thread_num;
+		}
+
+		const prefilter_thread& operator =( const prefilter_thread &p )
+		{
+			if( &p != this )
+			{
+				base::operator =( p );
+				data_ = p.data_;
+				width_ = p.width_;
+				height_ = p.height_;
+				depth_ = p.depth_;
+				axis_ = p.axis_;
+				thread_id_ = p.thread_id_;
+				thread_num_ = p.thread_num_;
+			}
+			return( *this );
+		}
+
+		prefilter_thread( ) : data_( NULL ), width_( 0 ), height_( 0 ), depth_( 0 ), axis_( 0 ), thread_id_( 0 ), thread_num_( 1 )
+		{
+		}
+
+		prefilter_thread( const prefilter_thread &p ) : base( p ), data_( p.data_ ), width_( p.width_ ), height_( p.height_ ), depth_( p.depth_ ),
+														axis_( p.axis_ ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ )
+		{
+		}
+
+	protected:
+		// pŕKXbh֐
+		virtual thread_exit_type thread_function( )
+		{
+			size_type n, stride, lines;
+			switch( axis_ )
+			{
+			case 0:
+				n = width_;
+				stride = 1;
+				lines = height_ * depth_;
+				break;
+
+			case 1:
+				n = height_;
+				stride = width_;
+				lines = width_ * depth_;
+				break;
+
+			default:
+				n = depth_;
+				stride = width_ * height_;
+				lines = width_ * height_;
+				break;
+			}
+
+			std::vector< double > line( n );
+
+			for( size_type l = lines * thread_id_ / thread_num_ ; l < lines * ( thread_id_ + 1 ) / thread_num_ ; l++ )
+			{
+				// l Ԗڂ̗̐擪vf
+				size_type offset;
+				if( axis_ == 0 )
+				{
+					offset = l * width_;
+				}
+				else if( axis_ == 1 )
+				{
+					offset = ( l / width_ ) * width_ * height_ + l % width_;
+				}
+				else
+				{
+					offset = l;
+				}
+
+				double *p = data_ + offset;
+				for( size_type i = 0 ; i < n ; i++ )
+				{
+					line[ i ] = p[ i * stride ];
+				}
+
+				prefilter_line( &line[ 0 ], n );
+
+				for( size_type i = 0 ; i < n ; i++ )
+				{
+					p[ i * stride ] = line[ i ];
+				}
+			}
+
+			return( 0 );
+		}
+	};
+
+	// x A width ~ height ~ depth ̃f[^CeɉBXvCWɕϊ
+	inline void prefilter( double *data, size_t width, size_t height, size_t depth, size_t thread_num )
+	{
+		if( thread_num == 0 )
+		{
+			thread_num = static_cast< size_t >( get_cpu_num( ) );
+		}
+
+		prefilter_thread *thread = new prefilter_thread[ thread_num ];
+
+		for( size_t axis = 0 ; axis < 3 ; axis++ )
+		{
+			for( size_t i = 0 ; i < thread_num ; i++ )
+			{
+				thread[ i ].setup_parameters( data, width, height, depth, axis, i, thread_num );
+			}
+			do_threads( thread, thread_num );
+		}
+
+		delete [] thread;
+	}
+}
+
+
+
 /// @brief 3BXvC֐p
+//!
+//! interpolate ͉flɒBXvCKp邽߁C𔺂ߎɂȂD
+//! iq_Ō̉flʂԂɂ́Cprefilter ŋ߂W܂ spline NXpD
+//!
 namespace BSpline
 {
 	/// @brief 1zɑ΂3BXvC֐p
@@ -3773,6 +4294,302 @@ namespace BSpline
 
 		return( true );
 	}
+
+	/// @brief Ԍ^3BXvČWvZ
+	//!
+	//! ċA^tB^iʓIEʓIIIRtB^jeɉēKpC
+	//! W3BXvCōč\l̉flƈv悤ȌW O(N) ŋ߂D
+	//! E͋EƂD
+	//!
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+	//!
+	//! @param[in]  in         c ̓f[^
+	//! @param[out] coef       c BXvCW
+	//! @param[in]  thread_num c gpXbh
+	//!
+	//! @return ͂̏ꍇ false
+	//!
+	template < class T, class Allocator1, class Allocator2 >
+	bool prefilter( const array2< T, Allocator1 > &in, array2< double, Allocator2 > &coef, typename array2< T, Allocator1 >::size_type thread_num = 0 )
+	{
+		if( in.empty( ) )
+		{
+			return( false );
+		}
+
+		if( !is_same_object( in, coef ) )
+		{
+			coef.resize( in.width( ), in.height( ) );
+			coef.reso1( in.reso1( ) );
+			coef.reso2( in.reso2( ) );
+			for( size_t i = 0 ; i < in.size( ) ; i++ )
+			{
+				coef[ i ] = static_cast< double >( in[ i ] );
+			}
+		}
+
+		__bspline__::prefilter( &coef[ 0 ], coef.width( ), coef.height( ), 1, thread_num );
+
+		return( true );
+	}
+
+
+	/// @brief Ԍ^3BXvČWvZ
+	//!
+	//! ċA^tB^iʓIEʓIIIRtB^jeɉēKpC
+	//! W3BXvCōč\l̉flƈv悤ȌW O(N) ŋ߂D
+	//! E͋EƂD
+	//!
+	//! @attention ͂Əo͂́CMISTReiIuWFNgł삷
+	//! @attention Xbh0w肵ꍇ́Cgp\CPUIɎ擾
+	//!
+	//! @param[in]  in         c ̓f[^
+	//! @param[out] coef       c BXvCW
+	//! @param[in]  thread_num c gpXbh
+	//!
+	//! @return ͂̏ꍇ false
+	//!
+	template < class T, class Allocator1, class Allocator2 >
+	bool prefilter( const array3< T, Allocator1 > &in, array3< double, Allocator2 > &coef, typename array3< T, Allocator1 >::size_type thread_num = 0 )
+	{
+		if( in.empty( ) )
+		{
+			return( false );
+		}
+
+		if( !is_same_object( in, coef ) )
+		{
+			coef.resize( in.width( ), in.height( ), in.depth( ) );
+			coef.reso1( in.reso1( ) );
+			coef.reso2( in.reso2( ) );
+			coef.reso3( in.reso3( ) );
+			for( size_t i = 0 ; i < in.size( ) ; i++ )
+			{
+				coef[ i ] = static_cast< double >( in[ i ] );
+			}
+		}
+
+		__bspline__::prefilter( &coef[ 0 ], coef.width( ), coef.height( ), coef.depth( ), thread_num );
+
+		return( true );
+	}
+
+
+	/// @brief Ԍ^3BXvCŔCӂ̈ʒu̒lƌz߂NX
+	//!
+	//! \z prefilter ŌWxvZCȍ~͋ߖT 4~4i3 4~4~4ǰWl߂D
+	//! iq_ł͌̉flƈvDW͉fPʁi0 ` -1jŎw肵C͈͊O͋EŐ܂ԂD
+	//!
+	//! @code gp
+	//! mist::BSpline::spline< 3 > s( volume );
+	//! mist::vector3< double > g;
+	//!
+	//! double v = s( 10.3, 20.5, 5.25 );        // l
+	//! double w = s( 10.3, 20.5, 5.25, g );     // lƌzifPʁj
+	//! @endcode
+	//!
+	//! @param DIMENSION c f[^̎i2܂3j
+	//!
+	template < size_t DIMENSION >
+	class spline;
+
+
+	/// @brief 2摜ɑ΂Ԍ^3BXvC
+	template < >
+	class spline< 2 >
+	{
+	public:
+		typedef size_t size_type;						///< @brief Ȃ̐\^
+		typedef array2< double > coefficient_type;		///< @brief BXvCWێž^
+
+	private:
+		coefficient_type coef_;
+
+	public:
+		/// @brief 摜 in ̌WvZ
+		template < class T, class Allocator >
+		bool build( const array2< T, Allocator > &in, size_type thread_num = 0 )
+		{
+			return( prefilter( in, coef_, thread_num ) );
+		}
+
+		/// @brief BXvCW
+		const coefficient_type &coefficients( ) const { return( coef_ ); }
+
+		/// @brief ʒu ( x, y ) ̒l
+		double operator ()( double x, double y ) const
+		{
+			vector2< double > g;
+			return( evaluate( x, y, g, false ) );
+		}
+
+		/// @brief ʒu ( x, y ) ̒lƌzifPʁj
+		double operator ()( double x, double y, vector2< double > &grad ) const
+		{
+			return( evaluate( x, y, grad, true ) );
+		}
+
+		spline( )
+		{
+		}
+
+		/// @brief 摜 in ̌WvZ
+		template < class T, class Allocator >
+		spline( const array2< T, Allocator > &in, size_type thread_num = 0 )
+		{
+			build( in, thread_num );
+		}
+
+	private:
+		double evaluate( double x, double y, vector2< double > &grad, bool gradient ) const
+		{
+			if( coef_.empty( ) )
+			{
+				grad = vector2< double >( 0, 0 );
+				return( 0.0 );
+			}
+
+			double fx = std::floor( x ), fy = std::floor( y );
+			double wx[ 4 ], dx[ 4 ], wy[ 4 ], dy[ 4 ];
+			__bspline__::weights( x - fx, wx, dx );
+			__bspline__::weights( y - fy, wy, dy );
+
+			ptrdiff_t w = coef_.width( ), h = coef_.height( );
+			ptrdiff_t ix = static_cast< ptrdiff_t >( fx ) - 1, iy = static_cast< ptrdiff_t >( fy ) - 1;
+			ptrdiff_t ii[ 4 ];
+			for( ptrdiff_t n = 0 ; n < 4 ; n++ )
+			{
+				ii[ n ] = __bspline__::mirror( ix + n, w );
+			}
+
+			double v = 0.0, gx = 0.0, gy = 0.0;
+			for( ptrdiff_t m = 0 ; m < 4 ; m++ )
+			{
+				const double *p = &coef_( 0, __bspline__::mirror( iy + m, h ) );
+				double s = p[ ii[ 0 ] ] * wx[ 0 ] + p[ ii[ 1 ] ] * wx[ 1 ] + p[ ii[ 2 ] ] * wx[ 2 ] + p[ ii[ 3 ] ] * wx[ 3 ];
+				v += s * wy[ m ];
+				if( gradient )
+				{
+					gx += ( p[ ii[ 0 ] ] * dx[ 0 ] + p[ ii[ 1 ] ] * dx[ 1 ] + p[ ii[ 2 ] ] * dx[ 2 ] + p[ ii[ 3 ] ] * dx[ 3 ] ) * wy[ m ];
+					gy += s * dy[ m ];
+				}
+			}
+
+			if( gradient )
+			{
+				grad = vector2< double >( gx, gy );
+			}
+
+			return( v );
+		}
+	};
+
+
+	/// @brief 3摜ɑ΂Ԍ^3BXvC
+	template < >
+	class spline< 3 >
+	{
+	public:
+		typedef size_t size_type;						///< @brief Ȃ̐\^
+		typedef array3< double > coefficient_type;		///< @brief BXvCWێž^
+
+	private:
+		coefficient_type coef_;
+
+	public:
+		/// @brief 摜 in ̌WvZ
+		template < class T, class Allocator >
+		bool build( const array3< T, Allocator > &in, size_type thread_num = 0 )
+		{
+			return( prefilter( in, coef_, thread_num ) );
+		}
+
+		/// @brief BXvCW
+		const coefficient_type &coefficients( ) const { return( coef_ ); }
+
+		/// @brief ʒu ( x, y, z ) ̒l
+		double operator ()( double x, double y, double z ) const
+		{
+			vector3< double > g;
+			return( evaluate( x, y, z, g, false ) );
+		}
+
+		/// @brief ʒu ( x, y, z ) ̒lƌzifPʁj
+		double operator ()( double x, double y, double z, vector3< double > &grad ) const
+		{
+			return( evaluate( x, y, z, grad, true ) );
+		}
+
+		spline( )
+		{
+		}
+
+		/// @brief 摜 in ̌WvZ
+		template < class T, class Allocator >
+		spline( const array3< T, Allocator > &in, size_type thread_num = 0 )
+		{
+			build( in, thread_num );
+		}
+
+	private:
+		double evaluate( double x, double y, double z, vector3< double > &grad, bool gradient ) const
+		{
+			if( coef_.empty( ) )
+			{
+				grad = vector3< double >( 0, 0, 0 );
+				return( 0.0 );
+			}
+
+			double fx = std::floor( x ), fy = std::floor( y ), fz = std::floor( z );
+			double wx[ 4 ], dx[ 4 ], wy[ 4 ], dy[ 4 ], wz[ 4 ], dz[ 4 ];
+			__bspline__::weights( x - fx, wx, dx );
+			__bspline__::weights( y - fy, wy, dy );
+			__bspline__::weights( z - fz, wz, dz );
+
+			ptrdiff_t w = coef_.width( ), h = coef_.height( ), d = coef_.depth( );
+			ptrdiff_t ix = static_cast< ptrdiff_t >( fx ) - 1, iy = static_cast< ptrdiff_t >( fy ) - 1, iz = static_cast< ptrdiff_t >( fz ) - 1;
+			ptrdiff_t ii[ 4 ], jj[ 4 ];
+			for( ptrdiff_t n = 0 ; n < 4 ; n++ )
+			{
+				ii[ n ] = __bspline__::mirror( ix + n, w );
+				jj[ n ] = __bspline__::mirror( iy + n, h );
+			}
+
+			double v = 0.0, gx = 0.0, gy = 0.0, gz = 0.0;
+			for( ptrdiff_t l = 0 ; l < 4 ; l++ )
+			{
+				ptrdiff_t k = __bspline__::mirror( iz + l, d );
+				double sv = 0.0, sx = 0.0, sy = 0.0;
+				for( ptrdiff_t m = 0 ; m < 4 ; m++ )
+				{
+					const double *p = &coef_( 0, jj[ m ], k );
+					double s = p[ ii[ 0 ] ] * wx[ 0 ] + p[ ii[ 1 ] ] * wx[ 1 ] + p[ ii[ 2 ] ] * wx[ 2 ] + p[ ii[ 3 ] ] * wx[ 3 ];
+					sv += s * wy[ m ];
+					if( gradient )
+					{
+						sx += ( p[ ii[ 0 ] ] * dx[ 0 ] + p[ ii[ 1 ] ] * dx[ 1 ] + p[ ii[ 2 ] ] * dx[ 2 ] + p[ ii[ 3 ] ] * dx[ 3 ] ) * wy[ m ];
+						sy += s * dy[ m ];
+					}
+				}
+				v += sv * wz[ l ];
+				if( gradient )
+				{
+					gx += sx * wz[ l ];
+					gy += sy * wz[ l ];
+					gz += sv * dz[ l ];
+				}
+			}
+
+			if( gradient )
+			{
+				grad = vector3< double >( gx, gy, gz );
+			}
+
+			return( v );
+		}
+	};
+
 }
 
 
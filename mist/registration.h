@@ -1943,6 +1943,36 @@ namespace _poc_
 		return tmp;
 	}
 
+	// [pXtB^irfft ɂ X̔񕉂̎g摜pDwidth ͌̉摜̕j
+	// Sg̉摜ɑ΂ lowpass_filter ̃}XN͌_Ώ̂ł͂Ȃ߁CtB^̉摜̓G~[gΏ̂ɂȂȂD
+	// ŁC}XN_Ώ̂ȐƔΏ̂ȐɕCtϊ̎ɂȂ even ƁCɂȂ oddi-i {Ď́jꂼꋁ߂D
+	inline void lowpass_filter( const mist::array2< std::complex< double > > &image, mist::array2< std::complex< double > > &even, mist::array2< std::complex< double > > &odd, const double lowpass_range, const int width )
+	{
+		int half = image.width();
+		int height = image.height();
+
+		even.resize( half, height );
+		odd.resize( half, height );
+
+		int width1 = (int)(width * lowpass_range / 2);
+		int width2 = (int)(width * (1-lowpass_range / 2));
+		int height1 = (int)(height * lowpass_range / 2);
+		int height2 = (int)(height * (1-lowpass_range / 2));
+#pragma omp parallel for schedule( guided )
+		for( int h = 0 ; h < height ; h++)
+		{
+			int hh = ( height - h ) % height;
+			for( int w = 0 ; w < half ; w++ )
+			{
+				int ww = ( width - w ) % width;
+				double m1 = ( ( w < width1 || w > width2 ) && ( h < height1 || h > height2 ) ) ? 1.0 : 0.0;
+				double m2 = ( ( ww < width1 || ww > width2 ) && ( hh < height1 || hh > height2 ) ) ? 1.0 : 0.0;
+				even( w, h ) = image( w, h ) * ( 0.5 * ( m1 + m2 ) );
+				odd( w, h ) = image( w, h ) * std::complex< double >( 0, -0.5 * ( m1 - m2 ) );
+			}
+		}
+	}
+
 	//Tus[NT
 	inline void serch_peak( const mist::array2< double > &poc_image, point< double > &peak, point< double > &x_peak, point< double > &y_peak )
 	{
@@ -2072,7 +2102,6 @@ namespace _poc_
 	}
 
 	/// @brief 2̉摜̕sړ̂TusNZxŐ
-	//! FFTgp邽߉摜1ӂ2ׂ̂łȂ΂ȂȂ
 	//!
 	//! @param[in]  input            c ͉摜
 	//! @param[in]  reference        c 摜
@@ -2085,15 +2114,15 @@ namespace _poc_
 	{
 		int width = reference.width();
 		int height = reference.height();
-		mist::array2< std::complex< double > > freq_ref( width , height ),  freq_input( width , height ) ;	//gԉ摜
+		mist::array2< std::complex< double > > freq_ref,  freq_input ;	//gԉ摜iX͔񕉂̎ĝ݁j
 		//mist::array2< std::complex< double > > phase_ref( width , height ), phase_input( width , height ) ;  //ʑ摜
-		mist::array2< std::complex< double > > freq_poc( width , height );	//
+		mist::array2< std::complex< double > > freq_poc( width / 2 + 1 , height );	//
 		mist::array2< double > poc_image;
 		double norm = 0.0;
 
-		// FFT 
-		mist::fft( reference, freq_ref );
-		mist::fft( input, freq_input );
+		// FFTi͎͂Ȃ̂ŁCG~[gΏ̐𗘗pĔvZj
+		mist::rfft( reference, freq_ref );
+		mist::rfft( input, freq_input );
 		// ʑ葊։摜쐬 --------------------------------------
 		//for( int h = 0 ; h < height ; h++)
 		//{
@@ -2110,7 +2139,7 @@ namespace _poc_
 		//		}
 		//	}
 		//}
-		for( size_t i = 0 ; i < reference.size() ; i++)
+		for( size_t i = 0 ; i < freq_poc.size() ; i++)
 		{
 			freq_poc[i] = freq_ref[i] * conj( freq_input[i] );
 			norm = abs( freq_poc[i] );
@@ -2122,10 +2151,17 @@ namespace _poc_
 		// end ʑ葊։摜vZ --------------------------------------
 
 		// [pXtB^
-		freq_poc = lowpass_filter( freq_poc, lowpass_range );
+		mist::array2< std::complex< double > > freq_even, freq_odd;
+		lowpass_filter( freq_poc, freq_even, freq_odd, lowpass_range, width );
 
-		// tFFT
-		mist::ifft( freq_poc, poc_image );
+		// tFFTiSg̉摜 ifft ꍇƓCƋU߂j
+		mist::array2< double > poc_imag;
+		mist::irfft( freq_even, poc_image, width );
+		mist::irfft( freq_odd, poc_imag, width );
+		for( size_t i = 0 ; i < poc_image.size() ; i++)
+		{
+			poc_image[i] = std::sqrt( poc_image[i] * poc_image[i] + poc_imag[i] * poc_imag[i] );
+		}
 
 		// ی̔zu(13A24) ----------------------------
 		poc_image = shuffle_image( poc_image );
@@ -154,6 +154,109 @@ inline void sleep( size_t dwMilliseconds )
 }
 
 
+/// @brief 32bitɑ΂ĕsȔriCompare And Swapjs
+//!
+//! value ̒l comparand Ɠꍇ̂݁Cvalue  exchange ɒuD
+//! Windows̏ꍇ InterlockedCompareExchange ֐CLinuxn̏ꍇ GCC ̑gݍ݊֐𗘗pD
+//!
+//! @param[in,out] value     c Ώۂ̕ϐ
+//! @param[in]     comparand c rl
+//! @param[in]     exchange  c ul
+//!
+//! @retval true  c uɐ
+//! @retval false c value  comparand ƈقȂĂ߁CusȂ
+//!
+inline bool atomic_compare_and_swap( volatile unsigned int &value, unsigned int comparand, unsigned int exchange )
+{
+#if !defined( _MIST_THREAD_SUPPORT_ ) || _MIST_THREAD_SUPPORT_ == 0
+	if( value == comparand )
+	{
+		value = exchange;
+		return( true );
+	}
+	return( false );
+#elif defined( __MIST_WINDOWS__ ) && __MIST_WINDOWS__ > 0
+	LONG c = static_cast< LONG >( comparand );
+	return( InterlockedCompareExchange( reinterpret_cast< volatile LONG * >( &value ), static_cast< LONG >( exchange ), c ) == c );
+#else
+	return( __sync_bool_compare_and_swap( &value, comparand, exchange ) );
+#endif
+}
+
+
+#if defined( __MIST64__ ) || defined( __LP64__ ) || defined( _LP64 )
+/// @brief size_t ^̐ɑ΂ĕsȔriCompare And Swapjs
+//!
+//! value ̒l comparand Ɠꍇ̂݁Cvalue  exchange ɒuD
+//! Windows̏ꍇ InterlockedCompareExchangePointer ֐CLinuxn̏ꍇ GCC ̑gݍ݊֐𗘗pD
+//!
+//! @attention 32bitł size_t 32bitƂȂ邽߁C32bitɑ΂֐p
+//!
+//! @param[in,out] value     c Ώۂ̕ϐ
+//! @param[in]     comparand c rl
+//! @param[in]     exchange  c ul
+//!
+//! @retval true  c uɐ
+//! @retval false c value  comparand ƈقȂĂ߁CusȂ
+//!
+inline bool atomic_compare_and_swap( volatile size_t &value, size_t comparand, size_t exchange )
+{
+#if !defined( _MIST_THREAD_SUPPORT_ ) || _MIST_THREAD_SUPPORT_ == 0
+	if( value == comparand )
+	{
+		value = exchange;
+		return( true );
+	}
+	return( false );
+#elif defined( __MIST_WINDOWS__ ) && __MIST_WINDOWS__ > 0
+	void *c = reinterpret_cast< void * >( comparand );
+	return( InterlockedCompareExchangePointer( reinterpret_cast< void * volatile * >( &value ), reinterpret_cast< void * >( exchange ), c ) == c );
+#else
+	return( __sync_bool_compare_and_swap( &value, comparand, exchange ) );
+#endif
+}
+#endif
+
+
+/// @brief 32bitɑ΂ĕsȉZs
+//!
+//! @param[in,out] value c Ώۂ̕ϐ
+//! @param[in]     v     c Zl
+//!
+//! @return O̒l
+//!
+inline unsigned int atomic_add( volatile unsigned int &value, unsigned int v )
+{
+#if !defined( _MIST_THREAD_SUPPORT_ ) || _MIST_THREAD_SUPPORT_ == 0
+	unsigned int old = value;
+	value += v;
+	return( old );
+#elif defined( __MIST_WINDOWS__ ) && __MIST_WINDOWS__ > 0
+	return( static_cast< unsigned int >( InterlockedExchangeAdd( reinterpret_cast< volatile LONG * >( &value ), static_cast< LONG >( v ) ) ) );
+#else
+	return( __sync_fetch_and_add( &value, v ) );
+#endif
+}
+
+
+/// @brief 32bitɑ΂ĕsȃrbgas
+//!
+//! @param[in,out] value c Ώۂ̕ϐ
+//! @param[in]     v     c rbgaƂl
+//!
+//! @return O̒l
+//!
+inline unsigned int atomic_or( volatile unsigned int &value, unsigned int v )
+{
+	unsigned int old = value;
+	while( !atomic_compare_and_swap( value, old, old | v ) )
+	{
+		old = value;
+	}
+	return( old );
+}
+
+
 /// @brief Xbh̔rT|[głPȃNX
 //! 
 //! bNIuWFNgLꍇɎgpłVvȃNX
@@ -861,7 +964,7 @@ public:
 	thread( const thread &t ) : thread_handle_( t.thread_handle_ ), thread_id_( t.thread_id_ ), thread_exit_code_( t.thread_exit_code_ ){ }
 	thread( ) : thread_handle_( NULL ), thread_id_( ( unsigned int )-1 ), thread_exit_code_( 0 ){ }
 #else
-	thread( const thread &t ) : thread_id_( t.thread_id ), joined_( false ), thread_exit_code_( t.thread_exit_code ){ }
+	thread( const thread &t ) : thread_id_( t.thread_id_ ), joined_( false ), thread_exit_code_( t.thread_exit_code_ ){ }
 	thread( ) : thread_id_( ( pthread_t ) ( -1 ) ), joined_( false ), thread_exit_code_( 0 ){ }
 #endif
 
@@ -2255,6 +2358,7 @@ public:
 public:
 	thread_handle( ) : thread_( NULL ){ }
 	thread_handle( thread_object *t ) : thread_( t ){ }
+	thread_handle( const thread_handle &t ) : thread_( t.thread_ ){ }
 
 	const thread_handle &operator =( const thread_handle &t )
 	{
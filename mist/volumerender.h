@@ -480,6 +480,232 @@ namespace volumerender
 		//return( ( ( long * )&val )[ 0 ] >> 16 );
 	}
 
+	/// @brief ŏlEől̃}NZpēȗ̈ǂݔ΂߂̋}bv
+	//!
+	//! {[ cell_size fƂ̃}NZɕCeZ̒l̍ŏlEől{[ƂɈx߂ĂD
+	//! update ŃJ[e[u̕sx 0 łȂԂƊeZ̒l͈̔͂rCȃZł߂sȃZ܂ł
+	//! `FXՋZPʂŋ߂DJ[e[uύXꍇ update Ăђł悭CvZʂ̓ZɔႷD
+	//! DepthMap Ƃ volumerendering ֐Ȃǂɂ̂܂ܓnƂłD
+	//!
+	//! @attention }XNt̃{[_Oł́C}XÑJ[e[ulȂߎgpłȂ
+	//!
+	//! @code gp
+	//! mist::volumerender::macrocell_map mmap( ct );    // {[ǂݍ񂾂ƂɈx쐬
+	//! mmap.update( table );                            // J[e[uύX邽тɍXV
+	//! mist::volumerendering( ct, image, mmap, param, table );
+	//! @endcode
+	//!
+	class macrocell_map
+	{
+	public:
+		typedef ptrdiff_t difference_type;
+		typedef size_t size_type;
+
+	private:
+		size_type shift_;							// Z̈ӂ̉fi2ׂ̂j̎w
+		size_type width_;							// X̃Z
+		size_type height_;							// ỸZ
+		size_type depth_;							// Z̃Z
+		std::vector< difference_type > minimum_;	// eZ̍ŏl
+		std::vector< difference_type > maximum_;	// eZ̍ől
+		std::vector< difference_type > distance_;	// ł߂sȃZ܂ł̃`FXՋi0 ͕sȃZj
+
+	public:
+		/// @brief ̃}bv쐬iǂݔ΂͍sȂj
+		macrocell_map( ) : shift_( 3 ), width_( 0 ), height_( 0 ), depth_( 0 ){ }
+
+		/// @brief {[ in }NZ쐬
+		//!
+		//! @param[in] in        c ̓{[
+		//! @param[in] cell_size c }NZ̈ӂ̉fi2ׂ̂ɐ؂グj
+		//!
+		template < class Array >
+		macrocell_map( const Array &in, size_type cell_size = 8 ) : shift_( 3 ), width_( 0 ), height_( 0 ), depth_( 0 )
+		{
+			build( in, cell_size );
+		}
+
+		/// @brief {[ in ƃJ[e[u table }NZ쐬
+		template < class Array, class T >
+		macrocell_map( const Array &in, const attribute_table< T > &table, size_type cell_size = 8 ) : shift_( 3 ), width_( 0 ), height_( 0 ), depth_( 0 )
+		{
+			build( in, cell_size );
+			update( table );
+		}
+
+		/// @brief {[ in e}NZ̍ŏlEől߂
+		//!
+		//! אڂZƂ1fdCZ̈ʒuŕԂlK͈͂Ɋ܂܂悤ɂD
+		//! 쐬͑SẴZsƂĈ߁Cupdate Ăяo܂ł͓ǂݔ΂sȂD
+		//!
+		//! @param[in] in        c ̓{[
+		//! @param[in] cell_size c }NZ̈ӂ̉fi2ׂ̂ɐ؂グj
+		//!
+		template < class Array >
+		void build( const Array &in, size_type cell_size = 8 )
+		{
+			shift_ = 0;
+			while( ( static_cast< size_type >( 1 ) << shift_ ) < cell_size )
+			{
+				shift_++;
+			}
+
+			const size_type cs = static_cast< size_type >( 1 ) << shift_;
+			const size_type w = in.width( ), h = in.height( ), d = in.depth( );
+
+			width_  = w == 0 ? 0 : ( w - 1 ) / cs + 1;
+			height_ = h == 0 ? 0 : ( h - 1 ) / cs + 1;
+			depth_  = d == 0 ? 0 : ( d - 1 ) / cs + 1;
+
+			const size_type num = width_ * height_ * depth_;
+			minimum_.resize( num );
+			maximum_.resize( num );
+			distance_.assign( num, 0 );
+
+			for( size_type k = 0, c = 0 ; k < depth_ ; k++ )
+			{
+				size_type z0 = k * cs, z1 = z0 + cs < d - 1 ? z0 + cs : d - 1;
+				for( size_type j = 0 ; j < height_ ; j++ )
+				{
+					size_type y0 = j * cs, y1 = y0 + cs < h - 1 ? y0 + cs : h - 1;
+					for( size_type i = 0 ; i < width_ ; i++, c++ )
+					{
+						size_type x0 = i * cs, x1 = x0 + cs < w - 1 ? x0 + cs : w - 1;
+
+						double min = static_cast< double >( in( x0, y0, z0 ) );
+						double max = min;
+						for( size_type z = z0 ; z <= z1 ; z++ )
+						{
+							for( size_type y = y0 ; y <= y1 ; y++ )
+							{
+								for( size_type x = x0 ; x <= x1 ; x++ )
+								{
+									double v = static_cast< double >( in( x, y, z ) );
+									min = v < min ? v : min;
+									max = v > max ? v : max;
+								}
+							}
+						}
+
+						minimum_[ c ] = to_integer( min );
+						maximum_[ c ] = to_integer( max );
+					}
+				}
+			}
+		}
+
+		/// @brief J[e[u table ɑ΂ēȃZ𔻒肵CsȃZ܂ł̋ߒ
+		//!
+		//! @param[in] table c {[_O̐F|le[u
+		//!
+		template < class T >
+		void update( const attribute_table< T > &table )
+		{
+			const size_type num = distance_.size( );
+			if( num == 0 )
+			{
+				return;
+			}
+			else if( table.empty( ) )
+			{
+				distance_.assign( num, 0 );
+				return;
+			}
+
+			// sx 0 łȂvf̗ݐϘapāCԓɕsȒl邩萔ԂŔ肷
+			const difference_type tmin = table.minimum( );
+			const difference_type tmax = table.maximum( );
+			std::vector< size_type > count( static_cast< size_type >( tmax - tmin + 2 ), 0 );
+			for( difference_type v = tmin ; v <= tmax ; v++ )
+			{
+				count[ v - tmin + 1 ] = count[ v - tmin ] + ( table.has_alpha( v ) ? 1 : 0 );
+			}
+
+			const difference_type infinity = static_cast< difference_type >( width_ + height_ + depth_ );
+			for( size_type c = 0 ; c < num ; c++ )
+			{
+				difference_type lo = minimum_[ c ] < tmin ? tmin : ( minimum_[ c ] > tmax ? tmax : minimum_[ c ] );
+				difference_type hi = maximum_[ c ] < tmin ? tmin : ( maximum_[ c ] > tmax ? tmax : maximum_[ c ] );
+				distance_[ c ] = count[ hi - tmin + 1 ] > count[ lo - tmin ] ? 0 : infinity;
+			}
+
+			// 26ߖT̑OiEޑŃ`FXՋ߂
+			const difference_type w = static_cast< difference_type >( width_ );
+			const difference_type h = static_cast< difference_type >( height_ );
+			const difference_type d = static_cast< difference_type >( depth_ );
+			for( int pass = 0 ; pass < 2 ; pass++ )
+			{
+				const difference_type s = pass == 0 ? 1 : -1;
+				for( difference_type kk = 0 ; kk < d ; kk++ )
+				{
+					difference_type k = pass == 0 ? kk : d - 1 - kk;
+					for( difference_type jj = 0 ; jj < h ; jj++ )
+					{
+						difference_type j = pass == 0 ? jj : h - 1 - jj;
+						for( difference_type ii = 0 ; ii < w ; ii++ )
+						{
+							difference_type i = pass == 0 ? ii : w - 1 - ii;
+							difference_type &dist = distance_[ ( k * h + j ) * w + i ];
+							if( dist == 0 )
+							{
+								continue;
+							}
+
+							// ̎Oɂ13ߖTQƂ
+							for( difference_type z = k - s ; z != k + s ; z += s )
+							{
+								if( z < 0 || z >= d )
+								{
+									continue;
+								}
+								for( difference_type y = j - 1 ; y <= j + 1 ; y++ )
+								{
+									if( y < 0 || y >= h || ( z == k && y == j + s ) )
+									{
+										continue;
+									}
+									for( difference_type x = i - 1 ; x <= i + 1 ; x++ )
+									{
+										if( x < 0 || x >= w || ( z == k && y == j && x != i - s ) )
+										{
+											continue;
+										}
+										difference_type v = distance_[ ( z * h + y ) * w + x ] + 1;
+										dist = v < dist ? v : dist;
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+
+		/// @brief }NZ̈ӂ̉f
+		size_type cell_size( ) const { return( static_cast< size_type >( 1 ) << shift_ ); }
+
+		/// @brief f ( i, j, k ) 瓧ȗ̈ǂݔ΂鋗ifPʁjԂ
+		double operator()( difference_type i, difference_type j, difference_type k ) const
+		{
+			if( i < 0 || j < 0 || k < 0 )
+			{
+				return( 2.0 );
+			}
+
+			size_type x = static_cast< size_type >( i ) >> shift_;
+			size_type y = static_cast< size_type >( j ) >> shift_;
+			size_type z = static_cast< size_type >( k ) >> shift_;
+			if( x >= width_ || y >= height_ || z >= depth_ )
+			{
+				return( 2.0 );
+			}
+
+			//  l ̃Z̎ l - 1 Z͑SēȂ̂ŁC̕i߂邱Ƃł
+			difference_type l = distance_[ ( z * height_ + y ) * width_ + x ];
+			return( l > 1 ? static_cast< double >( ( l - 1 ) << shift_ ) : 2.0 );
+		}
+	};
+
 	template < class T >
 	inline void normalize_vector( vector3< T > &v )
 	{
@@ -1462,7 +1688,7 @@ namespace __volumerendering_specialized__
 {
 	// CTlԃ^Cṽ_Oɓ{[_OGW
 	template < class Array1, class Array2, class DepthMap, class T >
-	bool volumerendering( const Array1 &in, Array2 &out, const DepthMap &depth_map, const volumerender::parameter &param, const volumerender::attribute_table< T > &volrtable, typename Array1::size_type thread_id, typename Array1::size_type thread_num )
+	bool volumerendering( const Array1 &in, Array2 &out, const DepthMap &depth_map, const volumerender::parameter &param, const volumerender::attribute_table< T > &volrtable, volatile unsigned int &tile_index )
 	{
 		typedef typename volumerender::parameter::vector_type vector_type;
 		typedef typename volumerender::attribute_table< T >::attribute_type attribute_type;
@@ -1559,361 +1785,157 @@ namespace __volumerendering_specialized__
 
 		double max_distance = pos.length( ) + std::sqrt( static_cast< double >( w * w + h * h + d * d ) );
 
-		for( size_type j = thread_id ; j < image_height ; j += thread_num )
-		{
-			for( size_type i = 0 ; i < image_width ; i++ )
-			{
-				// eʏ̓_JWnɕϊ
-				vector_type Pos( static_cast< double >( i ) - cx, cy - static_cast< double >( j ), -focal );
+		// 摜 tile_size ~ tile_size f̃^CɕCeXbh͋LJE^疢̃^C1擾ĕ`悷
+		// wi΂̃^C͂ɏI邽߁Ĉ𑽂܂ޗ̈SXbhxďI邱ƂȂ
+		const size_type tile_size = 8;
+		const size_type tile_cols = ( image_width + tile_size - 1 ) / tile_size;
+		const size_type tile_num  = tile_cols * ( ( image_height + tile_size - 1 ) / tile_size );
 
-				// CJWn烏[hWnɕϊ
-				vector_type light;
-				if( bperspective )
-				{
-					light = ( eX * Pos.x + eY * Pos.y + eZ * Pos.z ).unit( );
-				}
-				else
-				{
-					pos = param.pos - offset + eX * Pos.x + eY * Pos.y;
-					light = -eZ;
-				}
-
-				pixel_type add_intensity( 0 );
-				double add_opacity = 1;
-
-				casting_start = pos;
-				casting_end = pos + light * max_distance;
-				vector_type normal;
+		for( size_type tile = atomic_add( tile_index, 1 ) ; tile < tile_num ; tile = atomic_add( tile_index, 1 ) )
+		{
+			const size_type i0 = ( tile % tile_cols ) * tile_size;
+			const size_type j0 = ( tile / tile_cols ) * tile_size;
+			const size_type i1 = i0 + tile_size < image_width  ? i0 + tile_size : image_width;
+			const size_type j1 = j0 + tile_size < image_height ? j0 + tile_size : image_height;
 
-				// ̂Ƃ̏Փ˔
-				if( volumerender::check_intersection( casting_start, casting_end, box[ 0 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 1 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 2 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 3 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 4 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 5 ], normal ) )
+			for( size_type j = j0 ; j < j1 ; j++ )
+			{
+				for( size_type i = i0 ; i < i1 ; i++ )
 				{
-					// ̌邽߂ɁAJ̋𑪂
-					Pos.x = ( pos.x + offset.x ) * _1_ax;
-					Pos.y = ( pos.y + offset.y ) * _1_ay;
-					Pos.z = ( pos.z + offset.z ) * _1_az;
+					// eʏ̓_JWnɕϊ
+					vector_type Pos( static_cast< double >( i ) - cx, cy - static_cast< double >( j ), -focal );
 
-					// [hWnXCXWnɕϊ
-					// ȍ~́ASăXCXWnŌvZ
-					casting_start.x = ( casting_start.x + offset.x ) * _1_ax;
-					casting_start.y = ( casting_start.y + offset.y ) * _1_ay;
-					casting_start.z = ( casting_start.z + offset.z ) * _1_az;
-					casting_end.x   = ( casting_end.x   + offset.x ) * _1_ax;
-					casting_end.y   = ( casting_end.y   + offset.y ) * _1_ay;
-					casting_end.z   = ( casting_end.z   + offset.z ) * _1_az;
+					// CJWn烏[hWnɕϊ
+					vector_type light;
+					if( bperspective )
+					{
+						light = ( eX * Pos.x + eY * Pos.y + eZ * Pos.z ).unit( );
+					}
+					else
+					{
+						pos = param.pos - offset + eX * Pos.x + eY * Pos.y;
+						light = -eZ;
+					}
 
-					vector_type spos = casting_start;
-					vector_type ray = ( casting_end - casting_start ).unit( );
+					pixel_type add_intensity( 0 );
+					double add_opacity = 1;
 
-					// ̌̋ɒ߂̃p[^
-					double dlen = vector_type( ray.x * ax, ray.y * ay, ray.z * az ).length( );
+					casting_start = pos;
+					casting_end = pos + light * max_distance;
+					vector_type normal;
 
-					// ̉f̉摜ł͕ɂăTvOԊuςĂ܂ɑΉ
-					double ray_sampling_step = sampling_step * masp / dlen;
+					// ̂Ƃ̏Փ˔
+					if( volumerender::check_intersection( casting_start, casting_end, box[ 0 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 1 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 2 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 3 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 4 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 5 ], normal ) )
+					{
+						// ̌邽߂ɁAJ̋𑪂
+						Pos.x = ( pos.x + offset.x ) * _1_ax;
+						Pos.y = ( pos.y + offset.y ) * _1_ay;
+						Pos.z = ( pos.z + offset.z ) * _1_az;
 
-					vector_type ray_step = ray * ray_sampling_step;
+						// [hWnXCXWnɕϊ
+						// ȍ~́ASăXCXWnŌvZ
+						casting_start.x = ( casting_start.x + offset.x ) * _1_ax;
+						casting_start.y = ( casting_start.y + offset.y ) * _1_ay;
+						casting_start.z = ( casting_start.z + offset.z ) * _1_az;
+						casting_end.x   = ( casting_end.x   + offset.x ) * _1_ax;
+						casting_end.y   = ( casting_end.y   + offset.y ) * _1_ay;
+						casting_end.z   = ( casting_end.z   + offset.z ) * _1_az;
 
-					double n = ( casting_end - casting_start ).length( );
-					double l = 0, of = ( Pos - casting_start ).length( );
+						vector_type spos = casting_start;
+						vector_type ray = ( casting_end - casting_start ).unit( );
 
-					while( l < n )
-					{
-						difference_type si = volumerender::to_integer( spos.x );
-						difference_type sj = volumerender::to_integer( spos.y );
-						difference_type sk = volumerender::to_integer( spos.z );
+						// ̌̋ɒ߂̃p[^
+						double dlen = vector_type( ray.x * ax, ray.y * ay, ray.z * az ).length( );
 
-						// s͈͂̐擪|C^擾
-						const_pointer p = &in( si, sj, sk );
+						// ̉f̉摜ł͕ɂăTvOԊuςĂ܂ɑΉ
+						double ray_sampling_step = sampling_step * masp / dlen;
 
-						// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
-						if( table[ p[ d0 ] ].has_alpha || table[ p[ d1 ] ].has_alpha ||
-							table[ p[ d2 ] ].has_alpha || table[ p[ d3 ] ].has_alpha ||
-							table[ p[ d4 ] ].has_alpha || table[ p[ d5 ] ].has_alpha ||
-							table[ p[ d6 ] ].has_alpha || table[ p[ d7 ] ].has_alpha )
-						{
-							if( l > 0 )
-							{
-								spos.x -= ray.x;
-								spos.y -= ray.y;
-								spos.z -= ray.z;
-								l -= 1.0;
-							}
-							break;
-						}
+						vector_type ray_step = ray * ray_sampling_step;
 
-						double current_step = depth_map( si, sj, sk );
-						l += current_step;
-						spos.x += ray.x * current_step;
-						spos.y += ray.y * current_step;
-						spos.z += ray.z * current_step;
+						double n = ( casting_end - casting_start ).length( );
+						double l = 0, of = ( Pos - casting_start ).length( );
 
 						while( l < n )
 						{
-							si = volumerender::to_integer( spos.x );
-							sj = volumerender::to_integer( spos.y );
-							sk = volumerender::to_integer( spos.z );
+							difference_type si = volumerender::to_integer( spos.x );
+							difference_type sj = volumerender::to_integer( spos.y );
+							difference_type sk = volumerender::to_integer( spos.z );
 
-							current_step = depth_map( si, sj, sk );
+							// s͈͂̐擪|C^擾
+							const_pointer p = &in( si, sj, sk );
 
-							if( current_step <= 2.0 )
+							// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
+							if( table[ p[ d0 ] ].has_alpha || table[ p[ d1 ] ].has_alpha ||
+								table[ p[ d2 ] ].has_alpha || table[ p[ d3 ] ].has_alpha ||
+								table[ p[ d4 ] ].has_alpha || table[ p[ d5 ] ].has_alpha ||
+								table[ p[ d6 ] ].has_alpha || table[ p[ d7 ] ].has_alpha )
 							{
+								if( l > 0 )
+								{
+									spos.x -= ray.x;
+									spos.y -= ray.y;
+									spos.z -= ray.z;
+									l -= 1.0;
+								}
 								break;
 							}
 
+							double current_step = depth_map( si, sj, sk );
 							l += current_step;
 							spos.x += ray.x * current_step;
 							spos.y += ray.y * current_step;
 							spos.z += ray.z * current_step;
-						}
-					}
-
-					// [܂œBꍇ͉Ȃ
-					if( l >= n )
-					{
-						out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
-						continue;
-					}
-
-					double nct[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
-					double ndx[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
-					double ndy[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
-					double ndz[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
-					const_pointer op = NULL;
-
-					if( l == 0.0 )
-					{
-						difference_type si = volumerender::to_integer( spos.x );
-						difference_type sj = volumerender::to_integer( spos.y );
-						difference_type sk = volumerender::to_integer( spos.z );
-
-						double xx = spos.x - si;
-						double yy = spos.y - sj;
-						double zz = spos.z - sk;
-
-						const_pointer p = &in( si, sj, sk );
-
-						nct[ 0 ] = p[ d0 ];
-						nct[ 1 ] = p[ d3 ] - p[ d0 ];
-						nct[ 2 ] = p[ d1 ] - p[ d0 ];
-						nct[ 3 ] = p[ d2 ] - p[ d3 ] - nct[ 2 ];
-						nct[ 4 ] = p[ d4 ];
-						nct[ 5 ] = p[ d7 ] - p[ d4 ];
-						nct[ 6 ] = p[ d5 ] - p[ d4 ];
-						nct[ 7 ] = p[ d6 ] - p[ d7 ] - nct[ 6 ];
-
-						// CTlɑΉFƕsx擾
-						double ct = ( nct[ 0 ] + nct[ 1 ] * xx ) + ( nct[ 2 ] + nct[ 3 ] * xx ) * yy;
-						ct += ( ( nct[ 4 ] + nct[ 5 ] * xx ) + ( nct[ 6 ] + nct[ 7 ] * xx ) * yy - ct ) * zz;
-
-						const attribute_type &oc = table[ volumerender::to_integer( ct ) ];
 
-						if( oc.has_alpha )
-						{
-							const_pointer p0 = p;
-							const_pointer p1 = p0 + d1;
-							const_pointer p2 = p0 + d2;
-							const_pointer p3 = p0 + d3;
-							const_pointer p4 = p0 + d4;
-							const_pointer p5 = p0 + d5;
-							const_pointer p6 = p0 + d6;
-							const_pointer p7 = p0 + d7;
-
-							double n0x = p3[  0  ] - p0[ -_1 ];
-							double n0y = p1[  0  ] - p0[ -_2 ];
-							double n0z = p4[  0  ] - p0[ -_3 ];
-							double n1x = p2[  0  ] - p1[ -_1 ];
-							double n1y = p1[  _2 ] - p0[  0  ];
-							double n1z = p5[  0  ] - p1[ -_3 ];
-							double n2x = p2[  _1 ] - p1[  0  ];
-							double n2y = p2[  _2 ] - p3[  0  ];
-							double n2z = p6[  0  ] - p2[ -_3 ];
-							double n3x = p3[  _1 ] - p0[  0  ];
-							double n3y = p2[  0  ] - p3[ -_2 ];
-							double n3z = p7[  0  ] - p3[ -_3 ];
-							double n4x = p7[  0  ] - p4[ -_1 ];
-							double n4y = p5[  0  ] - p4[ -_2 ];
-							double n4z = p4[  _3 ] - p0[  0  ];
-							double n5x = p6[  0  ] - p5[ -_1 ];
-							double n5y = p5[  _2 ] - p4[  0  ];
-							double n5z = p5[  _3 ] - p1[  0  ];
-							double n6x = p6[  _1 ] - p5[  0  ];
-							double n6y = p6[  _2 ] - p7[  0  ];
-							double n6z = p6[  _3 ] - p2[  0  ];
-							double n7x = p7[  _1 ] - p4[  0  ];
-							double n7y = p6[  0  ] - p7[ -_2 ];
-							double n7z = p7[  _3 ] - p3[  0  ];
-
-							ndx[ 0 ] = n0x;
-							ndx[ 1 ] = n3x - n0x;
-							ndx[ 2 ] = n1x - n0x;
-							ndx[ 3 ] = n2x - n3x - ndx[ 2 ];
-							ndx[ 4 ] = n4x;
-							ndx[ 5 ] = n7x - n4x;
-							ndx[ 6 ] = n5x - n4x;
-							ndx[ 7 ] = n6x - n7x - ndx[ 6 ];
-
-							ndy[ 0 ] = n0y;
-							ndy[ 1 ] = n3y - n0y;
-							ndy[ 2 ] = n1y - n0y;
-							ndy[ 3 ] = n2y - n3y - ndy[ 2 ];
-							ndy[ 4 ] = n4y;
-							ndy[ 5 ] = n7y - n4y;
-							ndy[ 6 ] = n5y - n4y;
-							ndy[ 7 ] = n6y - n7y - ndy[ 6 ];
-
-							ndz[ 0 ] = n0z;
-							ndz[ 1 ] = n3z - n0z;
-							ndz[ 2 ] = n1z - n0z;
-							ndz[ 3 ] = n2z - n3z - ndz[ 2 ];
-							ndz[ 4 ] = n4z;
-							ndz[ 5 ] = n7z - n4z;
-							ndz[ 6 ] = n5z - n4z;
-							ndz[ 7 ] = n6z - n7z - ndz[ 6 ];
-
-							op = p;
-
-							double nx  = ( ndx[ 0 ] + ndx[ 1 ] * xx ) + ( ndx[ 2 ] + ndx[ 3 ] * xx ) * yy;
-							nx += ( ( ndx[ 4 ] + ndx[ 5 ] * xx ) + ( ndx[ 6 ] + ndx[ 7 ] * xx ) * yy - nx ) * zz;
-							double ny  = ( ndy[ 0 ] + ndy[ 1 ] * xx ) + ( ndy[ 2 ] + ndy[ 3 ] * xx ) * yy;
-							ny += ( ( ndy[ 4 ] + ndy[ 5 ] * xx ) + ( ndy[ 6 ] + ndy[ 7 ] * xx ) * yy - ny ) * zz;
-							double nz  = ( ndz[ 0 ] + ndz[ 1 ] * xx ) + ( ndz[ 2 ] + ndz[ 3 ] * xx ) * yy;
-							nz += ( ( ndz[ 4 ] + ndz[ 5 ] * xx ) + ( ndz[ 6 ] + ndz[ 7 ] * xx ) * yy - nz ) * zz;
-
-							// ؒfʂ̖@𔽉f
-							double _1_len = 0.5 / ( std::sqrt( nx * nx + ny * ny + nz * nz ) + type_limits< double >::tiny( ) );
-							nx = ( nx * _1_len + normal.x ) * _1_ax;
-							ny = ( ny * _1_len + normal.y ) * _1_ay;
-							nz = ( nz * _1_len + normal.z ) * _1_az;
-
-							// @]Ăꍇւ̑Ή
-							double c = light.x * nx + light.y * ny + light.z * nz;
-							c = std::sqrt( ( c * c ) / ( nx * nx + ny * ny + nz * nz + type_limits< double >::tiny( ) ) );
-
-							double spec = 0.0;
-							if( bSpecular )
-							{
-								spec = 2.0 * c * c - 1.0;
-
-								if( spec <= 0.0 )
-								{
-									spec = 0;
-								}
-								else
-								{
-									spec *= spec;	//  2
-									spec *= spec;	//  4
-									spec *= spec;	//  8
-									spec *= spec;	// 16
-									spec *= spec;	// 32
-									spec *= spec;	// 64
-									//spec *= spec;	// 128
-									spec *= specular * 255.0;
-								}
-							}
-
-							double lAtten = 1.0;
-							if( bLightAtten )
-							{
-								double len = ( l + of ) * dlen;
-								lAtten /= 1.0 + lightAtten * ( len * len );
-							}
-
-							double alpha = oc.alpha * sampling_step;
-							add_intensity += alpha * add_opacity * ( oc.pixel * ( c * diffuse_ratio + ambient_ratio ) + spec ) * lAtten;
-							add_opacity *= ( 1.0 - alpha );
-
-							// f_Oʂɗ^elȉɂȂꍇ͏I
-							if( add_opacity < termination )
-							{
-								out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( add_intensity * ( 1.0 - add_opacity ) + background * add_opacity ) );
-								continue;
-							}
-
-							spos.x += ray_step.x;
-							spos.y += ray_step.y;
-							spos.z += ray_step.z;
-							l += ray_sampling_step;
-						}
-						else
-						{
-							// ̈ʒuɂ镨̂̏ꍇ͎̃Xebvֈڍs
-							spos += ray_step;
-							l += ray_sampling_step;
-
-							double ol = l;
 							while( l < n )
 							{
-								difference_type si = volumerender::to_integer( spos.x );
-								difference_type sj = volumerender::to_integer( spos.y );
-								difference_type sk = volumerender::to_integer( spos.z );
+								si = volumerender::to_integer( spos.x );
+								sj = volumerender::to_integer( spos.y );
+								sk = volumerender::to_integer( spos.z );
 
-								const_pointer p = &in( si, sj, sk );
+								current_step = depth_map( si, sj, sk );
 
-								// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
-								if( table[ p[ d0 ] ].has_alpha || table[ p[ d1 ] ].has_alpha ||
-									table[ p[ d2 ] ].has_alpha || table[ p[ d3 ] ].has_alpha ||
-									table[ p[ d4 ] ].has_alpha || table[ p[ d5 ] ].has_alpha ||
-									table[ p[ d6 ] ].has_alpha || table[ p[ d7 ] ].has_alpha )
+								if( current_step <= 2.0 )
 								{
-									if( l > ol )
-									{
-										spos.x -= ray.x;
-										spos.y -= ray.y;
-										spos.z -= ray.z;
-										l -= 1.0;
-									}
 									break;
 								}
 
-								double current_step = depth_map( si, sj, sk );
 								l += current_step;
 								spos.x += ray.x * current_step;
 								spos.y += ray.y * current_step;
 								spos.z += ray.z * current_step;
-
-								while( l < n )
-								{
-									si = volumerender::to_integer( spos.x );
-									sj = volumerender::to_integer( spos.y );
-									sk = volumerender::to_integer( spos.z );
-
-									current_step = depth_map( si, sj, sk );
-
-									if( current_step <= 2.0 )
-									{
-										break;
-									}
-
-									l += current_step;
-									spos.x += ray.x * current_step;
-									spos.y += ray.y * current_step;
-									spos.z += ray.z * current_step;
-								}
 							}
 						}
-					}
 
-					while( l < n )
-					{
-						difference_type si = volumerender::to_integer( spos.x );
-						difference_type sj = volumerender::to_integer( spos.y );
-						difference_type sk = volumerender::to_integer( spos.z );
+						// [܂œBꍇ͉Ȃ
+						if( l >= n )
+						{
+							out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
+							continue;
+						}
 
-						double xx = spos.x - si;
-						double yy = spos.y - sj;
-						double zz = spos.z - sk;
+						double nct[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+						double ndx[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+						double ndy[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+						double ndz[ 8 ] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+						const_pointer op = NULL;
 
-						const_pointer p = &in( si, sj, sk );
+						if( l == 0.0 )
+						{
+							difference_type si = volumerender::to_integer( spos.x );
+							difference_type sj = volumerender::to_integer( spos.y );
+							difference_type sk = volumerender::to_integer( spos.z );
 
-						bool need_update = p != op;
+							double xx = spos.x - si;
+							double yy = spos.y - sj;
+							double zz = spos.z - sk;
+
+							const_pointer p = &in( si, sj, sk );
 
-						if( need_update )
-						{
 							nct[ 0 ] = p[ d0 ];
 							nct[ 1 ] = p[ d3 ] - p[ d0 ];
 							nct[ 2 ] = p[ d1 ] - p[ d0 ];
@@ -1922,17 +1944,14 @@ namespace __volumerendering_specialized__
 							nct[ 5 ] = p[ d7 ] - p[ d4 ];
 							nct[ 6 ] = p[ d5 ] - p[ d4 ];
 							nct[ 7 ] = p[ d6 ] - p[ d7 ] - nct[ 6 ];
-						}
 
-						// CTlɑΉFƕsx擾
-						double ct = ( nct[ 0 ] + nct[ 1 ] * xx ) + ( nct[ 2 ] + nct[ 3 ] * xx ) * yy;
-						ct += ( ( nct[ 4 ] + nct[ 5 ] * xx ) + ( nct[ 6 ] + nct[ 7 ] * xx ) * yy - ct ) * zz;
+							// CTlɑΉFƕsx擾
+							double ct = ( nct[ 0 ] + nct[ 1 ] * xx ) + ( nct[ 2 ] + nct[ 3 ] * xx ) * yy;
+							ct += ( ( nct[ 4 ] + nct[ 5 ] * xx ) + ( nct[ 6 ] + nct[ 7 ] * xx ) * yy - ct ) * zz;
 
-						const attribute_type &oc = table[ volumerender::to_integer( ct ) ];
+							const attribute_type &oc = table[ volumerender::to_integer( ct ) ];
 
-						if( oc.has_alpha )
-						{
-							if( need_update )
+							if( oc.has_alpha )
 							{
 								const_pointer p0 = p;
 								const_pointer p1 = p0 + d1;
@@ -1996,127 +2015,348 @@ namespace __volumerendering_specialized__
 								ndz[ 7 ] = n6z - n7z - ndz[ 6 ];
 
 								op = p;
-							}
-
-							double nx  = ( ndx[ 0 ] + ndx[ 1 ] * xx ) + ( ndx[ 2 ] + ndx[ 3 ] * xx ) * yy;
-							nx = ( nx + ( ( ndx[ 4 ] + ndx[ 5 ] * xx ) + ( ndx[ 6 ] + ndx[ 7 ] * xx ) * yy - nx ) * zz ) * _1_ax;
-							double ny  = ( ndy[ 0 ] + ndy[ 1 ] * xx ) + ( ndy[ 2 ] + ndy[ 3 ] * xx ) * yy;
-							ny = ( ny + ( ( ndy[ 4 ] + ndy[ 5 ] * xx ) + ( ndy[ 6 ] + ndy[ 7 ] * xx ) * yy - ny ) * zz ) * _1_ay;
-							double nz  = ( ndz[ 0 ] + ndz[ 1 ] * xx ) + ( ndz[ 2 ] + ndz[ 3 ] * xx ) * yy;
-							nz = ( nz + ( ( ndz[ 4 ] + ndz[ 5 ] * xx ) + ( ndz[ 6 ] + ndz[ 7 ] * xx ) * yy - nz ) * zz ) * _1_az;
 
-							// @]Ăꍇւ̑Ή
-							double c = light.x * nx + light.y * ny + light.z * nz;
-							c = std::sqrt( ( c * c ) / ( nx * nx + ny * ny + nz * nz + type_limits< double >::tiny( ) ) );
+								double nx  = ( ndx[ 0 ] + ndx[ 1 ] * xx ) + ( ndx[ 2 ] + ndx[ 3 ] * xx ) * yy;
+								nx += ( ( ndx[ 4 ] + ndx[ 5 ] * xx ) + ( ndx[ 6 ] + ndx[ 7 ] * xx ) * yy - nx ) * zz;
+								double ny  = ( ndy[ 0 ] + ndy[ 1 ] * xx ) + ( ndy[ 2 ] + ndy[ 3 ] * xx ) * yy;
+								ny += ( ( ndy[ 4 ] + ndy[ 5 ] * xx ) + ( ndy[ 6 ] + ndy[ 7 ] * xx ) * yy - ny ) * zz;
+								double nz  = ( ndz[ 0 ] + ndz[ 1 ] * xx ) + ( ndz[ 2 ] + ndz[ 3 ] * xx ) * yy;
+								nz += ( ( ndz[ 4 ] + ndz[ 5 ] * xx ) + ( ndz[ 6 ] + ndz[ 7 ] * xx ) * yy - nz ) * zz;
+
+								// ؒfʂ̖@𔽉f
+								double _1_len = 0.5 / ( std::sqrt( nx * nx + ny * ny + nz * nz ) + type_limits< double >::tiny( ) );
+								nx = ( nx * _1_len + normal.x ) * _1_ax;
+								ny = ( ny * _1_len + normal.y ) * _1_ay;
+								nz = ( nz * _1_len + normal.z ) * _1_az;
+
+								// @]Ăꍇւ̑Ή
+								double c = light.x * nx + light.y * ny + light.z * nz;
+								c = std::sqrt( ( c * c ) / ( nx * nx + ny * ny + nz * nz + type_limits< double >::tiny( ) ) );
+
+								double spec = 0.0;
+								if( bSpecular )
+								{
+									spec = 2.0 * c * c - 1.0;
 
-							double spec = 0.0;
-							if( bSpecular )
-							{
-								spec = 2.0 * c * c - 1.0;
+									if( spec <= 0.0 )
+									{
+										spec = 0;
+									}
+									else
+									{
+										spec *= spec;	//  2
+										spec *= spec;	//  4
+										spec *= spec;	//  8
+										spec *= spec;	// 16
+										spec *= spec;	// 32
+										spec *= spec;	// 64
+										//spec *= spec;	// 128
+										spec *= specular * 255.0;
+									}
+								}
 
-								if( spec <= 0.0 )
+								double lAtten = 1.0;
+								if( bLightAtten )
 								{
-									spec = 0;
+									double len = ( l + of ) * dlen;
+									lAtten /= 1.0 + lightAtten * ( len * len );
 								}
-								else
+
+								double alpha = oc.alpha * sampling_step;
+								add_intensity += alpha * add_opacity * ( oc.pixel * ( c * diffuse_ratio + ambient_ratio ) + spec ) * lAtten;
+								add_opacity *= ( 1.0 - alpha );
+
+								// f_Oʂɗ^elȉɂȂꍇ͏I
+								if( add_opacity < termination )
 								{
-									spec *= spec;	//  2
-									spec *= spec;	//  4
-									spec *= spec;	//  8
-									spec *= spec;	// 16
-									spec *= spec;	// 32
-									spec *= spec;	// 64
-									//spec *= spec;	// 128
-									spec *= specular * 255.0;
+									out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( add_intensity * ( 1.0 - add_opacity ) + background * add_opacity ) );
+									continue;
 								}
-							}
 
-							double lAtten = 1.0;
-							if( bLightAtten )
+								spos.x += ray_step.x;
+								spos.y += ray_step.y;
+								spos.z += ray_step.z;
+								l += ray_sampling_step;
+							}
+							else
 							{
-								double len = ( l + of ) * dlen;
-								lAtten /= 1.0 + lightAtten * ( len * len );
+								// ̈ʒuɂ镨̂̏ꍇ͎̃Xebvֈڍs
+								spos += ray_step;
+								l += ray_sampling_step;
+
+								double ol = l;
+								while( l < n )
+								{
+									difference_type si = volumerender::to_integer( spos.x );
+									difference_type sj = volumerender::to_integer( spos.y );
+									difference_type sk = volumerender::to_integer( spos.z );
+
+									const_pointer p = &in( si, sj, sk );
+
+									// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
+									if( table[ p[ d0 ] ].has_alpha || table[ p[ d1 ] ].has_alpha ||
+										table[ p[ d2 ] ].has_alpha || table[ p[ d3 ] ].has_alpha ||
+										table[ p[ d4 ] ].has_alpha || table[ p[ d5 ] ].has_alpha ||
+										table[ p[ d6 ] ].has_alpha || table[ p[ d7 ] ].has_alpha )
+									{
+										if( l > ol )
+										{
+											spos.x -= ray.x;
+											spos.y -= ray.y;
+											spos.z -= ray.z;
+											l -= 1.0;
+										}
+										break;
+									}
+
+									double current_step = depth_map( si, sj, sk );
+									l += current_step;
+									spos.x += ray.x * current_step;
+									spos.y += ray.y * current_step;
+									spos.z += ray.z * current_step;
+
+									while( l < n )
+									{
+										si = volumerender::to_integer( spos.x );
+										sj = volumerender::to_integer( spos.y );
+										sk = volumerender::to_integer( spos.z );
+
+										current_step = depth_map( si, sj, sk );
+
+										if( current_step <= 2.0 )
+										{
+											break;
+										}
+
+										l += current_step;
+										spos.x += ray.x * current_step;
+										spos.y += ray.y * current_step;
+										spos.z += ray.z * current_step;
+									}
+								}
 							}
+						}
+
+						while( l < n )
+						{
+							difference_type si = volumerender::to_integer( spos.x );
+							difference_type sj = volumerender::to_integer( spos.y );
+							difference_type sk = volumerender::to_integer( spos.z );
 
-							double alpha = oc.alpha * sampling_step;
-							add_intensity += alpha * add_opacity * ( oc.pixel * ( c * diffuse_ratio + ambient_ratio ) + spec ) * lAtten;
-							add_opacity *= ( 1.0 - alpha );
+							double xx = spos.x - si;
+							double yy = spos.y - sj;
+							double zz = spos.z - sk;
 
-							// f_Oʂɗ^elȉɂȂꍇ͏I
-							if( add_opacity < termination )
+							const_pointer p = &in( si, sj, sk );
+
+							bool need_update = p != op;
+
+							if( need_update )
 							{
-								break;
+								nct[ 0 ] = p[ d0 ];
+								nct[ 1 ] = p[ d3 ] - p[ d0 ];
+								nct[ 2 ] = p[ d1 ] - p[ d0 ];
+								nct[ 3 ] = p[ d2 ] - p[ d3 ] - nct[ 2 ];
+								nct[ 4 ] = p[ d4 ];
+								nct[ 5 ] = p[ d7 ] - p[ d4 ];
+								nct[ 6 ] = p[ d5 ] - p[ d4 ];
+								nct[ 7 ] = p[ d6 ] - p[ d7 ] - nct[ 6 ];
 							}
 
-							spos.x += ray_step.x;
-							spos.y += ray_step.y;
-							spos.z += ray_step.z;
-							l += ray_sampling_step;
-						}
-						else
-						{
-							// ̈ʒuɂ镨̂̏ꍇ͎̃Xebvֈڍs
-							spos += ray_step;
-							l += ray_sampling_step;
+							// CTlɑΉFƕsx擾
+							double ct = ( nct[ 0 ] + nct[ 1 ] * xx ) + ( nct[ 2 ] + nct[ 3 ] * xx ) * yy;
+							ct += ( ( nct[ 4 ] + nct[ 5 ] * xx ) + ( nct[ 6 ] + nct[ 7 ] * xx ) * yy - ct ) * zz;
 
-							double ol = l;
-							while( l < n )
+							const attribute_type &oc = table[ volumerender::to_integer( ct ) ];
+
+							if( oc.has_alpha )
 							{
-								difference_type si = volumerender::to_integer( spos.x );
-								difference_type sj = volumerender::to_integer( spos.y );
-								difference_type sk = volumerender::to_integer( spos.z );
+								if( need_update )
+								{
+									const_pointer p0 = p;
+									const_pointer p1 = p0 + d1;
+									const_pointer p2 = p0 + d2;
+									const_pointer p3 = p0 + d3;
+									const_pointer p4 = p0 + d4;
+									const_pointer p5 = p0 + d5;
+									const_pointer p6 = p0 + d6;
+									const_pointer p7 = p0 + d7;
+
+									double n0x = p3[  0  ] - p0[ -_1 ];
+									double n0y = p1[  0  ] - p0[ -_2 ];
+									double n0z = p4[  0  ] - p0[ -_3 ];
+									double n1x = p2[  0  ] - p1[ -_1 ];
+									double n1y = p1[  _2 ] - p0[  0  ];
+									double n1z = p5[  0  ] - p1[ -_3 ];
+									double n2x = p2[  _1 ] - p1[  0  ];
+									double n2y = p2[  _2 ] - p3[  0  ];
+									double n2z = p6[  0  ] - p2[ -_3 ];
+									double n3x = p3[  _1 ] - p0[  0  ];
+									double n3y = p2[  0  ] - p3[ -_2 ];
+									double n3z = p7[  0  ] - p3[ -_3 ];
+									double n4x = p7[  0  ] - p4[ -_1 ];
+									double n4y = p5[  0  ] - p4[ -_2 ];
+									double n4z = p4[  _3 ] - p0[  0  ];
+									double n5x = p6[  0  ] - p5[ -_1 ];
+									double n5y = p5[  _2 ] - p4[  0  ];
+									double n5z = p5[  _3 ] - p1[  0  ];
+									double n6x = p6[  _1 ] - p5[  0  ];
+									double n6y = p6[  _2 ] - p7[  0  ];
+									double n6z = p6[  _3 ] - p2[  0  ];
+									double n7x = p7[  _1 ] - p4[  0  ];
+									double n7y = p6[  0  ] - p7[ -_2 ];
+									double n7z = p7[  _3 ] - p3[  0  ];
+
+									ndx[ 0 ] = n0x;
+									ndx[ 1 ] = n3x - n0x;
+									ndx[ 2 ] = n1x - n0x;
+									ndx[ 3 ] = n2x - n3x - ndx[ 2 ];
+									ndx[ 4 ] = n4x;
+									ndx[ 5 ] = n7x - n4x;
+									ndx[ 6 ] = n5x - n4x;
+									ndx[ 7 ] = n6x - n7x - ndx[ 6 ];
+
+									ndy[ 0 ] = n0y;
+									ndy[ 1 ] = n3y - n0y;
+									ndy[ 2 ] = n1y - n0y;
+									ndy[ 3 ] = n2y - n3y - ndy[ 2 ];
+									ndy[ 4 ] = n4y;
+									ndy[ 5 ] = n7y - n4y;
+									ndy[ 6 ] = n5y - n4y;
+									ndy[ 7 ] = n6y - n7y - ndy[ 6 ];
+
+									ndz[ 0 ] = n0z;
+									ndz[ 1 ] = n3z - n0z;
+									ndz[ 2 ] = n1z - n0z;
+									ndz[ 3 ] = n2z - n3z - ndz[ 2 ];
+									ndz[ 4 ] = n4z;
+									ndz[ 5 ] = n7z - n4z;
+									ndz[ 6 ] = n5z - n4z;
+									ndz[ 7 ] = n6z - n7z - ndz[ 6 ];
+
+									op = p;
+								}
 
-								const_pointer p = &in( si, sj, sk );
+								double nx  = ( ndx[ 0 ] + ndx[ 1 ] * xx ) + ( ndx[ 2 ] + ndx[ 3 ] * xx ) * yy;
+								nx = ( nx + ( ( ndx[ 4 ] + ndx[ 5 ] * xx ) + ( ndx[ 6 ] + ndx[ 7 ] * xx ) * yy - nx ) * zz ) * _1_ax;
+								double ny  = ( ndy[ 0 ] + ndy[ 1 ] * xx ) + ( ndy[ 2 ] + ndy[ 3 ] * xx ) * yy;
+								ny = ( ny + ( ( ndy[ 4 ] + ndy[ 5 ] * xx ) + ( ndy[ 6 ] + ndy[ 7 ] * xx ) * yy - ny ) * zz ) * _1_ay;
+								double nz  = ( ndz[ 0 ] + ndz[ 1 ] * xx ) + ( ndz[ 2 ] + ndz[ 3 ] * xx ) * yy;
+								nz = ( nz + ( ( ndz[ 4 ] + ndz[ 5 ] * xx ) + ( ndz[ 6 ] + ndz[ 7 ] * xx ) * yy - nz ) * zz ) * _1_az;
 
-								// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
-								if( table[ p[ d0 ] ].has_alpha || table[ p[ d1 ] ].has_alpha ||
-									table[ p[ d2 ] ].has_alpha || table[ p[ d3 ] ].has_alpha ||
-									table[ p[ d4 ] ].has_alpha || table[ p[ d5 ] ].has_alpha ||
-									table[ p[ d6 ] ].has_alpha || table[ p[ d7 ] ].has_alpha )
+								// @]Ăꍇւ̑Ή
+								double c = light.x * nx + light.y * ny + light.z * nz;
+								c = std::sqrt( ( c * c ) / ( nx * nx + ny * ny + nz * nz + type_limits< double >::tiny( ) ) );
+
+								double spec = 0.0;
+								if( bSpecular )
 								{
-									if( l > ol )
+									spec = 2.0 * c * c - 1.0;
+
+									if( spec <= 0.0 )
+									{
+										spec = 0;
+									}
+									else
 									{
-										spos.x -= ray.x;
-										spos.y -= ray.y;
-										spos.z -= ray.z;
-										l -= 1.0;
+										spec *= spec;	//  2
+										spec *= spec;	//  4
+										spec *= spec;	//  8
+										spec *= spec;	// 16
+										spec *= spec;	// 32
+										spec *= spec;	// 64
+										//spec *= spec;	// 128
+										spec *= specular * 255.0;
 									}
+								}
+
+								double lAtten = 1.0;
+								if( bLightAtten )
+								{
+									double len = ( l + of ) * dlen;
+									lAtten /= 1.0 + lightAtten * ( len * len );
+								}
+
+								double alpha = oc.alpha * sampling_step;
+								add_intensity += alpha * add_opacity * ( oc.pixel * ( c * diffuse_ratio + ambient_ratio ) + spec ) * lAtten;
+								add_opacity *= ( 1.0 - alpha );
+
+								// f_Oʂɗ^elȉɂȂꍇ͏I
+								if( add_opacity < termination )
+								{
 									break;
 								}
 
-								double current_step = depth_map( si, sj, sk );
-								l += current_step;
-								spos.x += ray.x * current_step;
-								spos.y += ray.y * current_step;
-								spos.z += ray.z * current_step;
+								spos.x += ray_step.x;
+								spos.y += ray_step.y;
+								spos.z += ray_step.z;
+								l += ray_sampling_step;
+							}
+							else
+							{
+								// ̈ʒuɂ镨̂̏ꍇ͎̃Xebvֈڍs
+								spos += ray_step;
+								l += ray_sampling_step;
 
+								double ol = l;
 								while( l < n )
 								{
-									si = volumerender::to_integer( spos.x );
-									sj = volumerender::to_integer( spos.y );
-									sk = volumerender::to_integer( spos.z );
+									difference_type si = volumerender::to_integer( spos.x );
+									difference_type sj = volumerender::to_integer( spos.y );
+									difference_type sk = volumerender::to_integer( spos.z );
 
-									current_step = depth_map( si, sj, sk );
+									const_pointer p = &in( si, sj, sk );
 
-									if( current_step <= 2.0 )
+									// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
+									if( table[ p[ d0 ] ].has_alpha || table[ p[ d1 ] ].has_alpha ||
+										table[ p[ d2 ] ].has_alpha || table[ p[ d3 ] ].has_alpha ||
+										table[ p[ d4 ] ].has_alpha || table[ p[ d5 ] ].has_alpha ||
+										table[ p[ d6 ] ].has_alpha || table[ p[ d7 ] ].has_alpha )
 									{
+										if( l > ol )
+										{
+											spos.x -= ray.x;
+											spos.y -= ray.y;
+											spos.z -= ray.z;
+											l -= 1.0;
+										}
 										break;
 									}
 
+									double current_step = depth_map( si, sj, sk );
 									l += current_step;
 									spos.x += ray.x * current_step;
 									spos.y += ray.y * current_step;
 									spos.z += ray.z * current_step;
+
+									while( l < n )
+									{
+										si = volumerender::to_integer( spos.x );
+										sj = volumerender::to_integer( spos.y );
+										sk = volumerender::to_integer( spos.z );
+
+										current_step = depth_map( si, sj, sk );
+
+										if( current_step <= 2.0 )
+										{
+											break;
+										}
+
+										l += current_step;
+										spos.x += ray.x * current_step;
+										spos.y += ray.y * current_step;
+										spos.z += ray.z * current_step;
+									}
 								}
 							}
 						}
-					}
 
-					out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( add_intensity * ( 1.0 - add_opacity ) + background * add_opacity ) );
-				}
-				else
-				{
-					out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
+						out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( add_intensity * ( 1.0 - add_opacity ) + background * add_opacity ) );
+					}
+					else
+					{
+						out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
+					}
 				}
 			}
 		}
@@ -2133,9 +2373,6 @@ namespace __volumerendering_specialized__
 		typedef typename Array1::value_type value_type;
 
 	private:
-		size_t thread_id_;
-		size_t thread_num_;
-
 		// o͗p̉摜ւ̃|C^
 		const Array1 *in_;
 		Array2 *out_;
@@ -2143,25 +2380,25 @@ namespace __volumerendering_specialized__
 		const volumerender::parameter *param_;
 		const volumerender::attribute_table< T > *table_;
 
+		// SXbhŋLCɕ`悷^C̔ԍ
+		volatile unsigned int *tile_index_;
+
 	public:
-		void setup_parameters( const Array1 &in, Array2 &out, const DepthMap &depth_map, const volumerender::parameter &p, const volumerender::attribute_table< T > &t, size_type thread_id, size_type thread_num )
+		void setup_parameters( const Array1 &in, Array2 &out, const DepthMap &depth_map, const volumerender::parameter &p, const volumerender::attribute_table< T > &t, volatile unsigned int &tile_index )
 		{
 			in_  = &in;
 			out_ = &out;
 			depth_map_ = &depth_map;
 			param_ = &p;
 			table_ = &t;
-			thread_id_ = thread_id;
-			thread_num_ = thread_num;
+			tile_index_ = &tile_index;
 		}
 
-		volumerendering_thread( size_type id = 0, size_type num = 1 ) : thread_id_( id ), thread_num_( num ),
-													in_( NULL ), out_( NULL ), depth_map_( NULL ), param_( NULL ), table_( NULL )
+		volumerendering_thread( ) : in_( NULL ), out_( NULL ), depth_map_( NULL ), param_( NULL ), table_( NULL ), tile_index_( NULL )
 		{
 		}
-		volumerendering_thread( const volumerendering_thread &p ) : base( p ), thread_id_( p.thread_id_ ), thread_num_( p.thread_num_ ),
-																		in_( p.in_ ), out_( p.out_ ), depth_map_( p.depth_map_ ),
-																		param_( p.param_ ), table_( p.table_ )
+		volumerendering_thread( const volumerendering_thread &p ) : base( p ), in_( p.in_ ), out_( p.out_ ), depth_map_( p.depth_map_ ),
+																		param_( p.param_ ), table_( p.table_ ), tile_index_( p.tile_index_ )
 		{
 		}
 
@@ -2169,7 +2406,7 @@ namespace __volumerendering_specialized__
 		// pŕKXbh֐
 		virtual thread_exit_type thread_function( )
 		{
-			volumerendering( *in_, *out_, *depth_map_, *param_, *table_, thread_id_, thread_num_ );
+			volumerendering( *in_, *out_, *depth_map_, *param_, *table_, *tile_index_ );
 			return( true );
 		}
 	};
@@ -2181,7 +2418,7 @@ namespace __volumerendering_controller__
 {
 	// 낢ȃ_iF̌@jgݍ킹邱Ƃ\ȃ{[_OGW
 	template < class Array1, class Array2, class DepthMap, class Renderer, class T >
-	bool volumerendering( const Array1 &in, Array2 &out, const DepthMap &depth_map, const Renderer &renderer, const volumerender::parameter &param, const volumerender::attribute_table< T > &table, typename Array1::size_type thread_id, typename Array1::size_type thread_num )
+	bool volumerendering( const Array1 &in, Array2 &out, const DepthMap &depth_map, const Renderer &renderer, const volumerender::parameter &param, const volumerender::attribute_table< T > &table, volatile unsigned int &tile_index )
 	{
 		typedef typename volumerender::parameter::vector_type vector_type;
 		typedef typename volumerender::attribute_table< T >::attribute_type attribute_type;
@@ -2255,204 +2492,218 @@ namespace __volumerendering_controller__
 
 		double max_distance = pos.length( ) + std::sqrt( static_cast< double >( w * w + h * h + d * d ) );
 
-		for( size_type j = thread_id ; j < image_height ; j += thread_num )
+		// 摜 tile_size ~ tile_size f̃^CɕCeXbh͋LJE^疢̃^C1擾ĕ`悷
+		// wi΂̃^C͂ɏI邽߁Ĉ𑽂܂ޗ̈SXbhxďI邱ƂȂ
+		const size_type tile_size = 8;
+		const size_type tile_cols = ( image_width + tile_size - 1 ) / tile_size;
+		const size_type tile_num  = tile_cols * ( ( image_height + tile_size - 1 ) / tile_size );
+
+		for( size_type tile = atomic_add( tile_index, 1 ) ; tile < tile_num ; tile = atomic_add( tile_index, 1 ) )
 		{
-			for( size_type i = 0 ; i < image_width ; i++ )
-			{
-				// eʏ̓_JWnɕϊ
-				vector_type Pos( static_cast< double >( i ) - cx, cy - static_cast< double >( j ), -focal );
+			const size_type i0 = ( tile % tile_cols ) * tile_size;
+			const size_type j0 = ( tile / tile_cols ) * tile_size;
+			const size_type i1 = i0 + tile_size < image_width  ? i0 + tile_size : image_width;
+			const size_type j1 = j0 + tile_size < image_height ? j0 + tile_size : image_height;
 
-				// CJWn烏[hWnɕϊ
-				vector_type light;
-				if( bperspective )
-				{
-					light = ( eX * Pos.x + eY * Pos.y + eZ * Pos.z ).unit( );
-				}
-				else
+			for( size_type j = j0 ; j < j1 ; j++ )
+			{
+				for( size_type i = i0 ; i < i1 ; i++ )
 				{
-					pos = param.pos - offset + eX * Pos.x + eY * Pos.y;
-					light = -eZ;
-				}
+					// eʏ̓_JWnɕϊ
+					vector_type Pos( static_cast< double >( i ) - cx, cy - static_cast< double >( j ), -focal );
 
-				pixel_type add_intensity( 0 );
-				double add_opacity = 1;
+					// CJWn烏[hWnɕϊ
+					vector_type light;
+					if( bperspective )
+					{
+						light = ( eX * Pos.x + eY * Pos.y + eZ * Pos.z ).unit( );
+					}
+					else
+					{
+						pos = param.pos - offset + eX * Pos.x + eY * Pos.y;
+						light = -eZ;
+					}
 
-				casting_start = pos;
-				casting_end = pos + light * max_distance;
-				vector_type normal;
+					pixel_type add_intensity( 0 );
+					double add_opacity = 1;
 
-				// ̂Ƃ̏Փ˔
-				if( volumerender::check_intersection( casting_start, casting_end, box[ 0 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 1 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 2 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 3 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 4 ], normal )
-					&& volumerender::check_intersection( casting_start, casting_end, box[ 5 ], normal ) )
-				{
-					// ̌邽߂ɁAJ̋𑪂
-					Pos.x = ( pos.x + offset.x ) * _1_ax;
-					Pos.y = ( pos.y + offset.y ) * _1_ay;
-					Pos.z = ( pos.z + offset.z ) * _1_az;
+					casting_start = pos;
+					casting_end = pos + light * max_distance;
+					vector_type normal;
 
-					// [hWnXCXWnɕϊ
-					// ȍ~́ASăXCXWnŌvZ
-					casting_start.x = ( casting_start.x + offset.x ) * _1_ax;
-					casting_start.y = ( casting_start.y + offset.y ) * _1_ay;
-					casting_start.z = ( casting_start.z + offset.z ) * _1_az;
-					casting_end.x   = ( casting_end.x   + offset.x ) * _1_ax;
-					casting_end.y   = ( casting_end.y   + offset.y ) * _1_ay;
-					casting_end.z   = ( casting_end.z   + offset.z ) * _1_az;
+					// ̂Ƃ̏Փ˔
+					if( volumerender::check_intersection( casting_start, casting_end, box[ 0 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 1 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 2 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 3 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 4 ], normal )
+						&& volumerender::check_intersection( casting_start, casting_end, box[ 5 ], normal ) )
+					{
+						// ̌邽߂ɁAJ̋𑪂
+						Pos.x = ( pos.x + offset.x ) * _1_ax;
+						Pos.y = ( pos.y + offset.y ) * _1_ay;
+						Pos.z = ( pos.z + offset.z ) * _1_az;
 
-					vector_type spos = casting_start;
-					vector_type ray = ( casting_end - casting_start ).unit( );
+						// [hWnXCXWnɕϊ
+						// ȍ~́ASăXCXWnŌvZ
+						casting_start.x = ( casting_start.x + offset.x ) * _1_ax;
+						casting_start.y = ( casting_start.y + offset.y ) * _1_ay;
+						casting_start.z = ( casting_start.z + offset.z ) * _1_az;
+						casting_end.x   = ( casting_end.x   + offset.x ) * _1_ax;
+						casting_end.y   = ( casting_end.y   + offset.y ) * _1_ay;
+						casting_end.z   = ( casting_end.z   + offset.z ) * _1_az;
 
-					// ̌̋ɒ߂̃p[^
-					double dlen = vector_type( ray.x * ax, ray.y * ay, ray.z * az ).length( );
+						vector_type spos = casting_start;
+						vector_type ray = ( casting_end - casting_start ).unit( );
 
-					// ̉f̉摜ł͕ɂăTvOԊuςĂ܂ɑΉ
-					double ray_sampling_step = sampling_step * masp / dlen;
+						// ̌̋ɒ߂̃p[^
+						double dlen = vector_type( ray.x * ax, ray.y * ay, ray.z * az ).length( );
 
-					vector_type ray_step = ray * ray_sampling_step;
+						// ̉f̉摜ł͕ɂăTvOԊuςĂ܂ɑΉ
+						double ray_sampling_step = sampling_step * masp / dlen;
 
-					double n = ( casting_end - casting_start ).length( );
-					double l = 0, of = ( Pos - casting_start ).length( );
+						vector_type ray_step = ray * ray_sampling_step;
 
-					while( l < n )
-					{
-						difference_type si = volumerender::to_integer( spos.x );
-						difference_type sj = volumerender::to_integer( spos.y );
-						difference_type sk = volumerender::to_integer( spos.z );
+						double n = ( casting_end - casting_start ).length( );
+						double l = 0, of = ( Pos - casting_start ).length( );
 
-						// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
-						if( renderer.check( si, sj, sk ) )
+						while( l < n )
 						{
-							if( l > 0 )
+							difference_type si = volumerender::to_integer( spos.x );
+							difference_type sj = volumerender::to_integer( spos.y );
+							difference_type sk = volumerender::to_integer( spos.z );
+
+							// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
+							if( renderer.check( si, sj, sk ) )
 							{
-								spos.x -= ray.x;
-								spos.y -= ray.y;
-								spos.z -= ray.z;
-								l -= 1.0;
+								if( l > 0 )
+								{
+									spos.x -= ray.x;
+									spos.y -= ray.y;
+									spos.z -= ray.z;
+									l -= 1.0;
+								}
+								break;
 							}
-							break;
-						}
-
-						double current_step = depth_map( si, sj, sk );
-						l += current_step;
-						spos.x += ray.x * current_step;
-						spos.y += ray.y * current_step;
-						spos.z += ray.z * current_step;
-					}
-
-					// [܂œBꍇ͉Ȃ
-					if( l >= n )
-					{
-						out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
-						continue;
-					}
 
-					while( l < n )
-					{
-						difference_type si = volumerender::to_integer( spos.x );
-						difference_type sj = volumerender::to_integer( spos.y );
-						difference_type sk = volumerender::to_integer( spos.z );
-
-						double xx = spos.x - si;
-						double yy = spos.y - sj;
-						double zz = spos.z - sk;
+							double current_step = depth_map( si, sj, sk );
+							l += current_step;
+							spos.x += ray.x * current_step;
+							spos.y += ray.y * current_step;
+							spos.z += ray.z * current_step;
+						}
 
-						attribute_type oc;
+						// [܂œBꍇ͉Ȃ
+						if( l >= n )
+						{
+							out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
+							continue;
+						}
 
-						if( renderer.render( si, sj, sk, xx, yy, zz, oc ) )
+						while( l < n )
 						{
-							double lAtten = 1.0;
-							if( lightAtten > 0.0 )
-							{
-								double len = ( l + of ) * dlen;
-								lAtten /= 1.0 + lightAtten * ( len * len );
-							}
+							difference_type si = volumerender::to_integer( spos.x );
+							difference_type sj = volumerender::to_integer( spos.y );
+							difference_type sk = volumerender::to_integer( spos.z );
 
-							double c = light.inner( renderer.normal( si, sj, sk, xx, yy, zz ) );
-							c = c < 0.0 ? -c : c;
+							double xx = spos.x - si;
+							double yy = spos.y - sj;
+							double zz = spos.z - sk;
 
-							double spec = 0.0;
-							if( bSpecular )
-							{
-								spec = 2.0 * c * c - 1.0;
+							attribute_type oc;
 
-								if( spec <= 0.0 )
+							if( renderer.render( si, sj, sk, xx, yy, zz, oc ) )
+							{
+								double lAtten = 1.0;
+								if( lightAtten > 0.0 )
 								{
-									spec = 0;
+									double len = ( l + of ) * dlen;
+									lAtten /= 1.0 + lightAtten * ( len * len );
 								}
-								else
+
+								double c = light.inner( renderer.normal( si, sj, sk, xx, yy, zz ) );
+								c = c < 0.0 ? -c : c;
+
+								double spec = 0.0;
+								if( bSpecular )
 								{
-									spec *= spec;	//  2
-									spec *= spec;	//  4
-									spec *= spec;	//  8
-									spec *= spec;	// 16
-									spec *= spec;	// 32
-									spec *= spec;	// 64
-									//spec *= spec;	// 128
-									spec *= specular * 255.0;
-								}
-							}
+									spec = 2.0 * c * c - 1.0;
 
-							c = c * diffuse_ratio + ambient_ratio;
+									if( spec <= 0.0 )
+									{
+										spec = 0;
+									}
+									else
+									{
+										spec *= spec;	//  2
+										spec *= spec;	//  4
+										spec *= spec;	//  8
+										spec *= spec;	// 16
+										spec *= spec;	// 32
+										spec *= spec;	// 64
+										//spec *= spec;	// 128
+										spec *= specular * 255.0;
+									}
+								}
 
-							double alpha = oc.alpha * sampling_step;
-							add_intensity += alpha * add_opacity * ( oc.pixel * c + spec ) * lAtten;
-							add_opacity *= ( 1.0 - alpha );
+								c = c * diffuse_ratio + ambient_ratio;
 
-							// f_Oʂɗ^elȉɂȂꍇ͏I
-							if( add_opacity < termination )
-							{
-								break;
-							}
+								double alpha = oc.alpha * sampling_step;
+								add_intensity += alpha * add_opacity * ( oc.pixel * c + spec ) * lAtten;
+								add_opacity *= ( 1.0 - alpha );
 
-							spos.x += ray_step.x;
-							spos.y += ray_step.y;
-							spos.z += ray_step.z;
-							l += ray_sampling_step;
-						}
-						else
-						{
-							// ̈ʒuɂ镨̂̏ꍇ͎̃Xebvֈڍs
-							spos += ray_step;
-							l += ray_sampling_step;
+								// f_Oʂɗ^elȉɂȂꍇ͏I
+								if( add_opacity < termination )
+								{
+									break;
+								}
 
-							double ol = l;
-							while( l < n )
+								spos.x += ray_step.x;
+								spos.y += ray_step.y;
+								spos.z += ray_step.z;
+								l += ray_sampling_step;
+							}
+							else
 							{
-								difference_type si = volumerender::to_integer( spos.x );
-								difference_type sj = volumerender::to_integer( spos.y );
-								difference_type sk = volumerender::to_integer( spos.z );
+								// ̈ʒuɂ镨̂̏ꍇ͎̃Xebvֈڍs
+								spos += ray_step;
+								l += ray_sampling_step;
 
-								// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
-								if( renderer.check( si, sj, sk ) )
+								double ol = l;
+								while( l < n )
 								{
-									if( l > ol )
+									difference_type si = volumerender::to_integer( spos.x );
+									difference_type sj = volumerender::to_integer( spos.y );
+									difference_type sk = volumerender::to_integer( spos.z );
+
+									// ̈ʒuɂ镨̂s̏ꍇ͎̃Xebvֈڍs
+									if( renderer.check( si, sj, sk ) )
 									{
-										spos.x -= ray.x;
-										spos.y -= ray.y;
-										spos.z -= ray.z;
-										l -= 1.0;
+										if( l > ol )
+										{
+											spos.x -= ray.x;
+											spos.y -= ray.y;
+											spos.z -= ray.z;
+											l -= 1.0;
+										}
+										break;
 									}
-									break;
-								}
 
-								double current_step = depth_map( si, sj, sk );
-								l += current_step;
-								spos.x += ray.x * current_step;
-								spos.y += ray.y * current_step;
-								spos.z += ray.z * current_step;
+									double current_step = depth_map( si, sj, sk );
+									l += current_step;
+									spos.x += ray.x * current_step;
+									spos.y += ray.y * current_step;
+									spos.z += ray.z * current_step;
+								}
 							}
 						}
-					}
 
-					out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( add_intensity * ( 1.0 - add_opacity ) + background * add_opacity ) );
-				}
-				else
-				{
-					out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
+						out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( add_intensity * ( 1.0 - add_opacity ) + background * add_opacity ) );
+					}
+					else
+					{
+						out( i, j ) = static_cast< out_value_type >( mist::limits_0_255( background ) );
+					}
 				}
 			}
 		}
@@ -2710,9 +2961,6 @@ namespace __volumerendering_controller__
 		typedef typename Array1::value_type value_type;
 
 	private:
-		size_t thread_id_;
-		size_t thread_num_;
-
 		// o͗p̉摜ւ̃|C^
 		const Array1 *in_;
 		Array2 *out_;
@@ -2721,8 +2969,11 @@ namespace __volumerendering_controller__
 		const volumerender::parameter *param_;
 		const volumerender::attribute_table< T > *table_;
 
+		// SXbhŋLCɕ`悷^C̔ԍ
+		volatile unsigned int *tile_index_;
+
 	public:
-		void setup_parameters( const Array1 &in, Array2 &out, const DepthMap &depth_map, const Renderer &renderer, const volumerender::parameter &p, const volumerender::attribute_table< T > &t, size_type thread_id, size_type thread_num )
+		void setup_parameters( const Array1 &in, Array2 &out, const DepthMap &depth_map, const Renderer &renderer, const volumerender::parameter &p, const volumerender::attribute_table< T > &t, volatile unsigned int &tile_index )
 		{
 			in_  = &in;
 			out_ = &out;
@@ -2730,12 +2981,10 @@ namespace __volumerendering_controller__
 			renderer_ = &renderer;
 			param_ = &p;
 			table_ = &t;
-			thread_id_ = thread_id;
-			thread_num_ = thread_num;
+			tile_index_ = &tile_index;
 		}
 
-		volumerendering_thread( size_type id = 0, size_type num = 1 ) : thread_id_( id ), thread_num_( num ),
-													in_( NULL ), out_( NULL ), depth_map_( NULL ), renderer_( NULL ), param_( NULL ), table_( NULL )
+		volumerendering_thread( ) : in_( NULL ), out_( NULL ), depth_map_( NULL ), renderer_( NULL ), param_( NULL ), table_( NULL ), tile_index_( NULL )
 		{
 		}
 
@@ -2743,7 +2992,7 @@ namespace __volumerendering_controller__
 		// pŕKXbh֐
 		virtual thread_exit_type thread_function( )
 		{
-			volumerendering( *in_, *out_, *depth_map_, *renderer_, *param_, *table_, thread_id_, thread_num_ );
+			volumerendering( *in_, *out_, *depth_map_, *renderer_, *param_, *table_, *tile_index_ );
 			return( true );
 		}
 	};
@@ -3010,10 +3259,13 @@ bool volumerendering( const Array1 &in, Array2 &out, const DepthMap &dmap, const
 
 	volumerendering_thread *thread = new volumerendering_thread[ thread_num ];
 
+	// 摜̃^CɏIXbh珇Ɋ蓖Ă
+	volatile unsigned int tile_index = 0;
+
 	size_type i;
 	for( i = 0 ; i < thread_num ; i++ )
 	{
-		thread[ i ].setup_parameters( in, out, dmap, renderer, param, table, i, thread_num );
+		thread[ i ].setup_parameters( in, out, dmap, renderer, param, table, tile_index );
 	}
 
 	// XbhsāCI܂őҋ@
@@ -3233,10 +3485,13 @@ namespace specialized
 
 		volumerendering_thread *thread = new volumerendering_thread[ thread_num ];
 
+		// 摜̃^CɏIXbh珇Ɋ蓖Ă
+		volatile unsigned int tile_index = 0;
+
 		size_type i;
 		for( i = 0 ; i < thread_num ; i++ )
 		{
-			thread[ i ].setup_parameters( in, out, dmap, param, table, i, thread_num );
+			thread[ i ].setup_parameters( in, out, dmap, param, table, tile_index );
 		}
 
 		// XbhsāCI܂őҋ@
@@ -0,0 +1,312 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include "macros.h"
+#include <mist/filter/corner.h>
+#include <mist/filter/linear.h>
+
+class TestCorner : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array2< double >			image_type;
+	typedef image_type::size_type			size_type;
+	typedef image_type::difference_type		difference_type;
+	typedef mist::vector2< int >			point_type;
+	typedef std::vector< point_type >		point_list_type;
+
+	CPPUNIT_TEST_SUITE( TestCorner );
+	CPPUNIT_TEST( HarrisOddWindow );
+	CPPUNIT_TEST( HarrisEvenWindow );
+	CPPUNIT_TEST( ShiTomasi );
+	CPPUNIT_TEST( Threads );
+	CPPUNIT_TEST_SUITE_END( );
+
+	unsigned int seed;
+
+	double random( )
+	{
+		seed = seed * 1103515245u + 12345u;
+		return( static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0 );
+	}
+
+	// `ƎOp`܂ށCG̏摜쐬
+	template < class Array >
+	void make_image( Array &img, double scale )
+	{
+		for( size_type j = 0 ; j < img.height( ) ; j++ )
+		{
+			for( size_type i = 0 ; i < img.width( ) ; i++ )
+			{
+				double x = static_cast< double >( i ), y = static_cast< double >( j );
+				double v = 0.2;
+				if( 8 <= i && i < 30 && 10 <= j && j < 25 )
+				{
+					v += 0.5;
+				}
+				if( y > 30.0 && y < 55.0 && x > 40.0 && x - 40.0 < 55.0 - y )
+				{
+					v += 0.4;
+				}
+				if( 45 <= i && i < 60 && 5 <= j && j < 15 )
+				{
+					v -= 0.15;
+				}
+				v += 0.03 * random( );
+				img( i, j ) = static_cast< typename Array::value_type >( v * scale );
+			}
+		}
+	}
+
+	struct harris_key
+	{
+		double kappa;
+		harris_key( double k ) : kappa( k ){ }
+		double operator ()( double xx, double yy, double xy ) const { return( xx * yy - xy * xy - kappa * ( xx + yy ) * ( xx + yy ) ); }
+	};
+
+	struct shi_tomasi_key
+	{
+		double operator ()( double xx, double yy, double xy ) const { return( 0.5 * ( xx + yy - std::sqrt( ( xx - yy ) * ( xx - yy ) + 4.0 * xy * xy ) ) ); }
+	};
+
+	struct candidate
+	{
+		int x, y;
+		double key;
+		candidate( int xx, int yy, double k ) : x( xx ), y( yy ), key( k ){ }
+		static bool greater( const candidate &a, const candidate &b ){ return( a.key > b.key ); }
+	};
+
+	// ȑO̎ƓClinear_filter Ōz߁C\e\̑ςvZCx̑傫 min_distance ŊԈ
+	// ̑ average_filter ŕςC̑ [x - w/2, x + w/2 - 1] ͈̔͂摜̉fŕς
+	template < class Array, class Key >
+	static void reference( const Array &in, point_list_type &out, size_type max_corners, double min_distance, size_type window_size, Key key )
+	{
+		const difference_type w = in.width( ), h = in.height( ), fw = window_size, rw = fw / 2;
+		image_type tmp, k1( 3, 3 ), k2( 3, 3 ), gx, gy;
+		mist::convert( in, tmp );
+
+		k1( 0, 0 ) = -1; k1( 1, 0 ) =  0; k1( 2, 0 ) =  1;
+		k1( 0, 1 ) = -2; k1( 1, 1 ) =  0; k1( 2, 1 ) =  2;
+		k1( 0, 2 ) = -1; k1( 1, 2 ) =  0; k1( 2, 2 ) =  1;
+
+		k2( 0, 0 ) = -1; k2( 1, 0 ) = -2; k2( 2, 0 ) = -1;
+		k2( 0, 1 ) =  0; k2( 1, 1 ) =  0; k2( 2, 1 ) =  0;
+		k2( 0, 2 ) = +1; k2( 1, 2 ) = +2; k2( 2, 2 ) = +1;
+
+		mist::linear_filter( tmp, gx, k1, 1 );
+		mist::linear_filter( tmp, gy, k2, 1 );
+
+		image_type xx( w, h ), yy( w, h ), xy( w, h ), mxx, myy, mxy;
+		for( size_type i = 0 ; i < xx.size( ) ; i++ )
+		{
+			xx[ i ] = gx[ i ] * gx[ i ];
+			yy[ i ] = gy[ i ] * gy[ i ];
+			xy[ i ] = gx[ i ] * gy[ i ];
+		}
+
+		if( window_size % 2 == 1 )
+		{
+			mist::average_filter( xx, mxx, window_size, window_size, 1 );
+			mist::average_filter( yy, myy, window_size, window_size, 1 );
+			mist::average_filter( xy, mxy, window_size, window_size, 1 );
+		}
+		else
+		{
+			mxx.resize( w, h );
+			myy.resize( w, h );
+			mxy.resize( w, h );
+			for( difference_type j = 0 ; j < h ; j++ )
+			{
+				for( difference_type i = 0 ; i < w ; i++ )
+				{
+					double n = 0.0;
+					for( difference_type y = j - rw ; y < j - rw + fw ; y++ )
+					{
+						for( difference_type x = i - rw ; x < i - rw + fw ; x++ )
+						{
+							if( 0 <= x && x < w && 0 <= y && y < h )
+							{
+								mxx( i, j ) += xx( x, y );
+								myy( i, j ) += yy( x, y );
+								mxy( i, j ) += xy( x, y );
+								n += 1.0;
+							}
+						}
+					}
+					mxx( i, j ) /= n;
+					myy( i, j ) /= n;
+					mxy( i, j ) /= n;
+				}
+			}
+		}
+
+		std::vector< candidate > list;
+		for( difference_type j = 1 ; j < h - 1 ; j++ )
+		{
+			for( difference_type i = 1 ; i < w - 1 ; i++ )
+			{
+				double k = key( mxx( i, j ), myy( i, j ), mxy( i, j ) );
+				if( k > 0 )
+				{
+					list.push_back( candidate( static_cast< int >( i ), static_cast< int >( j ), k ) );
+				}
+			}
+		}
+
+		std::stable_sort( list.begin( ), list.end( ), candidate::greater );
+
+		out.clear( );
+		for( size_type n = 0 ; n < list.size( ) && out.size( ) < max_corners ; n++ )
+		{
+			const candidate &v = list[ n ];
+			bool flag = true;
+			for( size_type l = 0 ; l < out.size( ) && flag ; l++ )
+			{
+				double dx = v.x - out[ l ].x, dy = v.y - out[ l ].y;
+				flag = dx * dx + dy * dy >= min_distance * min_distance;
+			}
+
+			if( flag )
+			{
+				out.push_back( point_type( v.x, v.y ) );
+			}
+		}
+	}
+
+	static void assert_same( const std::list< point_type > &a, const point_list_type &b )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+		std::list< point_type >::const_iterator ite = a.begin( );
+		for( size_type i = 0 ; i < b.size( ) && ite != a.end( ) ; i++, ++ite )
+		{
+			CPPUNIT_ASSERTION_EQUAL( ite->x, b[ i ].x );
+			CPPUNIT_ASSERTION_EQUAL( ite->y, b[ i ].y );
+		}
+	}
+
+public:
+	TestCorner( ) : seed( 2012 )
+	{
+	}
+
+protected:
+	void HarrisOddWindow( )
+	{
+		image_type in( 71, 63 );
+		make_image( in, 1.0 );
+
+		mist::array2< unsigned char > in8( 71, 63 );
+		make_image( in8, 255.0 );
+
+		for( size_type window_size = 3 ; window_size <= 9 ; window_size += 2 )
+		{
+			std::list< point_type > out;
+			point_list_type ref;
+
+			reference( in, ref, 20, 5.0, window_size, harris_key( 0.04 ) );
+			CPPUNIT_ASSERTION( ref.size( ) > 5 );
+			CPPUNIT_ASSERTION_EQUAL( mist::harris( in, out, 20, 5.0, 0.04, window_size, 1 ), static_cast< difference_type >( ref.size( ) ) );
+			assert_same( out, ref );
+
+			reference( in8, ref, 20, 5.0, window_size, harris_key( 0.06 ) );
+			CPPUNIT_ASSERTION( ref.size( ) > 5 );
+			mist::harris( in8, out, 20, 5.0, 0.06, window_size, 1 );
+			assert_same( out, ref );
+		}
+	}
+
+	void HarrisEvenWindow( )
+	{
+		image_type in( 71, 63 );
+		make_image( in, 1.0 );
+
+		for( size_type window_size = 2 ; window_size <= 6 ; window_size += 2 )
+		{
+			std::list< point_type > out;
+			point_list_type ref;
+
+			reference( in, ref, 20, 5.0, window_size, harris_key( 0.04 ) );
+			CPPUNIT_ASSERTION( ref.size( ) > 5 );
+			mist::harris( in, out, 20, 5.0, 0.04, window_size, 1 );
+			assert_same( out, ref );
+		}
+	}
+
+	void ShiTomasi( )
+	{
+		image_type in( 71, 63 );
+		make_image( in, 1.0 );
+
+		mist::array2< unsigned short > in16( 71, 63 );
+		make_image( in16, 40000.0 );
+
+		for( size_type window_size = 3 ; window_size <= 6 ; window_size++ )
+		{
+			std::list< point_type > out;
+			point_list_type ref;
+
+			reference( in, ref, 25, 4.0, window_size, shi_tomasi_key( ) );
+			CPPUNIT_ASSERTION( ref.size( ) > 5 );
+			CPPUNIT_ASSERTION_EQUAL( mist::shi_tomasi( in, out, 25, 4.0, window_size, 1 ), static_cast< difference_type >( ref.size( ) ) );
+			assert_same( out, ref );
+
+			reference( in16, ref, 25, 4.0, window_size, shi_tomasi_key( ) );
+			mist::shi_tomasi( in16, out, 25, 4.0, window_size, 1 );
+			assert_same( out, ref );
+		}
+	}
+
+	void Threads( )
+	{
+		// Xbhɂ炸ʂɂȂ
+		image_type in( 71, 63 );
+		make_image( in, 1.0 );
+
+		std::list< point_type > ref1, ref2, out;
+		mist::harris( in, ref1, 30, 3.0, 0.04, 5, 1 );
+		mist::shi_tomasi( in, ref2, 30, 3.0, 4, 1 );
+
+		for( size_type thread_num = 2 ; thread_num <= 8 ; thread_num *= 2 )
+		{
+			mist::harris( in, out, 30, 3.0, 0.04, 5, thread_num );
+			CPPUNIT_ASSERTION( out == ref1 );
+
+			mist::shi_tomasi( in, out, 30, 3.0, 4, thread_num );
+			CPPUNIT_ASSERTION( out == ref2 );
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestCorner );
@@ -0,0 +1,180 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include "macros.h"
+#include <mist/filter/distance.h>
+
+class TestDistance : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array3< unsigned char >	image_type;
+	typedef image_type::size_type			size_type;
+	typedef image_type::difference_type		difference_type;
+
+	CPPUNIT_TEST_SUITE( TestDistance );
+	CPPUNIT_TEST( SlabEuclidean );
+	CPPUNIT_TEST( SlabEuclideanInMemory );
+	CPPUNIT_TEST( FeatureTransform );
+	CPPUNIT_TEST( SignedDistance );
+	CPPUNIT_TEST_SUITE_END( );
+
+	image_type image;
+
+	// Xuǂݍފ֐IuWFNg
+	template < class Array >
+	struct slab_reader
+	{
+		const image_type *in;
+
+		bool operator ()( Array &slab, size_type z, size_type num ) const
+		{
+			for( size_type k = 0 ; k < num ; k++ )
+			{
+				for( size_type j = 0 ; j < slab.height( ) ; j++ )
+				{
+					for( size_type i = 0 ; i < slab.width( ) ; i++ )
+					{
+						slab( i, j, k ) = ( *in )( i, j, z + k );
+					}
+				}
+			}
+			return( true );
+		}
+	};
+
+	// Xuo֐IuWFNg
+	template < class Array >
+	struct slab_writer
+	{
+		Array *out;
+
+		bool operator ()( const Array &slab, size_type z, size_type num ) const
+		{
+			for( size_type k = 0 ; k < num ; k++ )
+			{
+				for( size_type j = 0 ; j < slab.height( ) ; j++ )
+				{
+					for( size_type i = 0 ; i < slab.width( ) ; i++ )
+					{
+						( *out )( i, j, z + k ) = slab( i, j, k );
+					}
+				}
+			}
+			return( true );
+		}
+	};
+
+	template < class Array >
+	void check_slab( size_type slab_depth )
+	{
+		mist::array3< double > ref;
+		mist::calvin::distance_transform( image, ref, 2 );
+
+		Array slab( image.width( ), image.height( ), slab_depth ), out( image.width( ), image.height( ), image.depth( ) );
+		slab_reader< Array > reader = { &image };
+		slab_writer< Array > writer = { &out };
+
+		CPPUNIT_ASSERTION( mist::euclidean::slab_distance_transform( slab, image.depth( ), reader, writer, 3 ) );
+
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( static_cast< double >( out[ i ] ), ref[ i ], 1.0e-6 );
+		}
+	}
+
+public:
+	TestDistance( ) : image( 21, 17, 23 )
+	{
+		for( size_type i = 0 ; i < image.size( ) ; i++ )
+		{
+			image[ i ] = ( i * 2654435761u ) % 97 < 90 ? 1 : 0;
+		}
+	}
+
+protected:
+	void SlabEuclidean( )
+	{
+		check_slab< mist::array3< float > >( 4 );
+		check_slab< mist::array3< unsigned int > >( 5 );
+	}
+
+	void SlabEuclideanInMemory( )
+	{
+		check_slab< mist::array3< float > >( image.depth( ) );
+	}
+
+	void FeatureTransform( )
+	{
+		mist::array3< double > ref;
+		mist::calvin::distance_transform( image, ref, 2 );
+
+		mist::array3< float > dist;
+		mist::array3< difference_type > feature;
+		mist::euclidean::feature_transform( image, dist, feature, 3 );
+
+		const difference_type w = image.width( );
+		const difference_type h = image.height( );
+
+		for( size_type i = 0 ; i < image.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( static_cast< double >( dist[ i ] ), ref[ i ], 1.0e-6 );
+
+			// _͔wifłC̓_܂ł2拗lƈv
+			difference_type n = feature[ i ];
+			CPPUNIT_ASSERTION( n >= 0 && image[ n ] == 0 );
+
+			difference_type x = static_cast< difference_type >( i ) % w - n % w;
+			difference_type y = ( static_cast< difference_type >( i ) / w ) % h - ( n / w ) % h;
+			difference_type z = static_cast< difference_type >( i ) / ( w * h ) - n / ( w * h );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( static_cast< double >( x * x + y * y + z * z ), ref[ i ], 1.0e-6 );
+		}
+	}
+
+	void SignedDistance( )
+	{
+		image_type inv( image );
+		for( size_type i = 0 ; i < inv.size( ) ; i++ )
+		{
+			inv[ i ] = image[ i ] != 0 ? 0 : 1;
+		}
+
+		mist::array3< double > inside, outside, sdt;
+		mist::calvin::distance_transform( image, inside, 2 );
+		mist::calvin::distance_transform( inv, outside, 2 );
+		mist::euclidean::signed_distance_transform( image, sdt, 3 );
+
+		for( size_type i = 0 ; i < image.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( sdt[ i ], std::sqrt( outside[ i ] ) - std::sqrt( inside[ i ] ), 1.0e-6 );
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestDistance );
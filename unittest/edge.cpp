@@ -0,0 +1,279 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include "macros.h"
+#include <mist/filter/edge.h>
+#include <mist/filter/linear.h>
+
+class TestEdge : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array2< unsigned char >	mask_type;
+	typedef mask_type::size_type			size_type;
+	typedef mask_type::difference_type		difference_type;
+
+	CPPUNIT_TEST_SUITE( TestEdge );
+	CPPUNIT_TEST( CannyUChar );
+	CPPUNIT_TEST( CannyUShort );
+	CPPUNIT_TEST( CannyDouble );
+	CPPUNIT_TEST( CannyStep );
+	CPPUNIT_TEST( CannySwap );
+	CPPUNIT_TEST_SUITE_END( );
+
+	unsigned int seed;
+
+	double random( )
+	{
+		seed = seed * 1103515245u + 12345u;
+		return( static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0 );
+	}
+
+	// ~CX`Cɂ₩ȔZWCG܂ [0, 1] ̉摜쐬
+	mist::array2< double > make_image( size_type w, size_type h )
+	{
+		mist::array2< double > img( w, h );
+		for( size_type j = 0 ; j < h ; j++ )
+		{
+			for( size_type i = 0 ; i < w ; i++ )
+			{
+				double x = static_cast< double >( i ), y = static_cast< double >( j );
+				double v = 0.2 + 0.1 * x / w;
+				if( ( x - 20.0 ) * ( x - 20.0 ) + ( y - 18.0 ) * ( y - 18.0 ) < 144.0 )
+				{
+					v += 0.5;
+				}
+				double u = 0.8 * ( x - 45.0 ) + 0.6 * ( y - 35.0 );
+				double t = -0.6 * ( x - 45.0 ) + 0.8 * ( y - 35.0 );
+				if( std::abs( u ) < 14.0 && std::abs( t ) < 8.0 )
+				{
+					v += 0.3;
+				}
+				v += 0.05 * random( );
+				img( i, j ) = v < 0.0 ? 0.0 : ( v > 1.0 ? 1.0 : v );
+			}
+		}
+		return( img );
+	}
+
+	// z linear_filter ŌvZCɑl}ƃqXeVXl`ʂɍs
+	template < class Array >
+	static void reference( const Array &in, mask_type &out, double lower, double upper, bool useL2gradient )
+	{
+		typedef mist::array2< double > image_type;
+
+		const difference_type w = in.width( ), h = in.height( );
+		image_type tmp, k1( 3, 3 ), k2( 3, 3 ), gx, gy;
+		mist::convert( in, tmp );
+
+		k1( 0, 0 ) = -1; k1( 1, 0 ) =  0; k1( 2, 0 ) =  1;
+		k1( 0, 1 ) = -2; k1( 1, 1 ) =  0; k1( 2, 1 ) =  2;
+		k1( 0, 2 ) = -1; k1( 1, 2 ) =  0; k1( 2, 2 ) =  1;
+
+		k2( 0, 0 ) = -1; k2( 1, 0 ) = -2; k2( 2, 0 ) = -1;
+		k2( 0, 1 ) =  0; k2( 1, 1 ) =  0; k2( 2, 1 ) =  0;
+		k2( 0, 2 ) = +1; k2( 1, 2 ) = +2; k2( 2, 2 ) = +1;
+
+		mist::linear_filter( tmp, gx, k1, 1 );
+		mist::linear_filter( tmp, gy, k2, 1 );
+
+		for( size_type i = 0 ; i < tmp.size( ) ; i++ )
+		{
+			tmp[ i ] = useL2gradient ? std::sqrt( gx[ i ] * gx[ i ] + gy[ i ] * gy[ i ] ) : std::abs( gx[ i ] ) + std::abs( gy[ i ] );
+		}
+
+		mask_type mask( w, h );
+		std::vector< difference_type > stack;
+		for( difference_type j = 1 ; j < h - 1 ; j++ )
+		{
+			for( difference_type i = 1 ; i < w - 1 ; i++ )
+			{
+				double dx = std::abs( gx( i, j ) ), dy = std::abs( gy( i, j ) ), val = tmp( i, j );
+				bool is_max;
+				if( val <= lower )
+				{
+					continue;
+				}
+				else if( dy < dx * 0.4142135623730950488016887242097 )
+				{
+					is_max = val > tmp( i - 1, j ) && val >= tmp( i + 1, j );
+				}
+				else if( dy > dx * 2.4142135623730950488016887242097 )
+				{
+					is_max = val > tmp( i, j - 1 ) && val >= tmp( i, j + 1 );
+				}
+				else if( gx( i, j ) * gy( i, j ) < 0 )
+				{
+					is_max = val > tmp( i - 1, j + 1 ) && val > tmp( i + 1, j - 1 );
+				}
+				else
+				{
+					is_max = val > tmp( i - 1, j - 1 ) && val > tmp( i + 1, j + 1 );
+				}
+
+				if( is_max )
+				{
+					mask( i, j ) = val > upper ? 2 : 1;
+					if( val > upper )
+					{
+						stack.push_back( i + j * w );
+					}
+				}
+			}
+		}
+
+		// GbW8ߖTŘAアGbWǂ
+		while( !stack.empty( ) )
+		{
+			difference_type i = stack.back( ) % w, j = stack.back( ) / w;
+			stack.pop_back( );
+			for( difference_type y = j - 1 ; y <= j + 1 ; y++ )
+			{
+				for( difference_type x = i - 1 ; x <= i + 1 ; x++ )
+				{
+					if( mask( x, y ) == 1 )
+					{
+						mask( x, y ) = 2;
+						stack.push_back( x + y * w );
+					}
+				}
+			}
+		}
+
+		out.resize( w, h );
+		for( size_type i = 0 ; i < out.size( ) ; i++ )
+		{
+			out[ i ] = mask[ i ] == 2 ? 255 : 0;
+		}
+	}
+
+	template < class Array >
+	void check_canny( const Array &in, double lower, double upper, bool with_weak_edge = true )
+	{
+		for( int l2 = 0 ; l2 < 2 ; l2++ )
+		{
+			mask_type ref;
+			reference( in, ref, lower, upper, l2 != 0 );
+
+			size_type count = 0;
+			for( size_type i = 0 ; i < ref.size( ) ; i++ )
+			{
+				count += ref[ i ] != 0 ? 1 : 0;
+			}
+			// qXeVXlɂĎアGbWǉĂ
+			mask_type strong;
+			reference( in, strong, upper, upper, l2 != 0 );
+			size_type strong_count = 0;
+			for( size_type i = 0 ; i < strong.size( ) ; i++ )
+			{
+				strong_count += strong[ i ] != 0 ? 1 : 0;
+			}
+			CPPUNIT_ASSERTION( 0 < strong_count && strong_count <= count );
+			CPPUNIT_ASSERTION( !with_weak_edge || strong_count < count );
+
+			const size_type threads[] = { 1, 4 };
+			for( size_type t = 0 ; t < 2 ; t++ )
+			{
+				mask_type out;
+				CPPUNIT_ASSERTION( mist::canny( in, out, lower, upper, l2 != 0, 255, 0, threads[ t ] ) );
+				CPPUNIT_ASSERTION_EQUAL( out.width( ), ref.width( ) );
+				CPPUNIT_ASSERTION_EQUAL( out.height( ), ref.height( ) );
+				for( size_type i = 0 ; i < ref.size( ) ; i++ )
+				{
+					CPPUNIT_ASSERTION_EQUAL( out[ i ], ref[ i ] );
+				}
+			}
+		}
+	}
+
+public:
+	TestEdge( ) : seed( 2012 )
+	{
+	}
+
+protected:
+	void CannyUChar( )
+	{
+		mist::array2< double > img = make_image( 67, 53 );
+		mist::array2< unsigned char > in( img.width( ), img.height( ) );
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			in[ i ] = static_cast< unsigned char >( img[ i ] * 255.0 + 0.5 );
+		}
+		check_canny( in, 100.0, 300.0 );
+	}
+
+	void CannyUShort( )
+	{
+		mist::array2< double > img = make_image( 64, 48 );
+		mist::array2< unsigned short > in( img.width( ), img.height( ) );
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			in[ i ] = static_cast< unsigned short >( img[ i ] * 60000.0 + 0.5 );
+		}
+		check_canny( in, 15000.0, 70000.0 );
+	}
+
+	void CannyDouble( )
+	{
+		mist::array2< double > in = make_image( 59, 61 );
+		check_canny( in, 0.25, 1.2 );
+	}
+
+	void CannyStep( )
+	{
+		// ĜȂił́CGbW̗̌zxȂ
+		mist::array2< unsigned char > in( 31, 27 );
+		for( size_type j = 0 ; j < in.height( ) ; j++ )
+		{
+			for( size_type i = 0 ; i < in.width( ) ; i++ )
+			{
+				in( i, j ) = 5 <= i && i < 20 && 8 <= j && j < 22 ? 200 : 40;
+			}
+		}
+		check_canny( in, 100.0, 300.0, false );
+	}
+
+	void CannySwap( )
+	{
+		// ƏւĂĂʂɂȂ
+		mist::array2< double > in = make_image( 40, 40 );
+		mask_type a, b;
+		CPPUNIT_ASSERTION( mist::canny( in, a, 0.4, 1.2, false, 255, 0, 2 ) );
+		CPPUNIT_ASSERTION( mist::canny( in, b, 1.2, 0.4, false, 255, 0, 2 ) );
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( b[ i ], a[ i ] );
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestEdge );
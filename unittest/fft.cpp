@@ -0,0 +1,750 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include <complex>
+#include "macros.h"
+#include <mist/fft/fft.h>
+#include <mist/fft/dct.h>
+#include <mist/fft/dst.h>
+
+class TestFFT : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef std::complex< double >	complex_type;
+	typedef size_t					size_type;
+
+	CPPUNIT_TEST_SUITE( TestFFT );
+	CPPUNIT_TEST( FFTPlan1 );
+	CPPUNIT_TEST( FFTPlan2 );
+	CPPUNIT_TEST( FFTPlan3 );
+	CPPUNIT_TEST( RFFT1 );
+	CPPUNIT_TEST( RFFT2 );
+	CPPUNIT_TEST( RFFT3 );
+	CPPUNIT_TEST( BatchRows );
+	CPPUNIT_TEST( BatchStride );
+	CPPUNIT_TEST( BlockDCT );
+	CPPUNIT_TEST( MixedRadix1 );
+	CPPUNIT_TEST( MixedRadix2 );
+	CPPUNIT_TEST( MixedRadix3 );
+	CPPUNIT_TEST( DCT );
+	CPPUNIT_TEST( DST );
+	CPPUNIT_TEST( DeepVolume );
+	CPPUNIT_TEST( Threads );
+	CPPUNIT_TEST_SUITE_END( );
+
+	unsigned int seed;
+
+	double random( )
+	{
+		seed = seed * 1103515245u + 12345u;
+		return( static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0 );
+	}
+
+	template < class Array >
+	void randomize( Array &a )
+	{
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			a[ i ] = complex_type( random( ), random( ) );
+		}
+	}
+
+	template < class Array >
+	void randomize_real( Array &a )
+	{
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			a[ i ] = random( );
+		}
+	}
+
+	// X( u, v, w ) =  x( i, j, k ) exp( -2i ( ui / W + vj / H + wk / D ) ) `ʂɌvZ
+	template < class Array >
+	static complex_type dft( const Array &in, size_type w, size_type h, size_type d, size_type u, size_type v, size_type t )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		complex_type sum( 0.0 );
+		for( size_type k = 0 ; k < d ; k++ )
+		{
+			for( size_type j = 0 ; j < h ; j++ )
+			{
+				for( size_type i = 0 ; i < w ; i++ )
+				{
+					double phase = static_cast< double >( ( u * i ) % w ) / w + static_cast< double >( ( v * j ) % h ) / h + static_cast< double >( ( t * k ) % d ) / d;
+					sum += in[ i + ( j + k * h ) * w ] * std::polar( 1.0, -2.0 * pi * phase );
+				}
+			}
+		}
+		return( sum );
+	}
+
+	template < class Array1, class Array2 >
+	static void assert_equal_real( const Array1 &a, const Array2 &b, double eps )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+		for( size_type i = 0 ; i < a.size( ) && i < b.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( a[ i ], b[ i ], eps );
+		}
+	}
+
+	// ̔z b ƕf̔z a ̎vC 0 ł邱ƂmF
+	template < class Array1, class Array2 >
+	static void assert_equal_complex_real( const Array1 &a, const Array2 &b, double eps )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+		for( size_type i = 0 ; i < a.size( ) && i < b.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( a[ i ].real( ), b[ i ], eps );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( a[ i ].imag( ), 0.0, eps );
+		}
+	}
+
+	template < class Array1, class Array2 >
+	static void assert_equal( const Array1 &a, const Array2 &b, double eps )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+		for( size_type i = 0 ; i < a.size( ) && i < b.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( a[ i ].real( ), b[ i ].real( ), eps );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( a[ i ].imag( ), b[ i ].imag( ), eps );
+		}
+	}
+
+public:
+	TestFFT( ) : seed( 2012 )
+	{
+	}
+
+protected:
+	void FFTPlan1( )
+	{
+		// 2̎wCi2C3C5jCfiBluestein@j̒
+		const size_type sizes[] = { 16, 12, 15, 30, 17 };
+
+		for( size_type s = 0 ; s < 5 ; s++ )
+		{
+			const size_type n = sizes[ s ];
+			mist::array< complex_type > in( n ), out, ref( n ), back;
+			randomize( in );
+
+			for( size_type u = 0 ; u < n ; u++ )
+			{
+				ref[ u ] = dft( in, n, 1, 1, u, 0, 0 );
+			}
+
+			mist::fft_plan< 1 > plan( n );
+			CPPUNIT_ASSERTION_EQUAL( plan.size( ), n );
+			CPPUNIT_ASSERTION( plan.fft( in, out ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			// vJԂgpĂʂɂȂ
+			mist::array< complex_type > data( in );
+			CPPUNIT_ASSERTION( plan.fft( data ) );
+			assert_equal( data, ref, 1.0e-10 );
+
+			CPPUNIT_ASSERTION( plan.ifft( data ) );
+			assert_equal( data, in, 1.0e-12 );
+
+			CPPUNIT_ASSERTION( plan.ifft( out, back ) );
+			assert_equal( back, in, 1.0e-12 );
+
+			// 傫̈قȂf[^͕ϊȂ
+			mist::array< complex_type > other( n + 1 );
+			CPPUNIT_ASSERTION( !plan.fft( other ) );
+		}
+	}
+
+	void FFTPlan2( )
+	{
+		const size_type sizes[][ 2 ] = { { 16, 8 }, { 12, 10 }, { 9, 7 } };
+
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			const size_type w = sizes[ s ][ 0 ], h = sizes[ s ][ 1 ];
+			mist::array2< complex_type > in( w, h ), out, ref( w, h ), back, tmp;
+			randomize( in );
+
+			for( size_type v = 0 ; v < h ; v++ )
+			{
+				for( size_type u = 0 ; u < w ; u++ )
+				{
+					ref( u, v ) = dft( in, w, h, 1, u, v, 0 );
+				}
+			}
+
+			mist::fft_plan< 2 > plan( w, h );
+			CPPUNIT_ASSERTION( plan.fft( in, out ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			// vpȂ֐ƓʂɂȂ
+			CPPUNIT_ASSERTION( mist::fft( in, tmp ) );
+			assert_equal( tmp, ref, 1.0e-10 );
+
+			mist::array2< complex_type > data( in );
+			CPPUNIT_ASSERTION( plan.fft( data ) );
+			assert_equal( data, ref, 1.0e-10 );
+
+			CPPUNIT_ASSERTION( plan.ifft( data ) );
+			assert_equal( data, in, 1.0e-12 );
+
+			CPPUNIT_ASSERTION( plan.ifft( out, back ) );
+			assert_equal( back, in, 1.0e-12 );
+		}
+	}
+
+	void FFTPlan3( )
+	{
+		const size_type sizes[][ 3 ] = { { 8, 4, 4 }, { 6, 5, 4 }, { 7, 3, 5 } };
+
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			const size_type w = sizes[ s ][ 0 ], h = sizes[ s ][ 1 ], d = sizes[ s ][ 2 ];
+			mist::array3< complex_type > in( w, h, d ), out, ref( w, h, d ), back;
+			randomize( in );
+
+			for( size_type t = 0 ; t < d ; t++ )
+			{
+				for( size_type v = 0 ; v < h ; v++ )
+				{
+					for( size_type u = 0 ; u < w ; u++ )
+					{
+						ref( u, v, t ) = dft( in, w, h, d, u, v, t );
+					}
+				}
+			}
+
+			mist::fft_plan< 3 > plan( w, h, d );
+			CPPUNIT_ASSERTION( plan.fft( in, out ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			mist::array3< complex_type > data( in );
+			CPPUNIT_ASSERTION( plan.fft( data ) );
+			assert_equal( data, ref, 1.0e-10 );
+
+			CPPUNIT_ASSERTION( plan.ifft( data ) );
+			assert_equal( data, in, 1.0e-12 );
+
+			CPPUNIT_ASSERTION( plan.ifft( out, back ) );
+			assert_equal( back, in, 1.0e-12 );
+		}
+	}
+
+	void RFFT1( )
+	{
+		// CCf̒
+		const size_type sizes[] = { 16, 12, 15, 17, 2 };
+
+		for( size_type s = 0 ; s < 5 ; s++ )
+		{
+			const size_type n = sizes[ s ];
+			mist::array1< double > in( n ), back;
+			mist::array1< complex_type > out, ref( n / 2 + 1 );
+			randomize_real( in );
+
+			// 񕉂̎ĝ݂o͂
+			for( size_type u = 0 ; u <= n / 2 ; u++ )
+			{
+				ref[ u ] = dft( in, n, 1, 1, u, 0, 0 );
+			}
+
+			CPPUNIT_ASSERTION( mist::rfft( in, out ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			CPPUNIT_ASSERTION( mist::irfft( out, back, n ) );
+			assert_equal_real( back, in, 1.0e-12 );
+
+			// vf width/2+1 łȂꍇ͕ϊȂ
+			CPPUNIT_ASSERTION( !mist::irfft( out, back, 2 * n + 2 ) );
+		}
+	}
+
+	void RFFT2( )
+	{
+		const size_type sizes[][ 2 ] = { { 16, 8 }, { 12, 10 }, { 9, 7 } };
+
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			const size_type w = sizes[ s ][ 0 ], h = sizes[ s ][ 1 ];
+			mist::array2< double > in( w, h ), back;
+			mist::array2< complex_type > out, ref( w / 2 + 1, h ), tmp;
+			randomize_real( in );
+
+			for( size_type v = 0 ; v < h ; v++ )
+			{
+				for( size_type u = 0 ; u <= w / 2 ; u++ )
+				{
+					ref( u, v ) = dft( in, w, h, 1, u, v, 0 );
+				}
+			}
+
+			CPPUNIT_ASSERTION( mist::rfft( in, out, 1 ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			// Xbhɂ炸ʂɂȂ
+			CPPUNIT_ASSERTION( mist::rfft( in, tmp, 3 ) );
+			assert_equal( tmp, out, 0.0 );
+
+			CPPUNIT_ASSERTION( mist::irfft( out, back, w ) );
+			assert_equal_real( back, in, 1.0e-12 );
+		}
+	}
+
+	void RFFT3( )
+	{
+		const size_type sizes[][ 3 ] = { { 8, 4, 4 }, { 6, 5, 3 }, { 7, 3, 5 } };
+
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			const size_type w = sizes[ s ][ 0 ], h = sizes[ s ][ 1 ], d = sizes[ s ][ 2 ];
+			mist::array3< double > in( w, h, d ), back;
+			mist::array3< complex_type > out, ref( w / 2 + 1, h, d );
+			randomize_real( in );
+
+			for( size_type t = 0 ; t < d ; t++ )
+			{
+				for( size_type v = 0 ; v < h ; v++ )
+				{
+					for( size_type u = 0 ; u <= w / 2 ; u++ )
+					{
+						ref( u, v, t ) = dft( in, w, h, d, u, v, t );
+					}
+				}
+			}
+
+			CPPUNIT_ASSERTION( mist::rfft( in, out ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			CPPUNIT_ASSERTION( mist::irfft( out, back, w ) );
+			assert_equal_real( back, in, 1.0e-12 );
+		}
+	}
+
+	void BatchRows( )
+	{
+		const size_type sizes[] = { 16, 12, 17 };
+
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			const size_type n = sizes[ s ], count = 9;
+			mist::array2< complex_type > in( n, count ), ref( n, count );
+			randomize( in );
+
+			for( size_type j = 0 ; j < count ; j++ )
+			{
+				for( size_type u = 0 ; u < n ; u++ )
+				{
+					ref( u, j ) = dft( &in( 0, j ), n, 1, 1, u, 0, 0 );
+				}
+			}
+
+			// Xbhɂ炸es1FFTʂƈv
+			for( size_type thread_num = 1 ; thread_num <= 3 ; thread_num += 2 )
+			{
+				mist::fft_batch< double > batch( n, thread_num );
+				CPPUNIT_ASSERTION_EQUAL( batch.size( ), n );
+
+				mist::array2< complex_type > data( in );
+				CPPUNIT_ASSERTION( batch.fft( data ) );
+				assert_equal( data, ref, 1.0e-10 );
+
+				CPPUNIT_ASSERTION( batch.ifft( data ) );
+				assert_equal( data, in, 1.0e-12 );
+
+				mist::array2< complex_type > other( n + 1, count );
+				CPPUNIT_ASSERTION( !batch.fft( other ) );
+			}
+
+			// PxŕێꍇCϊ͔{xŌvZ
+			mist::array2< std::complex< float > > data( n, count );
+			for( size_type i = 0 ; i < data.size( ) ; i++ )
+			{
+				data[ i ] = std::complex< float >( static_cast< float >( in[ i ].real( ) ), static_cast< float >( in[ i ].imag( ) ) );
+			}
+
+			mist::fft_batch< float > batch( n );
+			CPPUNIT_ASSERTION( batch.fft( data ) );
+			assert_equal( data, ref, 1.0e-4 * n );
+		}
+	}
+
+	void BatchStride( )
+	{
+		// 3`l݂ɕԃf[^istride = 3Cdistance = 1j̊e`lϊ
+		const size_type n = 15, ch = 3;
+		mist::array< complex_type > in( n * ch ), data;
+		randomize( in );
+
+		mist::fft_batch< double > batch( n, 2 );
+		data = in;
+		CPPUNIT_ASSERTION( batch.fft( &data[ 0 ], ch, ch, 1 ) );
+
+		for( size_type c = 0 ; c < ch ; c++ )
+		{
+			mist::array< complex_type > x( n );
+			for( size_type i = 0 ; i < n ; i++ )
+			{
+				x[ i ] = in[ i * ch + c ];
+			}
+
+			for( size_type u = 0 ; u < n ; u++ )
+			{
+				complex_type ref = dft( x, n, 1, 1, u, 0, 0 );
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( data[ u * ch + c ].real( ), ref.real( ), 1.0e-10 );
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( data[ u * ch + c ].imag( ), ref.imag( ), 1.0e-10 );
+			}
+		}
+
+		CPPUNIT_ASSERTION( batch.ifft( &data[ 0 ], ch, ch, 1 ) );
+		assert_equal( data, in, 1.0e-12 );
+	}
+
+	void BlockDCT( )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		const size_type w = 48, h = 32;
+
+		mist::array2< double > in( w, h ), out, back, tmp;
+		randomize_real( in );
+
+		for( size_type n = 4 ; n <= 16 ; n *= 2 )
+		{
+			CPPUNIT_ASSERTION( mist::block_dct( in, out, n, 1 ) );
+			CPPUNIT_ASSERTION_EQUAL( out.width( ), w );
+			CPPUNIT_ASSERTION_EQUAL( out.height( ), h );
+
+			// eubN𐳋KDCT-II̒`ʂɌvZʂƈv
+			for( size_type by = 0 ; by < h ; by += n )
+			{
+				for( size_type bx = 0 ; bx < w ; bx += n )
+				{
+					for( size_type v = 0 ; v < n ; v++ )
+					{
+						for( size_type u = 0 ; u < n ; u++ )
+						{
+							double sum = 0.0;
+							for( size_type y = 0 ; y < n ; y++ )
+							{
+								for( size_type x = 0 ; x < n ; x++ )
+								{
+									sum += in( bx + x, by + y ) * std::cos( ( 2 * x + 1 ) * u * pi / ( 2 * n ) ) * std::cos( ( 2 * y + 1 ) * v * pi / ( 2 * n ) );
+								}
+							}
+							double au = std::sqrt( ( u == 0 ? 1.0 : 2.0 ) / n );
+							double av = std::sqrt( ( v == 0 ? 1.0 : 2.0 ) / n );
+							CPPUNIT_ASSERTION_DOUBLES_EQUAL( out( bx + u, by + v ), au * av * sum, 1.0e-12 );
+						}
+					}
+				}
+			}
+
+			// Xbhɂ炸ʂɂȂ
+			CPPUNIT_ASSERTION( mist::block_dct( in, tmp, n, 3 ) );
+			assert_equal_real( tmp, out, 0.0 );
+
+			CPPUNIT_ASSERTION( mist::block_idct( out, back, n ) );
+			assert_equal_real( back, in, 1.0e-12 );
+		}
+
+		// 摜̑傫ubN̔{łȂꍇCΉĂȂubN̑傫͕ϊȂ
+		mist::array2< double > odd( 20, 16 );
+		CPPUNIT_ASSERTION( !mist::block_dct( odd, out, 8 ) );
+		CPPUNIT_ASSERTION( !mist::block_dct( in, out, 6 ) );
+	}
+
+	void MixedRadix1( )
+	{
+		// fiBluestein@j 2C3C5C7 ̐ς̒
+		const size_type sizes[] = { 7, 13, 101, 1009, 210, 360, 1000 };
+
+		for( size_type s = 0 ; s < 7 ; s++ )
+		{
+			const size_type n = sizes[ s ];
+			mist::array1< complex_type > in( n ), out, back, ref( n );
+			randomize( in );
+
+			for( size_type u = 0 ; u < n ; u++ )
+			{
+				ref[ u ] = dft( in, n, 1, 1, u, 0, 0 );
+			}
+
+			CPPUNIT_ASSERTION( mist::fft( in, out ) );
+			assert_equal( out, ref, 1.0e-9 );
+
+			CPPUNIT_ASSERTION( mist::ifft( out, back ) );
+			assert_equal( back, in, 1.0e-12 );
+		}
+	}
+
+	void MixedRadix2( )
+	{
+		const size_type sizes[][ 2 ] = { { 12, 10 }, { 7, 11 }, { 30, 9 } };
+
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			const size_type w = sizes[ s ][ 0 ], h = sizes[ s ][ 1 ];
+			mist::array2< complex_type > in( w, h ), out, back, ref( w, h );
+			randomize( in );
+
+			for( size_type v = 0 ; v < h ; v++ )
+			{
+				for( size_type u = 0 ; u < w ; u++ )
+				{
+					ref( u, v ) = dft( in, w, h, 1, u, v, 0 );
+				}
+			}
+
+			CPPUNIT_ASSERTION( mist::fft( in, out ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			CPPUNIT_ASSERTION( mist::ifft( out, back ) );
+			assert_equal( back, in, 1.0e-12 );
+		}
+	}
+
+	void MixedRadix3( )
+	{
+		const size_type sizes[][ 3 ] = { { 6, 5, 7 }, { 12, 10, 3 }, { 5, 8, 9 } };
+
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			const size_type w = sizes[ s ][ 0 ], h = sizes[ s ][ 1 ], d = sizes[ s ][ 2 ];
+			mist::array3< complex_type > in( w, h, d ), out, back, ref( w, h, d );
+			randomize( in );
+
+			for( size_type t = 0 ; t < d ; t++ )
+			{
+				for( size_type v = 0 ; v < h ; v++ )
+				{
+					for( size_type u = 0 ; u < w ; u++ )
+					{
+						ref( u, v, t ) = dft( in, w, h, d, u, v, t );
+					}
+				}
+			}
+
+			CPPUNIT_ASSERTION( mist::fft( in, out ) );
+			assert_equal( out, ref, 1.0e-10 );
+
+			CPPUNIT_ASSERTION( mist::ifft( out, back ) );
+			assert_equal( back, in, 1.0e-12 );
+		}
+	}
+
+	void DCT( )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		const size_type sizes[] = { 16, 12, 15, 17, 360 };
+
+		for( size_type s = 0 ; s < 5 ; s++ )
+		{
+			// C( k ) =  x( j ) cos(  ( j + 1/2 ) k / N )
+			const size_type n = sizes[ s ];
+			mist::array1< double > in( n );
+			mist::array1< complex_type > out, back;
+			randomize_real( in );
+
+			CPPUNIT_ASSERTION( mist::dct( in, out ) );
+			for( size_type k = 0 ; k < n ; k++ )
+			{
+				double sum = 0.0;
+				for( size_type j = 0 ; j < n ; j++ )
+				{
+					sum += in[ j ] * std::cos( pi * ( j + 0.5 ) * k / n );
+				}
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ k ].real( ), sum, 1.0e-10 );
+			}
+
+			CPPUNIT_ASSERTION( mist::idct( out, back ) );
+			assert_equal_complex_real( back, in, 1.0e-12 );
+		}
+
+		mist::array2< double > in2( 12, 10 );
+		mist::array2< complex_type > out2, back2;
+		randomize_real( in2 );
+		CPPUNIT_ASSERTION( mist::dct( in2, out2 ) );
+		CPPUNIT_ASSERTION( mist::idct( out2, back2 ) );
+		assert_equal_complex_real( back2, in2, 1.0e-12 );
+
+		mist::array3< double > in3( 6, 5, 7 );
+		mist::array3< complex_type > out3, back3;
+		randomize_real( in3 );
+		CPPUNIT_ASSERTION( mist::dct( in3, out3 ) );
+		CPPUNIT_ASSERTION( mist::idct( out3, back3 ) );
+		assert_equal_complex_real( back3, in3, 1.0e-12 );
+	}
+
+	void DST( )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		const size_type sizes[] = { 16, 12, 15, 17, 360 };
+
+		for( size_type s = 0 ; s < 5 ; s++ )
+		{
+			// S( k ) =  x( j ) sin(  ( j + 1/2 ) k / N )i1̏o͂̐擪 S( N - 1 ) ƂȂj
+			const size_type n = sizes[ s ];
+			mist::array1< double > in( n );
+			mist::array1< complex_type > out;
+			randomize_real( in );
+
+			CPPUNIT_ASSERTION( mist::dst( in, out ) );
+			for( size_type k = 0 ; k < n ; k++ )
+			{
+				double sum = 0.0;
+				for( size_type j = 0 ; j < n ; j++ )
+				{
+					sum += in[ j ] * std::sin( pi * ( j + 0.5 ) * ( k == 0 ? n - 1 : k ) / n );
+				}
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ k ].real( ), sum, 1.0e-10 );
+			}
+		}
+
+		const size_type sizes2[][ 2 ] = { { 16, 8 }, { 12, 10 }, { 7, 9 } };
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			mist::array2< double > in( sizes2[ s ][ 0 ], sizes2[ s ][ 1 ] );
+			mist::array2< complex_type > out, back;
+			randomize_real( in );
+			CPPUNIT_ASSERTION( mist::dst( in, out ) );
+			CPPUNIT_ASSERTION( mist::idst( out, back ) );
+			assert_equal_complex_real( back, in, 1.0e-12 );
+		}
+
+		const size_type sizes3[][ 3 ] = { { 8, 4, 4 }, { 6, 5, 7 }, { 9, 3, 10 } };
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			mist::array3< double > in( sizes3[ s ][ 0 ], sizes3[ s ][ 1 ], sizes3[ s ][ 2 ] );
+			mist::array3< complex_type > out, back;
+			randomize_real( in );
+			CPPUNIT_ASSERTION( mist::dst( in, out ) );
+			CPPUNIT_ASSERTION( mist::idst( out, back ) );
+			assert_equal_complex_real( back, in, 1.0e-12 );
+		}
+	}
+
+	void DeepVolume( )
+	{
+		// sƍ傫ꍇƗ̈悪sȂ
+		const size_type w = 16, h = 8, d = 32;
+		mist::array3< complex_type > in( w, h, d ), out, back;
+		randomize( in );
+
+		CPPUNIT_ASSERTION( mist::fft( in, out, 1 ) );
+		for( size_type t = 0 ; t < d ; t += 3 )
+		{
+			for( size_type v = 0 ; v < h ; v += 3 )
+			{
+				for( size_type u = 0 ; u < w ; u += 5 )
+				{
+					complex_type ref = dft( in, w, h, d, u, v, t );
+					CPPUNIT_ASSERTION_DOUBLES_EQUAL( out( u, v, t ).real( ), ref.real( ), 1.0e-10 );
+					CPPUNIT_ASSERTION_DOUBLES_EQUAL( out( u, v, t ).imag( ), ref.imag( ), 1.0e-10 );
+				}
+			}
+		}
+
+		CPPUNIT_ASSERTION( mist::ifft( out, back, 1 ) );
+		assert_equal( back, in, 1.0e-12 );
+
+		mist::array3< double > din( w, h, d );
+		mist::array3< complex_type > dout, dback;
+		randomize_real( din );
+		CPPUNIT_ASSERTION( mist::dct( din, dout, 1 ) );
+		CPPUNIT_ASSERTION( mist::idct( dout, dback, 1 ) );
+		assert_equal_complex_real( dback, din, 1.0e-12 );
+
+		CPPUNIT_ASSERTION( mist::dst( din, dout, 1 ) );
+		CPPUNIT_ASSERTION( mist::idst( dout, dback, 1 ) );
+		assert_equal_complex_real( dback, din, 1.0e-12 );
+	}
+
+	void Threads( )
+	{
+		// Xbhɂ炸ʂɂȂi2̎wƁCłȂ傫j
+		const size_type threads[] = { 2, 3, 8 };
+
+		const size_type sizes2[][ 2 ] = { { 64, 32 }, { 16, 128 }, { 12, 10 } };
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			mist::array2< complex_type > in( sizes2[ s ][ 0 ], sizes2[ s ][ 1 ] ), f1, b1, f, b;
+			mist::array2< double > rin( in.width( ), in.height( ) );
+			mist::array2< complex_type > c1, s1, c, t;
+			randomize( in );
+			randomize_real( rin );
+
+			CPPUNIT_ASSERTION( mist::fft( in, f1, 1 ) );
+			CPPUNIT_ASSERTION( mist::ifft( f1, b1, 1 ) );
+			CPPUNIT_ASSERTION( mist::dct( rin, c1, 1 ) );
+			CPPUNIT_ASSERTION( mist::dst( rin, s1, 1 ) );
+
+			for( size_type n = 0 ; n < 3 ; n++ )
+			{
+				CPPUNIT_ASSERTION( mist::fft( in, f, threads[ n ] ) );
+				assert_equal( f, f1, 0.0 );
+				CPPUNIT_ASSERTION( mist::ifft( f1, b, threads[ n ] ) );
+				assert_equal( b, b1, 0.0 );
+				CPPUNIT_ASSERTION( mist::dct( rin, c, threads[ n ] ) );
+				assert_equal( c, c1, 0.0 );
+				CPPUNIT_ASSERTION( mist::dst( rin, t, threads[ n ] ) );
+				assert_equal( t, s1, 0.0 );
+			}
+		}
+
+		const size_type sizes3[][ 3 ] = { { 16, 8, 32 }, { 8, 16, 4 }, { 6, 5, 7 } };
+		for( size_type s = 0 ; s < 3 ; s++ )
+		{
+			mist::array3< complex_type > in( sizes3[ s ][ 0 ], sizes3[ s ][ 1 ], sizes3[ s ][ 2 ] ), f1, b1, f, b;
+			mist::array3< double > rin( in.width( ), in.height( ), in.depth( ) );
+			mist::array3< complex_type > c1, s1, c, t;
+			randomize( in );
+			randomize_real( rin );
+
+			CPPUNIT_ASSERTION( mist::fft( in, f1, 1 ) );
+			CPPUNIT_ASSERTION( mist::ifft( f1, b1, 1 ) );
+			CPPUNIT_ASSERTION( mist::dct( rin, c1, 1 ) );
+			CPPUNIT_ASSERTION( mist::dst( rin, s1, 1 ) );
+
+			for( size_type n = 0 ; n < 3 ; n++ )
+			{
+				CPPUNIT_ASSERTION( mist::fft( in, f, threads[ n ] ) );
+				assert_equal( f, f1, 0.0 );
+				CPPUNIT_ASSERTION( mist::ifft( f1, b, threads[ n ] ) );
+				assert_equal( b, b1, 0.0 );
+				CPPUNIT_ASSERTION( mist::dct( rin, c, threads[ n ] ) );
+				assert_equal( c, c1, 0.0 );
+				CPPUNIT_ASSERTION( mist::dst( rin, t, threads[ n ] ) );
+				assert_equal( t, s1, 0.0 );
+			}
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestFFT );
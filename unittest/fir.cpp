@@ -0,0 +1,187 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/filter/fir.h>
+
+class TestFIR : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array< double >	signal_type;
+	typedef signal_type::size_type	size_type;
+
+	CPPUNIT_TEST_SUITE( TestFIR );
+	CPPUNIT_TEST( Direct );
+	CPPUNIT_TEST( OverlapSave );
+	CPPUNIT_TEST( Streaming );
+	CPPUNIT_TEST( InPlace );
+	CPPUNIT_TEST_SUITE_END( );
+
+	signal_type signal;
+
+	static void make_coefficients( signal_type &coef, size_type taps )
+	{
+		coef.resize( taps );
+		for( size_type k = 0 ; k < taps ; k++ )
+		{
+			coef[ k ] = std::sin( 0.37 * k + 0.1 ) / ( 1.0 + k );
+		}
+	}
+
+	// y[ n ] =  h[ k ] x[ n - k ] `ʂɌvZin < 0 ̓͂0Ƃj
+	static void convolve( const signal_type &in, signal_type &out, const signal_type &coef )
+	{
+		out.resize( in.size( ) );
+		for( size_type n = 0 ; n < in.size( ) ; n++ )
+		{
+			double v = 0.0;
+			for( size_type k = 0 ; k < coef.size( ) && k <= n ; k++ )
+			{
+				v += coef[ k ] * in[ n - k ];
+			}
+			out[ n ] = v;
+		}
+	}
+
+public:
+	TestFIR( ) : signal( 3000 )
+	{
+		unsigned int seed = 12345;
+		for( size_type i = 0 ; i < signal.size( ) ; i++ )
+		{
+			seed = seed * 1103515245u + 12345u;
+			signal[ i ] = static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0;
+		}
+	}
+
+protected:
+	void Direct( )
+	{
+		signal_type coef, ref, out;
+		make_coefficients( coef, 17 );
+		convolve( signal, ref, coef );
+
+		mist::fir_filter f( coef );
+		CPPUNIT_ASSERTION( !f.use_fft( ) );
+		f.filter( signal, out );
+
+		CPPUNIT_ASSERTION_EQUAL( out.size( ), ref.size( ) );
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ i ], ref[ i ], 1.0e-12 );
+		}
+
+		// FFTgȂw̏ꍇ̓^bvĂڌvZ
+		make_coefficients( coef, 100 );
+		convolve( signal, ref, coef );
+
+		mist::fir_filter g( coef, false );
+		CPPUNIT_ASSERTION( !g.use_fft( ) );
+		g.filter( signal, out );
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ i ], ref[ i ], 1.0e-12 );
+		}
+	}
+
+	void OverlapSave( )
+	{
+		const size_type taps[] = { 33, 100, 257 };
+
+		for( size_type t = 0 ; t < 3 ; t++ )
+		{
+			signal_type coef, ref, out;
+			make_coefficients( coef, taps[ t ] );
+			convolve( signal, ref, coef );
+
+			mist::fir_filter f( coef );
+			CPPUNIT_ASSERTION( f.use_fft( ) );
+			f.filter( signal, out );
+
+			CPPUNIT_ASSERTION_EQUAL( out.size( ), ref.size( ) );
+			for( size_type i = 0 ; i < ref.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ i ], ref[ i ], 1.0e-10 );
+			}
+		}
+	}
+
+	void Streaming( )
+	{
+		// sȒi0܂ށj̃ubNɕė^ĂCxɏꍇƓʂɂȂ
+		const size_type chunks[] = { 1, 7, 0, 300, 2, 1024, 64, 5, 999 };
+		const size_type taps[] = { 17, 100 };
+
+		for( size_type t = 0 ; t < 2 ; t++ )
+		{
+			signal_type coef, ref, block, out;
+			make_coefficients( coef, taps[ t ] );
+
+			mist::fir_filter f( coef );
+			f.filter( signal, ref );
+			f.reset( );
+
+			size_type pos = 0;
+			for( size_type c = 0 ; pos < signal.size( ) ; c = ( c + 1 ) % 9 )
+			{
+				size_type num = chunks[ c ] < signal.size( ) - pos ? chunks[ c ] : signal.size( ) - pos;
+				signal_type in( num );
+				for( size_type i = 0 ; i < num ; i++ )
+				{
+					in[ i ] = signal[ pos + i ];
+				}
+
+				f.filter( in, block );
+				CPPUNIT_ASSERTION_EQUAL( block.size( ), num );
+				for( size_type i = 0 ; i < num ; i++ )
+				{
+					CPPUNIT_ASSERTION_DOUBLES_EQUAL( block[ i ], ref[ pos + i ], 1.0e-10 );
+				}
+				pos += num;
+			}
+		}
+	}
+
+	void InPlace( )
+	{
+		signal_type coef, ref, out( signal );
+		make_coefficients( coef, 40 );
+
+		mist::fir( signal, ref, coef );
+		mist::fir( out, out, coef );
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ i ], ref[ i ], 1.0e-12 );
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestFIR );
@@ -0,0 +1,376 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/geometry.h>
+
+class TestGeometry : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array3< double >					volume_type;
+	typedef mist::array3< mist::vector3< double > >	field_type;
+	typedef mist::matrix< double >					matrix_type;
+	typedef volume_type::size_type					size_type;
+
+	CPPUNIT_TEST_SUITE( TestGeometry );
+	CPPUNIT_TEST( Identity );
+	CPPUNIT_TEST( Rotation );
+	CPPUNIT_TEST( Affine );
+	CPPUNIT_TEST( Warp );
+	CPPUNIT_TEST( Invalid );
+	CPPUNIT_TEST_SUITE_END( );
+
+	enum
+	{
+		NEAREST,
+		LINEAR,
+		CUBIC
+	};
+
+	unsigned int seed;
+	volume_type in;
+
+	double random( )
+	{
+		seed = seed * 1103515245u + 12345u;
+		return( static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0 );
+	}
+
+	static double sinc1( double t ){ return( 1.0 + ( t - 2.0 ) * t * t ); }
+	static double sinc2( double t ){ return( 4.0 + ( -8.0 + ( 5.0 - t ) * t ) * t ); }
+
+	static size_type clamp( double v, size_type n )
+	{
+		return( v < 0.0 ? 0 : ( v > n - 1.0 ? n - 1 : static_cast< size_type >( v ) ) );
+	}
+
+	// ͉摜̈ʒu ( x, y, z ) ̒lCԕ@̒`ʂ1fvZ
+	static double sample( const volume_type &in, double x, double y, double z, int method )
+	{
+		if( method == NEAREST )
+		{
+			return( in( clamp( std::floor( x + 0.5 ), in.width( ) ), clamp( std::floor( y + 0.5 ), in.height( ) ), clamp( std::floor( z + 0.5 ), in.depth( ) ) ) );
+		}
+
+		double fx = std::floor( x ), fy = std::floor( y ), fz = std::floor( z );
+		double tx = x - fx, ty = y - fy, tz = z - fz;
+		double wx[ 4 ], wy[ 4 ], wz[ 4 ];
+		int o;
+		if( method == LINEAR )
+		{
+			wx[ 0 ] = 1.0 - tx; wx[ 1 ] = tx;
+			wy[ 0 ] = 1.0 - ty; wy[ 1 ] = ty;
+			wz[ 0 ] = 1.0 - tz; wz[ 1 ] = tz;
+			o = 2;
+		}
+		else
+		{
+			wx[ 0 ] = sinc2( 1.0 + tx ); wx[ 1 ] = sinc1( tx ); wx[ 2 ] = sinc1( 1.0 - tx ); wx[ 3 ] = sinc2( 2.0 - tx );
+			wy[ 0 ] = sinc2( 1.0 + ty ); wy[ 1 ] = sinc1( ty ); wy[ 2 ] = sinc1( 1.0 - ty ); wy[ 3 ] = sinc2( 2.0 - ty );
+			wz[ 0 ] = sinc2( 1.0 + tz ); wz[ 1 ] = sinc1( tz ); wz[ 2 ] = sinc1( 1.0 - tz ); wz[ 3 ] = sinc2( 2.0 - tz );
+			fx -= 1.0;
+			fy -= 1.0;
+			fz -= 1.0;
+			o = 4;
+		}
+
+		double v = 0.0;
+		for( int k = 0 ; k < o ; k++ )
+		{
+			for( int j = 0 ; j < o ; j++ )
+			{
+				for( int i = 0 ; i < o ; i++ )
+				{
+					v += in( clamp( fx + i, in.width( ) ), clamp( fy + j, in.height( ) ), clamp( fz + k, in.depth( ) ) ) * wx[ i ] * wy[ j ] * wz[ k ];
+				}
+			}
+		}
+		return( v );
+	}
+
+	// ͉摜͈͓̔ǂۂߌ덷ŕς肤ʒu͔rȂ
+	static bool is_ambiguous( double v, size_type n )
+	{
+		const double eps = 1.0e-6;
+		return( std::abs( v ) < eps || std::abs( v - ( n - 1.0 ) ) < eps );
+	}
+
+	static bool is_inside( double v, size_type n )
+	{
+		return( 0.0 <= v && v <= n - 1.0 );
+	}
+
+	// o͉摜̊efɂāC͉摜̈ʒu src( x, y, z ) ̒lƔri͈͊Ỏf͏l -10 ̂܂܁j
+	template < class Source >
+	static void check( const volume_type &in, const volume_type &out, const Source &src, int method, double eps )
+	{
+		size_type count = 0;
+		for( size_type k = 0 ; k < out.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < out.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < out.width( ) ; i++ )
+				{
+					double p[ 3 ];
+					src( i, j, k, p );
+					if( is_ambiguous( p[ 0 ], in.width( ) ) || is_ambiguous( p[ 1 ], in.height( ) ) || is_ambiguous( p[ 2 ], in.depth( ) ) )
+					{
+						continue;
+					}
+					else if( is_inside( p[ 0 ], in.width( ) ) && is_inside( p[ 1 ], in.height( ) ) && is_inside( p[ 2 ], in.depth( ) ) )
+					{
+						CPPUNIT_ASSERTION_DOUBLES_EQUAL( out( i, j, k ), sample( in, p[ 0 ], p[ 1 ], p[ 2 ], method ), eps );
+						count++;
+					}
+					else
+					{
+						CPPUNIT_ASSERTION_DOUBLES_EQUAL( out( i, j, k ), -10.0, 0.0 );
+					}
+				}
+			}
+		}
+
+		// ͉摜͈͓̔ɑΉf\ɂ
+		CPPUNIT_ASSERTION( count > out.size( ) / 10 );
+	}
+
+	// o͉摜̉f͉摜̈ʒu߂tϊiKEXEW_@ŋ߂j
+	struct inverse_affine
+	{
+		double m[ 3 ][ 4 ];
+
+		inverse_affine( const matrix_type &mat )
+		{
+			double a[ 3 ][ 6 ];
+			for( int r = 0 ; r < 3 ; r++ )
+			{
+				for( int c = 0 ; c < 3 ; c++ )
+				{
+					a[ r ][ c ] = mat( r, c );
+					a[ r ][ c + 3 ] = r == c ? 1.0 : 0.0;
+				}
+			}
+
+			for( int c = 0 ; c < 3 ; c++ )
+			{
+				int pivot = c;
+				for( int r = c + 1 ; r < 3 ; r++ )
+				{
+					if( std::abs( a[ r ][ c ] ) > std::abs( a[ pivot ][ c ] ) )
+					{
+						pivot = r;
+					}
+				}
+				for( int n = 0 ; n < 6 ; n++ )
+				{
+					std::swap( a[ c ][ n ], a[ pivot ][ n ] );
+				}
+
+				double d = a[ c ][ c ];
+				for( int n = 0 ; n < 6 ; n++ )
+				{
+					a[ c ][ n ] /= d;
+				}
+				for( int r = 0 ; r < 3 ; r++ )
+				{
+					if( r != c )
+					{
+						double f = a[ r ][ c ];
+						for( int n = 0 ; n < 6 ; n++ )
+						{
+							a[ r ][ n ] -= f * a[ c ][ n ];
+						}
+					}
+				}
+			}
+
+			for( int r = 0 ; r < 3 ; r++ )
+			{
+				m[ r ][ 3 ] = 0.0;
+				for( int c = 0 ; c < 3 ; c++ )
+				{
+					m[ r ][ c ] = a[ r ][ c + 3 ];
+					m[ r ][ 3 ] -= a[ r ][ c + 3 ] * mat( c, 3 );
+				}
+			}
+		}
+
+		void operator ()( size_type i, size_type j, size_type k, double p[ 3 ] ) const
+		{
+			for( int r = 0 ; r < 3 ; r++ )
+			{
+				p[ r ] = m[ r ][ 0 ] * i + m[ r ][ 1 ] * j + m[ r ][ 2 ] * k + m[ r ][ 3 ];
+			}
+		}
+	};
+
+	struct displacement
+	{
+		const field_type &field;
+
+		displacement( const field_type &f ) : field( f )
+		{
+		}
+
+		void operator ()( size_type i, size_type j, size_type k, double p[ 3 ] ) const
+		{
+			p[ 0 ] = i + field( i, j, k ).x;
+			p[ 1 ] = j + field( i, j, k ).y;
+			p[ 2 ] = k + field( i, j, k ).z;
+		}
+	};
+
+	static void assert_same( const volume_type &a, const volume_type &b )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( a[ i ], b[ i ], 0.0 );
+		}
+	}
+
+	void check_transform( const matrix_type &mat, size_type w, size_type h, size_type d )
+	{
+		inverse_affine src( mat );
+		volume_type out( w, h, d );
+
+		out.fill( -10.0 );
+		CPPUNIT_ASSERTION( mist::nearest::transform( in, out, mat ) );
+		check( in, out, src, NEAREST, 0.0 );
+
+		out.fill( -10.0 );
+		CPPUNIT_ASSERTION( mist::linear::transform( in, out, mat ) );
+		check( in, out, src, LINEAR, 1.0e-10 );
+
+		out.fill( -10.0 );
+		CPPUNIT_ASSERTION( mist::cubic::transform( in, out, mat ) );
+		check( in, out, src, CUBIC, 1.0e-10 );
+	}
+
+public:
+	TestGeometry( ) : seed( 12345 ), in( 23, 19, 17 )
+	{
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			in[ i ] = random( );
+		}
+	}
+
+	void Identity( )
+	{
+		matrix_type mat = matrix_type::identity( 4, 4 );
+		volume_type out( in.width( ), in.height( ), in.depth( ) );
+
+		CPPUNIT_ASSERTION( mist::nearest::transform( in, out, mat ) );
+		assert_same( out, in );
+		CPPUNIT_ASSERTION( mist::linear::transform( in, out, mat ) );
+		assert_same( out, in );
+		CPPUNIT_ASSERTION( mist::cubic::transform( in, out, mat ) );
+		assert_same( out, in );
+	}
+
+	void Rotation( )
+	{
+		// 摜S܂̔Cӎ̉]ƕsړ
+		const double theta = 0.7;
+		double ax = 1.0, ay = 2.0, az = 3.0;
+		double len = std::sqrt( ax * ax + ay * ay + az * az );
+		ax /= len;
+		ay /= len;
+		az /= len;
+
+		double c = std::cos( theta ), s = std::sin( theta );
+		matrix_type r = matrix_type::identity( 4, 4 );
+		r( 0, 0 ) = c + ax * ax * ( 1 - c );      r( 0, 1 ) = ax * ay * ( 1 - c ) - az * s; r( 0, 2 ) = ax * az * ( 1 - c ) + ay * s;
+		r( 1, 0 ) = ay * ax * ( 1 - c ) + az * s; r( 1, 1 ) = c + ay * ay * ( 1 - c );      r( 1, 2 ) = ay * az * ( 1 - c ) - ax * s;
+		r( 2, 0 ) = az * ax * ( 1 - c ) - ay * s; r( 2, 1 ) = az * ay * ( 1 - c ) + ax * s; r( 2, 2 ) = c + az * az * ( 1 - c );
+
+		double cx = ( in.width( ) - 1 ) / 2.0, cy = ( in.height( ) - 1 ) / 2.0, cz = ( in.depth( ) - 1 ) / 2.0;
+		for( int i = 0 ; i < 3 ; i++ )
+		{
+			r( i, 3 ) = ( i == 0 ? cx + 2.3 : ( i == 1 ? cy - 1.7 : cz + 0.6 ) ) - ( r( i, 0 ) * cx + r( i, 1 ) * cy + r( i, 2 ) * cz );
+		}
+
+		check_transform( r, 29, 21, 18 );
+	}
+
+	void Affine( )
+	{
+		// gkƂf܂ވʂ̃AtBϊi3 ~ 4 sł悢j
+		matrix_type mat( 3, 4 );
+		mat( 0, 0 ) =  1.31; mat( 0, 1 ) =  0.22; mat( 0, 2 ) = -0.17; mat( 0, 3 ) =  3.4;
+		mat( 1, 0 ) = -0.12; mat( 1, 1 ) =  0.83; mat( 1, 2 ) =  0.29; mat( 1, 3 ) = -1.9;
+		mat( 2, 0 ) =  0.07; mat( 2, 1 ) = -0.21; mat( 2, 2 ) =  1.12; mat( 2, 3 ) =  2.2;
+
+		check_transform( mat, 33, 20, 24 );
+	}
+
+	void Warp( )
+	{
+		field_type field( 20, 25, 16 );
+		for( size_type i = 0 ; i < field.size( ) ; i++ )
+		{
+			field[ i ].x = 2.0 * random( );
+			field[ i ].y = 2.0 * random( );
+			field[ i ].z = 2.0 * random( );
+		}
+		displacement src( field );
+		volume_type out( field.width( ), field.height( ), field.depth( ) );
+
+		out.fill( -10.0 );
+		CPPUNIT_ASSERTION( mist::nearest::warp( in, out, field ) );
+		check( in, out, src, NEAREST, 0.0 );
+
+		out.fill( -10.0 );
+		CPPUNIT_ASSERTION( mist::linear::warp( in, out, field ) );
+		check( in, out, src, LINEAR, 1.0e-10 );
+
+		out.fill( -10.0 );
+		CPPUNIT_ASSERTION( mist::cubic::warp( in, out, field ) );
+		check( in, out, src, CUBIC, 1.0e-10 );
+	}
+
+	void Invalid( )
+	{
+		volume_type out( 10, 10, 10 );
+
+		// قȍs
+		matrix_type mat = matrix_type::identity( 4, 4 );
+		mat( 2, 2 ) = 0.0;
+		CPPUNIT_ASSERTION( !mist::linear::transform( in, out, mat ) );
+
+		// ψʏ̑傫o͉摜ƈقȂ
+		field_type field( 10, 10, 9 );
+		CPPUNIT_ASSERTION( !mist::linear::warp( in, out, field ) );
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestGeometry );
@@ -0,0 +1,245 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/vector.h>
+#include <mist/filter/hough.h>
+
+class TestHough : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array2< double >			image_type;
+	typedef mist::array2< unsigned char >	edge_type;
+	typedef mist::vector3< double >			circle_type;
+	typedef mist::vector2< double >			line_type;
+	typedef image_type::size_type			size_type;
+
+	CPPUNIT_TEST_SUITE( TestHough );
+	CPPUNIT_TEST( Circle );
+	CPPUNIT_TEST( CircleThreads );
+	CPPUNIT_TEST( Line );
+	CPPUNIT_TEST( GradientLine );
+	CPPUNIT_TEST( GradientLineAllAngles );
+	CPPUNIT_TEST( LineThreads );
+	CPPUNIT_TEST_SUITE_END( );
+
+	image_type image;
+	edge_type edge;
+	image_type rect_image;
+	edge_type rect_edge;
+
+	//  ( rho, theta ) ɋ߂̐𐔂
+	static size_type count_line( const std::vector< line_type > &lines, double rho, double theta )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		size_type num = 0;
+		for( size_type i = 0 ; i < lines.size( ) ; i++ )
+		{
+			if( std::abs( lines[ i ].x - rho ) < 2.5 && std::abs( lines[ i ].y - theta ) < 1.5 * pi / 180.0 )
+			{
+				num++;
+			}
+		}
+		return( num );
+	}
+
+	static void assert_same( const std::vector< line_type > &a, const std::vector< line_type > &b )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+		for( size_type i = 0 ; i < a.size( ) && i < b.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( a[ i ].x, b[ i ].x );
+			CPPUNIT_ASSERTION_EQUAL( a[ i ].y, b[ i ].y );
+		}
+	}
+
+	// S ( 100, 80 )C傫 100~60 ̋` 20 x]ꍇ4Ӂi@̌ 20 x 110 xj
+	static void assert_rectangle( const std::vector< line_type > &lines )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		const double t1 = 20.0 * pi / 180.0, t2 = 110.0 * pi / 180.0;
+		const double r1 = 100.0 * std::cos( t1 ) + 80.0 * std::sin( t1 );
+		const double r2 = 100.0 * std::cos( t2 ) + 80.0 * std::sin( t2 );
+
+		// ̂GbWł͗אڂrɂɑ傪邽߁CoꂽSĂ̒ꂩ̕ӂɋ߂CSĂ̕ӂoĂ邱ƂmF
+		size_type n1 = count_line( lines, r1 + 50.0, t1 ), n2 = count_line( lines, r1 - 50.0, t1 );
+		size_type n3 = count_line( lines, r2 + 30.0, t2 ), n4 = count_line( lines, r2 - 30.0, t2 );
+		CPPUNIT_ASSERTION( n1 > 0 && n2 > 0 && n3 > 0 && n4 > 0 );
+		CPPUNIT_ASSERTION_EQUAL( n1 + n2 + n3 + n4, lines.size( ) );
+	}
+
+public:
+	TestHough( ) : image( 200, 160 ), edge( 200, 160 ), rect_image( 200, 160 ), rect_edge( 200, 160 )
+	{
+		// Eڂ]``CẺfGbWƂ
+		const double pi = 3.1415926535897932384626433832795;
+		const double c = std::cos( 20.0 * pi / 180.0 ), s = std::sin( 20.0 * pi / 180.0 );
+		for( size_type j = 0 ; j < rect_image.height( ) ; j++ )
+		{
+			for( size_type i = 0 ; i < rect_image.width( ) ; i++ )
+			{
+				double x = i - 100.0, y = j - 80.0;
+				double u = std::abs( c * x + s * y ), v = std::abs( -s * x + c * y );
+				double a = ( 50.0 - u < 30.0 - v ? 50.0 - u : 30.0 - v ) + 0.5;
+				a = a < 0.0 ? 0.0 : ( a > 1.0 ? 1.0 : a );
+				rect_image( i, j ) = 100.0 * a;
+				rect_edge( i, j ) = 0.0 < a && a < 1.0 ? 1 : 0;
+			}
+		}
+
+
+		// Eڂ2̉~`CẺfGbWƂ
+		const double cx[] = { 60.0, 145.0 }, cy[] = { 70.0, 95.0 }, r[] = { 30.0, 22.0 };
+		for( size_type j = 0 ; j < image.height( ) ; j++ )
+		{
+			for( size_type i = 0 ; i < image.width( ) ; i++ )
+			{
+				double v = 0.0;
+				for( size_type c = 0 ; c < 2 ; c++ )
+				{
+					double x = i - cx[ c ], y = j - cy[ c ];
+					double a = r[ c ] - std::sqrt( x * x + y * y ) + 0.5;
+					a = a < 0.0 ? 0.0 : ( a > 1.0 ? 1.0 : a );
+					v = v > a ? v : a;
+				}
+				image( i, j ) = 100.0 * v;
+				edge( i, j ) = 0.0 < v && v < 1.0 ? 1 : 0;
+			}
+		}
+	}
+
+protected:
+	void Circle( )
+	{
+		std::vector< circle_type > circles;
+		CPPUNIT_ASSERTION( mist::circle::hough_transform( edge, image, circles, 5, 10.0, 40.0 ) );
+		CPPUNIT_ASSERTION_EQUAL( circles.size( ), static_cast< size_t >( 2 ) );
+
+		// ~̉f̑ɕ
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( circles[ 0 ].x,  60.0, 0.5 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( circles[ 0 ].y,  70.0, 0.5 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( circles[ 0 ].z,  30.0, 0.5 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( circles[ 1 ].x, 145.0, 0.5 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( circles[ 1 ].y,  95.0, 0.5 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( circles[ 1 ].z,  22.0, 0.5 );
+
+		// a͈̔͊Ỏ~͌oȂ
+		CPPUNIT_ASSERTION( mist::circle::hough_transform( edge, image, circles, 5, 25.0, 40.0 ) );
+		CPPUNIT_ASSERTION_EQUAL( circles.size( ), static_cast< size_t >( 1 ) );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( circles[ 0 ].z,  30.0, 0.5 );
+	}
+
+	void CircleThreads( )
+	{
+		std::vector< circle_type > ref, out;
+		mist::circle::hough_transform( edge, image, ref, 5, 10.0, 40.0, 50, 1.0, 10.0, mist::__hough_detail__::foreground_evaluator( ), 1 );
+
+		for( size_type thread_num = 2 ; thread_num <= 4 ; thread_num++ )
+		{
+			mist::circle::hough_transform( edge, image, out, 5, 10.0, 40.0, 50, 1.0, 10.0, mist::__hough_detail__::foreground_evaluator( ), thread_num );
+			CPPUNIT_ASSERTION_EQUAL( out.size( ), ref.size( ) );
+			for( size_type i = 0 ; i < ref.size( ) && i < out.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_EQUAL( out[ i ].x, ref[ i ].x );
+				CPPUNIT_ASSERTION_EQUAL( out[ i ].y, ref[ i ].y );
+				CPPUNIT_ASSERTION_EQUAL( out[ i ].z, ref[ i ].z );
+			}
+		}
+	}
+
+	void Line( )
+	{
+		std::vector< line_type > lines;
+		CPPUNIT_ASSERTION( mist::line::hough_transform( rect_edge, lines, 8, 1.0, 3.1415926535897932384626433832795 / 180.0, 30 ) );
+		assert_rectangle( lines );
+	}
+
+	void GradientLine( )
+	{
+		std::vector< line_type > lines;
+		CPPUNIT_ASSERTION( mist::line::gradient_hough_transform( rect_edge, rect_image, lines, 8, 1.0, 3.1415926535897932384626433832795 / 180.0, 30 ) );
+		assert_rectangle( lines );
+
+		// 傫̈قȂ摜͏Ȃ
+		image_type other( 100, 160 );
+		CPPUNIT_ASSERTION( !mist::line::gradient_hough_transform( rect_edge, other, lines, 4 ) );
+		CPPUNIT_ASSERTION( lines.empty( ) );
+	}
+
+	void GradientLineAllAngles( )
+	{
+		// 2 * angle_range + 1 Ƃ̐ȏƂȂꍇ́CSẴƂɓ[ʏ Hough ϊƓʂɂȂ
+		const double pi = 3.1415926535897932384626433832795;
+		const double deltas[] = { pi / 2.0, pi };
+		std::vector< line_type > ref, out;
+
+		for( size_type thread_num = 1 ; thread_num <= 3 ; thread_num += 2 )
+		{
+			mist::line::hough_transform( rect_edge, ref, 8, 1.0, pi / 360.0, 30, mist::__hough_detail__::foreground_evaluator( ), thread_num );
+			CPPUNIT_ASSERTION( ref.size( ) > 4 );
+
+			for( size_type d = 0 ; d < 2 ; d++ )
+			{
+				mist::line::gradient_hough_transform( rect_edge, rect_image, out, 8, 1.0, pi / 360.0, 30, deltas[ d ], mist::__hough_detail__::foreground_evaluator( ), thread_num );
+				assert_same( out, ref );
+			}
+		}
+	}
+
+	void LineThreads( )
+	{
+		const double pi = 3.1415926535897932384626433832795;
+		std::vector< line_type > ref1, ref2, out;
+
+		// ~Ƌ`̗̃GbW܂މ摜ŁČo
+		edge_type both( edge );
+		for( size_type i = 0 ; i < both.size( ) ; i++ )
+		{
+			both[ i ] = both[ i ] | rect_edge[ i ];
+		}
+
+		mist::line::hough_transform( both, ref1, 50, 1.0, pi / 180.0, 10, mist::__hough_detail__::foreground_evaluator( ), 1 );
+		mist::line::gradient_hough_transform( both, rect_image, ref2, 50, 1.0, pi / 180.0, 10, pi / 18.0, mist::__hough_detail__::foreground_evaluator( ), 1 );
+		CPPUNIT_ASSERTION( ref1.size( ) > 10 );
+		CPPUNIT_ASSERTION( ref2.size( ) > 4 );
+
+		for( size_type thread_num = 2 ; thread_num <= 8 ; thread_num++ )
+		{
+			mist::line::hough_transform( both, out, 50, 1.0, pi / 180.0, 10, mist::__hough_detail__::foreground_evaluator( ), thread_num );
+			assert_same( out, ref1 );
+
+			mist::line::gradient_hough_transform( both, rect_image, out, 50, 1.0, pi / 180.0, 10, pi / 18.0, mist::__hough_detail__::foreground_evaluator( ), thread_num );
+			assert_same( out, ref2 );
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestHough );
@@ -0,0 +1,185 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/filter/iir.h>
+
+class TestIIR : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array< double >	signal_type;
+	typedef mist::array2< double >	channel_type;
+	typedef signal_type::size_type	size_type;
+
+	CPPUNIT_TEST_SUITE( TestIIR );
+	CPPUNIT_TEST( Biquad );
+	CPPUNIT_TEST( Streaming );
+	CPPUNIT_TEST( MultiChannel );
+	CPPUNIT_TEST_SUITE_END( );
+
+	signal_type signal;
+	channel_type sos;
+
+	// ei̍ a0 y[ n ] = b0 x[ n ] + b1 x[ n - 1 ] + b2 x[ n - 2 ] - a1 y[ n - 1 ] - a2 y[ n - 2 ] `ʂɌvZ
+	void difference_equation( const signal_type &in, signal_type &out ) const
+	{
+		out = in;
+		for( size_type s = 0 ; s < sos.height( ) ; s++ )
+		{
+			signal_type x( out );
+			for( size_type n = 0 ; n < x.size( ) ; n++ )
+			{
+				double v = sos( 0, s ) * x[ n ];
+				if( n >= 1 )
+				{
+					v += sos( 1, s ) * x[ n - 1 ] - sos( 4, s ) * out[ n - 1 ];
+				}
+				if( n >= 2 )
+				{
+					v += sos( 2, s ) * x[ n - 2 ] - sos( 5, s ) * out[ n - 2 ];
+				}
+				out[ n ] = v / sos( 3, s );
+			}
+		}
+	}
+
+public:
+	TestIIR( ) : signal( 2000 ), sos( 6, 2 )
+	{
+		unsigned int seed = 4321;
+		for( size_type i = 0 ; i < signal.size( ) ; i++ )
+		{
+			seed = seed * 1103515245u + 12345u;
+			signal[ i ] = static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0;
+		}
+
+		// 2ĩtB^ia0 1łȂi܂ށj
+		const double c[ 2 ][ 6 ] = { { 0.2, 0.4, 0.2, 1.0, -0.6, 0.25 }, { 1.0, -1.5, 0.8, 2.0, -1.2, 0.5 } };
+		for( size_type s = 0 ; s < 2 ; s++ )
+		{
+			for( size_type i = 0 ; i < 6 ; i++ )
+			{
+				sos( i, s ) = c[ s ][ i ];
+			}
+		}
+	}
+
+protected:
+	void Biquad( )
+	{
+		signal_type ref, out;
+		difference_equation( signal, ref );
+
+		mist::biquad_filter f( sos );
+		CPPUNIT_ASSERTION_EQUAL( f.sections( ), static_cast< size_type >( 2 ) );
+		CPPUNIT_ASSERTION( f.filter( signal, out ) );
+
+		CPPUNIT_ASSERTION_EQUAL( out.size( ), ref.size( ) );
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ i ], ref[ i ], 1.0e-12 );
+		}
+
+		// 2`l̃tB^1̐M󂯕tȂ
+		mist::biquad_filter g( sos, 2 );
+		CPPUNIT_ASSERTION( !g.filter( signal, out ) );
+	}
+
+	void Streaming( )
+	{
+		// sȒi0܂ށj̃ubNɕė^ĂCxɏꍇƓʂɂȂ
+		const size_type chunks[] = { 1, 13, 0, 250, 2, 700, 3 };
+
+		signal_type ref, block;
+		mist::biquad_filter f( sos );
+		f.filter( signal, ref );
+		f.reset( );
+
+		size_type pos = 0;
+		for( size_type c = 0 ; pos < signal.size( ) ; c = ( c + 1 ) % 7 )
+		{
+			size_type num = chunks[ c ] < signal.size( ) - pos ? chunks[ c ] : signal.size( ) - pos;
+			signal_type in( num );
+			for( size_type i = 0 ; i < num ; i++ )
+			{
+				in[ i ] = signal[ pos + i ];
+			}
+
+			CPPUNIT_ASSERTION( f.filter( in, block ) );
+			CPPUNIT_ASSERTION_EQUAL( block.size( ), num );
+			for( size_type i = 0 ; i < num ; i++ )
+			{
+				CPPUNIT_ASSERTION_EQUAL( block[ i ], ref[ pos + i ] );
+			}
+			pos += num;
+		}
+	}
+
+	void MultiChannel( )
+	{
+		// e`lʂɏʂƈv
+		const size_type ch = 3;
+		channel_type in( ch, signal.size( ) ), out;
+		for( size_type j = 0 ; j < in.height( ) ; j++ )
+		{
+			for( size_type i = 0 ; i < ch ; i++ )
+			{
+				in( i, j ) = signal[ ( j + 500 * i ) % signal.size( ) ] * ( 1.0 + i );
+			}
+		}
+
+		mist::biquad_filter f( sos, ch );
+		CPPUNIT_ASSERTION( f.filter( in, out ) );
+		CPPUNIT_ASSERTION_EQUAL( out.width( ), ch );
+		CPPUNIT_ASSERTION_EQUAL( out.height( ), in.height( ) );
+
+		for( size_type i = 0 ; i < ch ; i++ )
+		{
+			signal_type x( in.height( ) ), ref;
+			for( size_type j = 0 ; j < in.height( ) ; j++ )
+			{
+				x[ j ] = in( i, j );
+			}
+			difference_equation( x, ref );
+
+			for( size_type j = 0 ; j < in.height( ) ; j++ )
+			{
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( out( i, j ), ref[ j ], 1.0e-12 );
+			}
+		}
+
+		// `lقȂ͎͂󂯕tȂ
+		channel_type bad( ch + 1, 10 );
+		CPPUNIT_ASSERTION( !f.filter( bad, out ) );
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestIIR );
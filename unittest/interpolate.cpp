@@ -0,0 +1,256 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/interpolate.h>
+
+class TestInterpolate : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef size_t size_type;
+
+	CPPUNIT_TEST_SUITE( TestInterpolate );
+	CPPUNIT_TEST( Linear2 );
+	CPPUNIT_TEST( Linear3 );
+	CPPUNIT_TEST( Cubic2 );
+	CPPUNIT_TEST( Cubic3 );
+	CPPUNIT_TEST( BSpline2 );
+	CPPUNIT_TEST( BSpline3 );
+	CPPUNIT_TEST( Sinc2 );
+	CPPUNIT_TEST( Sinc3 );
+	CPPUNIT_TEST_SUITE_END( );
+
+	enum kernel_type
+	{
+		Linear,
+		Cubic,
+		BSpline,
+		Sinc,
+	};
+
+	unsigned int seed;
+
+	template < class Array >
+	void randomize( Array &a, double range )
+	{
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			seed = seed * 1103515245u + 12345u;
+			a[ i ] = static_cast< typename Array::value_type >( ( seed >> 8 ) % 1000 * range / 1000.0 );
+		}
+	}
+
+	// ƂɕԂƓo͂CfƂɕԂ]̎ŋ߂
+	template < class Array1, class Array2 >
+	static void reference( kernel_type type, const Array1 &in, Array2 &out )
+	{
+		switch( type )
+		{
+		case Linear:
+			mist::__linear__::interpolate( in, out, 0, 1, 0, 1, 0, 1 );
+			break;
+
+		case Cubic:
+			mist::__cubic__::interpolate( in, out, 0, 1, 0, 1, 0, 1 );
+			break;
+
+		case BSpline:
+			mist::__bspline__::interpolate( in, out, 0, 1, 0, 1, 0, 1 );
+			break;
+
+		case Sinc:
+		default:
+			mist::__sinc__::interpolate( in, out, 0, 1, 0, 1, 0, 1 );
+			break;
+		}
+	}
+
+	template < class T1, class T2 >
+	static bool interpolate( kernel_type type, const mist::array2< T1 > &in, mist::array2< T2 > &out, size_type w, size_type h, size_type thread_num )
+	{
+		switch( type )
+		{
+		case Linear:
+			return( mist::linear::interpolate( in, out, w, h, thread_num ) );
+
+		case Cubic:
+			return( mist::cubic::interpolate( in, out, w, h, thread_num ) );
+
+		case BSpline:
+			return( mist::BSpline::interpolate( in, out, w, h, thread_num ) );
+
+		case Sinc:
+		default:
+			return( mist::sinc::interpolate( in, out, w, h, thread_num ) );
+		}
+	}
+
+	template < class T1, class T2 >
+	static bool interpolate( kernel_type type, const mist::array3< T1 > &in, mist::array3< T2 > &out, size_type w, size_type h, size_type d, size_type thread_num )
+	{
+		switch( type )
+		{
+		case Linear:
+			return( mist::linear::interpolate( in, out, w, h, d, thread_num ) );
+
+		case Cubic:
+			return( mist::cubic::interpolate( in, out, w, h, d, thread_num ) );
+
+		case BSpline:
+			return( mist::BSpline::interpolate( in, out, w, h, d, thread_num ) );
+
+		case Sinc:
+		default:
+			return( mist::sinc::interpolate( in, out, w, h, d, thread_num ) );
+		}
+	}
+
+	template < class Array >
+	static void assert_identical( const Array &out, const Array &ref )
+	{
+		CPPUNIT_ASSERTION_EQUAL( out.width( ), ref.width( ) );
+		CPPUNIT_ASSERTION_EQUAL( out.height( ), ref.height( ) );
+		CPPUNIT_ASSERTION_EQUAL( out.depth( ), ref.depth( ) );
+
+		size_type diff = 0;
+		for( size_type i = 0 ; i < out.size( ) && i < ref.size( ) ; i++ )
+		{
+			diff += out[ i ] == ref[ i ] ? 0 : 1;
+		}
+		CPPUNIT_ASSERTION_EQUAL( diff, static_cast< size_type >( 0 ) );
+	}
+
+	// gEkE傫1̏o͂܂ޑgݍ킹ɂāCfƂ̕ԂƃrbgPʂňv邱ƂmF
+	template < class T1, class T2 >
+	void check2( kernel_type type, double range )
+	{
+		const size_type sizes[][ 2 ] = { { 13, 9 }, { 5, 17 }, { 16, 16 }, { 1, 7 }, { 6, 1 }, { 1, 1 }, { 29, 4 } };
+
+		mist::array2< T1 > in( 11, 8 );
+		randomize( in, range );
+
+		for( size_type n = 0 ; n < sizeof( sizes ) / sizeof( sizes[ 0 ] ) ; n++ )
+		{
+			mist::array2< T2 > ref( sizes[ n ][ 0 ], sizes[ n ][ 1 ] ), out;
+			reference( type, in, ref );
+
+			for( size_type thread_num = 1 ; thread_num <= 4 ; thread_num += 3 )
+			{
+				CPPUNIT_ASSERTION( interpolate( type, in, out, sizes[ n ][ 0 ], sizes[ n ][ 1 ], thread_num ) );
+				assert_identical( out, ref );
+			}
+		}
+	}
+
+	template < class T1, class T2 >
+	void check3( kernel_type type, double range )
+	{
+		const size_type sizes[][ 3 ] = { { 9, 7, 11 }, { 3, 12, 4 }, { 6, 5, 5 }, { 1, 1, 9 }, { 8, 1, 1 }, { 1, 1, 1 }, { 10, 3, 1 } };
+
+		mist::array3< T1 > in( 6, 5, 7 );
+		randomize( in, range );
+
+		for( size_type n = 0 ; n < sizeof( sizes ) / sizeof( sizes[ 0 ] ) ; n++ )
+		{
+			mist::array3< T2 > ref( sizes[ n ][ 0 ], sizes[ n ][ 1 ], sizes[ n ][ 2 ] ), out;
+			reference( type, in, ref );
+
+			for( size_type thread_num = 1 ; thread_num <= 4 ; thread_num += 3 )
+			{
+				CPPUNIT_ASSERTION( interpolate( type, in, out, sizes[ n ][ 0 ], sizes[ n ][ 1 ], sizes[ n ][ 2 ], thread_num ) );
+				assert_identical( out, ref );
+			}
+		}
+	}
+
+	void check2( kernel_type type )
+	{
+		check2< unsigned char, unsigned char >( type, 255.0 );
+		check2< short, short >( type, 2000.0 );
+		check2< double, double >( type, 1.0 );
+		check2< unsigned char, double >( type, 255.0 );
+	}
+
+	void check3( kernel_type type )
+	{
+		check3< unsigned char, unsigned char >( type, 255.0 );
+		check3< short, short >( type, 2000.0 );
+		check3< double, double >( type, 1.0 );
+		check3< unsigned char, double >( type, 255.0 );
+	}
+
+public:
+	TestInterpolate( ) : seed( 1 )
+	{
+	}
+
+	void Linear2( )
+	{
+		check2( Linear );
+	}
+
+	void Linear3( )
+	{
+		check3( Linear );
+	}
+
+	void Cubic2( )
+	{
+		check2( Cubic );
+	}
+
+	void Cubic3( )
+	{
+		check3( Cubic );
+	}
+
+	void BSpline2( )
+	{
+		check2( BSpline );
+	}
+
+	void BSpline3( )
+	{
+		check3( BSpline );
+	}
+
+	void Sinc2( )
+	{
+		check2( Sinc );
+	}
+
+	void Sinc3( )
+	{
+		check3( Sinc );
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestInterpolate );
@@ -0,0 +1,202 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include "macros.h"
+#include <mist/filter/labeling.h>
+
+class TestLabeling : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array3< unsigned char >	image_type;
+	typedef image_type::size_type			size_type;
+
+	CPPUNIT_TEST_SUITE( TestLabeling );
+	CPPUNIT_TEST( ParallelLabeling2D );
+	CPPUNIT_TEST( ParallelLabeling3D );
+	CPPUNIT_TEST( RegionStatistics );
+	CPPUNIT_TEST( SelectRegions );
+	CPPUNIT_TEST_SUITE_END( );
+
+	image_type image;
+
+	template < class Array >
+	void check_equal( const Array &a, size_type na, const Array &b, size_type nb )
+	{
+		CPPUNIT_ASSERTION_EQUAL( na, nb );
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( a[ i ], b[ i ] );
+		}
+	}
+
+public:
+	TestLabeling( ) : image( 23, 19, 29 )
+	{
+		for( size_type i = 0 ; i < image.size( ) ; i++ )
+		{
+			image[ i ] = ( i * 2654435761u ) % 97 < 45 ? 1 : 0;
+		}
+	}
+
+protected:
+	void ParallelLabeling2D( )
+	{
+		mist::array2< unsigned char > img( 61, 47 );
+		for( size_type i = 0 ; i < img.size( ) ; i++ )
+		{
+			img[ i ] = ( i * 2654435761u ) % 89 < 50 ? 1 : 0;
+		}
+
+		mist::array2< int > ref, out;
+		size_type nr, no;
+
+		nr = mist::labeling4( img, ref );
+		no = mist::parallel::labeling4( img, out, 3 );
+		check_equal( ref, nr, out, no );
+
+		nr = mist::labeling8( img, ref );
+		no = mist::parallel::labeling8( img, out, 5 );
+		check_equal( ref, nr, out, no );
+	}
+
+	void ParallelLabeling3D( )
+	{
+		mist::array3< int > ref, out;
+		size_type nr, no;
+
+		nr = mist::labeling6( image, ref );
+		no = mist::parallel::labeling6( image, out, 3 );
+		check_equal( ref, nr, out, no );
+
+		nr = mist::labeling18( image, ref );
+		no = mist::parallel::labeling18( image, out, 4 );
+		check_equal( ref, nr, out, no );
+
+		nr = mist::labeling26( image, ref );
+		no = mist::parallel::labeling26( image, out, 7 );
+		check_equal( ref, nr, out, no );
+	}
+
+	void RegionStatistics( )
+	{
+		mist::array3< float > intensity( image.width( ), image.height( ), image.depth( ) );
+		for( size_type i = 0 ; i < intensity.size( ) ; i++ )
+		{
+			intensity[ i ] = static_cast< float >( i % 13 );
+		}
+
+		mist::array3< int > ref, out;
+		std::vector< mist::region_statistics > regions;
+		size_type nr = mist::labeling26( image, ref );
+		size_type no = mist::parallel::labeling26( image, intensity, out, regions, 3 );
+		check_equal( ref, nr, out, no );
+		CPPUNIT_ASSERTION_EQUAL( regions.size( ), no );
+
+		// Sf𑖍ċ߂vʂƔr
+		std::vector< mist::region_statistics > tmp( no );
+		for( size_type l = 0 ; l < no ; l++ )
+		{
+			tmp[ l ] = mist::region_statistics( l + 1 );
+		}
+
+		for( size_type k = 0 ; k < ref.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < ref.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < ref.width( ) ; i++ )
+				{
+					if( ref( i, j, k ) != 0 )
+					{
+						tmp[ ref( i, j, k ) - 1 ].append( i, j, k, intensity( i, j, k ) );
+					}
+				}
+			}
+		}
+
+		for( size_type l = 0 ; l < no ; l++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( regions[ l ].label, tmp[ l ].label );
+			CPPUNIT_ASSERTION_EQUAL( regions[ l ].count, tmp[ l ].count );
+			CPPUNIT_ASSERTION_EQUAL( regions[ l ].min_x, tmp[ l ].min_x );
+			CPPUNIT_ASSERTION_EQUAL( regions[ l ].max_y, tmp[ l ].max_y );
+			CPPUNIT_ASSERTION_EQUAL( regions[ l ].max_z, tmp[ l ].max_z );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( regions[ l ].center_x( ), tmp[ l ].center_x( ), 1.0e-6 );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( regions[ l ].sum, tmp[ l ].sum, 1.0e-6 );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( regions[ l ].maximum, tmp[ l ].maximum, 1.0e-6 );
+		}
+	}
+
+	void SelectRegions( )
+	{
+		mist::array3< int > out;
+		std::vector< mist::region_statistics > regions;
+		mist::parallel::labeling6( image, out, regions, 2 );
+
+		std::vector< mist::region_statistics > org( regions );
+		mist::array3< int > label( out );
+		size_type num = mist::remove_small_regions( label, regions, 3 );
+
+		size_type count = 0;
+		for( size_type l = 0 ; l < org.size( ) ; l++ )
+		{
+			count += org[ l ].count >= 3 ? 1 : 0;
+		}
+		CPPUNIT_ASSERTION_EQUAL( num, count );
+
+		for( size_type i = 0 ; i < label.size( ) ; i++ )
+		{
+			if( out[ i ] != 0 && org[ out[ i ] - 1 ].count >= 3 )
+			{
+				CPPUNIT_ASSERTION( label[ i ] != 0 );
+				CPPUNIT_ASSERTION_EQUAL( regions[ label[ i ] - 1 ].count, org[ out[ i ] - 1 ].count );
+			}
+			else
+			{
+				CPPUNIT_ASSERTION_EQUAL( label[ i ], 0 );
+			}
+		}
+
+		// ő̘Â݂c
+		size_type max_count = 0;
+		for( size_type l = 0 ; l < org.size( ) ; l++ )
+		{
+			max_count = org[ l ].count > max_count ? org[ l ].count : max_count;
+		}
+
+		label = out;
+		regions = org;
+		CPPUNIT_ASSERTION_EQUAL( mist::keep_largest_regions( label, regions, 1 ), static_cast< size_type >( 1 ) );
+		CPPUNIT_ASSERTION_EQUAL( regions[ 0 ].count, max_count );
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestLabeling );
@@ -0,0 +1,247 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <map>
+#include "macros.h"
+#include <mist/filter/mode.h>
+
+class TestMode : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef size_t	size_type;
+
+	CPPUNIT_TEST_SUITE( TestMode );
+	CPPUNIT_TEST( NarrowRange2 );
+	CPPUNIT_TEST( NarrowRange3 );
+	CPPUNIT_TEST( WideRange2 );
+	CPPUNIT_TEST( WideRange3 );
+	CPPUNIT_TEST( Tie );
+	CPPUNIT_TEST( Threads );
+	CPPUNIT_TEST_SUITE_END( );
+
+	unsigned int seed;
+
+	size_type random( size_type n )
+	{
+		seed = seed * 1103515245u + 12345u;
+		return( ( seed >> 8 ) % n );
+	}
+
+	// ̃xɕz摜쐬ix values ̒Iԁj
+	template < class Array, class T >
+	void make_label_image( Array &a, const T *values, size_type num )
+	{
+		for( size_type k = 0 ; k < a.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < a.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < a.width( ) ; i++ )
+				{
+					size_type l = ( i / 4 + j / 3 + k / 2 ) % num;
+					a( i, j, k ) = values[ random( 5 ) < 3 ? l : random( num ) ];
+				}
+			}
+		}
+	}
+
+	// \vf̃x𐔂グCo͂őpx̃xł邱Ɓiډf̃xőpx̏ꍇ͂ꂪc邱ƁjmF
+	template < class Array >
+	static void check_mode( const Array &in, const Array &out, const mist::mode_filter::mode_structure &s )
+	{
+		typedef typename Array::value_type value_type;
+		typedef std::map< value_type, size_type > histogram_type;
+
+		CPPUNIT_ASSERTION_EQUAL( out.size( ), in.size( ) );
+
+		const ptrdiff_t w = in.width( ), h = in.height( ), d = in.depth( );
+		for( ptrdiff_t k = 0 ; k < d ; k++ )
+		{
+			for( ptrdiff_t j = 0 ; j < h ; j++ )
+			{
+				for( ptrdiff_t i = 0 ; i < w ; i++ )
+				{
+					histogram_type hist;
+					size_type max = 0;
+					for( size_type n = 0 ; n < s.object.size( ) ; n++ )
+					{
+						ptrdiff_t x = i + s.object[ n ].x, y = j + s.object[ n ].y, z = k + s.object[ n ].z;
+						if( 0 <= x && x < w && 0 <= y && y < h && 0 <= z && z < d )
+						{
+							size_type c = ++hist[ in( x, y, z ) ];
+							max = c > max ? c : max;
+						}
+					}
+
+					const value_type &center = in( i, j, k );
+					const value_type &result = out( i, j, k );
+					if( hist[ center ] == max )
+					{
+						CPPUNIT_ASSERTION_EQUAL( result, center );
+					}
+					else
+					{
+						CPPUNIT_ASSERTION_EQUAL( hist[ result ], max );
+					}
+				}
+			}
+		}
+	}
+
+public:
+	TestMode( ) : seed( 2012 )
+	{
+	}
+
+protected:
+	void NarrowRange2( )
+	{
+		const unsigned char values[] = { 0, 1, 2, 3, 7, 255 };
+		mist::array2< unsigned char > in( 41, 33 ), out;
+		make_label_image( in, values, 6 );
+
+		const double radius[] = { 1.0, 2.5 };
+		for( size_type r = 0 ; r < 2 ; r++ )
+		{
+			mist::mode_filter::mode_structure s = mist::mode_filter::circle( radius[ r ], 1.0, 1.0 );
+			out = in;
+			CPPUNIT_ASSERTION( mist::label_mode( out, s, 1 ) );
+			check_mode( in, out, s );
+		}
+
+		mist::mode_filter::mode_structure s = mist::mode_filter::square( 1.0, 1.0, 1.0 );
+		out = in;
+		CPPUNIT_ASSERTION( mist::label_mode( out, s, 1 ) );
+		check_mode( in, out, s );
+	}
+
+	void NarrowRange3( )
+	{
+		const unsigned char values[] = { 0, 1, 2, 5 };
+		mist::array3< unsigned char > in( 17, 13, 11 ), out;
+		make_label_image( in, values, 4 );
+
+		mist::mode_filter::mode_structure s = mist::mode_filter::sphere( 1.5, 1.0, 1.0, 1.0 );
+		out = in;
+		CPPUNIT_ASSERTION( mist::label_mode( out, s, 1 ) );
+		check_mode( in, out, s );
+	}
+
+	void WideRange2( )
+	{
+		// l͈̔͂ĹC摜Ɍl݂̂ŃqXgO\
+		const int ivalues[] = { -70000, 3, 4, 120000, 5000000, 7 };
+		mist::array2< int > iin( 41, 33 ), iout;
+		make_label_image( iin, ivalues, 6 );
+
+		mist::mode_filter::mode_structure s = mist::mode_filter::circle( 2.0, 1.0, 1.0 );
+		iout = iin;
+		CPPUNIT_ASSERTION( mist::label_mode( iout, s, 1 ) );
+		check_mode( iin, iout, s );
+
+		const double dvalues[] = { 0.5, 1.25, -3.0, 1.0e6, 0.0 };
+		mist::array2< double > din( 37, 29 ), dout;
+		make_label_image( din, dvalues, 5 );
+
+		dout = din;
+		CPPUNIT_ASSERTION( mist::label_mode( dout, s, 1 ) );
+		check_mode( din, dout, s );
+	}
+
+	void WideRange3( )
+	{
+		const double values[] = { 0.5, 1.25, -3.0, 1.0e6 };
+		mist::array3< double > in( 15, 12, 10 ), out;
+		make_label_image( in, values, 4 );
+
+		mist::mode_filter::mode_structure s = mist::mode_filter::cube( 1.0, 1.0, 1.0, 1.0 );
+		out = in;
+		CPPUNIT_ASSERTION( mist::label_mode( out, s, 1 ) );
+		check_mode( in, out, s );
+	}
+
+	void Tie( )
+	{
+		// [̉f͍\vf2̃xƂȂ邽߁Cډf̃xc
+		const int values[] = { 1, 2, 2, 1, 3, 3, 1 };
+		mist::array2< int > in( 7, 1 ), out;
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			in[ i ] = values[ i ];
+		}
+
+		mist::mode_filter::mode_structure s = mist::mode_filter::square( 1.0, 1.0, 1.0 );
+		out = in;
+		CPPUNIT_ASSERTION( mist::label_mode( out, s, 1 ) );
+		check_mode( in, out, s );
+
+		const int expected[] = { 1, 2, 2, 1, 3, 3, 1 };
+		for( size_type i = 0 ; i < out.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( out[ i ], expected[ i ] );
+		}
+	}
+
+	void Threads( )
+	{
+		// Xbhɂ炸ʂɂȂ
+		const unsigned char values[] = { 0, 1, 2, 3, 7 };
+		mist::array2< unsigned char > in2( 53, 47 ), ref2, out2;
+		make_label_image( in2, values, 5 );
+
+		ref2 = in2;
+		CPPUNIT_ASSERTION( mist::label_mode( ref2, 2.0, 1 ) );
+
+		const double dvalues[] = { 0.5, 1.25, -3.0, 1.0e6 };
+		mist::array3< double > in3( 19, 17, 13 ), ref3, out3;
+		make_label_image( in3, dvalues, 4 );
+
+		ref3 = in3;
+		CPPUNIT_ASSERTION( mist::label_mode( ref3, 1.5, 1 ) );
+
+		for( size_type thread_num = 2 ; thread_num <= 4 ; thread_num++ )
+		{
+			out2 = in2;
+			CPPUNIT_ASSERTION( mist::label_mode( out2, 2.0, thread_num ) );
+			for( size_type i = 0 ; i < ref2.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_EQUAL( out2[ i ], ref2[ i ] );
+			}
+
+			out3 = in3;
+			CPPUNIT_ASSERTION( mist::label_mode( out3, 1.5, thread_num ) );
+			for( size_type i = 0 ; i < ref3.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_EQUAL( out3[ i ], ref3[ i ] );
+			}
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestMode );
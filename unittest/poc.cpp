@@ -0,0 +1,144 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/registration.h>
+
+class TestPOC : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array2< double >	image_type;
+	typedef image_type::size_type	size_type;
+
+	CPPUNIT_TEST_SUITE( TestPOC );
+	CPPUNIT_TEST( Previous );
+	CPPUNIT_TEST( Shift );
+	CPPUNIT_TEST_SUITE_END( );
+
+	// 3 ~ 3 ̕ςŕIȗ摜
+	static void make_image( image_type &img, size_type width, size_type height )
+	{
+		image_type tmp( width, height );
+		unsigned int seed = 1;
+		for( size_type i = 0 ; i < tmp.size( ) ; i++ )
+		{
+			seed = seed * 1103515245u + 12345u;
+			tmp[ i ] = static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0;
+		}
+
+		img.resize( width, height );
+		for( size_type j = 0 ; j < height ; j++ )
+		{
+			for( size_type i = 0 ; i < width ; i++ )
+			{
+				double v = 0.0;
+				for( size_type dj = 0 ; dj < 3 ; dj++ )
+				{
+					for( size_type di = 0 ; di < 3 ; di++ )
+					{
+						v += tmp( ( i + di + width - 1 ) % width, ( j + dj + height - 1 ) % height );
+					}
+				}
+				img( i, j ) = v;
+			}
+		}
+	}
+
+	static double at( const image_type &img, int i, int j )
+	{
+		int w = static_cast< int >( img.width( ) ), h = static_cast< int >( img.height( ) );
+		return( img( ( i % w + w ) % w, ( j % h + h ) % h ) );
+	}
+
+	// 摜I ( dx, dy ) sړi`ԁj
+	static void shift( const image_type &in, image_type &out, double dx, double dy )
+	{
+		out.resize( in.width( ), in.height( ) );
+		for( size_type j = 0 ; j < in.height( ) ; j++ )
+		{
+			for( size_type i = 0 ; i < in.width( ) ; i++ )
+			{
+				double x = i - dx, y = j - dy;
+				int ix = static_cast< int >( std::floor( x ) ), iy = static_cast< int >( std::floor( y ) );
+				double fx = x - ix, fy = y - iy;
+				out( i, j ) = ( 1.0 - fx ) * ( 1.0 - fy ) * at( in, ix, iy ) + fx * ( 1.0 - fy ) * at( in, ix + 1, iy )
+							+ ( 1.0 - fx ) * fy * at( in, ix, iy + 1 ) + fx * fy * at( in, ix + 1, iy + 1 );
+			}
+		}
+	}
+
+public:
+	void Previous( )
+	{
+		// Sg FFT pĂ]̎ƓlɂȂ
+		const double shifts[][ 4 ] = {
+			{  3.3, -2.4,  3.2932083686, -2.3749254372 },
+			{ -5.6,  4.7, -5.6250745628,  4.7067916314 },
+			{  1.2,  6.8,  1.2241088771,  6.7758911229 },
+		};
+
+		image_type ref, in;
+		make_image( ref, 64, 64 );
+		for( size_type n = 0 ; n < 3 ; n++ )
+		{
+			shift( ref, in, shifts[ n ][ 0 ], shifts[ n ][ 1 ] );
+
+			double dx, dy;
+			mist::poc::estimate( in, ref, dx, dy );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( dx, shifts[ n ][ 2 ], 1.0e-8 );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( dy, shifts[ n ][ 3 ], 1.0e-8 );
+		}
+	}
+
+	void Shift( )
+	{
+		// 2ׂ̂łȂ傫܂߂āCTusNZxŕsړʂ𐄒ł
+		const size_type sizes[][ 2 ] = { { 64, 64 }, { 64, 32 }, { 48, 40 }, { 50, 36 } };
+		const double shifts[][ 2 ] = { { 3.3, -2.4 }, { -5.6, 4.7 }, { 1.2, 6.8 } };
+
+		for( size_type s = 0 ; s < 4 ; s++ )
+		{
+			image_type ref, in;
+			make_image( ref, sizes[ s ][ 0 ], sizes[ s ][ 1 ] );
+			for( size_type n = 0 ; n < 3 ; n++ )
+			{
+				shift( ref, in, shifts[ n ][ 0 ], shifts[ n ][ 1 ] );
+
+				mist::vector2< double > d;
+				mist::poc::estimate( in, ref, d );
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( d.x, shifts[ n ][ 0 ], 0.1 );
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( d.y, shifts[ n ][ 1 ], 0.1 );
+			}
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestPOC );
@@ -0,0 +1,284 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/filter/pyramid.h>
+
+class TestPyramid : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array2< double >	image_type;
+	typedef mist::array3< double >	volume_type;
+	typedef image_type::size_type	size_type;
+	typedef ptrdiff_t				difference_type;
+
+	CPPUNIT_TEST_SUITE( TestPyramid );
+	CPPUNIT_TEST( LevelSize2 );
+	CPPUNIT_TEST( LevelSize3 );
+	CPPUNIT_TEST( Reduce2 );
+	CPPUNIT_TEST( Reduce3 );
+	CPPUNIT_TEST( Reconstruct2 );
+	CPPUNIT_TEST( Reconstruct3 );
+	CPPUNIT_TEST( BuildAll );
+	CPPUNIT_TEST_SUITE_END( );
+
+	unsigned int seed;
+
+	double random( )
+	{
+		seed = seed * 1103515245u + 12345u;
+		return( static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0 );
+	}
+
+	template < class Array >
+	void randomize( Array &a )
+	{
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			a[ i ] = random( );
+		}
+	}
+
+	static difference_type mirror( difference_type i, difference_type n )
+	{
+		if( n == 1 )
+		{
+			return( 0 );
+		}
+
+		// 摜ł͕܂Ԃ
+		while( i < 0 || i >= n )
+		{
+			i = i < 0 ? -i : 2 * n - 2 - i;
+		}
+		return( i );
+	}
+
+	// 񍀌W [ 1 4 6 4 1 ] / 16 3̏dݕtaCE1fvZ
+	static void reduce( const volume_type &in, volume_type &out )
+	{
+		const double w[ 5 ] = { 1.0 / 16.0, 4.0 / 16.0, 6.0 / 16.0, 4.0 / 16.0, 1.0 / 16.0 };
+		const difference_type iw = in.width( ), ih = in.height( ), id = in.depth( );
+
+		out.resize( ( in.width( ) + 1 ) / 2, ( in.height( ) + 1 ) / 2, ( in.depth( ) + 1 ) / 2 );
+		for( difference_type k = 0 ; k < static_cast< difference_type >( out.depth( ) ) ; k++ )
+		{
+			for( difference_type j = 0 ; j < static_cast< difference_type >( out.height( ) ) ; j++ )
+			{
+				for( difference_type i = 0 ; i < static_cast< difference_type >( out.width( ) ) ; i++ )
+				{
+					double v = 0.0;
+					for( difference_type c = -2 ; c <= 2 ; c++ )
+					{
+						for( difference_type b = -2 ; b <= 2 ; b++ )
+						{
+							for( difference_type a = -2 ; a <= 2 ; a++ )
+							{
+								v += w[ a + 2 ] * w[ b + 2 ] * w[ c + 2 ] * in( mirror( 2 * i + a, iw ), mirror( 2 * j + b, ih ), mirror( 2 * k + c, id ) );
+							}
+						}
+					}
+					out( i, j, k ) = v;
+				}
+			}
+		}
+	}
+
+	template < class Array >
+	static void assert_equal( const Array &a, const Array &b, double eps )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.width( ), b.width( ) );
+		CPPUNIT_ASSERTION_EQUAL( a.height( ), b.height( ) );
+		CPPUNIT_ASSERTION_EQUAL( a.depth( ), b.depth( ) );
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( a[ i ], b[ i ], eps );
+		}
+	}
+
+	// vVAs~bh̑eKw珇Ɋg債ĉZCłׂKw𕜌
+	template < class Pyramid, class Array >
+	static void reconstruct( const Pyramid &pyr, Array &out )
+	{
+		out = pyr.laplacian( pyr.size( ) - 1 );
+		for( size_type l = pyr.size( ) - 1 ; l > 0 ; l-- )
+		{
+			const Array &band = pyr.laplacian( l - 1 );
+			Array tmp;
+			pyr.expand( out, tmp, band.width( ), band.height( ), band.depth( ) );
+			out.resize( band.width( ), band.height( ), band.depth( ) );
+			for( size_type i = 0 ; i < out.size( ) ; i++ )
+			{
+				out[ i ] = band[ i ] + tmp[ i ];
+			}
+		}
+	}
+
+public:
+	TestPyramid( ) : seed( 12345 )
+	{
+	}
+
+	void LevelSize2( )
+	{
+		image_type in( 37, 20, 0.5, 2.0 );
+		mist::image_pyramid< image_type > pyr( in );
+
+		// ł1fɂȂ܂ŁCe̗vf͒[؂グĔɂȂCfԊu2{ɂȂ
+		const size_type width[] = { 37, 19, 10, 5, 3, 2 };
+		const size_type height[] = { 20, 10, 5, 3, 2, 1 };
+		CPPUNIT_ASSERTION_EQUAL( pyr.size( ), static_cast< size_type >( 6 ) );
+		for( size_type l = 0 ; l < pyr.size( ) ; l++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( pyr[ l ].width( ), width[ l ] );
+			CPPUNIT_ASSERTION_EQUAL( pyr[ l ].height( ), height[ l ] );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( pyr[ l ].reso1( ), 0.5 * ( 1 << l ), 1.0e-12 );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( pyr[ l ].reso2( ), 2.0 * ( 1 << l ), 1.0e-12 );
+		}
+
+		// Kww肵ꍇ
+		mist::image_pyramid< image_type > pyr3( in, 3 );
+		CPPUNIT_ASSERTION_EQUAL( pyr3.size( ), static_cast< size_type >( 3 ) );
+		CPPUNIT_ASSERTION_EQUAL( pyr3[ 2 ].width( ), static_cast< size_type >( 10 ) );
+	}
+
+	void LevelSize3( )
+	{
+		// vf1̎͏kCfԊuςȂ
+		volume_type in( 9, 6, 1, 1.0, 1.5, 3.0 );
+		mist::image_pyramid< volume_type > pyr( in );
+
+		CPPUNIT_ASSERTION_EQUAL( pyr.size( ), static_cast< size_type >( 4 ) );
+		for( size_type l = 0 ; l < pyr.size( ) ; l++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( pyr[ l ].depth( ), static_cast< size_type >( 1 ) );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( pyr[ l ].reso3( ), 3.0, 1.0e-12 );
+		}
+
+		// 9 -> 5 -> 3 -> 2C6 -> 3 -> 2 -> 1
+		CPPUNIT_ASSERTION_EQUAL( pyr[ 3 ].width( ), static_cast< size_type >( 2 ) );
+		CPPUNIT_ASSERTION_EQUAL( pyr[ 3 ].height( ), static_cast< size_type >( 1 ) );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( pyr[ 3 ].reso1( ), 8.0, 1.0e-12 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( pyr[ 3 ].reso2( ), 12.0, 1.0e-12 );
+	}
+
+	void Reduce2( )
+	{
+		image_type in( 23, 14 );
+		randomize( in );
+
+		mist::image_pyramid< image_type > pyr( in );
+
+		volume_type ref( in.width( ), in.height( ), 1 ), tmp;
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			ref[ i ] = in[ i ];
+		}
+
+		for( size_type l = 1 ; l < pyr.size( ) ; l++ )
+		{
+			reduce( ref, tmp );
+			ref.swap( tmp );
+
+			const image_type &g = pyr[ l ];
+			CPPUNIT_ASSERTION_EQUAL( g.width( ), ref.width( ) );
+			CPPUNIT_ASSERTION_EQUAL( g.height( ), ref.height( ) );
+			for( size_type i = 0 ; i < g.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_DOUBLES_EQUAL( g[ i ], ref[ i ], 1.0e-12 );
+			}
+		}
+	}
+
+	void Reduce3( )
+	{
+		volume_type in( 13, 10, 7 ), ref, tmp;
+		randomize( in );
+		ref = in;
+
+		mist::image_pyramid< volume_type > pyr( in, 0, 3 );
+		for( size_type l = 1 ; l < pyr.size( ) ; l++ )
+		{
+			reduce( ref, tmp );
+			ref.swap( tmp );
+			assert_equal( pyr[ l ], ref, 1.0e-12 );
+		}
+	}
+
+	void Reconstruct2( )
+	{
+		// ^̉摜CvVAs~bhۂߌ덷͈̔͂ŕł
+		mist::array2< unsigned char > in( 45, 31 );
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			in[ i ] = static_cast< unsigned char >( ( random( ) + 1.0 ) * 127.5 );
+		}
+
+		mist::image_pyramid< mist::array2< unsigned char > > pyr( in );
+		image_type out;
+		reconstruct( pyr, out );
+
+		CPPUNIT_ASSERTION_EQUAL( out.width( ), in.width( ) );
+		CPPUNIT_ASSERTION_EQUAL( out.height( ), in.height( ) );
+		for( size_type i = 0 ; i < out.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( out[ i ], static_cast< double >( in[ i ] ), 1.0e-10 );
+		}
+	}
+
+	void Reconstruct3( )
+	{
+		volume_type in( 17, 12, 9 ), out;
+		randomize( in );
+
+		mist::image_pyramid< volume_type > pyr( in );
+		reconstruct( pyr, out );
+		assert_equal( out, in, 1.0e-12 );
+	}
+
+	void BuildAll( )
+	{
+		// ɑSĂ̊Kw쐬ĂCQƎɍ쐬ꍇƓʂɂȂ
+		volume_type in( 21, 16, 11 );
+		randomize( in );
+
+		mist::image_pyramid< volume_type > lazy( in, 0, 1 ), all( in, 0, 4 );
+		all.build_all( );
+
+		for( size_type l = 0 ; l < lazy.size( ) ; l++ )
+		{
+			assert_equal( all.level( l ), lazy.level( l ), 0.0 );
+			assert_equal( all.laplacian( l ), lazy.laplacian( l ), 0.0 );
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestPyramid );
@@ -42,6 +42,8 @@ private:
 	CPPUNIT_TEST( PaintedRegion1 );
 	CPPUNIT_TEST( PaintedRegion2 );
 	CPPUNIT_TEST( PaintedRegion3 );
+	CPPUNIT_TEST( ParallelPaintedRegion1 );
+	CPPUNIT_TEST( ParallelPaintedRegion2 );
 	CPPUNIT_TEST_SUITE_END( );
 
 	image_type image;
@@ -146,6 +148,71 @@ protected:
 		CPPUNIT_ASSERTION_EQUAL( count[ 2 ], ( difference_type )30 );
 		CPPUNIT_ASSERTION_EQUAL( num, 30 );
 	}
+
+	void ParallelPaintedRegion1( )
+	{
+		image_type tmp;
+
+		typedef mist::vector2< difference_type >					point_type;     // ̈g̊Jn_w肷^imist::vector2  mist::vector3 őpj
+		typedef mist::region_growing_utility::pixel					component_type; // ̈gɗp\vf
+		typedef mist::region_growing_utility::equal< value_type >	condition_type; // ̈ĝ̊g
+
+		std::vector< point_type > points;
+		points.push_back( point_type( 5, 5 ) );
+		points.push_back( point_type( 2, 7 ) );
+		points.push_back( point_type( 0, 0 ) );
+
+		difference_type num = mist::parallel::region_growing(
+											image,					// ͉摜
+											tmp,					// ̈gsʂi[摜	
+											points,					// gJn_̃Xg
+											2,						// ̈ǧʂɑl
+											component_type( ),		// ̈gɗp\vfifj
+											condition_type( 1 ),	// ̈ĝ̊giCȏC͈͂Ȃǁj
+											3						// gpXbh
+										);
+
+		difference_type count[ 3 ] = { 0, 0, 0 };
+		for( size_type i = 0 ; i < tmp.size( ) ; i++ )
+		{
+			count[ tmp[ i ] ]++;
+		}
+
+		CPPUNIT_ASSERTION_EQUAL( count[ 0 ], ( difference_type )36 );
+		CPPUNIT_ASSERTION_EQUAL( count[ 1 ], ( difference_type )0  );
+		CPPUNIT_ASSERTION_EQUAL( count[ 2 ], ( difference_type )64 );
+		CPPUNIT_ASSERTION_EQUAL( num, count[ 2 ] );
+	}
+
+	void ParallelPaintedRegion2( )
+	{
+		image_type tmp;
+
+		typedef mist::vector2< difference_type >					point_type;     // ̈g̊Jn_w肷^imist::vector2  mist::vector3 őpj
+		typedef mist::region_growing_utility::circle				component_type; // ̈gɗp\vf
+		typedef mist::region_growing_utility::equal< value_type >	condition_type; // ̈ĝ̊g
+
+		difference_type num = mist::parallel::region_growing(
+											image,					// ͉摜
+											tmp,					// ̈gsʂi[摜	
+											point_type( 5, 5 ),		// gJn_iXgɂ邱Ƃŕw\j
+											2,						// ̈ǧʂɑl
+											component_type( 2 ),	// ̈gɗp\vfi~j
+											condition_type( 1 ),	// ̈ĝ̊giCȏC͈͂Ȃǁj
+											2						// gpXbh
+										);
+
+		difference_type count[ 3 ] = { 0, 0, 0 };
+		for( size_type i = 0 ; i < tmp.size( ) ; i++ )
+		{
+			count[ tmp[ i ] ]++;
+		}
+
+		CPPUNIT_ASSERTION_EQUAL( count[ 0 ], ( difference_type )48 );
+		CPPUNIT_ASSERTION_EQUAL( count[ 1 ], ( difference_type )0  );
+		CPPUNIT_ASSERTION_EQUAL( count[ 2 ], ( difference_type )52 );
+		CPPUNIT_ASSERTION_EQUAL( num, count[ 2 ] );
+	}
 };
 
 
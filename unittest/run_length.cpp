@@ -0,0 +1,258 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include "macros.h"
+#include <mist/filter/labeling.h>
+#include <mist/filter/boundary.h>
+#include <mist/filter/run_length.h>
+
+class TestRunLength : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array3< unsigned char >	image_type;
+	typedef image_type::size_type			size_type;
+
+	CPPUNIT_TEST_SUITE( TestRunLength );
+	CPPUNIT_TEST( Convert );
+	CPPUNIT_TEST( Labeling );
+	CPPUNIT_TEST( Boundary );
+	CPPUNIT_TEST( BoundaryIsBorder );
+	CPPUNIT_TEST( Boundary2 );
+	CPPUNIT_TEST( Boundary3 );
+	CPPUNIT_TEST_SUITE_END( );
+
+	image_type image;
+	mist::run_length_mask mask;
+
+public:
+	TestRunLength( ) : image( 27, 21, 19 )
+	{
+		for( size_type i = 0 ; i < image.size( ) ; i++ )
+		{
+			image[ i ] = ( i * 2654435761u ) % 97 < 60 ? 1 : 0;
+		}
+		mist::convert( image, mask );
+	}
+
+protected:
+	void Convert( )
+	{
+		image_type out;
+		mist::convert( mask, out );
+
+		size_type count = 0;
+		for( size_type i = 0 ; i < image.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( out[ i ], image[ i ] );
+			count += image[ i ];
+		}
+		CPPUNIT_ASSERTION_EQUAL( mask.count( ), count );
+		CPPUNIT_ASSERTION( mask.is_complete( ) );
+	}
+
+	void Labeling( )
+	{
+		mist::array3< int > ref, out;
+		std::vector< size_type > label;
+
+		size_type nr = mist::labeling6( image, ref );
+		size_type no = mist::run_length::labeling6( mask, label );
+		mist::run_length::convert( mask, label, out );
+		CPPUNIT_ASSERTION_EQUAL( no, nr );
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( out[ i ], ref[ i ] );
+		}
+
+		nr = mist::labeling26( image, ref );
+		no = mist::run_length::labeling26( mask, label );
+		mist::run_length::convert( mask, label, out );
+		CPPUNIT_ASSERTION_EQUAL( no, nr );
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( out[ i ], ref[ i ] );
+		}
+	}
+
+	void Boundary( )
+	{
+		image_type ref( image ), out;
+		mist::boundary18( ref, 1, 0, false );
+
+		mist::run_length_mask bmask;
+		size_type num = mist::run_length::boundary18( mask, bmask, false );
+		mist::convert( bmask, out );
+
+		size_type count = 0;
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( out[ i ], ref[ i ] );
+			count += ref[ i ];
+		}
+		CPPUNIT_ASSERTION_EQUAL( num, count );
+	}
+
+	void BoundaryIsBorder( )
+	{
+		// 摜̊OwiƂ݂Ȃʂ́C0 Ŋg摜̋Efƈv
+		image_type ref( image.width( ) + 2, image.height( ) + 2, image.depth( ) + 2 ), out;
+		for( size_type k = 0 ; k < image.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < image.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < image.width( ) ; i++ )
+				{
+					ref( i + 1, j + 1, k + 1 ) = image( i, j, k );
+				}
+			}
+		}
+		mist::boundary6( ref, 1, 0, false );
+
+		mist::run_length_mask bmask;
+		size_type num = mist::run_length::boundary6( mask, bmask );
+		mist::convert( bmask, out );
+
+		size_type count = 0;
+		for( size_type k = 0 ; k < out.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < out.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < out.width( ) ; i++ )
+				{
+					CPPUNIT_ASSERTION_EQUAL( out( i, j, k ), ref( i + 1, j + 1, k + 1 ) );
+					count += out( i, j, k );
+				}
+			}
+		}
+		CPPUNIT_ASSERTION_EQUAL( num, count );
+		CPPUNIT_ASSERTION_EQUAL( mist::run_length::boundary6( mask, bmask, true ), num );
+		CPPUNIT_ASSERTION( mist::run_length::boundary6( mask, bmask, false ) < num );
+	}
+
+	void Boundary2( )
+	{
+		mist::array2< unsigned char > img( 23, 17 );
+		for( size_type i = 0 ; i < img.size( ) ; i++ )
+		{
+			img[ i ] = ( i * 2654435761u ) % 97 < 70 ? 1 : 0;
+		}
+
+		mist::array2< unsigned char > solid( 23, 17 );
+		solid.fill( 1 );
+
+		for( int b = 0 ; b < 2 ; b++ )
+		{
+			check_boundary2( img, b != 0 );
+			CPPUNIT_ASSERTION_EQUAL( check_boundary2( solid, b != 0 ) > 0, b != 0 );
+		}
+	}
+
+	void Boundary3( )
+	{
+		image_type solid( 13, 11, 9 );
+		solid.fill( 1 );
+
+		for( int b = 0 ; b < 2 ; b++ )
+		{
+			check_boundary3( image, b != 0 );
+			CPPUNIT_ASSERTION_EQUAL( check_boundary3( solid, b != 0 ) > 0, b != 0 );
+		}
+	}
+
+	size_type check_boundary2( const mist::array2< unsigned char > &img, bool boundary_is_border )
+	{
+		mist::run_length_mask m, bmask;
+		mist::convert( img, m );
+
+		mist::array2< unsigned char > ref( img ), out;
+		size_type num = mist::run_length::boundary4( m, bmask, boundary_is_border );
+		mist::convert( bmask, out );
+		mist::boundary4( ref, 1, 0, boundary_is_border );
+		size_type diff = compare_boundary( ref, out, num, boundary_is_border );
+
+		ref = img;
+		num = mist::run_length::boundary8( m, bmask, boundary_is_border );
+		mist::convert( bmask, out );
+		mist::boundary8( ref, 1, 0, boundary_is_border );
+		return( diff + compare_boundary( ref, out, num, boundary_is_border ) );
+	}
+
+	size_type check_boundary3( const image_type &img, bool boundary_is_border )
+	{
+		mist::run_length_mask m, bmask;
+		mist::convert( img, m );
+
+		image_type ref( img ), out;
+		size_type num = mist::run_length::boundary6( m, bmask, boundary_is_border );
+		mist::convert( bmask, out );
+		mist::boundary6( ref, 1, 0, boundary_is_border );
+		size_type diff = compare_boundary( ref, out, num, boundary_is_border );
+
+		ref = img;
+		num = mist::run_length::boundary18( m, bmask, boundary_is_border );
+		mist::convert( bmask, out );
+		mist::boundary18( ref, 1, 0, boundary_is_border );
+		diff += compare_boundary( ref, out, num, boundary_is_border );
+
+		ref = img;
+		num = mist::run_length::boundary26( m, bmask, boundary_is_border );
+		mist::convert( bmask, out );
+		mist::boundary26( ref, 1, 0, boundary_is_border );
+		return( diff + compare_boundary( ref, out, num, boundary_is_border ) );
+	}
+
+	// boundary_is_border = false ł mist::boundary ƈvCtrue ł mist::boundary EƂ
+	// e̐擪2fځiW 1j̉f݂̂قȂ
+	template < class Array >
+	size_type compare_boundary( const Array &ref, const Array &out, size_type num, bool boundary_is_border )
+	{
+		const size_type w = ref.width( );
+		const size_type h = ref.height( );
+
+		size_type count = 0, diff = 0;
+		for( size_type i = 0 ; i < ref.size( ) ; i++ )
+		{
+			count += out[ i ];
+			if( out[ i ] != ref[ i ] )
+			{
+				size_type x = i % w, y = ( i / w ) % h, z = i / ( w * h );
+				CPPUNIT_ASSERTION( boundary_is_border );
+				CPPUNIT_ASSERTION( out[ i ] == 0 && ref[ i ] == 1 );
+				CPPUNIT_ASSERTION( x == 1 || y == 1 || ( ref.size( ) > w * h && z == 1 ) );
+				diff++;
+			}
+		}
+		CPPUNIT_ASSERTION_EQUAL( num, count );
+
+		return( diff );
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestRunLength );
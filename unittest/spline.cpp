@@ -0,0 +1,225 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/interpolate.h>
+
+class TestSpline : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array2< double >	image_type;
+	typedef mist::array3< double >	volume_type;
+	typedef image_type::size_type	size_type;
+
+	CPPUNIT_TEST_SUITE( TestSpline );
+	CPPUNIT_TEST( GridPoints2 );
+	CPPUNIT_TEST( GridPoints3 );
+	CPPUNIT_TEST( Gradient2 );
+	CPPUNIT_TEST( Gradient3 );
+	CPPUNIT_TEST( InPlace );
+	CPPUNIT_TEST( Threads );
+	CPPUNIT_TEST_SUITE_END( );
+
+	unsigned int seed;
+
+	double random( )
+	{
+		seed = seed * 1103515245u + 12345u;
+		return( static_cast< double >( ( seed >> 8 ) % 2001 ) / 1000.0 - 1.0 );
+	}
+
+	template < class Array >
+	void randomize( Array &a )
+	{
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			a[ i ] = random( );
+		}
+	}
+
+	// fԊu 0 ` 1 ̈l
+	double position( size_type n )
+	{
+		return( ( random( ) + 1.0 ) * 0.5 * ( n - 1 ) );
+	}
+
+public:
+	TestSpline( ) : seed( 12345 )
+	{
+	}
+
+	void GridPoints2( )
+	{
+		// 傫12̎܂߂āCiq_Ō̉flČ
+		const size_type sizes[][ 2 ] = { { 17, 13 }, { 1, 9 }, { 2, 5 }, { 64, 3 } };
+		for( size_type n = 0 ; n < sizeof( sizes ) / sizeof( sizes[ 0 ] ) ; n++ )
+		{
+			image_type in( sizes[ n ][ 0 ], sizes[ n ][ 1 ] );
+			randomize( in );
+
+			mist::BSpline::spline< 2 > s( in );
+			for( size_type j = 0 ; j < in.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < in.width( ) ; i++ )
+				{
+					CPPUNIT_ASSERTION_DOUBLES_EQUAL( s( i, j ), in( i, j ), 1.0e-13 );
+				}
+			}
+		}
+	}
+
+	void GridPoints3( )
+	{
+		const size_type sizes[][ 3 ] = { { 11, 7, 5 }, { 20, 3, 1 }, { 2, 9, 6 } };
+		for( size_type n = 0 ; n < sizeof( sizes ) / sizeof( sizes[ 0 ] ) ; n++ )
+		{
+			volume_type in( sizes[ n ][ 0 ], sizes[ n ][ 1 ], sizes[ n ][ 2 ] );
+			randomize( in );
+
+			mist::BSpline::spline< 3 > s( in );
+			for( size_type k = 0 ; k < in.depth( ) ; k++ )
+			{
+				for( size_type j = 0 ; j < in.height( ) ; j++ )
+				{
+					for( size_type i = 0 ; i < in.width( ) ; i++ )
+					{
+						CPPUNIT_ASSERTION_DOUBLES_EQUAL( s( i, j, k ), in( i, j, k ), 1.0e-13 );
+					}
+				}
+			}
+		}
+
+		// ^̓͂łlɂȂ
+		mist::array3< short > in( 6, 5, 4 );
+		for( size_type i = 0 ; i < in.size( ) ; i++ )
+		{
+			in[ i ] = static_cast< short >( random( ) * 1000.0 );
+		}
+
+		mist::BSpline::spline< 3 > s( in );
+		for( size_type k = 0 ; k < in.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < in.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < in.width( ) ; i++ )
+				{
+					CPPUNIT_ASSERTION_DOUBLES_EQUAL( s( i, j, k ), static_cast< double >( in( i, j, k ) ), 1.0e-10 );
+				}
+			}
+		}
+	}
+
+	void Gradient2( )
+	{
+		image_type in( 23, 17 );
+		randomize( in );
+
+		mist::BSpline::spline< 2 > s( in );
+		const double h = 1.0e-5;
+		for( size_type n = 0 ; n < 200 ; n++ )
+		{
+			double x = position( in.width( ) ), y = position( in.height( ) );
+
+			mist::vector2< double > g;
+			double v = s( x, y, g );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( v, s( x, y ), 1.0e-13 );
+
+			// SƔr
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( g.x, ( s( x + h, y ) - s( x - h, y ) ) / ( 2.0 * h ), 1.0e-6 );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( g.y, ( s( x, y + h ) - s( x, y - h ) ) / ( 2.0 * h ), 1.0e-6 );
+		}
+	}
+
+	void Gradient3( )
+	{
+		volume_type in( 13, 11, 9 );
+		randomize( in );
+
+		mist::BSpline::spline< 3 > s( in );
+		const double h = 1.0e-5;
+		for( size_type n = 0 ; n < 200 ; n++ )
+		{
+			double x = position( in.width( ) ), y = position( in.height( ) ), z = position( in.depth( ) );
+
+			mist::vector3< double > g;
+			double v = s( x, y, z, g );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( v, s( x, y, z ), 1.0e-13 );
+
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( g.x, ( s( x + h, y, z ) - s( x - h, y, z ) ) / ( 2.0 * h ), 1.0e-6 );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( g.y, ( s( x, y + h, z ) - s( x, y - h, z ) ) / ( 2.0 * h ), 1.0e-6 );
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( g.z, ( s( x, y, z + h ) - s( x, y, z - h ) ) / ( 2.0 * h ), 1.0e-6 );
+		}
+	}
+
+	void InPlace( )
+	{
+		// prefilter( c, c ) ͕ʂ̔z֏o͂ꍇƓWɂȂ
+		image_type in2( 19, 14 ), out2, c2;
+		randomize( in2 );
+		c2 = in2;
+		CPPUNIT_ASSERTION( mist::BSpline::prefilter( in2, out2 ) );
+		CPPUNIT_ASSERTION( mist::BSpline::prefilter( c2, c2 ) );
+		CPPUNIT_ASSERTION_EQUAL( c2.size( ), out2.size( ) );
+		for( size_type i = 0 ; i < c2.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( c2[ i ], out2[ i ], 0.0 );
+		}
+
+		volume_type in3( 9, 8, 7 ), out3, c3;
+		randomize( in3 );
+		c3 = in3;
+		CPPUNIT_ASSERTION( mist::BSpline::prefilter( in3, out3 ) );
+		CPPUNIT_ASSERTION( mist::BSpline::prefilter( c3, c3 ) );
+		CPPUNIT_ASSERTION_EQUAL( c3.size( ), out3.size( ) );
+		for( size_type i = 0 ; i < c3.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( c3[ i ], out3[ i ], 0.0 );
+		}
+
+		// ͎̓͂s
+		volume_type empty;
+		CPPUNIT_ASSERTION( !mist::BSpline::prefilter( empty, out3 ) );
+	}
+
+	void Threads( )
+	{
+		volume_type in( 21, 18, 15 ), c1, c4;
+		randomize( in );
+		CPPUNIT_ASSERTION( mist::BSpline::prefilter( in, c1, 1 ) );
+		CPPUNIT_ASSERTION( mist::BSpline::prefilter( in, c4, 4 ) );
+		for( size_type i = 0 ; i < c1.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_DOUBLES_EQUAL( c4[ i ], c1[ i ], 0.0 );
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestSpline );
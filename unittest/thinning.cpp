@@ -0,0 +1,182 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/filter/thinning.h>
+
+class TestThinning : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array3< unsigned char >	image_type;
+	typedef mist::array3< unsigned short >	skeleton_type;
+	typedef image_type::size_type			size_type;
+
+	CPPUNIT_TEST_SUITE( TestThinning );
+	CPPUNIT_TEST( Bar );
+	CPPUNIT_TEST( Thinning6 );
+	CPPUNIT_TEST( Thinning26 );
+	CPPUNIT_TEST_SUITE_END( );
+
+	// אʂ̉fƁCfԍ̘a
+	static void summary( const skeleton_type &out, size_type &count, size_type &sum )
+	{
+		count = sum = 0;
+		for( size_type i = 0 ; i < out.size( ) ; i++ )
+		{
+			if( out[ i ] != 0 )
+			{
+				count++;
+				sum += i;
+			}
+		}
+	}
+
+	// אʂ͓͐}`Ɋ܂܂
+	void assert_inside( const skeleton_type &out )
+	{
+		CPPUNIT_ASSERTION_EQUAL( out.size( ), image.size( ) );
+		for( size_type i = 0 ; i < out.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION( out[ i ] == 0 || image[ i ] != 0 );
+		}
+	}
+
+	image_type image;
+
+public:
+	TestThinning( ) : image( 64, 60, 56 )
+	{
+		// g[XƊpgݍ킹}`
+		for( size_type k = 0 ; k < image.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < image.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < image.width( ) ; i++ )
+				{
+					double x = i - 31.5, y = j - 29.5, z = k - 27.5;
+					double r = std::sqrt( x * x + y * y ) - 18.0;
+					bool torus = r * r + z * z < 49.0;
+					bool bar = std::abs( x - 4.0 ) < 5.0 && std::abs( y ) < 4.0 && std::abs( z ) < 20.0;
+					image( i, j, k ) = torus || bar ? 1 : 0;
+				}
+			}
+		}
+	}
+
+protected:
+	void Bar( )
+	{
+		// p̍אʂ͒S̐ɂȂ
+		image_type bar( 11, 11, 31 );
+		for( size_type k = 3 ; k < 28 ; k++ )
+		{
+			for( size_type j = 3 ; j < 8 ; j++ )
+			{
+				for( size_type i = 3 ; i < 8 ; i++ )
+				{
+					bar( i, j, k ) = 1;
+				}
+			}
+		}
+
+		skeleton_type expected( bar.width( ), bar.height( ), bar.depth( ) );
+		for( size_type k = 5 ; k <= 26 ; k++ )
+		{
+			expected( 5, 5, k ) = 1;
+		}
+
+		for( size_type thread_num = 1 ; thread_num <= 4 ; thread_num += 3 )
+		{
+			skeleton_type out6, out26;
+			mist::euclidean::thinning6( bar, out6, thread_num );
+			mist::euclidean::thinning26( bar, out26, thread_num );
+			for( size_type i = 0 ; i < expected.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_EQUAL( out6[ i ], expected[ i ] );
+				CPPUNIT_ASSERTION_EQUAL( out26[ i ], expected[ i ] );
+			}
+		}
+	}
+
+	void Thinning6( )
+	{
+		// 1Xbhł̓X^ɏC]ƓʂɂȂ
+		skeleton_type ref, out;
+		size_type count, sum;
+		mist::euclidean::thinning6( image, ref );
+		summary( ref, count, sum );
+		CPPUNIT_ASSERTION_EQUAL( count, static_cast< size_type >( 142 ) );
+		CPPUNIT_ASSERTION_EQUAL( sum, static_cast< size_type >( 15655681 ) );
+
+		// 2Xbhȏł̓TutB[hɏCXbhɂ炸ʂɂȂ
+		mist::euclidean::thinning6( image, ref, 2 );
+		summary( ref, count, sum );
+		CPPUNIT_ASSERTION_EQUAL( count, static_cast< size_type >( 170 ) );
+		CPPUNIT_ASSERTION_EQUAL( sum, static_cast< size_type >( 18661460 ) );
+		assert_inside( ref );
+
+		for( size_type thread_num = 3 ; thread_num <= 4 ; thread_num++ )
+		{
+			mist::euclidean::thinning6( image, out, thread_num );
+			for( size_type i = 0 ; i < ref.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_EQUAL( out[ i ], ref[ i ] );
+			}
+		}
+	}
+
+	void Thinning26( )
+	{
+		skeleton_type ref, out;
+		size_type count, sum;
+		mist::euclidean::thinning26( image, ref );
+		summary( ref, count, sum );
+		CPPUNIT_ASSERTION_EQUAL( count, static_cast< size_type >( 102 ) );
+		CPPUNIT_ASSERTION_EQUAL( sum, static_cast< size_type >( 11278101 ) );
+
+		mist::euclidean::thinning26( image, ref, 2 );
+		summary( ref, count, sum );
+		CPPUNIT_ASSERTION_EQUAL( count, static_cast< size_type >( 130 ) );
+		CPPUNIT_ASSERTION_EQUAL( sum, static_cast< size_type >( 14283754 ) );
+		assert_inside( ref );
+
+		for( size_type thread_num = 3 ; thread_num <= 4 ; thread_num++ )
+		{
+			mist::euclidean::thinning26( image, out, thread_num );
+			for( size_type i = 0 ; i < ref.size( ) ; i++ )
+			{
+				CPPUNIT_ASSERTION_EQUAL( out[ i ], ref[ i ] );
+			}
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestThinning );
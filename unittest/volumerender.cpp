@@ -0,0 +1,203 @@
+// 
+// Copyright (c) 2003-2010, MIST Project, Nagoya University
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+// 
+// 3. Neither the name of the Nagoya University nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+// FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+// IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+
+#include <iostream>
+#include <cmath>
+#include "macros.h"
+#include <mist/volumerender.h>
+
+class TestVolumeRender : public CPPUNIT_NS::TestCase
+{
+private:
+	typedef mist::array3< short >								volume_type;
+	typedef mist::array2< mist::rgb< unsigned char > >			image_type;
+	typedef mist::volumerender::attribute_table< mist::rgb< double > >	table_type;
+	typedef volume_type::size_type								size_type;
+
+	CPPUNIT_TEST_SUITE( TestVolumeRender );
+	CPPUNIT_TEST( MacrocellSkip );
+	CPPUNIT_TEST( MacrocellRender );
+	CPPUNIT_TEST( Threads );
+	CPPUNIT_TEST_SUITE_END( );
+
+	volume_type ct;
+	mist::volumerender::parameter param;
+	table_type table1;
+	table_type table2;
+
+	static void assert_same( const image_type &a, const image_type &b )
+	{
+		CPPUNIT_ASSERTION_EQUAL( a.size( ), b.size( ) );
+		for( size_type i = 0 ; i < a.size( ) ; i++ )
+		{
+			CPPUNIT_ASSERTION_EQUAL( a[ i ].r, b[ i ].r );
+			CPPUNIT_ASSERTION_EQUAL( a[ i ].g, b[ i ].g );
+			CPPUNIT_ASSERTION_EQUAL( a[ i ].b, b[ i ].b );
+		}
+	}
+
+	// }NZœǂݔ΂ꍇƁCǂݔ΂Ȃꍇ̕`挋ʂv
+	void check_render( const mist::volumerender::macrocell_map &mmap, const table_type &table )
+	{
+		for( int interpolation = 0 ; interpolation < 2 ; interpolation++ )
+		{
+			param.value_interpolation = interpolation == 1;
+
+			image_type a( 61, 47 ), b( 61, 47 );
+			CPPUNIT_ASSERTION( mist::volumerendering( ct, a, mist::volumerender::no_depth_map( ), param, table, 2 ) );
+			CPPUNIT_ASSERTION( mist::volumerendering( ct, b, mmap, param, table, 2 ) );
+			assert_same( b, a );
+		}
+	}
+
+public:
+	TestVolumeRender( ) : ct( 48, 48, 48 )
+	{
+		// C̒ɁC͗l̂鋅iOk͍ljƏȍPx̋u
+		for( size_type k = 0 ; k < ct.depth( ) ; k++ )
+		{
+			for( size_type j = 0 ; j < ct.height( ) ; j++ )
+			{
+				for( size_type i = 0 ; i < ct.width( ) ; i++ )
+				{
+					double r1 = std::sqrt( ( i - 18.0 ) * ( i - 18.0 ) + ( j - 24.0 ) * ( j - 24.0 ) + ( k - 24.0 ) * ( k - 24.0 ) );
+					double r2 = std::sqrt( ( i - 36.0 ) * ( i - 36.0 ) + ( j - 20.0 ) * ( j - 20.0 ) + ( k - 28.0 ) * ( k - 28.0 ) );
+					short v = 0;
+					if( r1 < 12.0 )
+					{
+						v = static_cast< short >( r1 > 10.5 ? 1300 : 1040 + ( i % 7 ) * 5 );
+					}
+					else if( r2 < 6.0 )
+					{
+						v = 1600;
+					}
+					ct( i, j, k ) = v;
+				}
+			}
+		}
+
+		param.offset = mist::vector3< double >( ( ct.width( ) - 1 ) / 2.0, ( ct.height( ) - 1 ) / 2.0, ( ct.depth( ) - 1 ) / 2.0 );
+
+		typedef mist::volumerender::boundingbox boundingbox;
+		param.box[ 0 ] = boundingbox(  0,  0,  1, param.offset.z - 1 );
+		param.box[ 1 ] = boundingbox(  1,  0,  0, param.offset.x - 1 );
+		param.box[ 2 ] = boundingbox(  0,  0, -1, param.offset.z - 1 );
+		param.box[ 3 ] = boundingbox( -1,  0,  0, param.offset.x - 1 );
+		param.box[ 4 ] = boundingbox(  0, -1,  0, param.offset.y - 1 );
+		param.box[ 5 ] = boundingbox(  0,  1,  0, param.offset.y - 1 );
+
+		param.pos = mist::vector3< double >( 36.0, 14.0, -30.0 );
+		param.dir = ( param.offset - param.pos ).unit( );
+		param.up  = mist::vector3< double >( 0, -1, 0 );
+		param.up  = ( param.up - param.dir * param.up.inner( param.dir ) ).unit( );
+		param.specular = 0.8;
+		param.fovy = 30.0;
+
+		// gDƍ\vZbg
+		table1.create( 0, 2047 );
+		table1.append( mist::rgb< double >( 255, 128, 102 ), 1000, 1200, 0.2, 0.6 );
+		table1.append( mist::rgb< double >( 255, 255, 255 ), 1250, 2047, 1.0, 1.0 );
+
+		// Px݂̂̕\vZbg
+		table2.create( 0, 2047 );
+		table2.append( mist::rgb< double >( 255, 255, 255 ), 1500, 2047, 0.3, 1.0 );
+	}
+
+	void MacrocellSkip( )
+	{
+		mist::volumerender::macrocell_map mmap( ct );
+
+		// update ̑O͓ǂݔ΂Ȃ
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( mmap( 0, 0, 0 ), mist::volumerender::no_depth_map( )( 0, 0, 0 ), 0.0 );
+
+		// ̂痣ꂽC̗͓̈ǂݔ΂Csȕ̂̓ł͓ǂݔ΂Ȃ
+		mmap.update( table1 );
+		CPPUNIT_ASSERTION( mmap( 47, 47, 47 ) > 2.0 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( mmap( 8, 24, 24 ), 2.0, 0.0 );
+
+		// 2ڂ̃vZbgł͑傫ȋ̓ɂȂCǂݔ΂̈悪L
+		mmap.update( table2 );
+		CPPUNIT_ASSERTION( mmap( 8, 24, 24 ) > 2.0 );
+		CPPUNIT_ASSERTION_DOUBLES_EQUAL( mmap( 36, 20, 28 ), 2.0, 0.0 );
+	}
+
+	void MacrocellRender( )
+	{
+		// vZbgw肵č쐬}bv
+		mist::volumerender::macrocell_map mmap( ct, table1 );
+		check_render( mmap, table1 );
+
+		// 2ڂ̃vZbgɐ؂ւĂ`悷
+		mmap.update( table2 );
+		check_render( mmap, table2 );
+
+		// ̃vZbgɖ߂
+		mmap.update( table1 );
+		check_render( mmap, table1 );
+
+		// Z̑傫ςꍇ
+		mist::volumerender::macrocell_map small( ct, table2, 4 );
+		check_render( small, table2 );
+	}
+
+	void Threads( )
+	{
+		// 摜^Cɕĕ`悷邽߁C8̔{łȂ傫̉摜łXbhɂ炸ʂɂȂ
+		const size_type sizes[][ 2 ] = { { 61, 47 }, { 37, 83 }, { 5, 3 } };
+		mist::volumerender::macrocell_map mmap( ct, table1 );
+
+		for( size_type n = 0 ; n < sizeof( sizes ) / sizeof( sizes[ 0 ] ) ; n++ )
+		{
+			for( int interpolation = 0 ; interpolation < 2 ; interpolation++ )
+			{
+				param.value_interpolation = interpolation == 1;
+
+				image_type a( sizes[ n ][ 0 ], sizes[ n ][ 1 ] ), b( sizes[ n ][ 0 ], sizes[ n ][ 1 ] );
+				image_type c( sizes[ n ][ 0 ], sizes[ n ][ 1 ] ), d( sizes[ n ][ 0 ], sizes[ n ][ 1 ] );
+				CPPUNIT_ASSERTION( mist::volumerendering( ct, a, param, table1, 1 ) );
+				CPPUNIT_ASSERTION( mist::volumerendering( ct, c, mmap, param, table1, 1 ) );
+				CPPUNIT_ASSERTION( mist::specialized::volumerendering( ct, d, mmap, param, table1, 1 ) );
+
+				for( size_type thread_num = 2 ; thread_num <= 5 ; thread_num++ )
+				{
+					CPPUNIT_ASSERTION( mist::volumerendering( ct, b, param, table1, thread_num ) );
+					assert_same( b, a );
+
+					CPPUNIT_ASSERTION( mist::volumerendering( ct, b, mmap, param, table1, thread_num ) );
+					assert_same( b, c );
+
+					CPPUNIT_ASSERTION( mist::specialized::volumerendering( ct, b, mmap, param, table1, thread_num ) );
+					assert_same( b, d );
+				}
+			}
+		}
+	}
+};
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION( TestVolumeRender );